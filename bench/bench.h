@@ -0,0 +1,87 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include <common.h>
+#include <time.h>
+
+/* Keep the compiler from discarding a value that is only computed for benchmarking */
+#if defined(__GNUC__) || defined(__clang__)
+    #define X_BENCH_DO_NOT_OPTIMIZE(x) __asm__ volatile("" : : "g"(x) : "memory")
+#else
+    #define X_BENCH_DO_NOT_OPTIMIZE(x) ((void)(x))
+#endif
+
+/* Monotonic clock in seconds */
+static inline f64 xBenchNow(void) {
+    struct timespec ts;
+#if defined(_WIN32)
+    timespec_get(&ts, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return (f64)ts.tv_sec + (f64)ts.tv_nsec * 1e-9;
+}
+
+/*
+ * Deterministic xorshift32 stream shared by every suite, so generated scenes
+ * and workloads are identical across runs and harness passes. `state` must be
+ * seeded non-zero; suites reseed it at the start of each pass.
+ */
+static inline u32 xBenchRandom(u32* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/* Uniform in [0, 1) */
+static inline f32 xBenchRandomUnit(u32* state) {
+    return (f32)(xBenchRandom(state) >> 8) / (f32)(1u << 24);
+}
+
+/* Uniform in [lo, hi) */
+static inline f32 xBenchRandomRange(u32* state, f32 lo, f32 hi) {
+    return lo + (hi - lo) * xBenchRandomUnit(state);
+}
+
+/*
+ * Scratch directory for suites that generate files, relative to the working
+ * directory. Create succeeds if it already exists; remove expects the suite to
+ * have deleted its files first.
+ */
+bool xBenchTempDirCreate(const char* path);
+void xBenchTempDirRemove(const char* path);
+
+/*
+ * Record one timed sample of `iterations` iterations under `name`. The harness
+ * reruns whole suites for --warmup and --reps, so a name collects one sample
+ * per pass and is reported as median/p90 (plus TSC cycles on x86), written to
+ * --json and checked against --baseline. Names must be unique within a suite.
+ */
+void xBenchReport(const char* name, f64 seconds, u64 iterations);
+
+/* Individual benchmark suites */
+void xBenchArena(void);
+void xBenchPool(void);
+void xBenchCommands(void);
+void xBenchSwrast(void);
+void xBenchJobs(void);
+void xBenchMath(void);
+void xBenchEcs(void);
+void xBenchProfiler(void);
+void xBenchInput(void);
+void xBenchFrameLoop(void);
+void xBenchXpak(void);
+void xBenchStream(void);
+void xBenchSpatial(void);
+void xBenchCull(void);
+void xBenchContainers(void);
+void xBenchIntern(void);
+void xBenchMacros(void);
+void xBenchSprites(void);
+void xBenchParticles(void);
+void xBenchTransform(void);
+void xBenchLog(void);
@@ -0,0 +1,99 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <arena.h>
+
+#define FRAME_COUNT 240
+#define ALLOCS_PER_FRAME 20000
+#define MIN_ALLOC 16
+#define MAX_ALLOC 256
+
+/* Cheap deterministic size sequence so both allocators see identical workloads */
+static u32 nextSize(u32* state) {
+    return MIN_ALLOC + (xBenchRandom(state) % (MAX_ALLOC - MIN_ALLOC));
+}
+
+static void reportFrames(const char* name, f64 total, f64 worst) {
+    xBenchReport(name, total, (u64)FRAME_COUNT * ALLOCS_PER_FRAME);
+    printf("  %-40s %10.3f ms avg frame  %10.3f ms worst frame\n",
+           "",
+           X_SEC_TO_MS(total / FRAME_COUNT),
+           X_SEC_TO_MS(worst));
+}
+
+static void benchMalloc(void) {
+    void** ptrs  = X_MALLOC(void*, ALLOCS_PER_FRAME);
+    u32 state    = 0x9E3779B9u;
+    f64 total    = 0.0;
+    f64 worst    = 0.0;
+
+    for (u32 frame = 0; frame < FRAME_COUNT; ++frame) {
+        const f64 start = xBenchNow();
+        for (u32 i = 0; i < ALLOCS_PER_FRAME; ++i) {
+            const u32 size = nextSize(&state);
+            ptrs[i]        = malloc(size);
+            memset(ptrs[i], (int)i, size);
+        }
+        for (u32 i = 0; i < ALLOCS_PER_FRAME; ++i) {
+            free(ptrs[i]);
+        }
+        const f64 elapsed = xBenchNow() - start;
+        total += elapsed;
+        worst = X_MAX(worst, elapsed);
+    }
+
+    reportFrames("malloc/free per frame", total, worst);
+    X_FREE(ptrs);
+}
+
+static void benchFrameArena(void) {
+    xFrameArena frame_arena;
+    X_CHECK(xFrameArenaInit(&frame_arena, (size_t)ALLOCS_PER_FRAME * (MAX_ALLOC + X_ARENA_DEFAULT_ALIGN)));
+
+    u32 state = 0x9E3779B9u;
+    f64 total = 0.0;
+    f64 worst = 0.0;
+
+    for (u32 frame = 0; frame < FRAME_COUNT; ++frame) {
+        const f64 start = xBenchNow();
+        xFrameArenaSwap(&frame_arena);
+        xArena* arena = xFrameArenaCurrent(&frame_arena);
+        for (u32 i = 0; i < ALLOCS_PER_FRAME; ++i) {
+            const u32 size = nextSize(&state);
+            void* ptr      = xArenaAlloc(arena, size);
+            memset(ptr, (int)i, size);
+            X_BENCH_DO_NOT_OPTIMIZE(ptr);
+        }
+        const f64 elapsed = xBenchNow() - start;
+        total += elapsed;
+        worst = X_MAX(worst, elapsed);
+    }
+
+    reportFrames("frame arena (reset per frame)", total, worst);
+    xFrameArenaShutdown(&frame_arena);
+}
+
+static void benchMarkers(void) {
+    xArena arena;
+    X_CHECK(xArenaInit(&arena, 1024 * 1024));
+
+    const u64 iterations = 10000000;
+    const f64 start      = xBenchNow();
+    for (u64 i = 0; i < iterations; ++i) {
+        const xArenaMarker marker = xArenaSave(&arena);
+        void* ptr                 = xArenaAllocAligned(&arena, 64, 64);
+        X_BENCH_DO_NOT_OPTIMIZE(ptr);
+        xArenaRestore(&arena, marker);
+    }
+    xBenchReport("save/alloc(64, align 64)/restore", xBenchNow() - start, iterations);
+
+    xArenaShutdown(&arena);
+}
+
+void xBenchArena(void) {
+    benchMalloc();
+    benchFrameArena();
+    benchMarkers();
+}
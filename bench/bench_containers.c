@@ -0,0 +1,323 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <containers.h>
+
+#include <stdio.h>
+
+#define PUSH_COUNT 1000000
+#define SMALL_VEC_COUNT 100000
+#define SMALL_VEC_FILL 6
+#define MAP_COUNT 1000000
+#define SPARSE_ID_RANGE (4 * MAP_COUNT)
+
+X_HASHMAP(xBenchMap, u64, u64, xHashMapHashU64, xHashMapEqualScalar)
+
+/* ============================================================================
+ * NAIVE BASELINES
+ * ============================================================================ */
+
+/* Separate chaining with one malloc per entry, doubling at load factor 1 */
+typedef struct xChainNode {
+    u64 key;
+    u64 value;
+    struct xChainNode* next;
+} xChainNode;
+
+typedef struct {
+    xChainNode** buckets;
+    u32 bucket_count;
+    u32 count;
+} xChainMap;
+
+static void chainInit(xChainMap* map) {
+    map->bucket_count = 16;
+    map->count        = 0;
+    map->buckets      = X_CALLOC(xChainNode*, map->bucket_count);
+    X_CHECK_ALLOC(map->buckets);
+}
+
+static void chainGrow(xChainMap* map) {
+    const u32 bucket_count = map->bucket_count * 2;
+    xChainNode** buckets   = X_CALLOC(xChainNode*, bucket_count);
+    X_CHECK_ALLOC(buckets);
+    for (u32 b = 0; b < map->bucket_count; ++b) {
+        xChainNode* node = map->buckets[b];
+        while (node != NULL) {
+            xChainNode* next = node->next;
+            const u32 index  = (u32)xHashMix64(node->key) & (bucket_count - 1);
+            node->next       = buckets[index];
+            buckets[index]   = node;
+            node             = next;
+        }
+    }
+    X_FREE(map->buckets);
+    map->buckets      = buckets;
+    map->bucket_count = bucket_count;
+}
+
+static u64* chainFind(const xChainMap* map, u64 key) {
+    xChainNode* node = map->buckets[(u32)xHashMix64(key) & (map->bucket_count - 1)];
+    for (; node != NULL; node = node->next) {
+        if (node->key == key) { return &node->value; }
+    }
+    return NULL;
+}
+
+static void chainPut(xChainMap* map, u64 key, u64 value) {
+    u64* existing = chainFind(map, key);
+    if (existing != NULL) {
+        *existing = value;
+        return;
+    }
+    if (map->count == map->bucket_count) { chainGrow(map); }
+    xChainNode* node = X_MALLOC(xChainNode, 1);
+    X_CHECK_ALLOC(node);
+    const u32 index     = (u32)xHashMix64(key) & (map->bucket_count - 1);
+    node->key           = key;
+    node->value         = value;
+    node->next          = map->buckets[index];
+    map->buckets[index] = node;
+    map->count++;
+}
+
+static bool chainRemove(xChainMap* map, u64 key) {
+    xChainNode** link = &map->buckets[(u32)xHashMix64(key) & (map->bucket_count - 1)];
+    for (; *link != NULL; link = &(*link)->next) {
+        if ((*link)->key == key) {
+            xChainNode* node = *link;
+            *link            = node->next;
+            X_FREE(node);
+            map->count--;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void chainFree(xChainMap* map) {
+    for (u32 b = 0; b < map->bucket_count; ++b) {
+        for (xChainNode* node = map->buckets[b]; node != NULL;) {
+            xChainNode* next = node->next;
+            X_FREE(node);
+            node = next;
+        }
+    }
+    X_FREE(map->buckets);
+}
+
+/* ============================================================================
+ * SUITES
+ * ============================================================================ */
+
+/* Two draws per key; consecutive xorshift32 outputs never repeat as a pair within its period */
+static u64 randomU64(u32* state) {
+    const u64 high = xBenchRandom(state);
+    return (high << 32) | xBenchRandom(state);
+}
+
+static void benchArrays(void) {
+    f64 start  = xBenchNow();
+    u32* naive = NULL;
+    for (u32 i = 0; i < PUSH_COUNT; ++i) {
+        naive = X_REALLOC(naive, u32, i + 1);
+        X_CHECK_ALLOC(naive);
+        naive[i] = i;
+    }
+    X_BENCH_DO_NOT_OPTIMIZE(naive);
+    xBenchReport("1M realloc-per-push", xBenchNow() - start, PUSH_COUNT);
+    X_FREE(naive);
+
+    xArrayU32 array = {0};
+    start           = xBenchNow();
+    for (u32 i = 0; i < PUSH_COUNT; ++i) {
+        X_ARRAY_PUSH(&array, i);
+    }
+    X_BENCH_DO_NOT_OPTIMIZE(array.items);
+    xBenchReport("1M X_ARRAY_PUSH (heap)", xBenchNow() - start, PUSH_COUNT);
+    X_ARRAY_FREE(&array);
+
+    xArena arena;
+    // Growth abandons each old block, so the arena needs about twice the final (power-of-two) capacity
+    X_CHECK_MSG(xArenaInit(&arena, 4 * PUSH_COUNT * sizeof(u32)), "Failed to init arena");
+    xArrayU32 arena_array = {.arena = &arena};
+    start                 = xBenchNow();
+    for (u32 i = 0; i < PUSH_COUNT; ++i) {
+        X_ARRAY_PUSH(&arena_array, i);
+    }
+    X_BENCH_DO_NOT_OPTIMIZE(arena_array.items);
+    xBenchReport("1M X_ARRAY_PUSH (arena)", xBenchNow() - start, PUSH_COUNT);
+    xArenaShutdown(&arena);
+
+    // Many short lists: the common case for per-object scratch (contacts, children, ...)
+    typedef X_SMALL_VEC(u32, 8) xBenchSmallVec;
+    xBenchSmallVec* small = X_CALLOC(xBenchSmallVec, SMALL_VEC_COUNT);
+    xArrayU32* heap       = X_CALLOC(xArrayU32, SMALL_VEC_COUNT);
+    X_CHECK_ALLOC(small);
+    X_CHECK_ALLOC(heap);
+
+    start = xBenchNow();
+    for (u32 v = 0; v < SMALL_VEC_COUNT; ++v) {
+        for (u32 i = 0; i < SMALL_VEC_FILL; ++i) {
+            X_ARRAY_PUSH(&heap[v], i);
+        }
+    }
+    for (u32 v = 0; v < SMALL_VEC_COUNT; ++v) {
+        X_ARRAY_FREE(&heap[v]);
+    }
+    xBenchReport("100k x6 X_ARRAY (fill + free)", xBenchNow() - start, (u64)SMALL_VEC_COUNT * SMALL_VEC_FILL);
+
+    start = xBenchNow();
+    for (u32 v = 0; v < SMALL_VEC_COUNT; ++v) {
+        for (u32 i = 0; i < SMALL_VEC_FILL; ++i) {
+            X_SMALL_VEC_PUSH(&small[v], i);
+        }
+    }
+    for (u32 v = 0; v < SMALL_VEC_COUNT; ++v) {
+        X_SMALL_VEC_FREE(&small[v]);
+    }
+    xBenchReport("100k x6 X_SMALL_VEC<8> (fill + free)", xBenchNow() - start, (u64)SMALL_VEC_COUNT * SMALL_VEC_FILL);
+
+    X_FREE(small);
+    X_FREE(heap);
+}
+
+static void benchMaps(const u64* keys, const u64* misses) {
+    xChainMap chain;
+    chainInit(&chain);
+    f64 start = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        chainPut(&chain, keys[i], i);
+    }
+    xBenchReport("1M chained insert", xBenchNow() - start, MAP_COUNT);
+
+    u64 sum = 0;
+    start   = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        sum += *chainFind(&chain, keys[i]);
+    }
+    xBenchReport("1M chained find (hit)", xBenchNow() - start, MAP_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        sum += chainFind(&chain, misses[i]) != NULL;
+    }
+    xBenchReport("1M chained find (miss)", xBenchNow() - start, MAP_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; i += 2) {
+        chainRemove(&chain, keys[i]);
+    }
+    xBenchReport("500k chained remove", xBenchNow() - start, MAP_COUNT / 2);
+    chainFree(&chain);
+
+    xBenchMap map;
+    xBenchMapInit(&map, 0);
+    start = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        xBenchMapPut(&map, keys[i], i);
+    }
+    xBenchReport("1M swiss insert", xBenchNow() - start, MAP_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        sum += *xBenchMapFind(&map, keys[i]);
+    }
+    xBenchReport("1M swiss find (hit)", xBenchNow() - start, MAP_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        sum += xBenchMapFind(&map, misses[i]) != NULL;
+    }
+    xBenchReport("1M swiss find (miss)", xBenchNow() - start, MAP_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; i += 2) {
+        xBenchMapRemove(&map, keys[i]);
+    }
+    xBenchReport("500k swiss remove", xBenchNow() - start, MAP_COUNT / 2);
+
+    start = xBenchNow();
+    X_HASHMAP_FOREACH(&map, index) {
+        sum += map.slots[index].value;
+    }
+    xBenchReport("500k swiss iterate", xBenchNow() - start, map.count);
+    xBenchMapShutdown(&map);
+    X_BENCH_DO_NOT_OPTIMIZE(sum);
+}
+
+/* Entity-style ids: dense-ish integers, looked up against a chained map keyed the same way */
+static void benchSparseSet(const u64* keys) {
+    u32* ids = X_MALLOC(u32, MAP_COUNT);
+    X_CHECK_ALLOC(ids);
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        ids[i] = (u32)(keys[i] % SPARSE_ID_RANGE);
+    }
+
+    xChainMap chain;
+    chainInit(&chain);
+    f64 start = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        chainPut(&chain, ids[i], i);
+    }
+    xBenchReport("1M chained insert (ids)", xBenchNow() - start, MAP_COUNT);
+
+    u64 sum = 0;
+    start   = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        sum += *chainFind(&chain, ids[i]);
+    }
+    xBenchReport("1M chained find (ids)", xBenchNow() - start, MAP_COUNT);
+    chainFree(&chain);
+
+    X_SPARSE_SET(u64) set = {0};
+    start                 = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        X_SPARSE_SET_INSERT(&set, ids[i], i);
+    }
+    xBenchReport("1M sparse set insert", xBenchNow() - start, MAP_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        sum += *X_SPARSE_SET_GET(&set, ids[i]);
+    }
+    xBenchReport("1M sparse set get", xBenchNow() - start, MAP_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < set.count; ++i) {
+        sum += set.values[i];
+    }
+    xBenchReport("sparse set iterate", xBenchNow() - start, set.count);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < MAP_COUNT; i += 2) {
+        X_SPARSE_SET_REMOVE(&set, ids[i]);
+    }
+    xBenchReport("500k sparse set remove", xBenchNow() - start, MAP_COUNT / 2);
+
+    X_SPARSE_SET_FREE(&set);
+    X_FREE(ids);
+    X_BENCH_DO_NOT_OPTIMIZE(sum);
+}
+
+void xBenchContainers(void) {
+    u64* keys   = X_MALLOC(u64, MAP_COUNT);
+    u64* misses = X_MALLOC(u64, MAP_COUNT);
+    X_CHECK_ALLOC(keys);
+    X_CHECK_ALLOC(misses);
+    u32 state = 0x243F6A88u;
+    // Odd keys are inserted and even keys miss, so the two sets never collide
+    for (u32 i = 0; i < MAP_COUNT; ++i) {
+        keys[i]   = randomU64(&state) | 1;
+        misses[i] = randomU64(&state) & ~1ull;
+    }
+
+    benchArrays();
+    benchMaps(keys, misses);
+    benchSparseSet(keys);
+
+    X_FREE(keys);
+    X_FREE(misses);
+}
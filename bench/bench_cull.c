@@ -0,0 +1,222 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <cull.h>
+#include <renderer.h>
+
+#include <math.h>
+#include <stdio.h>
+
+#define OBJECT_COUNT 1000000
+#define WORLD_EXTENT 500.0f
+#define OBJECT_EXTENT 1.0f
+#define FRAMES 8
+#define DEPTH_WIDTH 256
+#define DEPTH_HEIGHT 144
+#define FOV_Y X_DEG2RAD(60.0f)
+
+/* Objects drawn in the renderer pass; its visible set has to fit in X_RENDERER_MAX_COMMANDS */
+#define DRAW_OBJECT_COUNT 250000
+
+#define RANDOM_SEED 0x9e3779b9u
+
+static u32 sRandom = RANDOM_SEED;
+
+static void sceneInit(xCullBounds* bounds) {
+    X_CHECK_MSG(xCullBoundsInit(bounds, OBJECT_COUNT), "Failed to init cull bounds");
+    for (u32 i = 0; i < OBJECT_COUNT; ++i) {
+        const xVec4 center = xVec4Make(xBenchRandomRange(&sRandom, -WORLD_EXTENT, WORLD_EXTENT),
+                                       xBenchRandomRange(&sRandom, -WORLD_EXTENT, WORLD_EXTENT),
+                                       xBenchRandomRange(&sRandom, -WORLD_EXTENT, WORLD_EXTENT),
+                                       0.0f);
+        const f32 size     = xBenchRandomRange(&sRandom, 0.25f, 1.0f) * OBJECT_EXTENT;
+        const xVec4 half   = xVec4Make(size, size, size, 0.0f);
+        const xAabb box    = xAabbMake(xVec4Sub(center, half), xVec4Add(center, half));
+        xCullBoundsPush(bounds, &box);
+    }
+}
+
+/* A row of walls a short way in front of the camera, with gaps between them */
+static u32 makeOccluders(xAabb* occluders, u32 capacity) {
+    u32 count = 0;
+    for (s32 i = -4; i <= 4 && count < capacity; ++i) {
+        const f32 x        = (f32)i * 14.0f;
+        const xVec4 min    = xVec4Make(x - 5.0f, -40.0f, -41.0f, 0.0f);
+        const xVec4 max    = xVec4Make(x + 5.0f, 8.0f, -40.0f, 0.0f);
+        occluders[count++] = xAabbMake(min, max);
+    }
+    return count;
+}
+
+/* Visible indices from the scalar kernel; every SIMD kernel must produce exactly the same list */
+typedef struct {
+    u32* visible;
+    u32 count;
+} xCullReference;
+
+static xCullReference cullReference(const xCullBounds* bounds, const xMat4* view_projection) {
+    xCuller scalar;
+    X_CHECK_MSG(xCullerInit(&scalar, NULL, 0, 0), "Failed to init culler");
+    X_CHECK_MSG(xCullerSetKernel(&scalar, X_CULL_KERNEL_SCALAR), "Scalar cull kernel unavailable");
+    xCullReference reference = {NULL, xCullerRun(&scalar, bounds, view_projection, NULL, 0)};
+    reference.visible        = X_MALLOC(u32, X_MAX(reference.count, 1u));
+    X_CHECK_ALLOC(reference.visible);
+    memcpy(reference.visible, xCullerVisible(&scalar), sizeof(u32) * reference.count);
+    xCullerShutdown(&scalar);
+    return reference;
+}
+
+static bool matchesReference(const xCuller* culler, u32 visible, const xCullReference* reference) {
+    if (visible != reference->count) {
+        X_PRINT_ERROR(
+          "%s kernel found %u visible objects, scalar found %u", culler->kernel_name, visible, reference->count);
+        return false;
+    }
+    for (u32 i = 0; i < visible; ++i) {
+        if (xCullerVisible(culler)[i] != reference->visible[i]) {
+            X_PRINT_ERROR("%s kernel disagrees with scalar at visible entry %u", culler->kernel_name, i);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void runFrustum(xCuller* culler,
+                       const xCullBounds* bounds,
+                       const xMat4* view_projection,
+                       const xCullReference* reference,
+                       const char* mode) {
+    f64 total   = 0.0;
+    u32 visible = 0;
+    for (u32 frame = 0; frame < FRAMES; ++frame) {
+        visible = xCullerRun(culler, bounds, view_projection, NULL, 0);
+        total += xCullerStats(culler)->frustum_seconds;
+    }
+    if (!matchesReference(culler, visible, reference)) { return; }
+    char name[64];
+    snprintf(name, sizeof(name), "1M frustum %s %s (%u visible)", culler->kernel_name, mode, visible);
+    xBenchReport(name, total, (u64)OBJECT_COUNT * FRAMES);
+}
+
+/* Cull and record through the renderer, as a game frame would, and check every survivor reached the backend */
+static void runRendererFrames(xJobSystem* jobs, const xCullBounds* bounds, const xMat4* view_projection) {
+    xCullBounds subset = *bounds;
+    subset.count       = DRAW_OBJECT_COUNT;
+
+    xRenderDraw* draws = X_MALLOC(xRenderDraw, DRAW_OBJECT_COUNT);
+    X_CHECK_ALLOC(draws);
+    for (u32 i = 0; i < DRAW_OBJECT_COUNT; ++i) {
+        draws[i] = (xRenderDraw) {
+          .shader         = (u16)(i & 31),
+          .material       = (u16)((i >> 5) & 255),
+          .state          = X_RENDER_STATE_DEFAULT,
+          .mesh           = X_HANDLE_INVALID,
+          .index_count    = 36,
+          .instance_count = 1,
+        };
+    }
+
+    xRenderer* renderer = xRendererCreate();
+    xRendererInitialize(renderer, 1280, 720);
+    xCuller culler;
+    X_CHECK_MSG(xCullerInit(&culler, jobs, 0, 0), "Failed to init culler");
+
+    u32 visible     = 0;
+    bool submitted  = true;
+    const f64 start = xBenchNow();
+    for (u32 frame = 0; frame < FRAMES; ++frame) {
+        xRendererFrameBegin(renderer);
+        visible = xRendererDrawCulled(renderer, &culler, &subset, view_projection, draws, NULL, 0);
+        xRendererFrameEnd(renderer);
+        submitted = submitted && renderer->stats.draws == visible;
+    }
+    const f64 elapsed = xBenchNow() - start;
+
+    if (submitted) {
+        char name[64];
+        snprintf(name, sizeof(name), "250k cull + record + submit (%u drawn)", visible);
+        xBenchReport(name, elapsed, (u64)DRAW_OBJECT_COUNT * FRAMES);
+    } else {
+        X_PRINT_ERROR("Renderer submitted %u draws for %u visible objects", renderer->stats.draws, visible);
+    }
+
+    xCullerShutdown(&culler);
+    xRendererShutdown(renderer);
+    xRendererDestroy(renderer);
+    X_FREE(draws);
+}
+
+void xBenchCull(void) {
+    sRandom = RANDOM_SEED;  // Identical scene on every harness pass
+
+    xJobSystem* jobs = xJobSystemCreate(0);
+    xCullBounds bounds;
+    sceneInit(&bounds);
+
+    const xVec4 eye             = xVec4Make(0.0f, 0.0f, 0.0f, 1.0f);
+    const xVec4 target          = xVec4Make(0.0f, 0.0f, -1.0f, 1.0f);
+    const xVec4 up              = xVec4Make(0.0f, 1.0f, 0.0f, 0.0f);
+    const xMat4 projection      = xMat4Perspective(FOV_Y, 16.0f / 9.0f, 0.1f, WORLD_EXTENT);
+    const xMat4 view            = xMat4LookAt(eye, target, up);
+    const xMat4 view_projection = xMat4Mul(&projection, &view);
+    xCullReference reference    = cullReference(&bounds, &view_projection);
+
+    const xCullKernel kernels[] = {X_CULL_KERNEL_SCALAR, X_CULL_KERNEL_SSE2, X_CULL_KERNEL_AVX2};
+    X_FOREACH(const xCullKernel, kernel, kernels) {
+        xCuller single;
+        xCuller threaded;
+        X_CHECK_MSG(xCullerInit(&single, NULL, 0, 0), "Failed to init culler");
+        X_CHECK_MSG(xCullerInit(&threaded, jobs, 0, 0), "Failed to init culler");
+        if (xCullerSetKernel(&single, *kernel) && xCullerSetKernel(&threaded, *kernel)) {
+            runFrustum(&single, &bounds, &view_projection, &reference, "1 thread");
+            runFrustum(&threaded, &bounds, &view_projection, &reference, "jobs");
+        }
+        xCullerShutdown(&single);
+        xCullerShutdown(&threaded);
+    }
+
+    // Full pipeline with the coarse occlusion pass
+    xAabb occluders[16];
+    const u32 occluder_count = makeOccluders(occluders, X_ARRAY_SIZE(occluders));
+    xCuller culler;
+    X_CHECK_MSG(xCullerInit(&culler, jobs, DEPTH_WIDTH, DEPTH_HEIGHT), "Failed to init culler");
+
+    // Counts are identical every frame; only the stage times are summed
+    xCullStats totals = {0};
+    for (u32 frame = 0; frame < FRAMES; ++frame) {
+        xCullerRun(&culler, &bounds, &view_projection, occluders, occluder_count);
+        const xCullStats* stats  = xCullerStats(&culler);
+        const f64 frustum        = totals.frustum_seconds + stats->frustum_seconds;
+        const f64 raster         = totals.raster_seconds + stats->raster_seconds;
+        const f64 occlusion      = totals.occlusion_seconds + stats->occlusion_seconds;
+        totals                   = *stats;
+        totals.frustum_seconds   = frustum;
+        totals.raster_seconds    = raster;
+        totals.occlusion_seconds = occlusion;
+    }
+
+    char name[64];
+    if (OBJECT_COUNT - totals.frustum_culled == reference.count) {
+        snprintf(name, sizeof(name), "1M frustum %s (%u culled)", culler.kernel_name, totals.frustum_culled);
+        xBenchReport(name, totals.frustum_seconds, (u64)OBJECT_COUNT * FRAMES);
+    } else {
+        X_PRINT_ERROR("%s kernel culled %u objects, scalar culled %u",
+                      culler.kernel_name,
+                      totals.frustum_culled,
+                      OBJECT_COUNT - reference.count);
+    }
+    snprintf(name, sizeof(name), "%ux%u occluder raster (%u)", DEPTH_WIDTH, DEPTH_HEIGHT, totals.occluders);
+    xBenchReport(name, totals.raster_seconds, FRAMES);
+    snprintf(name, sizeof(name), "occlusion test (%u culled, %u visible)", totals.occlusion_culled, totals.visible);
+    xBenchReport(name, totals.occlusion_seconds, (u64)(totals.visible + totals.occlusion_culled) * FRAMES);
+
+    xCullerShutdown(&culler);
+
+    runRendererFrames(jobs, &bounds, &view_projection);
+
+    X_FREE(reference.visible);
+    xCullBoundsShutdown(&bounds);
+    xJobSystemDestroy(jobs);
+}
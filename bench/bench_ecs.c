@@ -0,0 +1,167 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <ecs.h>
+#include <platform.h>
+
+#define ENTITY_COUNT 1000000
+#define REPS 20
+
+typedef struct {
+    f32 x, y, z;
+} xBenchPosition;
+
+typedef struct {
+    f32 x, y, z;
+} xBenchVelocity;
+
+typedef struct {
+    f32 value;
+} xBenchHealth;
+
+typedef struct {
+    f32 inverse;
+} xBenchMass;
+
+/* Baseline: one fat struct per entity, as a naive scene array would store it */
+typedef struct {
+    xBenchPosition position;
+    xBenchVelocity velocity;
+    xBenchHealth health;
+    xBenchMass mass;
+    u64 mask;
+} xBenchFatEntity;
+
+typedef struct {
+    xEcsWorld* world;
+    xComponentId position;
+    xComponentId velocity;
+    xComponentId health;
+    xComponentId mass;
+    f32 dt;
+} xBenchEcsIds;
+
+static void integrate(const xEcsView* view, void* user) {
+    const xBenchEcsIds* ids   = (const xBenchEcsIds*)user;
+    xBenchPosition* positions = X_ECS_COLUMN(view, xBenchPosition, ids->position);
+    xBenchVelocity* velocity  = X_ECS_COLUMN(view, xBenchVelocity, ids->velocity);
+    for (u32 i = 0; i < view->count; ++i) {
+        positions[i].x += velocity[i].x * ids->dt;
+        positions[i].y += velocity[i].y * ids->dt;
+        positions[i].z += velocity[i].z * ids->dt;
+    }
+}
+
+static void applyGravity(const xEcsView* view, void* user) {
+    const xBenchEcsIds* ids  = (const xBenchEcsIds*)user;
+    xBenchVelocity* velocity = X_ECS_COLUMN(view, xBenchVelocity, ids->velocity);
+    xBenchHealth* health     = X_ECS_COLUMN(view, xBenchHealth, ids->health);
+    xBenchMass* mass         = X_ECS_COLUMN(view, xBenchMass, ids->mass);
+    for (u32 i = 0; i < view->count; ++i) {
+        velocity[i].y -= 9.81f * mass[i].inverse * ids->dt;
+        health[i].value -= 0.01f;
+    }
+}
+
+/* Structural changes are recorded during iteration and applied by xEcsFlush */
+static void killLowHealth(const xEcsView* view, void* user) {
+    const xBenchEcsIds* ids     = (const xBenchEcsIds*)user;
+    const xBenchHealth* health  = X_ECS_COLUMN(view, xBenchHealth, ids->health);
+    xEcsCommandBuffer* deferred = xEcsDeferred(ids->world);
+    for (u32 i = 0; i < view->count; ++i) {
+        if (health[i].value < 10.0f) { xEcsCmdDestroy(deferred, view->entities[i]); }
+    }
+}
+
+void xBenchEcs(void) {
+    xEcsWorld world;
+    X_CHECK_MSG(xEcsWorldInit(&world, ENTITY_COUNT), "Failed to init ECS world");
+
+    xBenchEcsIds ids;
+    ids.world    = &world;
+    ids.position = X_ECS_REGISTER(&world, xBenchPosition);
+    ids.velocity = X_ECS_REGISTER(&world, xBenchVelocity);
+    ids.health   = X_ECS_REGISTER(&world, xBenchHealth);
+    ids.mass     = X_ECS_REGISTER(&world, xBenchMass);
+    ids.dt       = 1.0f / 60.0f;
+
+    // Four archetypes with 2, 3, 3 and 4 components, 250k entities each
+    const u64 moving  = X_ECS_MASK(ids.position) | X_ECS_MASK(ids.velocity);
+    const u64 masks[] = {
+      moving,
+      moving | X_ECS_MASK(ids.health),
+      moving | X_ECS_MASK(ids.mass),
+      moving | X_ECS_MASK(ids.health) | X_ECS_MASK(ids.mass),
+    };
+
+    xBenchFatEntity* fat = X_CALLOC(xBenchFatEntity, ENTITY_COUNT);
+    X_CHECK_ALLOC(fat);
+
+    f64 start = xBenchNow();
+    for (u32 i = 0; i < ENTITY_COUNT; ++i) {
+        const xEntity entity     = xEcsCreate(&world, masks[i & 3]);
+        xBenchVelocity* velocity = (xBenchVelocity*)xEcsGet(&world, entity, ids.velocity);
+        *velocity                = (xBenchVelocity) {1.0f, (f32)(i & 7), 0.5f};
+        xBenchHealth* health     = (xBenchHealth*)xEcsGet(&world, entity, ids.health);
+        if (health != NULL) { health->value = (f32)(i % 100); }
+        fat[i].velocity     = *velocity;
+        fat[i].mask         = masks[i & 3];
+        fat[i].mass.inverse = 1.0f;
+    }
+    xBenchReport("create entities", xBenchNow() - start, ENTITY_COUNT);
+
+    start = xBenchNow();
+    for (u32 rep = 0; rep < REPS; ++rep) {
+        for (u32 i = 0; i < ENTITY_COUNT; ++i) {
+            fat[i].position.x += fat[i].velocity.x * ids.dt;
+            fat[i].position.y += fat[i].velocity.y * ids.dt;
+            fat[i].position.z += fat[i].velocity.z * ids.dt;
+        }
+        X_BENCH_DO_NOT_OPTIMIZE(fat);
+    }
+    xBenchReport("integrate, AoS baseline", xBenchNow() - start, (u64)REPS * ENTITY_COUNT);
+
+    const xEcsQuery movers = {moving, 0};
+    start                  = xBenchNow();
+    for (u32 rep = 0; rep < REPS; ++rep) {
+        xEcsQueryEach(&world, movers, integrate, &ids);
+    }
+    xBenchReport("integrate, 2 components", xBenchNow() - start, (u64)REPS * ENTITY_COUNT);
+
+    const xEcsQuery heavy = {masks[3], 0};
+    const u32 heavy_count = xEcsQueryCount(&world, heavy);
+    start                 = xBenchNow();
+    for (u32 rep = 0; rep < REPS; ++rep) {
+        xEcsQueryEach(&world, heavy, applyGravity, &ids);
+    }
+    xBenchReport("gravity, 4 components", xBenchNow() - start, (u64)REPS * heavy_count);
+
+    const u32 cores = xPlatformCoreCount();
+    for (u32 threads = 1; threads <= cores; threads = threads < cores ? X_MIN(threads * 2, cores) : threads + 1) {
+        xJobSystem* jobs = xJobSystemCreate(threads);
+        char name[64];
+
+        start = xBenchNow();
+        for (u32 rep = 0; rep < REPS; ++rep) {
+            xEcsQueryParallel(&world, jobs, movers, integrate, &ids);
+        }
+        snprintf(name, sizeof(name), "integrate parallel, %u thread(s)", threads);
+        xBenchReport(name, xBenchNow() - start, (u64)REPS * ENTITY_COUNT);
+
+        xJobSystemDestroy(jobs);
+    }
+
+    const xEcsQuery living = {X_ECS_MASK(ids.health), 0};
+    const u32 before       = xEcsQueryCount(&world, living);
+    start                  = xBenchNow();
+    xEcsQueryEach(&world, living, killLowHealth, &ids);
+    xEcsFlush(&world);
+    const u32 after = xEcsQueryCount(&world, living);
+    xBenchReport("deferred destroy + flush", xBenchNow() - start, before);
+    printf("  %-40s %u -> %u\n", "entities with health", before, after);
+
+    X_FREE(fat);
+    xEcsWorldShutdown(&world);
+}
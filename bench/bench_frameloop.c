@@ -0,0 +1,60 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <frameloop.h>
+
+#define FRAME_COUNT X_FRAME_LOOP_HISTORY
+
+typedef struct {
+    u64 updates;
+    f64 work_seconds;
+} xBenchLoopState;
+
+static void benchUpdate(void* user, f64 dt) {
+    X_UNUSED(dt);
+    ((xBenchLoopState*)user)->updates++;
+}
+
+/* Stand-in for render cost: busy-wait so the scheduler sees a loaded thread */
+static void benchRender(void* user, f64 alpha) {
+    X_UNUSED(alpha);
+    const f64 end = xBenchNow() + ((xBenchLoopState*)user)->work_seconds;
+    while (xBenchNow() < end) {}
+}
+
+static void runLoop(const char* name, xFramePacing pacing, f64 target_hz, f64 work_seconds) {
+    xBenchLoopState state               = {0, work_seconds};
+    const xFrameLoopCallbacks callbacks = {&state, NULL, benchUpdate, benchRender};
+    const xFrameLoopDesc desc           = {.fixed_hz = 120.0, .target_hz = target_hz, .pacing = pacing};
+
+    xFrameLoop loop;
+    xFrameLoopInit(&loop, &desc);
+
+    const f64 start = xBenchNow();
+    for (u32 i = 0; i < FRAME_COUNT; ++i) {
+        xFrameLoopTick(&loop, &callbacks);
+    }
+    const f64 elapsed = xBenchNow() - start;
+    xBenchReport(name, elapsed, FRAME_COUNT);
+
+    xFrameLoopStats stats;
+    xFrameLoopGetStats(&loop, &stats);
+    printf("    mean %.3f ms  stddev %.3f ms  min %.3f  p99 %.3f  max %.3f  hitches %u\n",
+           stats.mean,
+           stats.stddev,
+           stats.min,
+           stats.p99,
+           stats.max,
+           stats.hitches);
+    printf("    %llu fixed updates for %.1f ms simulated at 120 Hz\n",
+           (unsigned long long)state.updates,
+           elapsed * 1000.0);
+}
+
+void xBenchFrameLoop(void) {
+    runLoop("capped 240 Hz, 1 ms work", X_FRAME_PACING_CAPPED, 240.0, 0.001);
+    runLoop("capped 60 Hz, 4 ms work", X_FRAME_PACING_CAPPED, 60.0, 0.004);
+    runLoop("uncapped, 0.5 ms work", X_FRAME_PACING_UNCAPPED, 0.0, 0.0005);
+}
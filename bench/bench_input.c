@@ -0,0 +1,49 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <input.h>
+
+#define EVENT_COUNT (1u << 20)
+#define EVENTS_PER_FRAME 256
+
+void xBenchInput(void) {
+    xInputQueue* queue = X_NEW(xInputQueue);
+    X_CHECK_ALLOC(queue);
+    xInputQueueInit(queue);
+
+    xInputState state;
+    xInputStateInit(&state);
+
+    // Simulated frames: a burst of key/mouse events, then one batched drain
+    u32 drained = 0;
+    f64 start   = xBenchNow();
+    for (u32 sent = 0; sent < EVENT_COUNT; sent += EVENTS_PER_FRAME) {
+        for (u32 i = 0; i < EVENTS_PER_FRAME; ++i) {
+            xInputEvent event = {.time = (f64)(sent + i)};
+            if (i & 1) {
+                event.type       = X_INPUT_EVENT_MOUSE_MOVE;
+                event.position.x = (f32)i;
+                event.position.y = (f32)sent;
+            } else {
+                event.type     = X_INPUT_EVENT_KEY;
+                event.action   = (u8)((i >> 1) & 1);
+                event.key.code = (s32)(i % 348);
+            }
+            xInputQueuePush(queue, &event);
+        }
+        drained += xInputDrain(queue, &state, NULL, 0);
+    }
+    xBenchReport("push + batched drain", xBenchNow() - start, EVENT_COUNT);
+    X_BENCH_DO_NOT_OPTIMIZE(state.keys[0]);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < EVENT_COUNT; ++i) {
+        X_BENCH_DO_NOT_OPTIMIZE(xInputKeyPressed(&state, (s32)(i % 348)));
+    }
+    xBenchReport("key pressed query", xBenchNow() - start, EVENT_COUNT);
+
+    printf("  %-40s %u / %u (dropped %u)\n", "events drained", drained, EVENT_COUNT, atomic_load(&queue->dropped));
+    X_FREE(queue);
+}
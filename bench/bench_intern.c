@@ -0,0 +1,73 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <intern.h>
+
+#include <stdio.h>
+
+#define NAME_COUNT 100000
+#define NAME_LENGTH 48
+#define COMPARE_ROUNDS 10
+
+void xBenchIntern(void) {
+    // Resource-style names sharing a long prefix, the worst case for strcmp
+    char* names = X_MALLOC(char, (size_t)NAME_COUNT * NAME_LENGTH);
+    X_CHECK_ALLOC(names);
+    for (u32 i = 0; i < NAME_COUNT; ++i) {
+        snprintf(names + (size_t)i * NAME_LENGTH, NAME_LENGTH, "assets/textures/environment/rock_%06u.xtex", i);
+    }
+
+    xInternTable table;
+    X_CHECK_MSG(xInternInit(&table, 0), "Failed to init intern table");
+    xStringId* ids = X_MALLOC(xStringId, NAME_COUNT);
+    X_CHECK_ALLOC(ids);
+
+    f64 start = xBenchNow();
+    for (u32 i = 0; i < NAME_COUNT; ++i) {
+        ids[i] = xIntern(&table, names + (size_t)i * NAME_LENGTH);
+    }
+    xBenchReport("100k intern (new)", xBenchNow() - start, NAME_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < NAME_COUNT; ++i) {
+        ids[i] = xIntern(&table, names + (size_t)i * NAME_LENGTH);
+    }
+    xBenchReport("100k intern (existing)", xBenchNow() - start, NAME_COUNT);
+
+    u64 checksum = 0;
+    start        = xBenchNow();
+    for (u32 i = 0; i < NAME_COUNT; ++i) {
+        checksum += (uintptr_t)xInternLookup(&table, ids[i]);
+    }
+    xBenchReport("100k id -> string", xBenchNow() - start, NAME_COUNT);
+
+    // Find one name in the list: strcmp against every string vs one integer compare each
+    const char* needle        = "assets/textures/environment/rock_099999.xtex";
+    const xStringId needle_id = X_STRING_ID("assets/textures/environment/rock_099999.xtex");
+    start                     = xBenchNow();
+    for (u32 round = 0; round < COMPARE_ROUNDS; ++round) {
+        for (u32 i = 0; i < NAME_COUNT; ++i) {
+            checksum += X_STREQ(names + (size_t)i * NAME_LENGTH, needle);
+        }
+        X_BENCH_DO_NOT_OPTIMIZE(checksum);
+    }
+    xBenchReport("100k strcmp scan", xBenchNow() - start, (u64)NAME_COUNT * COMPARE_ROUNDS);
+
+    start = xBenchNow();
+    for (u32 round = 0; round < COMPARE_ROUNDS; ++round) {
+        for (u32 i = 0; i < NAME_COUNT; ++i) {
+            checksum += ids[i] == needle_id;
+        }
+        X_BENCH_DO_NOT_OPTIMIZE(checksum);
+    }
+    xBenchReport("100k string id scan", xBenchNow() - start, (u64)NAME_COUNT * COMPARE_ROUNDS);
+
+    X_BENCH_DO_NOT_OPTIMIZE(checksum);
+    printf("  %u strings interned into %zu KiB of arena storage\n", xInternCount(&table), table.bytes / 1024);
+
+    xInternShutdown(&table);
+    X_FREE(ids);
+    X_FREE(names);
+}
@@ -0,0 +1,91 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <jobs.h>
+#include <platform.h>
+
+#include <math.h>
+
+#define ELEMENT_COUNT (1 << 24)
+#define GRAIN 16384
+#define EMPTY_JOB_COUNT 200000
+
+typedef struct {
+    const f32* input;
+    f32* output;
+} xBenchJobData;
+
+static void transformRange(void* data, u32 begin, u32 end) {
+    const xBenchJobData* job = (const xBenchJobData*)data;
+    for (u32 i = begin; i < end; ++i) {
+        job->output[i] = sqrtf(job->input[i]) * 0.5f + job->input[i];
+    }
+}
+
+static void emptyJob(void* data, u32 begin, u32 end) {
+    X_UNUSED(data);
+    X_UNUSED(begin);
+    X_UNUSED(end);
+}
+
+static void benchThreads(u32 threads, const xBenchJobData* data) {
+    xJobSystem* jobs = xJobSystemCreate(threads);
+    char name[64];
+
+    // Warm the workers and caches once before timing
+    xJobsParallelFor(jobs, ELEMENT_COUNT, GRAIN, transformRange, (void*)data);
+
+    const f64 start = xBenchNow();
+    for (u32 rep = 0; rep < 10; ++rep) {
+        xJobsParallelFor(jobs, ELEMENT_COUNT, GRAIN, transformRange, (void*)data);
+    }
+    snprintf(name, sizeof(name), "parallel-for, %u thread(s)", threads);
+    xBenchReport(name, xBenchNow() - start, 10ull * ELEMENT_COUNT);
+
+    xJobCounter counter;
+    xJobCounterInit(&counter);
+    xJob batch[256];
+    for (u32 i = 0; i < X_ARRAY_SIZE(batch); ++i) {
+        batch[i] = (xJob) {.fn = emptyJob};
+    }
+
+    const f64 empty_start = xBenchNow();
+    for (u32 submitted = 0; submitted < EMPTY_JOB_COUNT; submitted += X_ARRAY_SIZE(batch)) {
+        xJobsRun(jobs, batch, X_ARRAY_SIZE(batch), &counter);
+        // Keep queue depth bounded so the benchmark measures scheduling, not the inline fallback
+        if (counter.pending > 2048) { xJobsWait(jobs, &counter); }
+    }
+    xJobsWait(jobs, &counter);
+    snprintf(name, sizeof(name), "empty jobs, %u thread(s)", threads);
+    xBenchReport(name, xBenchNow() - empty_start, EMPTY_JOB_COUNT);
+
+    xJobSystemDestroy(jobs);
+}
+
+void xBenchJobs(void) {
+    f32* input  = X_MALLOC(f32, ELEMENT_COUNT);
+    f32* output = X_MALLOC(f32, ELEMENT_COUNT);
+    X_CHECK_ALLOC(input);
+    X_CHECK_ALLOC(output);
+    for (u32 i = 0; i < ELEMENT_COUNT; ++i) {
+        input[i] = (f32)i;
+    }
+
+    const xBenchJobData data = {input, output};
+    const u32 cores          = xPlatformCoreCount();
+
+    const f64 serial_start = xBenchNow();
+    for (u32 rep = 0; rep < 10; ++rep) {
+        transformRange((void*)&data, 0, ELEMENT_COUNT);
+    }
+    xBenchReport("serial loop", xBenchNow() - serial_start, 10ull * ELEMENT_COUNT);
+
+    for (u32 threads = 1; threads <= cores; threads = threads < cores ? X_MIN(threads * 2, cores) : threads + 1) {
+        benchThreads(threads, &data);
+    }
+
+    X_FREE(input);
+    X_FREE(output);
+}
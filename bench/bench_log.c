@@ -0,0 +1,62 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <log.h>
+
+#include <threads.h>
+
+#define RECORD_COUNT 20000
+#define BURST_SIZE 256
+#define LOG_PATH "xenc_bench_log.txt"
+
+static void waitForWriter(void) {
+    const struct timespec wait = {0, 2000000};
+    thrd_sleep(&wait, NULL);
+}
+
+/*
+ * Caller-side cost of a typical error line: fprintf to a file, the logger
+ * handing records to its writer thread, and a call filtered out by the runtime
+ * level. Async records are logged in bursts with a pause between them, like
+ * per-frame logging, so the writer keeps up and the numbers exclude drops.
+ */
+void xBenchLog(void) {
+    FILE* file = fopen(LOG_PATH, "w");
+    X_CHECK_MSG(file != NULL, "Failed to open bench log file");
+
+    f64 start = xBenchNow();
+    for (u32 i = 0; i < RECORD_COUNT; ++i) {
+        fprintf(file, "[ERROR] %s:%d: entity %u failed at %.3f (%s)\n", __FILE__, __LINE__, i, i * 0.25, "mesh");
+    }
+    fflush(file);
+    xBenchReport("fprintf to file", xBenchNow() - start, RECORD_COUNT);
+    fclose(file);
+
+    X_CHECK_MSG(xLogStart(LOG_PATH), "Failed to start logger");
+    const u64 dropped = xLogDropped();
+    f64 elapsed       = 0.0;
+    for (u32 burst = 0; burst < RECORD_COUNT / BURST_SIZE; ++burst) {
+        start = xBenchNow();
+        for (u32 i = 0; i < BURST_SIZE; ++i) {
+            xLogWrite(X_LOG_LEVEL_INFO, __FILE__, __LINE__, "entity %u failed at %.3f (%s)", i, i * 0.25, "mesh");
+        }
+        elapsed += xBenchNow() - start;
+        waitForWriter();
+    }
+    xBenchReport("record, async", elapsed, (RECORD_COUNT / BURST_SIZE) * BURST_SIZE);
+    printf("  %-40s %llu\n", "async records dropped", (unsigned long long)(xLogDropped() - dropped));
+
+    const xLogLevel level = xLogGetLevel();
+    xLogSetLevel(X_LOG_LEVEL_WARN);
+    start = xBenchNow();
+    for (u32 i = 0; i < RECORD_COUNT; ++i) {
+        xLogWrite(X_LOG_LEVEL_INFO, __FILE__, __LINE__, "entity %u failed at %.3f (%s)", i, i * 0.25, "mesh");
+    }
+    xBenchReport("record below runtime level", xBenchNow() - start, RECORD_COUNT);
+    xLogSetLevel(level);
+
+    xLogStop();
+    remove(LOG_PATH);
+}
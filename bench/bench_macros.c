@@ -0,0 +1,91 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <renderer.h>
+
+#define VALUE_COUNT 1000000
+#define DUP_COUNT 100000
+#define RENDERER_COUNT 200
+
+/*
+ * The macros.h utilities on their own, plus renderer creation on the null
+ * backend. Window creation needs a display and a GL context, so it is not
+ * measured here.
+ */
+void xBenchMacros(void) {
+    u32* values = X_MALLOC(u32, VALUE_COUNT);
+    f32* floats = X_MALLOC(f32, VALUE_COUNT);
+    X_CHECK_ALLOC(values);
+    X_CHECK_ALLOC(floats);
+    for (u32 i = 0; i < VALUE_COUNT; ++i) {
+        values[i] = i * 2654435761u;
+        floats[i] = (f32)(values[i] >> 8) / (f32)(1u << 24) * 4.0f - 2.0f;
+    }
+
+    u64 sum   = 0;
+    f64 start = xBenchNow();
+    for (u32 i = 0; i < VALUE_COUNT; ++i) {
+        const u32 align = X_BIT(values[i] & 7);
+        sum += X_IS_POW2(values[i]) + X_ALIGN_UP(values[i], align) + X_ALIGN_DOWN(values[i], align);
+    }
+    X_BENCH_DO_NOT_OPTIMIZE(sum);
+    xBenchReport("1M X_ALIGN_UP/DOWN + X_IS_POW2", xBenchNow() - start, VALUE_COUNT);
+
+    f32 accum = 0.0f;
+    start     = xBenchNow();
+    for (u32 i = 0; i < VALUE_COUNT; ++i) {
+        const f32 t = X_CLAMP(floats[i], 0.0f, 1.0f);
+        accum += X_LERP(-1.0f, 1.0f, t) + X_SMOOTHSTEP(t) + X_REMAP(floats[i], -2.0f, 2.0f, 0.0f, 1.0f);
+    }
+    X_BENCH_DO_NOT_OPTIMIZE(accum);
+    xBenchReport("1M X_CLAMP + X_LERP + X_SMOOTHSTEP + X_REMAP", xBenchNow() - start, VALUE_COUNT);
+
+    sum   = 0;
+    start = xBenchNow();
+    for (u32 i = 0; i < VALUE_COUNT; ++i) {
+        const f32 f     = floats[i] * 0.5f + 0.5f;
+        const u32 color = X_COLOR_RGBA(X_COLOR_F2B(f), (u8)values[i], (u8)(values[i] >> 8), 255);
+        sum += X_COLOR_GET_R(color) + X_COLOR_GET_G(color) + X_COLOR_GET_B(color) + X_COLOR_GET_A(color);
+    }
+    X_BENCH_DO_NOT_OPTIMIZE(sum);
+    xBenchReport("1M X_COLOR_RGBA pack + unpack", xBenchNow() - start, VALUE_COUNT);
+
+    const char* names[] = {"u_model", "u_view", "u_projection", "u_albedo", "u_normal", "u_roughness", "u_time"};
+    sum                 = 0;
+    start               = xBenchNow();
+    for (u32 i = 0; i < VALUE_COUNT; ++i) {
+        sum += X_STREQ(names[i % X_ARRAY_SIZE(names)], "u_projection");
+    }
+    X_BENCH_DO_NOT_OPTIMIZE(sum);
+    xBenchReport("1M X_STREQ uniform names", xBenchNow() - start, VALUE_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < DUP_COUNT; ++i) {
+        char* copy = X_STRDUP_SAFE(names[i % X_ARRAY_SIZE(names)]);
+        X_BENCH_DO_NOT_OPTIMIZE(copy);
+        X_FREE(copy);
+    }
+    xBenchReport("100k X_STRDUP_SAFE + X_FREE", xBenchNow() - start, DUP_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < DUP_COUNT; ++i) {
+        void* copy = X_MEMDUP(values + (i & 1023), 64);
+        X_BENCH_DO_NOT_OPTIMIZE(copy);
+        X_FREE(copy);
+    }
+    xBenchReport("100k X_MEMDUP 64 B + X_FREE", xBenchNow() - start, DUP_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < RENDERER_COUNT; ++i) {
+        xRenderer* renderer = xRendererCreate();
+        xRendererInitialize(renderer, 1280, 720);
+        xRendererShutdown(renderer);
+        xRendererDestroy(renderer);
+    }
+    xBenchReport("renderer create + init (null backend)", xBenchNow() - start, RENDERER_COUNT);
+
+    X_FREE(floats);
+    X_FREE(values);
+}
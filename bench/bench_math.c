@@ -0,0 +1,114 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <vecmath.h>
+
+#define POINT_COUNT 100000
+#define MATRIX_COUNT 20000
+#define REPS 100
+
+typedef struct {
+    f32 x;
+    f32 y;
+    f32 z;
+} xBenchVec3;
+
+/* Baseline: AoS points transformed with the scalar X_VEC3_DOT macro against matrix rows */
+static void transformWithMacros(const xBenchVec3 rows[3], const f32 translation[3], const xBenchVec3* in,
+                                xBenchVec3* out, u32 count) {
+    for (u32 i = 0; i < count; ++i) {
+        out[i].x = X_VEC3_DOT(rows[0], in[i]) + translation[0];
+        out[i].y = X_VEC3_DOT(rows[1], in[i]) + translation[1];
+        out[i].z = X_VEC3_DOT(rows[2], in[i]) + translation[2];
+    }
+}
+
+void xBenchMath(void) {
+    const xQuat rotation = xQuatFromAxisAngle(xVec4Make(0.3f, 1.0f, 0.2f, 0.0f), X_DEG2RAD(35.0f));
+    const xMat4 m        = xMat4FromTRS(xVec4Make(1.0f, 2.0f, 3.0f, 0.0f), rotation, xVec4Make(2.0f, 2.0f, 2.0f, 0.0f));
+
+    xBenchVec3* aos     = X_MALLOC(xBenchVec3, POINT_COUNT);
+    xBenchVec3* aos_out = X_MALLOC(xBenchVec3, POINT_COUNT);
+    f32* soa            = X_MALLOC(f32, POINT_COUNT * 6);
+    X_CHECK_ALLOC(aos);
+    X_CHECK_ALLOC(aos_out);
+    X_CHECK_ALLOC(soa);
+    f32* xs = soa;
+    f32* ys = soa + POINT_COUNT;
+    f32* zs = soa + POINT_COUNT * 2;
+    f32* ox = soa + POINT_COUNT * 3;
+    f32* oy = soa + POINT_COUNT * 4;
+    f32* oz = soa + POINT_COUNT * 5;
+
+    for (u32 i = 0; i < POINT_COUNT; ++i) {
+        aos[i] = (xBenchVec3) {(f32)i * 0.001f, (f32)(i % 97), -(f32)(i % 13)};
+        xs[i]  = aos[i].x;
+        ys[i]  = aos[i].y;
+        zs[i]  = aos[i].z;
+    }
+
+    const xBenchVec3 rows[3] = {
+      {m.cols[0].x, m.cols[1].x, m.cols[2].x},
+      {m.cols[0].y, m.cols[1].y, m.cols[2].y},
+      {m.cols[0].z, m.cols[1].z, m.cols[2].z},
+    };
+    const f32 translation[3] = {m.cols[3].x, m.cols[3].y, m.cols[3].z};
+
+    f64 start = xBenchNow();
+    for (u32 rep = 0; rep < REPS; ++rep) {
+        transformWithMacros(rows, translation, aos, aos_out, POINT_COUNT);
+        X_BENCH_DO_NOT_OPTIMIZE(aos_out);
+    }
+    xBenchReport("transform points, X_VEC3_DOT AoS", xBenchNow() - start, (u64)REPS * POINT_COUNT);
+
+    xMat4* a   = X_MALLOC(xMat4, MATRIX_COUNT);
+    xMat4* b   = X_MALLOC(xMat4, MATRIX_COUNT);
+    xMat4* out = X_MALLOC(xMat4, MATRIX_COUNT);
+    X_CHECK_ALLOC(a);
+    X_CHECK_ALLOC(b);
+    X_CHECK_ALLOC(out);
+    for (u32 i = 0; i < MATRIX_COUNT; ++i) {
+        a[i] = m;
+        b[i] = xMat4Translation((f32)i, 1.0f, 2.0f);
+    }
+
+    const xMathPath original = xMathActivePath();
+    for (xMathPath path = 0; path < X_MATH_PATH_COUNT; ++path) {
+        if (!xMathForcePath(path)) { continue; }
+        char name[64];
+
+        start = xBenchNow();
+        for (u32 rep = 0; rep < REPS; ++rep) {
+            xMathTransformPointsSoA(&m, xs, ys, zs, ox, oy, oz, POINT_COUNT);
+            X_BENCH_DO_NOT_OPTIMIZE(ox);
+        }
+        snprintf(name, sizeof(name), "transform points, %s SoA", xMathPathName(path));
+        xBenchReport(name, xBenchNow() - start, (u64)REPS * POINT_COUNT);
+
+        // Results must match the macro baseline regardless of kernel
+        f32 max_error = 0.0f;
+        for (u32 i = 0; i < POINT_COUNT; ++i) {
+            max_error = X_MAX(max_error, X_ABS(ox[i] - aos_out[i].x));
+            max_error = X_MAX(max_error, X_ABS(oz[i] - aos_out[i].z));
+        }
+        printf("  %-40s %g\n", "max abs error vs baseline", max_error);
+
+        start = xBenchNow();
+        for (u32 rep = 0; rep < REPS; ++rep) {
+            xMathMulMat4Batch(a, b, out, MATRIX_COUNT);
+            X_BENCH_DO_NOT_OPTIMIZE(out);
+        }
+        snprintf(name, sizeof(name), "mat4 multiply batch, %s", xMathPathName(path));
+        xBenchReport(name, xBenchNow() - start, (u64)REPS * MATRIX_COUNT);
+    }
+    xMathForcePath(original);
+
+    X_FREE(a);
+    X_FREE(b);
+    X_FREE(out);
+    X_FREE(soa);
+    X_FREE(aos);
+    X_FREE(aos_out);
+}
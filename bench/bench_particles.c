@@ -0,0 +1,98 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <particles.h>
+#include <platform.h>
+
+#define PARTICLE_COUNT (2 * 1024 * 1024)
+#define FRAME_COUNT 20
+#define FRAME_DT (1.0f / 60.0f)
+
+static const xParticleParams kParams = {
+  .gravity     = {0.0f, -9.81f, 0.0f},
+  .drag        = 0.4f,
+  .size_start  = 0.25f,
+  .size_end    = 0.02f,
+  .color_start = X_COLOR_RGBA(255, 220, 120, 255),
+  .color_end   = X_COLOR_RGBA(120, 20, 0, 0),
+};
+
+/* Lifetimes of 0.5-3 s, so a few percent of the emitter expires and is refilled every frame */
+static const xParticleSpawn kSpawn = {
+  .position        = {0.0f, 0.0f, 0.0f},
+  .velocity        = {0.0f, 8.0f, 0.0f},
+  .velocity_jitter = 4.0f,
+  .lifetime_min    = 0.5f,
+  .lifetime_max    = 3.0f,
+};
+
+static void benchPath(xMathPath path, xJobSystem* jobs, const char* label, xParticleInstance* instances) {
+    xParticleEmitter emitter;
+    X_CHECK_MSG(xParticleEmitterInit(&emitter, PARTICLE_COUNT, &kParams), "Failed to create particle emitter");
+    if (!xParticleEmitterSetPath(&emitter, path)) {
+        xParticleEmitterShutdown(&emitter);
+        return;
+    }
+
+    // Age the emitter for a second first so lifetimes are spread out like a running effect
+    xParticleEmitterSpawn(&emitter, &kSpawn, PARTICLE_COUNT);
+    for (u32 frame = 0; frame < 60; ++frame) {
+        xParticleEmitterUpdate(&emitter, FRAME_DT, jobs);
+        xParticleEmitterSpawn(&emitter, &kSpawn, PARTICLE_COUNT);
+    }
+
+    f64 update_time   = 0.0;
+    f64 instance_time = 0.0;
+    u64 updated       = 0;
+    u64 written       = 0;
+    for (u32 frame = 0; frame < FRAME_COUNT; ++frame) {
+        updated += emitter.count;
+        const f64 t0 = xBenchNow();
+        xParticleEmitterUpdate(&emitter, FRAME_DT, jobs);
+        const f64 t1 = xBenchNow();
+        written += xParticleEmitterWriteInstances(&emitter, instances, jobs);
+        const f64 t2 = xBenchNow();
+        X_BENCH_DO_NOT_OPTIMIZE(instances[0]);
+
+        update_time += t1 - t0;
+        instance_time += t2 - t1;
+        xParticleEmitterSpawn(&emitter, &kSpawn, PARTICLE_COUNT);
+    }
+
+    char name[64];
+    snprintf(name, sizeof(name), "update + compact, %s (%s)", xMathPathName(path), label);
+    xBenchReport(name, update_time, updated);
+    snprintf(name, sizeof(name), "write instances, %s (%s)", xMathPathName(path), label);
+    xBenchReport(name, instance_time, written);
+
+    xParticleEmitterShutdown(&emitter);
+}
+
+/*
+ * Two million particles per frame through every kernel flavor the CPU runs:
+ * the fused integrate/age/compact pass and the instance write, on one thread
+ * and on the job system.
+ */
+void xBenchParticles(void) {
+    xParticleInstance* instances = X_MALLOC(xParticleInstance, PARTICLE_COUNT);
+    X_CHECK_ALLOC(instances);
+
+    for (xMathPath path = 0; path < X_MATH_PATH_COUNT; ++path) {
+        benchPath(path, NULL, "1 thread", instances);
+    }
+
+    const u32 cores = xPlatformCoreCount();
+    if (cores > 1) {
+        xJobSystem* jobs = xJobSystemCreate(cores);
+        char label[32];
+        snprintf(label, sizeof(label), "%u threads", cores);
+        for (xMathPath path = 0; path < X_MATH_PATH_COUNT; ++path) {
+            benchPath(path, jobs, label, instances);
+        }
+        xJobSystemDestroy(jobs);
+    }
+
+    X_FREE(instances);
+}
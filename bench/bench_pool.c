@@ -0,0 +1,80 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <pool.h>
+
+#define OBJECT_COUNT 100000
+#define ROUNDS 50
+
+typedef struct {
+    f32 position[3];
+    f32 velocity[3];
+    u32 flags;
+    u32 padding;
+} xBenchObject;
+
+static void benchMallocObjects(void) {
+    xBenchObject** objects = X_MALLOC(xBenchObject*, OBJECT_COUNT);
+
+    const f64 start = xBenchNow();
+    for (u32 round = 0; round < ROUNDS; ++round) {
+        for (u32 i = 0; i < OBJECT_COUNT; ++i) {
+            objects[i] = X_NEW(xBenchObject);
+        }
+        for (u32 i = 0; i < OBJECT_COUNT; i += 2) {
+            X_FREE(objects[i]);
+        }
+        for (u32 i = 1; i < OBJECT_COUNT; i += 2) {
+            X_FREE(objects[i]);
+        }
+    }
+    xBenchReport("malloc/free single objects", xBenchNow() - start, (u64)ROUNDS * OBJECT_COUNT);
+
+    X_FREE(objects);
+}
+
+static void benchPoolObjects(void) {
+    xPool pool;
+    X_CHECK(xPoolInit(&pool, sizeof(xBenchObject), OBJECT_COUNT));
+    xHandle* handles = X_MALLOC(xHandle, OBJECT_COUNT);
+
+    const f64 start = xBenchNow();
+    for (u32 round = 0; round < ROUNDS; ++round) {
+        for (u32 i = 0; i < OBJECT_COUNT; ++i) {
+            handles[i] = xPoolAcquire(&pool);
+        }
+        for (u32 i = 0; i < OBJECT_COUNT; i += 2) {
+            xPoolRelease(&pool, handles[i]);
+        }
+        for (u32 i = 1; i < OBJECT_COUNT; i += 2) {
+            xPoolRelease(&pool, handles[i]);
+        }
+    }
+    xBenchReport("pool acquire/release", xBenchNow() - start, (u64)ROUNDS * OBJECT_COUNT);
+
+    // Iterate a half-full pool the way a system would walk live objects
+    for (u32 i = 0; i < OBJECT_COUNT; ++i) {
+        handles[i] = xPoolAcquire(&pool);
+    }
+    for (u32 i = 0; i < OBJECT_COUNT; i += 2) {
+        xPoolRelease(&pool, handles[i]);
+    }
+
+    const f64 iter_start = xBenchNow();
+    for (u32 round = 0; round < ROUNDS; ++round) {
+        X_POOL_FOREACH(&pool, xBenchObject, object) {
+            object->position[0] += object->velocity[0];
+        }
+    }
+    xBenchReport("pool iterate live objects", xBenchNow() - iter_start, (u64)ROUNDS * pool.count);
+
+    X_FREE(handles);
+    xPoolShutdown(&pool);
+}
+
+void xBenchPool(void) {
+    benchMallocObjects();
+    benchPoolObjects();
+}
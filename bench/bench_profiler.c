@@ -0,0 +1,47 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <profiler.h>
+
+#define ZONE_COUNT 1000000
+#define ZONES_PER_FRAME 10000
+
+void xBenchProfiler(void) {
+    xProfilerInit();
+
+    // Zones are called directly so the cost is measured even when X_PROFILE_SCOPE is compiled out
+    f64 start = xBenchNow();
+    for (u32 i = 0; i < ZONE_COUNT; ++i) {
+        xProfileZone zone = xProfileZoneBegin("bench zone");
+        xProfileZoneEnd(&zone);
+        if ((i + 1) % ZONES_PER_FRAME == 0) { xProfilerFrameMark(); }
+    }
+    xBenchReport("zone begin/end + frame drain", xBenchNow() - start, ZONE_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < ZONE_COUNT; ++i) {
+        xProfileZone outer = xProfileZoneBegin("outer");
+        xProfileZone inner = xProfileZoneBegin("inner");
+        xProfileZoneEnd(&inner);
+        xProfileZoneEnd(&outer);
+        if ((i + 1) % ZONES_PER_FRAME == 0) { xProfilerFrameMark(); }
+    }
+    xBenchReport("nested zone pair", xBenchNow() - start, ZONE_COUNT);
+
+    start = xBenchNow();
+    for (u32 i = 0; i < ZONE_COUNT; ++i) {
+        X_BENCH_DO_NOT_OPTIMIZE(xProfileNow());
+    }
+    xBenchReport("raw timestamp", xBenchNow() - start, ZONE_COUNT);
+
+    // Timestamps must agree with the wall clock once calibrated
+    const u64 ticks      = xProfileNow();
+    const f64 wall_start = xBenchNow();
+    while (xBenchNow() - wall_start < 0.02) {}
+    printf("  %-40s %.3f ms\n", "20 ms wait measured as", xProfileTicksToMs(xProfileNow() - ticks));
+
+    xProfilerReport(stdout);
+    xProfilerShutdown();
+}
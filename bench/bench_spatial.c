@@ -0,0 +1,329 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <spatial.h>
+
+#include <math.h>
+#include <stdio.h>
+
+#define HALF_EXTENT 0.5f
+#define SPEED 0.05f
+#define TREE_MARGIN 0.1f
+#define CELL_SIZE 1.0f
+#define FRAMES 4
+#define QUERY_COUNT 10000
+#define BRUTE_FORCE_LIMIT 10000
+
+/* Every Nth grid query is checked against a linear scan; checking all of them at 1M objects takes minutes */
+#define VERIFY_STRIDE 64
+
+/* Uniform density: about one object per 16 unit cubes at every scale */
+#define VOLUME_PER_OBJECT 16.0f
+
+typedef struct {
+    xVec4* centers;
+    xVec4* velocities;
+    xAabb* bounds;
+    u32 count;
+    f32 extent;
+} xBenchScene;
+
+typedef struct {
+    const xAabbTree* tree;
+    const xSpatialHash* hash;
+    const xAabb* regions;
+    const xRay* rays;
+    u32* hits;
+} xBenchQueryBatch;
+
+#define RANDOM_SEED 0x12345678u
+
+static u32 sRandom = RANDOM_SEED;
+
+static xVec4 randomPoint(f32 extent) {
+    return xVec4Make(xBenchRandomUnit(&sRandom) * extent,
+                     xBenchRandomUnit(&sRandom) * extent,
+                     xBenchRandomUnit(&sRandom) * extent,
+                     0.0f);
+}
+
+static xAabb boxAround(xVec4 center) {
+    const xVec4 half = xVec4Make(HALF_EXTENT, HALF_EXTENT, HALF_EXTENT, 0.0f);
+    return xAabbMake(xVec4Sub(center, half), xVec4Add(center, half));
+}
+
+static void sceneInit(xBenchScene* scene, u32 count) {
+    scene->count      = count;
+    scene->extent     = cbrtf((f32)count * VOLUME_PER_OBJECT);
+    scene->centers    = X_MALLOC(xVec4, count);
+    scene->velocities = X_MALLOC(xVec4, count);
+    scene->bounds     = X_MALLOC(xAabb, count);
+    X_CHECK_ALLOC(scene->centers);
+    X_CHECK_ALLOC(scene->velocities);
+    X_CHECK_ALLOC(scene->bounds);
+    for (u32 i = 0; i < count; ++i) {
+        scene->centers[i]    = randomPoint(scene->extent);
+        scene->velocities[i] = xVec4Scale(xVec4Sub(randomPoint(2.0f), xVec4Make(1.0f, 1.0f, 1.0f, 0.0f)), SPEED);
+        scene->bounds[i]     = boxAround(scene->centers[i]);
+    }
+}
+
+static void sceneStep(xBenchScene* scene) {
+    for (u32 i = 0; i < scene->count; ++i) {
+        scene->centers[i] = xVec4Add(scene->centers[i], scene->velocities[i]);
+        scene->bounds[i]  = boxAround(scene->centers[i]);
+    }
+}
+
+static void sceneFree(xBenchScene* scene) {
+    X_FREE(scene->centers);
+    X_FREE(scene->velocities);
+    X_FREE(scene->bounds);
+}
+
+static bool countHit(void* user, u32 id) {
+    X_UNUSED(id);
+    (*(u32*)user)++;
+    return true;
+}
+
+static f32 closestHit(void* user, u32 id, f32 t) {
+    X_UNUSED(id);
+    (*(u32*)user)++;
+    return t;
+}
+
+static void treeRegionBatch(void* data, u32 begin, u32 end) {
+    const xBenchQueryBatch* batch = (const xBenchQueryBatch*)data;
+    for (u32 i = begin; i < end; ++i) {
+        xAabbTreeQuery(batch->tree, &batch->regions[i], countHit, &batch->hits[i]);
+    }
+}
+
+static void treeRayBatch(void* data, u32 begin, u32 end) {
+    const xBenchQueryBatch* batch = (const xBenchQueryBatch*)data;
+    for (u32 i = begin; i < end; ++i) {
+        xAabbTreeRayCast(batch->tree, &batch->rays[i], closestHit, &batch->hits[i]);
+    }
+}
+
+static void hashRegionBatch(void* data, u32 begin, u32 end) {
+    const xBenchQueryBatch* batch = (const xBenchQueryBatch*)data;
+    for (u32 i = begin; i < end; ++i) {
+        xSpatialHashQuery(batch->hash, &batch->regions[i], countHit, &batch->hits[i]);
+    }
+}
+
+static void hashRayBatch(void* data, u32 begin, u32 end) {
+    const xBenchQueryBatch* batch = (const xBenchQueryBatch*)data;
+    for (u32 i = begin; i < end; ++i) {
+        xSpatialHashRayCast(batch->hash, &batch->rays[i], closestHit, &batch->hits[i]);
+    }
+}
+
+static f32 recordClosest(void* user, u32 id, f32 t) {
+    X_UNUSED(id);
+    f32* closest = (f32*)user;
+    *closest     = X_MIN(*closest, t);
+    return t;
+}
+
+static u32 bruteForceRegion(const xBenchScene* scene, const xAabb* region) {
+    u32 hits = 0;
+    for (u32 i = 0; i < scene->count; ++i) {
+        hits += xAabbOverlaps(&scene->bounds[i], region);
+    }
+    return hits;
+}
+
+static f32 bruteForceRay(const xBenchScene* scene, const xRay* ray) {
+    const xVec4 inverse = xVec4Make(1.0f / ray->direction.x, 1.0f / ray->direction.y, 1.0f / ray->direction.z, 0.0f);
+    f32 closest         = INFINITY;
+    for (u32 i = 0; i < scene->count; ++i) {
+        const f32 t = xAabbRayEntry(&scene->bounds[i], ray->origin, inverse, ray->max_t);
+        if (t >= 0.0f) { closest = X_MIN(closest, t); }
+    }
+    return closest;
+}
+
+/* The grid must agree with a linear scan of the bounds it was built from, or its timings mean nothing */
+static bool verifyHashRegions(const xBenchScene* scene, const xAabb* regions, const u32* hits) {
+    for (u32 i = 0; i < QUERY_COUNT; i += VERIFY_STRIDE) {
+        const u32 expected = bruteForceRegion(scene, &regions[i]);
+        if (hits[i] != expected) {
+            X_PRINT_ERROR("Hash region query %u found %u objects, linear scan found %u", i, hits[i], expected);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool verifyHashRays(const xSpatialHash* hash, const xBenchScene* scene, const xRay* rays) {
+    for (u32 i = 0; i < QUERY_COUNT; i += VERIFY_STRIDE) {
+        f32 closest = INFINITY;
+        xSpatialHashRayCast(hash, &rays[i], recordClosest, &closest);
+        const f32 expected = bruteForceRay(scene, &rays[i]);
+        if (closest != expected) {
+            X_PRINT_ERROR("Hash ray %u hit at %f, linear scan hit at %f", i, (f64)closest, (f64)expected);
+            return false;
+        }
+    }
+    return true;
+}
+
+static u64 bruteForcePairs(const xBenchScene* scene) {
+    u64 pairs = 0;
+    for (u32 a = 0; a < scene->count; ++a) {
+        for (u32 b = a + 1; b < scene->count; ++b) {
+            pairs += xAabbOverlaps(&scene->bounds[a], &scene->bounds[b]);
+        }
+    }
+    return pairs;
+}
+
+static void runScale(xJobSystem* jobs, u32 count) {
+    xBenchScene scene;
+    sceneInit(&scene, count);
+    char name[64];
+
+    xAabb* regions = X_MALLOC(xAabb, QUERY_COUNT);
+    xRay* rays     = X_MALLOC(xRay, QUERY_COUNT);
+    u32* hits      = X_CALLOC(u32, QUERY_COUNT);
+    X_CHECK_ALLOC(regions);
+    X_CHECK_ALLOC(rays);
+    X_CHECK_ALLOC(hits);
+    for (u32 i = 0; i < QUERY_COUNT; ++i) {
+        const xVec4 center = randomPoint(scene.extent);
+        const xVec4 half   = xVec4Make(2.0f, 2.0f, 2.0f, 0.0f);
+        const xVec4 dir    = xVec3Normalize(xVec4Sub(randomPoint(2.0f), xVec4Make(1.0f, 1.0f, 1.0f, 0.0f)));
+        regions[i]         = xAabbMake(xVec4Sub(center, half), xVec4Add(center, half));
+        rays[i]            = (xRay) {center, dir, scene.extent};
+    }
+
+    if (count <= BRUTE_FORCE_LIMIT) {
+        const f64 start = xBenchNow();
+        const u64 pairs = bruteForcePairs(&scene);
+        snprintf(name, sizeof(name), "%uk brute-force pairs (%llu)", count / 1000, (unsigned long long)pairs);
+        xBenchReport(name, xBenchNow() - start, count);
+    }
+
+    // Dynamic AABB tree: incremental updates, pairs for moved proxies
+    xAabbTree tree;
+    X_CHECK_MSG(xAabbTreeInit(&tree, count * 2, TREE_MARGIN), "Failed to init AABB tree");
+    u32* proxies = X_MALLOC(u32, count);
+    X_CHECK_ALLOC(proxies);
+
+    f64 start = xBenchNow();
+    for (u32 i = 0; i < count; ++i) {
+        proxies[i] = xAabbTreeInsert(&tree, &scene.bounds[i], i);
+    }
+    snprintf(name, sizeof(name), "%uk tree insert (height %u)", count / 1000, xAabbTreeHeight(&tree));
+    xBenchReport(name, xBenchNow() - start, count);
+
+    xSpatialPairList pairs = {0};
+    xAabbTreeQueryPairs(&tree, jobs, &pairs);
+
+    f64 move_time  = 0.0;
+    f64 pair_time  = 0.0;
+    u64 reinserted = 0;
+    u64 reported   = 0;
+    for (u32 frame = 0; frame < FRAMES; ++frame) {
+        sceneStep(&scene);
+        start = xBenchNow();
+        for (u32 i = 0; i < count; ++i) {
+            reinserted += xAabbTreeMove(&tree, proxies[i], &scene.bounds[i], scene.velocities[i]);
+        }
+        move_time += xBenchNow() - start;
+
+        start = xBenchNow();
+        xAabbTreeQueryPairs(&tree, jobs, &pairs);
+        pair_time += xBenchNow() - start;
+        reported += pairs.count;
+    }
+    const f64 reinserted_percent = 100.0 * (f64)reinserted / ((f64)count * FRAMES);
+    snprintf(name, sizeof(name), "%uk tree move (%.0f%% re-inserted)", count / 1000, reinserted_percent);
+    xBenchReport(name, move_time, (u64)count * FRAMES);
+    snprintf(name, sizeof(name), "%uk tree pairs (%llu/frame)", count / 1000, (unsigned long long)(reported / FRAMES));
+    xBenchReport(name, pair_time, (u64)count * FRAMES);
+
+    xBenchQueryBatch batch = {&tree, NULL, regions, rays, hits};
+    start                  = xBenchNow();
+    xJobsParallelFor(jobs, QUERY_COUNT, 64, treeRegionBatch, &batch);
+    snprintf(name, sizeof(name), "%uk tree region query", count / 1000);
+    xBenchReport(name, xBenchNow() - start, QUERY_COUNT);
+
+    start = xBenchNow();
+    xJobsParallelFor(jobs, QUERY_COUNT, 64, treeRayBatch, &batch);
+    snprintf(name, sizeof(name), "%uk tree closest-hit ray", count / 1000);
+    xBenchReport(name, xBenchNow() - start, QUERY_COUNT);
+
+    X_FREE(proxies);
+    xAabbTreeShutdown(&tree);
+
+    // Spatial hash: full rebuild and all pairs every frame
+    xSpatialHash hash;
+    xSpatialHashInit(&hash, CELL_SIZE);
+    f64 build_time = 0.0;
+    pair_time      = 0.0;
+    reported       = 0;
+    for (u32 frame = 0; frame < FRAMES; ++frame) {
+        sceneStep(&scene);
+        start = xBenchNow();
+        X_CHECK_MSG(xSpatialHashBuild(&hash, scene.bounds, count), "Failed to build spatial hash");
+        build_time += xBenchNow() - start;
+
+        start = xBenchNow();
+        xSpatialHashQueryPairs(&hash, jobs, &pairs);
+        pair_time += xBenchNow() - start;
+        reported += pairs.count;
+    }
+    snprintf(name, sizeof(name), "%uk hash rebuild", count / 1000);
+    xBenchReport(name, build_time, (u64)count * FRAMES);
+    // The scene hasn't moved since the last build, so the final frame's pairs can be checked directly
+    const u64 expected_pairs = count <= BRUTE_FORCE_LIMIT ? bruteForcePairs(&scene) : pairs.count;
+    if (pairs.count == expected_pairs) {
+        snprintf(
+          name, sizeof(name), "%uk hash pairs (%llu/frame)", count / 1000, (unsigned long long)(reported / FRAMES));
+        xBenchReport(name, pair_time, (u64)count * FRAMES);
+    } else {
+        X_PRINT_ERROR("Hash found %u pairs, linear scan found %llu", pairs.count, (unsigned long long)expected_pairs);
+    }
+
+    batch.hash = &hash;
+    memset(hits, 0, sizeof(u32) * QUERY_COUNT);
+    start = xBenchNow();
+    xJobsParallelFor(jobs, QUERY_COUNT, 64, hashRegionBatch, &batch);
+    const f64 region_time = xBenchNow() - start;
+    if (verifyHashRegions(&scene, regions, hits)) {
+        snprintf(name, sizeof(name), "%uk hash region query", count / 1000);
+        xBenchReport(name, region_time, QUERY_COUNT);
+    }
+
+    start = xBenchNow();
+    xJobsParallelFor(jobs, QUERY_COUNT, 64, hashRayBatch, &batch);
+    const f64 ray_time = xBenchNow() - start;
+    if (verifyHashRays(&hash, &scene, rays)) {
+        snprintf(name, sizeof(name), "%uk hash closest-hit ray", count / 1000);
+        xBenchReport(name, ray_time, QUERY_COUNT);
+    }
+
+    xSpatialHashShutdown(&hash);
+    xSpatialPairListFree(&pairs);
+    X_FREE(regions);
+    X_FREE(rays);
+    X_FREE(hits);
+    sceneFree(&scene);
+}
+
+void xBenchSpatial(void) {
+    sRandom = RANDOM_SEED;  // Identical scene on every harness pass
+
+    xJobSystem* jobs   = xJobSystemCreate(0);
+    const u32 counts[] = {10000, 100000, 1000000};
+    X_FOREACH(const u32, count, counts) {
+        runScale(jobs, *count);
+    }
+    xJobSystemDestroy(jobs);
+}
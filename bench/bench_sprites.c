@@ -0,0 +1,107 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <platform.h>
+#include <sprite.h>
+
+#define SPRITE_COUNT 50000
+#define FRAME_COUNT 50
+#define SPRITES_PER_TEXTURE 512
+#define WIDTH 1920
+#define HEIGHT 1080
+
+/* 8-64 px sprites across a 1080p target, a quarter of them rotated, spread over 16 array slices */
+static xSprite* makeSprites(u32 count) {
+    xSprite* sprites = X_MALLOC(xSprite, count);
+    X_CHECK_ALLOC(sprites);
+
+    u32 state = 0x5EED5u;
+    for (u32 i = 0; i < count; ++i) {
+        const f32 size = 8.0f + xBenchRandomUnit(&state) * 56.0f;
+        const f32 u    = (f32)(xBenchRandom(&state) & 7) / 8.0f;
+
+        sprites[i] = (xSprite) {
+          .x        = xBenchRandomUnit(&state) * WIDTH,
+          .y        = xBenchRandomUnit(&state) * HEIGHT,
+          .width    = size,
+          .height   = size,
+          .rotation = (xBenchRandom(&state) & 3) == 0 ? xBenchRandomUnit(&state) * 6.2831853f : 0.0f,
+          .u0       = u,
+          .v0       = 0.0f,
+          .u1       = u + 0.125f,
+          .v1       = 1.0f,
+          .color    = X_COLOR_RGBA(xBenchRandom(&state), xBenchRandom(&state), xBenchRandom(&state), 255),
+          .layer    = xBenchRandom(&state) & 15,
+        };
+    }
+    return sprites;
+}
+
+/* Sprites come in runs sharing one texture array, as they would from a sorted scene or a tilemap */
+static void queueFrame(xSpriteBatcher* batcher, const xSprite* sprites) {
+    xSpriteBatcherBegin(batcher, WIDTH, HEIGHT);
+    for (u32 i = 0; i < SPRITE_COUNT; ++i) {
+        if (i % SPRITES_PER_TEXTURE == 0) { xSpriteBatcherSetTexture(batcher, 1 + (i / SPRITES_PER_TEXTURE) % 4); }
+        xSpriteBatcherDraw(batcher, &sprites[i]);
+    }
+}
+
+static void benchFrames(const xSprite* sprites, xJobSystem* jobs, const char* label) {
+    xSpriteNullBackend null_backend;
+    xSpriteNullBackendInit(&null_backend, 0);
+    xSpriteBatcher batcher;
+    xSpriteBatcherInit(&batcher, &null_backend.backend, jobs);
+
+    f64 queue_time    = 0.0;
+    f64 generate_time = 0.0;
+    f64 end_time      = 0.0;
+    for (u32 frame = 0; frame < FRAME_COUNT; ++frame) {
+        const f64 t0 = xBenchNow();
+        queueFrame(&batcher, sprites);
+        const f64 t1 = xBenchNow();
+        xSpriteBatcherEnd(&batcher);
+        const f64 t2 = xBenchNow();
+
+        queue_time += t1 - t0;
+        generate_time += batcher.stats.generate_seconds;
+        end_time += t2 - t1;
+    }
+
+    char name[64];
+    snprintf(name, sizeof(name), "queue sprites (%s)", label);
+    xBenchReport(name, queue_time, (u64)FRAME_COUNT * SPRITE_COUNT);
+    snprintf(name, sizeof(name), "generate quads (%s)", label);
+    xBenchReport(name, generate_time, (u64)FRAME_COUNT * SPRITE_COUNT);
+    snprintf(name, sizeof(name), "end frame (%s)", label);
+    xBenchReport(name, end_time, (u64)FRAME_COUNT * SPRITE_COUNT);
+    printf("  %-40s %u batches, %llu texture binds per frame\n",
+           "batching",
+           batcher.stats.batches,
+           (unsigned long long)(null_backend.texture_changes / FRAME_COUNT));
+
+    xSpriteBatcherShutdown(&batcher);
+    xSpriteNullBackendShutdown(&null_backend);
+}
+
+/*
+ * Sprite batching on the null backend: queuing, quad generation into the ring
+ * and the whole End, on one thread and on the job system.
+ */
+void xBenchSprites(void) {
+    xSprite* sprites = makeSprites(SPRITE_COUNT);
+
+    benchFrames(sprites, NULL, "1 thread");
+
+    const u32 cores = xPlatformCoreCount();
+    if (cores > 1) {
+        xJobSystem* jobs = xJobSystemCreate(cores);
+        char label[32];
+        snprintf(label, sizeof(label), "%u threads", cores);
+        benchFrames(sprites, jobs, label);
+        xJobSystemDestroy(jobs);
+    }
+
+    X_FREE(sprites);
+}
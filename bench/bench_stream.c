@@ -0,0 +1,149 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <stream.h>
+
+#define STREAM_DIR "xenc_bench_stream"
+#define STREAM_FILE_COUNT 512
+#define STREAM_FILE_SIZE (64 * 1024)
+#define STREAM_FRAME_BUDGET 0.002
+
+typedef struct {
+    u32 completed;
+    u64 bytes;
+} xStreamBenchTally;
+
+static void filePath(char* out, size_t size, u32 index) {
+    snprintf(out, size, STREAM_DIR "/chunk_%03u.bin", index);
+}
+
+static void onLoaded(void* user, xStreamHandle handle, xStreamStatus status, const void* data, u64 size) {
+    X_UNUSED(handle);
+    X_UNUSED(data);
+    xStreamBenchTally* tally = (xStreamBenchTally*)user;
+    if (status == X_STREAM_DONE) { tally->bytes += size; }
+    tally->completed++;
+}
+
+static bool createFiles(void) {
+    if (!xBenchTempDirCreate(STREAM_DIR)) { return false; }
+    u8* data = X_MALLOC(u8, STREAM_FILE_SIZE);
+    X_CHECK_ALLOC(data);
+    for (u32 i = 0; i < STREAM_FILE_SIZE; ++i) {
+        data[i] = (u8)(i * 31u);
+    }
+
+    bool ok = true;
+    char path[64];
+    for (u32 i = 0; i < STREAM_FILE_COUNT && ok; ++i) {
+        filePath(path, sizeof(path), i);
+        FILE* file = fopen(path, "wb");
+        ok         = file != NULL && fwrite(data, 1, STREAM_FILE_SIZE, file) == STREAM_FILE_SIZE;
+        if (file != NULL) { fclose(file); }
+    }
+    X_FREE(data);
+    return ok;
+}
+
+static void removeFiles(void) {
+    char path[64];
+    for (u32 i = 0; i < STREAM_FILE_COUNT; ++i) {
+        filePath(path, sizeof(path), i);
+        remove(path);
+    }
+    xBenchTempDirRemove(STREAM_DIR);
+}
+
+static void queueAll(xStreamer* streamer, xStreamHandle* handles, xStreamBenchTally* tally) {
+    char path[64];
+    for (u32 i = 0; i < STREAM_FILE_COUNT; ++i) {
+        filePath(path, sizeof(path), i);
+        const xStreamRequest request = {.path = path, .priority = (s32)(i % 4), .callback = onLoaded, .user = tally};
+        handles[i] = xStreamLoad(streamer, &request);
+    }
+}
+
+static void releaseAll(xStreamer* streamer, xStreamHandle* handles) {
+    for (u32 i = 0; i < STREAM_FILE_COUNT; ++i) {
+        xStreamRelease(streamer, handles[i]);
+    }
+}
+
+static void runBackend(xStreamBackend backend, const char* label) {
+    const xStreamerDesc desc = {.backend = backend, .max_bytes_in_flight = 8ull * 1024 * 1024};
+    xStreamer* streamer      = xStreamerCreate(&desc);
+    if (streamer == NULL) { return; }
+    if (xStreamerBackend(streamer) != backend) {
+        printf("  %-40s unavailable\n", label);
+        xStreamerDestroy(streamer);
+        return;
+    }
+
+    xStreamHandle* handles = X_CALLOC(xStreamHandle, STREAM_FILE_COUNT);
+    X_CHECK_ALLOC(handles);
+    char name[96];
+
+    // Throughput: drain with an unlimited budget until every request is back
+    xStreamBenchTally tally = {0};
+    f64 start               = xBenchNow();
+    queueAll(streamer, handles, &tally);
+    while (tally.completed < STREAM_FILE_COUNT) {
+        xStreamerUpdate(streamer, 1.0);
+    }
+    snprintf(name, sizeof(name), "%s load all", label);
+    xBenchReport(name, xBenchNow() - start, STREAM_FILE_COUNT);
+    releaseAll(streamer, handles);
+
+    // Frame-paced: how many frames with completions the load is spread over, and the worst drain cost
+    X_ZERO_STRUCT(&tally);
+    queueAll(streamer, handles, &tally);
+    u32 frames     = 0;
+    f64 worst      = 0.0;
+    f64 frame_time = 0.0;
+    while (tally.completed < STREAM_FILE_COUNT) {
+        const f64 frame_start = xBenchNow();
+        if (xStreamerUpdate(streamer, STREAM_FRAME_BUDGET) == 0) { continue; }
+        const f64 elapsed = xBenchNow() - frame_start;
+        worst             = X_MAX(worst, elapsed);
+        frame_time += elapsed;
+        frames++;
+    }
+    snprintf(name, sizeof(name), "%s drain (2 ms budget)", label);
+    xBenchReport(name, frame_time, frames);
+    printf("  %-40s %u frames, worst %.3f ms\n", "", frames, X_SEC_TO_MS(worst));
+    releaseAll(streamer, handles);
+
+    // Cancellation: queue everything, then cancel the lower half straight away
+    X_ZERO_STRUCT(&tally);
+    queueAll(streamer, handles, &tally);
+    start         = xBenchNow();
+    u32 cancelled = 0;
+    for (u32 i = 0; i < STREAM_FILE_COUNT; i += 2) {
+        if (xStreamCancel(streamer, handles[i])) { cancelled++; }
+    }
+    snprintf(name, sizeof(name), "%s cancel", label);
+    xBenchReport(name, xBenchNow() - start, STREAM_FILE_COUNT / 2);
+    while (xStreamerPendingCount(streamer) > 0) {
+        xStreamerUpdate(streamer, 1.0);
+    }
+    releaseAll(streamer, handles);
+    X_BENCH_DO_NOT_OPTIMIZE(cancelled);
+
+    X_FREE(handles);
+    xStreamerDestroy(streamer);
+}
+
+void xBenchStream(void) {
+    if (!createFiles()) {
+        X_PRINT_ERROR("Failed to generate benchmark files in '%s'", STREAM_DIR);
+        removeFiles();
+        return;
+    }
+    printf("  %-40s %u files x %u KB\n", "data set", STREAM_FILE_COUNT, STREAM_FILE_SIZE / 1024);
+
+    runBackend(X_STREAM_BACKEND_IO_URING, "io_uring");
+    runBackend(X_STREAM_BACKEND_PREAD, "pread pool");
+    removeFiles();
+}
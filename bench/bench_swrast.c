@@ -0,0 +1,93 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <platform.h>
+#include <swrast.h>
+
+#define WIDTH 1280
+#define HEIGHT 720
+#define TRIANGLE_COUNT 100000
+#define FRAME_COUNT 20
+
+/* Small random triangles scattered across the screen, roughly 10-20 px each */
+static xVertex* makeTriangles(u32 count) {
+    xVertex* vertices = X_MALLOC(xVertex, (size_t)count * 3);
+    X_CHECK_ALLOC(vertices);
+
+    u32 state = 0xC0FFEEu;
+    for (u32 i = 0; i < count; ++i) {
+        const f32 cx    = xBenchRandomUnit(&state) * 2.0f - 1.0f;
+        const f32 cy    = xBenchRandomUnit(&state) * 2.0f - 1.0f;
+        const f32 z     = xBenchRandomUnit(&state) * 2.0f - 1.0f;
+        const f32 size  = 0.01f + xBenchRandomUnit(&state) * 0.02f;
+        const u32 color = X_COLOR_RGB(xBenchRandom(&state), xBenchRandom(&state), xBenchRandom(&state));
+
+        vertices[i * 3 + 0] = (xVertex) {cx - size, cy - size, z, color};
+        vertices[i * 3 + 1] = (xVertex) {cx + size, cy - size, z, color};
+        vertices[i * 3 + 2] = (xVertex) {cx, cy + size, z, color};
+    }
+    return vertices;
+}
+
+static f64 renderFrames(xRenderer* renderer, xMeshHandle mesh) {
+    const f64 start = xBenchNow();
+    for (u32 frame = 0; frame < FRAME_COUNT; ++frame) {
+        xRendererFrameBegin(renderer);
+        xRendererClear(renderer, 0, X_COLOR_RGB(16, 16, 24), 1.0f);
+        xRendererDraw(renderer,
+                      &(xRenderDraw) {
+                        .state          = X_RENDER_STATE_DEFAULT,
+                        .mesh           = mesh,
+                        .index_count    = TRIANGLE_COUNT * 3,
+                        .instance_count = 1,
+                      });
+        xRendererFrameEnd(renderer);
+    }
+    return xBenchNow() - start;
+}
+
+void xBenchSwrast(void) {
+    xRenderer* renderer = xRendererCreate();
+    xRendererInitialize(renderer, WIDTH, HEIGHT);
+
+    xVertex* vertices      = makeTriangles(TRIANGLE_COUNT);
+    const xMeshHandle mesh = xRendererCreateMesh(renderer,
+                                                 &(xMeshDesc) {
+                                                   .vertex_count  = TRIANGLE_COUNT * 3,
+                                                   .vertex_stride = sizeof(xVertex),
+                                                   .vertices      = vertices,
+                                                 });
+
+    const xSwKernel kernels[] = {X_SW_KERNEL_SCALAR, X_SW_KERNEL_SSE2, X_SW_KERNEL_AVX2};
+    const u32 cores           = xPlatformCoreCount();
+
+    for (u32 threads = 1; threads <= cores; threads = threads < cores ? X_MIN(threads * 2, cores) : threads + 1) {
+        xJobSystem* jobs = xJobSystemCreate(threads);
+        xSoftwareBackend sb;
+        X_CHECK(xSoftwareBackendInit(&sb, renderer, jobs));
+        xRendererSetBackend(renderer, &sb.backend);
+
+        X_FOREACH(const xSwKernel, kernel, kernels) {
+            if (!xSoftwareBackendSetKernel(&sb, *kernel)) { continue; }
+
+            char name[64];
+            snprintf(name, sizeof(name), "%s, %u thread(s), tris", sb.kernel_name, threads);
+            const f64 seconds = renderFrames(renderer, mesh);
+            xBenchReport(name, seconds, (u64)FRAME_COUNT * TRIANGLE_COUNT);
+            printf("  %-40s %10.3f ms/frame\n", "", X_SEC_TO_MS(seconds / FRAME_COUNT));
+        }
+
+        if (threads == cores) { xSoftwareBackendWritePPM(&sb, "xenc_bench_swrast.ppm"); }
+
+        xRendererSetBackend(renderer, NULL);
+        xSoftwareBackendShutdown(&sb);
+        xJobSystemDestroy(jobs);
+    }
+
+    xRendererDestroyMesh(renderer, mesh);
+    X_FREE(vertices);
+    xRendererShutdown(renderer);
+    xRendererDestroy(renderer);
+}
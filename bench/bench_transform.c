@@ -0,0 +1,128 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <platform.h>
+#include <transform.h>
+
+#define ROOT_COUNT 64
+#define FAN_OUT 4
+#define FRAME_COUNT 10
+#define DIRTY_PERCENT 2
+#define REPARENT_COUNT 1000
+
+static xTransformLocal randomLocal(u32* state) {
+    const f32 angle       = (f32)(xBenchRandom(state) & 1023) / 163.0f;
+    xTransformLocal local = xTransformLocalIdentity();
+    local.translation     = xVec4Make((f32)(xBenchRandom(state) & 255), (f32)(xBenchRandom(state) & 255), 0.0f, 0.0f);
+    local.rotation        = xQuatFromAxisAngle(xVec4Make(0.0f, 1.0f, 0.0f, 0.0f), angle);
+    return local;
+}
+
+/* Scene-like tree: a few roots, then every node gets FAN_OUT children in creation order (about 8 levels at 1M) */
+static xTransform* buildTree(xTransformHierarchy* hierarchy, u32 count, u32* state) {
+    xTransform* nodes = X_MALLOC(xTransform, count);
+    X_CHECK_ALLOC(nodes);
+
+    for (u32 i = 0; i < count; ++i) {
+        const xTransform parent     = i < ROOT_COUNT ? X_HANDLE_INVALID : nodes[(i - ROOT_COUNT) / FAN_OUT];
+        const xTransformLocal local = randomLocal(state);
+        nodes[i]                    = xTransformCreate(hierarchy, parent, &local);
+    }
+    return nodes;
+}
+
+static void benchUpdates(xTransformHierarchy* hierarchy,
+                         const xTransform* nodes,
+                         u32 count,
+                         xJobSystem* jobs,
+                         const char* label,
+                         u32* state) {
+    char name[64];
+
+    // Everything dirty, as after loading a level
+    for (u32 i = 0; i < count; ++i) {
+        xTransformSetLocal(hierarchy, nodes[i], xTransformGetLocal(hierarchy, nodes[i]));
+    }
+    f64 start = xBenchNow();
+    xTransformUpdate(hierarchy, jobs);
+    snprintf(name, sizeof(name), "full update, %uk nodes (%s)", count / 1000, label);
+    xBenchReport(name, xBenchNow() - start, count);
+
+    f64 elapsed = 0.0;
+    for (u32 frame = 0; frame < FRAME_COUNT; ++frame) {
+        start = xBenchNow();
+        xTransformUpdate(hierarchy, jobs);
+        elapsed += xBenchNow() - start;
+    }
+    // Nothing marked: reported per frame, as the cost does not depend on the node count
+    snprintf(name, sizeof(name), "static frame, %uk nodes (%s)", count / 1000, label);
+    xBenchReport(name, elapsed, FRAME_COUNT);
+
+    // A few percent of nodes animated per frame, anywhere in the tree
+    elapsed     = 0.0;
+    u64 updated = 0;
+    for (u32 frame = 0; frame < FRAME_COUNT; ++frame) {
+        for (u32 i = 0; i < count / (100 / DIRTY_PERCENT); ++i) {
+            const xTransformLocal local = randomLocal(state);
+            xTransformSetLocal(hierarchy, nodes[xBenchRandom(state) % count], &local);
+        }
+        start = xBenchNow();
+        xTransformUpdate(hierarchy, jobs);
+        elapsed += xBenchNow() - start;
+        updated += hierarchy->stats.updated;
+    }
+    snprintf(name, sizeof(name), "%d%% dirty update, %uk nodes (%s)", DIRTY_PERCENT, count / 1000, label);
+    xBenchReport(name, elapsed, (u64)FRAME_COUNT * count);
+    printf("  %-40s %.1f%% of nodes recomputed per frame\n",
+           "propagation",
+           100.0 * (f64)updated / ((f64)FRAME_COUNT * count));
+}
+
+static void benchHierarchy(u32 count, xJobSystem* jobs, const char* label) {
+    xTransformHierarchy hierarchy;
+    X_CHECK_MSG(xTransformHierarchyInit(&hierarchy, count), "Failed to create transform hierarchy");
+    u32 state = 0x5EED5u;
+    char name[64];
+
+    f64 start         = xBenchNow();
+    xTransform* nodes = buildTree(&hierarchy, count, &state);
+    snprintf(name, sizeof(name), "build, %uk nodes (%s)", count / 1000, label);
+    xBenchReport(name, xBenchNow() - start, count);
+
+    benchUpdates(&hierarchy, nodes, count, jobs, label, &state);
+
+    // Move small subtrees from the bottom half under nodes at other depths, shifting their levels
+    start = xBenchNow();
+    for (u32 i = 0; i < REPARENT_COUNT; ++i) {
+        const xTransform node   = nodes[count / 2 + xBenchRandom(&state) % (count / 2)];
+        const xTransform parent = nodes[xBenchRandom(&state) % (count / 4)];
+        xTransformSetParent(&hierarchy, node, parent);
+    }
+    snprintf(name, sizeof(name), "reparent subtree, %uk nodes (%s)", count / 1000, label);
+    xBenchReport(name, xBenchNow() - start, REPARENT_COUNT);
+
+    X_FREE(nodes);
+    xTransformHierarchyShutdown(&hierarchy);
+}
+
+/*
+ * World matrix propagation for 100k and 1M node hierarchies: a full rebuild,
+ * a frame with nothing changed and frames with a few percent of locals
+ * changed, plus build and reparent costs, on one thread and on the job system.
+ */
+void xBenchTransform(void) {
+    benchHierarchy(100000, NULL, "1 thread");
+    benchHierarchy(1000000, NULL, "1 thread");
+
+    const u32 cores = xPlatformCoreCount();
+    if (cores > 1) {
+        xJobSystem* jobs = xJobSystemCreate(cores);
+        char label[32];
+        snprintf(label, sizeof(label), "%u threads", cores);
+        benchHierarchy(100000, jobs, label);
+        benchHierarchy(1000000, jobs, label);
+        xJobSystemDestroy(jobs);
+    }
+}
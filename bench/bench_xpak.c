@@ -0,0 +1,197 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <xpak.h>
+
+#if defined(__linux__)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#define ASSET_DIR "xenc_bench_assets"
+#define ASSET_COUNT 2000
+#define ASSET_MIN_SIZE (4 * 1024)
+#define ASSET_MAX_SIZE (64 * 1024)
+#define RAW_PAK ASSET_DIR "/raw.xpak"
+#define LZ4_PAK ASSET_DIR "/lz4.xpak"
+
+typedef struct {
+    const char* name;
+    bool cold;
+    int source;  // 0 = loose files, 1 = uncompressed pak, 2 = LZ4 pak
+} xPakBenchRun;
+
+static void assetPath(char* out, size_t size, u32 index) {
+    snprintf(out, size, ASSET_DIR "/asset_%04u.bin", index);
+}
+
+/* Half-compressible filler: a repeating pattern with noise, roughly what texture and mesh data looks like */
+static void fillAsset(u8* data, u32 size, u32 seed) {
+    u32 state = seed * 2654435761u + 1u;
+    for (u32 i = 0; i < size; ++i) {
+        state   = state * 1664525u + 1013904223u;
+        data[i] = (i & 7) < 4 ? (u8)(i >> 3) : (u8)(state >> 24);
+    }
+}
+
+/* Drop a file from the page cache so the next read has to hit the disk */
+static void evictFile(const char* path) {
+#if defined(__linux__)
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) { return; }
+    fdatasync(fd);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+#else
+    (void)path;
+#endif
+}
+
+static void evictAll(void) {
+    char path[64];
+    for (u32 i = 0; i < ASSET_COUNT; ++i) {
+        assetPath(path, sizeof(path), i);
+        evictFile(path);
+    }
+    evictFile(RAW_PAK);
+    evictFile(LZ4_PAK);
+}
+
+/* The baseline: one fopen/fread and one malloc per asset */
+static u64 loadLoose(void) {
+    char path[64];
+    u64 checksum = 0;
+    for (u32 i = 0; i < ASSET_COUNT; ++i) {
+        assetPath(path, sizeof(path), i);
+        FILE* file = fopen(path, "rb");
+        if (file == NULL) { continue; }
+        fseek(file, 0, SEEK_END);
+        const long size = ftell(file);
+        fseek(file, 0, SEEK_SET);
+
+        u8* data = X_MALLOC(u8, (size_t)size);
+        if (data != NULL && fread(data, 1, (size_t)size, file) == (size_t)size) { checksum += data[size - 1]; }
+        X_FREE(data);
+        fclose(file);
+    }
+    return checksum;
+}
+
+/* One mapping for the whole set; every payload is copied (or decoded) into an arena buffer */
+static u64 loadPak(const char* pak_path, xArena* arena) {
+    xPak pak;
+    if (!xPakOpen(&pak, pak_path)) { return 0; }
+
+    char path[64];
+    u64 checksum = 0;
+    xArenaReset(arena);
+    for (u32 i = 0; i < ASSET_COUNT; ++i) {
+        assetPath(path, sizeof(path), i);
+        const xPakEntry* entry = xPakFindPath(&pak, path);
+        if (entry == NULL) { continue; }
+        // Copy the whole payload out like loadLoose does, rather than touching the mapping in place
+        u8* data = (u8*)xArenaAllocAligned(arena, entry->size, X_PAK_ALIGN);
+        if (data != NULL && xPakRead(&pak, entry, data)) { checksum += data[entry->size - 1]; }
+    }
+    xPakClose(&pak);
+    return checksum;
+}
+
+static bool createAssets(u64* out_bytes) {
+    if (!xBenchTempDirCreate(ASSET_DIR)) { return false; }
+    xPakInput* inputs = X_CALLOC(xPakInput, ASSET_COUNT);
+    char(*paths)[64]  = (char(*)[64])X_CALLOC(char, (size_t)ASSET_COUNT * 64);
+    X_CHECK_ALLOC(inputs);
+    X_CHECK_ALLOC(paths);
+
+    bool ok   = true;
+    u64 bytes = 0;
+    for (u32 i = 0; i < ASSET_COUNT && ok; ++i) {
+        const u32 size = ASSET_MIN_SIZE + (i * 7919u) % (ASSET_MAX_SIZE - ASSET_MIN_SIZE);
+        u8* data       = X_MALLOC(u8, size);
+        X_CHECK_ALLOC(data);
+        fillAsset(data, size, i);
+
+        assetPath(paths[i], sizeof(paths[i]), i);
+        FILE* file = fopen(paths[i], "wb");
+        ok         = file != NULL && fwrite(data, 1, size, file) == size;
+        if (file != NULL) { fclose(file); }
+
+        inputs[i].path = paths[i];
+        inputs[i].data = data;
+        inputs[i].size = size;
+        bytes += size;
+    }
+
+    ok = ok && xPakWrite(RAW_PAK, inputs, ASSET_COUNT);
+    for (u32 i = 0; i < ASSET_COUNT; ++i) {
+        inputs[i].compress = true;
+    }
+    ok = ok && xPakWrite(LZ4_PAK, inputs, ASSET_COUNT);
+
+    for (u32 i = 0; i < ASSET_COUNT; ++i) {
+        X_MEM_FREE((void*)inputs[i].data);
+    }
+    X_FREE(inputs);
+    X_FREE(paths);
+    *out_bytes = bytes;
+    return ok;
+}
+
+static void removeAssets(void) {
+    char path[64];
+    for (u32 i = 0; i < ASSET_COUNT; ++i) {
+        assetPath(path, sizeof(path), i);
+        remove(path);
+    }
+    remove(RAW_PAK);
+    remove(LZ4_PAK);
+    xBenchTempDirRemove(ASSET_DIR);
+}
+
+void xBenchXpak(void) {
+    u64 bytes = 0;
+    if (!createAssets(&bytes)) {
+        X_PRINT_ERROR("Failed to generate benchmark assets in '%s'", ASSET_DIR);
+        removeAssets();
+        return;
+    }
+    printf("  %-40s %u files, %.1f MB\n", "asset set", ASSET_COUNT, (f64)bytes / (1024.0 * 1024.0));
+
+    xArena arena;
+    xArenaInit(&arena, (size_t)bytes + (size_t)ASSET_COUNT * X_PAK_ALIGN);
+
+    // Cold runs evict the page cache first (Linux only; elsewhere they match the warm numbers)
+    const xPakBenchRun kRuns[] = {
+      {"cold loose fopen/fread", true, 0},
+      {"cold xpak (mapped)", true, 1},
+      {"cold xpak (lz4)", true, 2},
+      {"warm loose fopen/fread", false, 0},
+      {"warm xpak (mapped)", false, 1},
+      {"warm xpak (lz4)", false, 2},
+    };
+
+    X_FOREACH(const xPakBenchRun, run, kRuns) {
+        if (run->cold) { evictAll(); }
+        u64 checksum    = 0;
+        const f64 start = xBenchNow();
+        switch (run->source) {
+            case 0:
+                checksum = loadLoose();
+                break;
+            case 1:
+                checksum = loadPak(RAW_PAK, &arena);
+                break;
+            default:
+                checksum = loadPak(LZ4_PAK, &arena);
+                break;
+        }
+        xBenchReport(run->name, xBenchNow() - start, ASSET_COUNT);
+        X_BENCH_DO_NOT_OPTIMIZE(checksum);
+    }
+
+    xArenaShutdown(&arena);
+    removeAssets();
+}
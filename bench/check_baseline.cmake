@@ -0,0 +1,14 @@
+# Run by the bench_check target with -P. Skips until `bench_baseline` has recorded a baseline, since the numbers
+# depend on the machine and none is committed.
+if(NOT EXISTS "${BASELINE}")
+    message(STATUS "bench_check: no baseline at ${BASELINE}, skipping. Build the bench_baseline target to record one.")
+    return()
+endif()
+
+execute_process(
+    COMMAND "${BENCH}" ${ARGS} --json "${OUTPUT}" --baseline "${BASELINE}" --threshold "${THRESHOLD}"
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "bench_check: failed against ${BASELINE}, see the output above")
+endif()
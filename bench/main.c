@@ -0,0 +1,418 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "bench.h"
+#include <containers.h>
+#include <profiler.h>
+
+#include <errno.h>
+#include <stdlib.h>
+
+#if defined(__linux__)
+    #include <sys/stat.h>
+    #include <unistd.h>
+#elif defined(_WIN32)
+    #include <direct.h>
+#endif
+
+/* Upper bound on --reps; each result keeps one sample per repetition */
+#define X_BENCH_MAX_REPETITIONS 64
+
+/* Default allowed slowdown against the baseline, in percent */
+#define X_BENCH_DEFAULT_THRESHOLD 15.0
+
+#define X_BENCH_SUITE_LENGTH 32
+#define X_BENCH_NAME_LENGTH 96
+
+typedef struct {
+    const char* name;
+    void (*run)(void);
+} xBenchSuite;
+
+static const xBenchSuite kSuites[] = {
+    {"arena", xBenchArena},
+    {"pool", xBenchPool},
+    {"commands", xBenchCommands},
+    {"swrast", xBenchSwrast},
+    {"jobs", xBenchJobs},
+    {"math", xBenchMath},
+    {"ecs", xBenchEcs},
+    {"profiler", xBenchProfiler},
+    {"input", xBenchInput},
+    {"frameloop", xBenchFrameLoop},
+    {"xpak", xBenchXpak},
+    {"stream", xBenchStream},
+    {"spatial", xBenchSpatial},
+    {"cull", xBenchCull},
+    {"containers", xBenchContainers},
+    {"intern", xBenchIntern},
+    {"macros", xBenchMacros},
+    {"sprites", xBenchSprites},
+    {"particles", xBenchParticles},
+    {"transform", xBenchTransform},
+    {"log", xBenchLog},
+};
+
+typedef struct {
+    char suite[X_BENCH_SUITE_LENGTH];
+    char name[X_BENCH_NAME_LENGTH];
+    u64 iterations;
+    u32 sample_count;
+    f64 samples[X_BENCH_MAX_REPETITIONS];  // seconds per repetition
+    f64 min;                               // ns per iteration, filled by summarize()
+    f64 median;
+    f64 p90;
+    f64 max;
+} xBenchResult;
+
+typedef struct {
+    const char* filters[X_ARRAY_SIZE(kSuites)];
+    u32 filter_count;
+    const char* json_path;
+    const char* baseline_path;
+    f64 threshold;
+    u32 warmup;
+    u32 repetitions;
+} xBenchOptions;
+
+static struct {
+    X_ARRAY(xBenchResult) results;
+    const char* suite;
+    bool recording;    // false during warm-up passes
+    bool summarize;    // with several repetitions, results are printed once per suite
+    f64 ticks_per_ns;  // TSC rate, 0 when the target has no cycle counter
+} gBench;
+
+/* ============================================================================
+ * RESULTS
+ * ============================================================================ */
+
+static xBenchResult* findResult(const char* suite, const char* name) {
+    X_ARRAY_FOREACH(xBenchResult, result, &gBench.results) {
+        if (X_STREQ(result->suite, suite) && X_STREQ(result->name, name)) { return result; }
+    }
+    return NULL;
+}
+
+static int compareF64(const void* a, const void* b) {
+    const f64 lhs = *(const f64*)a;
+    const f64 rhs = *(const f64*)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+/* Nearest-rank percentile of an ascending array */
+static f64 percentile(const f64* sorted, u32 count, f64 fraction) {
+    u32 rank = (u32)(fraction * (f64)count + 0.999999);
+    rank     = X_CLAMP(rank, 1u, count);
+    return sorted[rank - 1];
+}
+
+static void summarize(xBenchResult* result) {
+    f64 ns[X_BENCH_MAX_REPETITIONS];
+    const f64 scale = result->iterations > 0 ? 1e9 / (f64)result->iterations : 0.0;
+    for (u32 i = 0; i < result->sample_count; ++i) {
+        ns[i] = result->samples[i] * scale;
+    }
+    qsort(ns, result->sample_count, sizeof(f64), compareF64);
+
+    result->min    = ns[0];
+    result->median = percentile(ns, result->sample_count, 0.5);
+    result->p90    = percentile(ns, result->sample_count, 0.9);
+    result->max    = ns[result->sample_count - 1];
+}
+
+static void printSummary(const char* suite) {
+    X_ARRAY_FOREACH(xBenchResult, result, &gBench.results) {
+        if (!X_STREQ(result->suite, suite)) { continue; }
+        summarize(result);
+        printf("  %-40s %10.2f ns/iter median  p90 %10.2f  min %10.2f  max %10.2f",
+               result->name,
+               result->median,
+               result->p90,
+               result->min,
+               result->max);
+        if (gBench.ticks_per_ns > 0.0) { printf("  %8.1f cyc/iter", result->median * gBench.ticks_per_ns); }
+        printf("\n");
+    }
+}
+
+void xBenchReport(const char* name, f64 seconds, u64 iterations) {
+    if (!gBench.recording) { return; }
+
+    xBenchResult* result = findResult(gBench.suite, name);
+    if (result == NULL) {
+        xBenchResult fresh = {0};
+        snprintf(fresh.suite, sizeof(fresh.suite), "%s", gBench.suite);
+        snprintf(fresh.name, sizeof(fresh.name), "%s", name);
+        fresh.iterations = iterations;
+        X_CHECK_MSG(X_ARRAY_PUSH(&gBench.results, fresh), "Failed to record benchmark result");
+        result = &X_ARRAY_LAST(&gBench.results);
+    }
+    if (result->sample_count < X_BENCH_MAX_REPETITIONS) { result->samples[result->sample_count++] = seconds; }
+    if (gBench.summarize) { return; }
+
+    const f64 ns_per_iter = iterations > 0 ? (seconds * 1e9) / (f64)iterations : 0.0;
+    printf("  %-40s %10.3f ms  %10.2f ns/iter  %12.0f iter/s",
+           name,
+           X_SEC_TO_MS(seconds),
+           ns_per_iter,
+           seconds > 0.0 ? (f64)iterations / seconds : 0.0);
+    if (gBench.ticks_per_ns > 0.0) { printf("  %8.1f cyc/iter", ns_per_iter * gBench.ticks_per_ns); }
+    printf("\n");
+}
+
+bool xBenchTempDirCreate(const char* path) {
+#if defined(__linux__)
+    const int result = mkdir(path, 0755);
+#elif defined(_WIN32)
+    const int result = _mkdir(path);
+#else
+    const int result = -1;
+#endif
+    if (result != 0 && errno != EEXIST) {
+        X_PRINT_ERROR("Failed to create benchmark directory '%s'", path);
+        return false;
+    }
+    return true;
+}
+
+void xBenchTempDirRemove(const char* path) {
+#if defined(__linux__)
+    rmdir(path);
+#elif defined(_WIN32)
+    _rmdir(path);
+#else
+    X_UNUSED(path);
+#endif
+}
+
+/* Spin ~10 ms against the monotonic clock to convert ns into TSC cycles */
+static f64 calibrateTicksPerNs(void) {
+#if X_PROFILE_HAS_TSC
+    const f64 start = xBenchNow();
+    const u64 ticks = xProfileNow();
+    f64 now;
+    do {
+        now = xBenchNow();
+    } while (now - start < 0.01);
+    return (f64)(xProfileNow() - ticks) / ((now - start) * 1e9);
+#else
+    return 0.0;
+#endif
+}
+
+/* ============================================================================
+ * JSON OUTPUT AND BASELINE
+ * ============================================================================ */
+
+static void writeJsonString(FILE* file, const char* string) {
+    fputc('"', file);
+    for (const char* c = string; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') { fputc('\\', file); }
+        if ((u8)*c >= 0x20) { fputc(*c, file); }
+    }
+    fputc('"', file);
+}
+
+/* One result per line so the baseline reader can stay line based */
+static bool writeJson(const char* path, const xBenchOptions* options) {
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        X_PRINT_ERROR("Failed to open %s for writing", path);
+        return false;
+    }
+
+    fprintf(file,
+            "{\n  \"warmup\": %u,\n  \"repetitions\": %u,\n  \"tsc_ghz\": %.4f,\n  \"results\": [\n",
+            options->warmup,
+            options->repetitions,
+            gBench.ticks_per_ns);
+    for (u32 i = 0; i < gBench.results.count; ++i) {
+        const xBenchResult* result = &gBench.results.items[i];
+        fprintf(file, "    {\"suite\": ");
+        writeJsonString(file, result->suite);
+        fprintf(file, ", \"name\": ");
+        writeJsonString(file, result->name);
+        fprintf(file,
+                ", \"iterations\": %llu, \"samples\": %u, \"median_ns\": %.4f, \"p90_ns\": %.4f, \"min_ns\": %.4f, "
+                "\"max_ns\": %.4f, \"cycles\": %.2f}%s\n",
+                (unsigned long long)result->iterations,
+                result->sample_count,
+                result->median,
+                result->p90,
+                result->min,
+                result->max,
+                result->median * gBench.ticks_per_ns,
+                i + 1 < gBench.results.count ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+
+    const bool ok = ferror(file) == 0;
+    fclose(file);
+    if (!ok) { X_PRINT_ERROR("Failed to write %s", path); }
+    return ok;
+}
+
+/* Copy the string value of `"key": "..."` on `line` into `out` */
+static bool jsonString(const char* line, const char* key, char* out, size_t out_size) {
+    char pattern[32];
+    snprintf(pattern, sizeof(pattern), "\"%s\": \"", key);
+    const char* c = strstr(line, pattern);
+    if (c == NULL) { return false; }
+
+    size_t length = 0;
+    for (c += strlen(pattern); *c != '\0' && *c != '"'; ++c) {
+        if (*c == '\\' && c[1] != '\0') { ++c; }
+        if (length + 1 < out_size) { out[length++] = *c; }
+    }
+    out[length] = '\0';
+    return *c == '"';
+}
+
+static bool jsonNumber(const char* line, const char* key, f64* out) {
+    char pattern[32];
+    snprintf(pattern, sizeof(pattern), "\"%s\": ", key);
+    const char* c = strstr(line, pattern);
+    if (c == NULL) { return false; }
+
+    char* end;
+    *out = strtod(c + strlen(pattern), &end);
+    return end != c + strlen(pattern);
+}
+
+/*
+ * Compare every recorded result against the baseline file (a previous --json
+ * run). Results missing from either side are skipped, so a filtered run only
+ * checks the suites it ran. Returns false if anything regressed.
+ */
+static bool checkBaseline(const char* path, f64 threshold) {
+    FILE* file = fopen(path, "r");
+    if (file == NULL) {
+        X_PRINT_ERROR("Failed to open baseline %s", path);
+        return false;
+    }
+
+    printf("[baseline] %s, threshold +%.1f%%\n", path, threshold);
+    char line[512];
+    u32 compared    = 0;
+    u32 regressions = 0;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char suite[X_BENCH_SUITE_LENGTH];
+        char name[X_BENCH_NAME_LENGTH];
+        f64 baseline;
+        if (!jsonString(line, "suite", suite, sizeof(suite)) || !jsonString(line, "name", name, sizeof(name)) ||
+            !jsonNumber(line, "median_ns", &baseline)) {
+            continue;
+        }
+
+        const xBenchResult* result = findResult(suite, name);
+        if (result == NULL || result->iterations == 0 || baseline <= 0.0) { continue; }
+
+        ++compared;
+        const f64 change = (result->median / baseline - 1.0) * 100.0;
+        if (change > threshold) {
+            ++regressions;
+            printf("  REGRESSION %s/%s: %.2f -> %.2f ns/iter (%+.1f%%)\n",
+                   suite,
+                   name,
+                   baseline,
+                   result->median,
+                   change);
+        }
+    }
+    fclose(file);
+
+    printf("  %u results compared, %u regressed\n", compared, regressions);
+    return regressions == 0;
+}
+
+/* ============================================================================
+ * ENTRY POINT
+ * ============================================================================ */
+
+static void printUsage(const char* program) {
+    printf("usage: %s [suite...] [--warmup N] [--reps N] [--json PATH] [--baseline PATH] [--threshold PCT]\n", program);
+    printf("  --warmup N       untimed passes over each suite before measuring (default 0)\n");
+    printf("  --reps N         timed passes; reports median/p90/min/max per result (default 1, max %d)\n",
+           X_BENCH_MAX_REPETITIONS);
+    printf("  --json PATH      write results as JSON\n");
+    printf("  --baseline PATH  fail if a median is slower than in this earlier --json output\n");
+    printf("  --threshold PCT  allowed slowdown against the baseline (default %.0f)\n", X_BENCH_DEFAULT_THRESHOLD);
+}
+
+static bool parseOptions(int argc, char** argv, xBenchOptions* options) {
+    *options = (xBenchOptions) {.threshold = X_BENCH_DEFAULT_THRESHOLD, .repetitions = 1};
+    for (int i = 1; i < argc; ++i) {
+        const char* arg   = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (arg[0] != '-') {
+            if (options->filter_count == X_ARRAY_SIZE(options->filters)) { return false; }
+            options->filters[options->filter_count++] = arg;
+            continue;
+        }
+        if (value == NULL) { return false; }
+
+        if (X_STREQ(arg, "--warmup")) {
+            options->warmup = (u32)strtoul(value, NULL, 10);
+        } else if (X_STREQ(arg, "--reps")) {
+            options->repetitions = (u32)X_CLAMP(strtoul(value, NULL, 10), 1ul, (unsigned long)X_BENCH_MAX_REPETITIONS);
+        } else if (X_STREQ(arg, "--json")) {
+            options->json_path = value;
+        } else if (X_STREQ(arg, "--baseline")) {
+            options->baseline_path = value;
+        } else if (X_STREQ(arg, "--threshold")) {
+            options->threshold = strtod(value, NULL);
+        } else {
+            return false;
+        }
+        ++i;
+    }
+    return true;
+}
+
+static bool selected(const xBenchOptions* options, const char* suite) {
+    for (u32 i = 0; i < options->filter_count; ++i) {
+        if (X_STREQ(options->filters[i], suite)) { return true; }
+    }
+    return options->filter_count == 0;
+}
+
+int main(int argc, char** argv) {
+    xBenchOptions options;
+    if (!parseOptions(argc, argv, &options)) {
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    gBench.ticks_per_ns = calibrateTicksPerNs();
+    gBench.summarize    = options.repetitions > 1;
+
+    X_FOREACH(const xBenchSuite, suite, kSuites) {
+        if (!selected(&options, suite->name)) { continue; }
+        printf("[%s]\n", suite->name);
+        gBench.suite = suite->name;
+
+        // Each pass reruns the whole suite, so every xBenchReport call site gets warm-up and repetitions
+        gBench.recording = false;
+        for (u32 pass = 0; pass < options.warmup; ++pass) {
+            suite->run();
+        }
+        gBench.recording = true;
+        for (u32 pass = 0; pass < options.repetitions; ++pass) {
+            suite->run();
+        }
+        if (gBench.summarize) { printSummary(suite->name); }
+    }
+
+    X_ARRAY_FOREACH(xBenchResult, result, &gBench.results) {
+        summarize(result);
+    }
+
+    bool ok = true;
+    if (options.json_path != NULL) { ok = writeJson(options.json_path, &options) && ok; }
+    if (options.baseline_path != NULL) { ok = checkBaseline(options.baseline_path, options.threshold) && ok; }
+
+    X_ARRAY_FREE(&gBench.results);
+    return ok ? 0 : 1;
+}
@@ -21,4 +21,19 @@ FetchContent_Declare(
 FetchContent_MakeAvailable(
     glfw
     glm
-)
\ No newline at end of file
+)
+
+# LZ4 is only needed as the block codec, so build lib/lz4.c directly instead of its CLI-oriented CMake project
+FetchContent_Declare(
+    lz4
+    GIT_REPOSITORY https://github.com/lz4/lz4.git
+    GIT_TAG v1.9.4
+)
+
+FetchContent_GetProperties(lz4)
+if (NOT lz4_POPULATED)
+    FetchContent_Populate(lz4)
+endif ()
+
+add_library(lz4 STATIC ${lz4_SOURCE_DIR}/lib/lz4.c ${lz4_SOURCE_DIR}/lib/lz4hc.c)
+target_include_directories(lz4 PUBLIC ${lz4_SOURCE_DIR}/lib)
\ No newline at end of file
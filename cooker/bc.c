@@ -0,0 +1,502 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "cook.h"
+
+#include <math.h>
+
+/* Block rows per job */
+#define X_COOK_BLOCK_ROW_GRAIN 2
+
+/* Power iterations used to find a block's principal axis */
+#define X_COOK_PCA_ITERATIONS 8
+
+/* ============================================================================
+ * SHARED HELPERS
+ * ============================================================================ */
+
+/*
+ * Mean and principal axis of `count` points with `channels` components, via
+ * power iteration on the covariance matrix. The axis is zero for flat blocks.
+ */
+static void principalAxis(const f32 (*points)[4], u32 count, u32 channels, f32* mean, f32* axis) {
+    for (u32 c = 0; c < 4; ++c) {
+        mean[c] = 0.0f;
+        axis[c] = 0.0f;
+    }
+    if (count == 0) { return; }
+    for (u32 i = 0; i < count; ++i) {
+        for (u32 c = 0; c < channels; ++c) {
+            mean[c] += points[i][c];
+        }
+    }
+    for (u32 c = 0; c < channels; ++c) {
+        mean[c] /= (f32)count;
+    }
+
+    f32 cov[4][4] = {{0}};
+    for (u32 i = 0; i < count; ++i) {
+        f32 d[4];
+        for (u32 c = 0; c < channels; ++c) {
+            d[c] = points[i][c] - mean[c];
+        }
+        for (u32 r = 0; r < channels; ++r) {
+            for (u32 c = 0; c < channels; ++c) {
+                cov[r][c] += d[r] * d[c];
+            }
+        }
+    }
+
+    // Start from the widest channel so a block that only varies in one channel converges immediately
+    u32 widest = 0;
+    for (u32 c = 1; c < channels; ++c) {
+        if (cov[c][c] > cov[widest][widest]) { widest = c; }
+    }
+    if (cov[widest][widest] <= 0.0f) { return; }
+    f32 v[4] = {0};
+    for (u32 c = 0; c < channels; ++c) {
+        v[c] = cov[widest][c];
+    }
+
+    for (u32 iteration = 0; iteration < X_COOK_PCA_ITERATIONS; ++iteration) {
+        f32 next[4] = {0};
+        f32 length  = 0.0f;
+        for (u32 r = 0; r < channels; ++r) {
+            for (u32 c = 0; c < channels; ++c) {
+                next[r] += cov[r][c] * v[c];
+            }
+            length += next[r] * next[r];
+        }
+        if (length <= 1e-12f) { return; }
+        length = 1.0f / sqrtf(length);
+        for (u32 c = 0; c < channels; ++c) {
+            v[c] = next[c] * length;
+        }
+    }
+    for (u32 c = 0; c < channels; ++c) {
+        axis[c] = v[c];
+    }
+}
+
+/* Endpoints at the extremes of the points' projection onto the axis, clamped to [0, 255] */
+static void axisEndpoints(
+  const f32 (*points)[4], u32 count, u32 channels, const f32* mean, const f32* axis, f32* lo, f32* hi) {
+    f32 min_t = 0.0f;
+    f32 max_t = 0.0f;
+    for (u32 i = 0; i < count; ++i) {
+        f32 t = 0.0f;
+        for (u32 c = 0; c < channels; ++c) {
+            t += (points[i][c] - mean[c]) * axis[c];
+        }
+        min_t = X_MIN(min_t, t);
+        max_t = X_MAX(max_t, t);
+    }
+    for (u32 c = 0; c < channels; ++c) {
+        lo[c] = X_CLAMP(mean[c] + axis[c] * min_t, 0.0f, 255.0f);
+        hi[c] = X_CLAMP(mean[c] + axis[c] * max_t, 0.0f, 255.0f);
+    }
+}
+
+/*
+ * Least-squares endpoints for fixed indices: minimize |w_i * a + (1 - w_i) * b - x_i|^2
+ * where w_i is the weight of endpoint `a` for pixel i. Returns false when degenerate.
+ */
+static bool refitEndpoints(
+  const f32 (*points)[4], const f32* weights, u32 count, u32 channels, f32* a, f32* b) {
+    f32 aa = 0.0f, bb = 0.0f, ab = 0.0f;
+    f32 ax[4] = {0}, bx[4] = {0};
+    for (u32 i = 0; i < count; ++i) {
+        const f32 wa = weights[i];
+        const f32 wb = 1.0f - wa;
+        aa += wa * wa;
+        bb += wb * wb;
+        ab += wa * wb;
+        for (u32 c = 0; c < channels; ++c) {
+            ax[c] += wa * points[i][c];
+            bx[c] += wb * points[i][c];
+        }
+    }
+
+    const f32 det = aa * bb - ab * ab;
+    if (fabsf(det) < 1e-6f) { return false; }
+    const f32 inv = 1.0f / det;
+    for (u32 c = 0; c < channels; ++c) {
+        a[c] = X_CLAMP((ax[c] * bb - bx[c] * ab) * inv, 0.0f, 255.0f);
+        b[c] = X_CLAMP((bx[c] * aa - ax[c] * ab) * inv, 0.0f, 255.0f);
+    }
+    return true;
+}
+
+/* ============================================================================
+ * BC1 / BC3
+ * ============================================================================ */
+
+X_FORCE_INLINE static u16 pack565(const f32* c) {
+    const u32 r = (u32)(c[0] * 31.0f / 255.0f + 0.5f);
+    const u32 g = (u32)(c[1] * 63.0f / 255.0f + 0.5f);
+    const u32 b = (u32)(c[2] * 31.0f / 255.0f + 0.5f);
+    return (u16)((r << 11) | (g << 5) | b);
+}
+
+X_FORCE_INLINE static void unpack565(u16 v, f32* out) {
+    const u32 r = (v >> 11) & 31;
+    const u32 g = (v >> 5) & 63;
+    const u32 b = v & 31;
+    out[0]      = (f32)((r << 3) | (r >> 2));
+    out[1]      = (f32)((g << 2) | (g >> 4));
+    out[2]      = (f32)((b << 3) | (b >> 2));
+}
+
+/* Palette weights of color0 for each index, in 4-color and 3-color (punch-through) mode */
+static const f32 kBc1Weights4[4] = {1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+static const f32 kBc1Weights3[3] = {1.0f, 0.0f, 0.5f};
+
+typedef struct {
+    u16 c0;
+    u16 c1;
+    u8 indices[16];
+    f32 error;
+} xBc1Fit;
+
+/* Pick the nearest palette entry for every opaque pixel of `block` given quantized endpoints */
+static void bc1Assign(const f32 (*colors)[4], const bool* transparent, bool three_color, xBc1Fit* fit) {
+    f32 e0[3], e1[3], palette[4][3];
+    unpack565(fit->c0, e0);
+    unpack565(fit->c1, e1);
+    const f32* weights = three_color ? kBc1Weights3 : kBc1Weights4;
+    const u32 entries  = three_color ? 3 : 4;
+    for (u32 i = 0; i < entries; ++i) {
+        for (u32 c = 0; c < 3; ++c) {
+            palette[i][c] = weights[i] * e0[c] + (1.0f - weights[i]) * e1[c];
+        }
+    }
+
+    fit->error = 0.0f;
+    for (u32 p = 0; p < 16; ++p) {
+        if (transparent[p]) {
+            fit->indices[p] = 3;
+            continue;
+        }
+        u32 best       = 0;
+        f32 best_error = 1e30f;
+        for (u32 i = 0; i < entries; ++i) {
+            const f32 dr = palette[i][0] - colors[p][0];
+            const f32 dg = palette[i][1] - colors[p][1];
+            const f32 db = palette[i][2] - colors[p][2];
+            const f32 e  = dr * dr + dg * dg + db * db;
+            if (e < best_error) {
+                best_error = e;
+                best       = i;
+            }
+        }
+        fit->indices[p] = (u8)best;
+        fit->error += best_error;
+    }
+}
+
+/* Encode the color half of a BC1/BC3 block. Punch-through alpha is only legal for BC1. */
+static void encodeColor(const u8* rgba, bool punch_through, u8* out) {
+    f32 colors[16][4];
+    f32 opaque[16][4];
+    bool transparent[16];
+    u32 opaque_count = 0;
+    for (u32 p = 0; p < 16; ++p) {
+        transparent[p] = punch_through && rgba[p * 4 + 3] < 128;
+        for (u32 c = 0; c < 4; ++c) {
+            colors[p][c] = (f32)rgba[p * 4 + c];
+        }
+        if (!transparent[p]) { memcpy(opaque[opaque_count++], colors[p], sizeof(colors[p])); }
+    }
+    const bool three_color = opaque_count < 16;
+
+    f32 mean[4], axis[4], lo[4] = {0}, hi[4] = {0};
+    principalAxis((const f32(*)[4])opaque, opaque_count, 3, mean, axis);
+    axisEndpoints((const f32(*)[4])opaque, opaque_count, 3, mean, axis, lo, hi);
+
+    xBc1Fit fit = {pack565(hi), pack565(lo), {0}, 0.0f};
+    bc1Assign((const f32(*)[4])colors, transparent, three_color, &fit);
+
+    // One least-squares pass on the chosen indices usually recovers a few dB
+    f32 weights[16];
+    u32 weight_count = 0;
+    for (u32 p = 0; p < 16; ++p) {
+        if (!transparent[p]) {
+            weights[weight_count] = (three_color ? kBc1Weights3 : kBc1Weights4)[fit.indices[p]];
+            memcpy(opaque[weight_count++], colors[p], sizeof(colors[p]));
+        }
+    }
+    f32 a[4], b[4];
+    if (refitEndpoints((const f32(*)[4])opaque, weights, weight_count, 3, a, b)) {
+        xBc1Fit refit = {pack565(a), pack565(b), {0}, 0.0f};
+        bc1Assign((const f32(*)[4])colors, transparent, three_color, &refit);
+        if (refit.error < fit.error) { fit = refit; }
+    }
+
+    // The endpoint order selects the mode: c0 > c1 is 4-color, c0 <= c1 is 3-color with transparent black
+    if (three_color ? fit.c0 > fit.c1 : fit.c0 < fit.c1) {
+        const u16 t = fit.c0;
+        fit.c0      = fit.c1;
+        fit.c1      = t;
+        for (u32 p = 0; p < 16; ++p) {
+            // Swap the roles of the two endpoints: 0 <-> 1, and 2 <-> 3 in 4-color mode
+            if (fit.indices[p] < 2 || !three_color) { fit.indices[p] ^= 1; }
+        }
+    } else if (!three_color && fit.c0 == fit.c1) {
+        X_ZERO_STRUCT(&fit.indices);
+    }
+
+    u32 bits = 0;
+    for (u32 p = 0; p < 16; ++p) {
+        bits |= (u32)fit.indices[p] << (p * 2);
+    }
+    out[0] = (u8)fit.c0;
+    out[1] = (u8)(fit.c0 >> 8);
+    out[2] = (u8)fit.c1;
+    out[3] = (u8)(fit.c1 >> 8);
+    out[4] = (u8)bits;
+    out[5] = (u8)(bits >> 8);
+    out[6] = (u8)(bits >> 16);
+    out[7] = (u8)(bits >> 24);
+}
+
+/* BC3 alpha: 8-level interpolation between the block's alpha extremes */
+static void encodeAlpha(const u8* rgba, u8* out) {
+    u8 a0 = 0, a1 = 255;
+    for (u32 p = 0; p < 16; ++p) {
+        a0 = X_MAX(a0, rgba[p * 4 + 3]);
+        a1 = X_MIN(a1, rgba[p * 4 + 3]);
+    }
+    out[0] = a0;
+    out[1] = a1;
+
+    u64 bits = 0;
+    if (a0 > a1) {
+        u32 palette[8];
+        palette[0] = a0;
+        palette[1] = a1;
+        for (u32 k = 2; k < 8; ++k) {
+            palette[k] = ((8 - k) * a0 + (k - 1) * a1) / 7;
+        }
+        for (u32 p = 0; p < 16; ++p) {
+            const s32 value = rgba[p * 4 + 3];
+            u32 best        = 0;
+            s32 best_error  = INT32_MAX;
+            for (u32 k = 0; k < 8; ++k) {
+                const s32 e = X_ABS(value - (s32)palette[k]);
+                if (e < best_error) {
+                    best_error = e;
+                    best       = k;
+                }
+            }
+            bits |= (u64)best << (p * 3);
+        }
+    }
+    for (u32 i = 0; i < 6; ++i) {
+        out[2 + i] = (u8)(bits >> (i * 8));
+    }
+}
+
+void xCookEncodeBC1(const u8* rgba, u8 out[8]) {
+    encodeColor(rgba, true, out);
+}
+
+void xCookEncodeBC3(const u8* rgba, u8 out[16]) {
+    encodeAlpha(rgba, out);
+    encodeColor(rgba, false, out + 8);
+}
+
+/* ============================================================================
+ * BC7 (mode 6)
+ * ============================================================================ */
+
+/*
+ * Mode 6 is a single subset with 7-bit RGBA endpoints, a p-bit per endpoint and
+ * 4-bit indices. It handles both opaque and alpha content well and keeps the
+ * encoder small; multi-subset modes would add quality on sharp-edged blocks.
+ */
+static const u32 kBc7Weights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+typedef struct {
+    u8 q[2][4];  // 7-bit endpoint values
+    u8 p[2];
+    u8 indices[16];
+    f32 error;
+} xBc7Fit;
+
+/* Quantize an endpoint to 7 bits plus the p-bit that reconstructs it best */
+static void bc7QuantizeEndpoint(const f32* value, u8* q, u8* p) {
+    f32 best_error = 1e30f;
+    for (u32 bit = 0; bit < 2; ++bit) {
+        u8 candidate[4];
+        f32 error = 0.0f;
+        for (u32 c = 0; c < 4; ++c) {
+            const s32 level = (s32)((value[c] - (f32)bit) * 0.5f + 0.5f);
+            candidate[c]    = (u8)X_CLAMP(level, 0, 127);
+            const f32 d     = (f32)((candidate[c] << 1) | bit) - value[c];
+            error += d * d;
+        }
+        if (error < best_error) {
+            best_error = error;
+            memcpy(q, candidate, 4);
+            *p = (u8)bit;
+        }
+    }
+}
+
+static void bc7Assign(const f32 (*pixels)[4], xBc7Fit* fit) {
+    u32 e0[4], e1[4];
+    for (u32 c = 0; c < 4; ++c) {
+        e0[c] = ((u32)fit->q[0][c] << 1) | fit->p[0];
+        e1[c] = ((u32)fit->q[1][c] << 1) | fit->p[1];
+    }
+    f32 palette[16][4];
+    for (u32 i = 0; i < 16; ++i) {
+        for (u32 c = 0; c < 4; ++c) {
+            palette[i][c] = (f32)(((64 - kBc7Weights4[i]) * e0[c] + kBc7Weights4[i] * e1[c] + 32) >> 6);
+        }
+    }
+
+    fit->error = 0.0f;
+    for (u32 p = 0; p < 16; ++p) {
+        u32 best       = 0;
+        f32 best_error = 1e30f;
+        for (u32 i = 0; i < 16; ++i) {
+            f32 e = 0.0f;
+            for (u32 c = 0; c < 4; ++c) {
+                const f32 d = palette[i][c] - pixels[p][c];
+                e += d * d;
+            }
+            if (e < best_error) {
+                best_error = e;
+                best       = i;
+            }
+        }
+        fit->indices[p] = (u8)best;
+        fit->error += best_error;
+    }
+}
+
+static void bc7Fit(const f32 (*pixels)[4], const f32* a, const f32* b, xBc7Fit* fit) {
+    bc7QuantizeEndpoint(a, fit->q[0], &fit->p[0]);
+    bc7QuantizeEndpoint(b, fit->q[1], &fit->p[1]);
+    bc7Assign(pixels, fit);
+}
+
+typedef struct {
+    u8* out;
+    u32 position;
+} xBitWriter;
+
+static void putBits(xBitWriter* writer, u32 value, u32 count) {
+    for (u32 i = 0; i < count; ++i, ++writer->position) {
+        if ((value >> i) & 1) { writer->out[writer->position >> 3] |= (u8)(1u << (writer->position & 7)); }
+    }
+}
+
+void xCookEncodeBC7(const u8* rgba, u8 out[16]) {
+    f32 pixels[16][4];
+    for (u32 p = 0; p < 16; ++p) {
+        for (u32 c = 0; c < 4; ++c) {
+            pixels[p][c] = (f32)rgba[p * 4 + c];
+        }
+    }
+
+    f32 mean[4], axis[4], lo[4], hi[4];
+    principalAxis((const f32(*)[4])pixels, 16, 4, mean, axis);
+    axisEndpoints((const f32(*)[4])pixels, 16, 4, mean, axis, lo, hi);
+
+    xBc7Fit fit;
+    bc7Fit((const f32(*)[4])pixels, lo, hi, &fit);
+
+    f32 weights[16];
+    for (u32 p = 0; p < 16; ++p) {
+        weights[p] = 1.0f - (f32)kBc7Weights4[fit.indices[p]] / 64.0f;
+    }
+    f32 a[4], b[4];
+    if (refitEndpoints((const f32(*)[4])pixels, weights, 16, 4, a, b)) {
+        xBc7Fit refit;
+        bc7Fit((const f32(*)[4])pixels, a, b, &refit);
+        if (refit.error < fit.error) { fit = refit; }
+    }
+
+    // The first index is stored with an implicit zero MSB; swap the endpoints if it is set
+    if (fit.indices[0] >= 8) {
+        for (u32 c = 0; c < 4; ++c) {
+            const u8 t   = fit.q[0][c];
+            fit.q[0][c] = fit.q[1][c];
+            fit.q[1][c] = t;
+        }
+        const u8 t = fit.p[0];
+        fit.p[0]   = fit.p[1];
+        fit.p[1]   = t;
+        for (u32 p = 0; p < 16; ++p) {
+            fit.indices[p] = (u8)(15 - fit.indices[p]);
+        }
+    }
+
+    memset(out, 0, 16);
+    xBitWriter writer = {out, 0};
+    putBits(&writer, 1u << 6, 7);  // mode 6
+    for (u32 c = 0; c < 4; ++c) {
+        putBits(&writer, fit.q[0][c], 7);
+        putBits(&writer, fit.q[1][c], 7);
+    }
+    putBits(&writer, fit.p[0], 1);
+    putBits(&writer, fit.p[1], 1);
+    putBits(&writer, fit.indices[0], 3);
+    for (u32 p = 1; p < 16; ++p) {
+        putBits(&writer, fit.indices[p], 4);
+    }
+}
+
+/* ============================================================================
+ * LEVEL COMPRESSION
+ * ============================================================================ */
+
+typedef struct {
+    xTextureFormat format;
+    const u8* rgba;
+    u32 width;
+    u32 height;
+    u8* out;
+} xCookCompressJob;
+
+static void compressRows(void* data, u32 begin, u32 end) {
+    const xCookCompressJob* job = (const xCookCompressJob*)data;
+    const u32 blocks_x          = (job->width + 3) / 4;
+    const u32 unit              = xTextureFormatUnitBytes(job->format);
+
+    u8 block[64];
+    for (u32 by = begin; by < end; ++by) {
+        for (u32 bx = 0; bx < blocks_x; ++bx) {
+            for (u32 y = 0; y < 4; ++y) {
+                const u32 sy = X_MIN(by * 4 + y, job->height - 1);
+                for (u32 x = 0; x < 4; ++x) {
+                    const u32 sx = X_MIN(bx * 4 + x, job->width - 1);
+                    memcpy(block + (y * 4 + x) * 4, job->rgba + ((size_t)sy * job->width + sx) * 4, 4);
+                }
+            }
+
+            u8* dst = job->out + ((size_t)by * blocks_x + bx) * unit;
+            switch (job->format) {
+                case X_TEXTURE_FORMAT_BC1:
+                    xCookEncodeBC1(block, dst);
+                    break;
+                case X_TEXTURE_FORMAT_BC3:
+                    xCookEncodeBC3(block, dst);
+                    break;
+                case X_TEXTURE_FORMAT_BC7:
+                default:
+                    xCookEncodeBC7(block, dst);
+                    break;
+            }
+        }
+    }
+}
+
+void xCookCompress(xJobSystem* jobs, xTextureFormat format, const u8* rgba, u32 width, u32 height, u8* out) {
+    X_ASSERT_MSG(xTextureFormatIsBlock(format), "xCookCompress only handles block-compressed formats");
+    xCookCompressJob job = {format, rgba, width, height, out};
+    xJobsParallelFor(jobs, (height + 3) / 4, X_COOK_BLOCK_ROW_GRAIN, compressRows, &job);
+}
@@ -0,0 +1,70 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include <common.h>
+#include <jobs.h>
+#include <texture.h>
+#include <vecmath.h>
+
+/* ============================================================================
+ * SOURCE IMAGES
+ * ============================================================================ */
+
+/* 8-bit RGBA, rows top to bottom */
+typedef struct {
+    u32 width;
+    u32 height;
+    u8* pixels;
+} xCookImage;
+
+/* Binary PPM (P6), PAM (P7, RGB or RGB_ALPHA) and TGA (true-color, raw or RLE) at 8 bits per channel */
+bool xCookImageLoad(const char* path, xCookImage* out);
+void xCookImageFree(xCookImage* image);
+
+/* True for file names the loader understands */
+bool xCookImageIsSupported(const char* path);
+
+/* ============================================================================
+ * MIP CHAIN
+ * ============================================================================ */
+
+typedef enum {
+    X_COOK_MIP_BOX = 0,
+    X_COOK_MIP_KAISER,
+} xCookMipFilter;
+
+/* Linear-light RGBA, one xVec4 per pixel so filtering runs four channels per SIMD op */
+typedef struct {
+    u32 width;
+    u32 height;
+    xVec4* pixels;
+} xCookLevel;
+
+/* Decode to linear light (when `srgb`) and optionally premultiply color by alpha */
+bool xCookLevelFromImage(xJobSystem* jobs, const xCookImage* image, bool srgb, bool premultiply, xCookLevel* out);
+
+/* Halve each dimension (clamping at 1) */
+bool xCookLevelDownsample(xJobSystem* jobs, const xCookLevel* src, xCookMipFilter filter, xCookLevel* out);
+
+/* Back to 8-bit RGBA, re-encoding to sRGB when `srgb` */
+void xCookLevelToRgba8(xJobSystem* jobs, const xCookLevel* level, bool srgb, u8* out);
+
+void xCookLevelFree(xCookLevel* level);
+
+/* ============================================================================
+ * BLOCK COMPRESSION
+ * ============================================================================ */
+
+/* Encode one 4x4 block of RGBA8 pixels (row-major, 64 bytes) */
+void xCookEncodeBC1(const u8* rgba, u8 out[8]);
+void xCookEncodeBC3(const u8* rgba, u8 out[16]);
+void xCookEncodeBC7(const u8* rgba, u8 out[16]);
+
+/*
+ * Compress a whole RGBA8 level into `out` (xTextureMipBytes bytes). Partial
+ * edge blocks repeat the last row/column. Block rows are spread over `jobs`.
+ */
+void xCookCompress(xJobSystem* jobs, xTextureFormat format, const u8* rgba, u32 width, u32 height, u8* out);
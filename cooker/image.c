@@ -0,0 +1,285 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#if defined(_MSC_VER)
+    #define _CRT_SECURE_NO_WARNINGS 1
+#endif
+
+#include "cook.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static u8* readWholeFile(const char* path, size_t* out_size) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        X_PRINT_ERROR("Failed to open '%s'", path);
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    u8* data = size > 0 ? X_MALLOC(u8, (size_t)size) : NULL;
+    if (data == NULL || fread(data, 1, (size_t)size, file) != (size_t)size) {
+        X_PRINT_ERROR("Failed to read '%s'", path);
+        X_FREE(data);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+    *out_size = (size_t)size;
+    return data;
+}
+
+static bool allocatePixels(xCookImage* image, u32 width, u32 height) {
+    if (width == 0 || height == 0 || width > 65536 || height > 65536) { return false; }
+    image->width  = width;
+    image->height = height;
+    image->pixels = X_MALLOC(u8, (size_t)width * height * 4);
+    return image->pixels != NULL;
+}
+
+/* ============================================================================
+ * NETPBM
+ * ============================================================================ */
+
+typedef struct {
+    const u8* data;
+    size_t size;
+    size_t cursor;
+} xCookReader;
+
+static void skipSpaceAndComments(xCookReader* reader) {
+    while (reader->cursor < reader->size) {
+        const u8 c = reader->data[reader->cursor];
+        if (c == '#') {
+            while (reader->cursor < reader->size && reader->data[reader->cursor] != '\n') {
+                reader->cursor++;
+            }
+        } else if (isspace(c)) {
+            reader->cursor++;
+        } else {
+            break;
+        }
+    }
+}
+
+static bool readNumber(xCookReader* reader, u32* out) {
+    skipSpaceAndComments(reader);
+    u64 value  = 0;
+    bool digit = false;
+    while (reader->cursor < reader->size && isdigit(reader->data[reader->cursor]) && value < UINT32_MAX) {
+        value = value * 10 + (u64)(reader->data[reader->cursor++] - '0');
+        digit = true;
+    }
+    *out = (u32)value;
+    return digit && value <= UINT32_MAX;
+}
+
+static bool readToken(xCookReader* reader, char* out, size_t capacity) {
+    skipSpaceAndComments(reader);
+    size_t length = 0;
+    while (reader->cursor < reader->size && !isspace(reader->data[reader->cursor]) && length + 1 < capacity) {
+        out[length++] = (char)reader->data[reader->cursor++];
+    }
+    out[length] = '\0';
+    return length > 0;
+}
+
+/* Step over the single whitespace byte between header and raster; a file that ends first is truncated */
+static bool skipRasterSeparator(xCookReader* reader) {
+    if (reader->cursor >= reader->size) { return false; }
+    reader->cursor++;
+    return true;
+}
+
+/* True when at least `bytes` of raster remain after the header */
+static bool hasRaster(const xCookReader* reader, size_t bytes) {
+    return reader->cursor <= reader->size && reader->size - reader->cursor >= bytes;
+}
+
+static bool loadPpm(xCookReader* reader, xCookImage* out) {
+    u32 width, height, max_value;
+    if (!readNumber(reader, &width) || !readNumber(reader, &height) || !readNumber(reader, &max_value)) {
+        return false;
+    }
+    if (max_value != 255) {
+        X_PRINT_ERROR("Only 8-bit PPM files are supported (maxval %u)", max_value);
+        return false;
+    }
+    if (!skipRasterSeparator(reader)) { return false; }  // exactly one whitespace byte before the raster
+
+    if (!allocatePixels(out, width, height)) { return false; }
+    const size_t count = (size_t)width * height;
+    if (!hasRaster(reader, count * 3)) { return false; }
+
+    const u8* src = reader->data + reader->cursor;
+    for (size_t i = 0; i < count; ++i) {
+        out->pixels[i * 4 + 0] = src[i * 3 + 0];
+        out->pixels[i * 4 + 1] = src[i * 3 + 1];
+        out->pixels[i * 4 + 2] = src[i * 3 + 2];
+        out->pixels[i * 4 + 3] = 255;
+    }
+    return true;
+}
+
+static bool loadPam(xCookReader* reader, xCookImage* out) {
+    u32 width = 0, height = 0, depth = 0, max_value = 0;
+    char token[32];
+    for (;;) {
+        if (!readToken(reader, token, sizeof(token))) { return false; }
+        if (X_STREQ(token, "ENDHDR")) { break; }
+        if (X_STREQ(token, "WIDTH")) {
+            readNumber(reader, &width);
+        } else if (X_STREQ(token, "HEIGHT")) {
+            readNumber(reader, &height);
+        } else if (X_STREQ(token, "DEPTH")) {
+            readNumber(reader, &depth);
+        } else if (X_STREQ(token, "MAXVAL")) {
+            readNumber(reader, &max_value);
+        } else if (X_STREQ(token, "TUPLTYPE")) {
+            readToken(reader, token, sizeof(token));
+        }
+    }
+    if (!skipRasterSeparator(reader)) { return false; }  // newline after ENDHDR
+
+    if (max_value != 255 || (depth != 3 && depth != 4)) {
+        X_PRINT_ERROR("Only 8-bit RGB and RGB_ALPHA PAM files are supported");
+        return false;
+    }
+    if (!allocatePixels(out, width, height)) { return false; }
+    const size_t count = (size_t)width * height;
+    if (!hasRaster(reader, count * depth)) { return false; }
+
+    const u8* src = reader->data + reader->cursor;
+    for (size_t i = 0; i < count; ++i) {
+        out->pixels[i * 4 + 0] = src[i * depth + 0];
+        out->pixels[i * 4 + 1] = src[i * depth + 1];
+        out->pixels[i * 4 + 2] = src[i * depth + 2];
+        out->pixels[i * 4 + 3] = depth == 4 ? src[i * depth + 3] : 255;
+    }
+    return true;
+}
+
+/* ============================================================================
+ * TGA
+ * ============================================================================ */
+
+#define X_TGA_HEADER_SIZE 18
+
+static void tgaStorePixel(const u8* src, u32 bytes, u8* dst) {
+    if (bytes == 1) {
+        dst[0] = dst[1] = dst[2] = src[0];
+        dst[3]                   = 255;
+        return;
+    }
+    // Stored as BGR(A)
+    dst[0] = src[2];
+    dst[1] = src[1];
+    dst[2] = src[0];
+    dst[3] = bytes == 4 ? src[3] : 255;
+}
+
+static bool loadTga(const u8* data, size_t size, xCookImage* out) {
+    if (size < X_TGA_HEADER_SIZE) { return false; }
+    const u8 id_length  = data[0];
+    const u8 color_map  = data[1];
+    const u8 image_type = data[2];
+    const u32 width     = (u32)data[12] | ((u32)data[13] << 8);
+    const u32 height    = (u32)data[14] | ((u32)data[15] << 8);
+    const u32 bpp       = data[16];
+    const bool top_down = (data[17] & 0x20) != 0;
+
+    const bool rle   = image_type == 10 || image_type == 11;
+    const bool gray  = image_type == 3 || image_type == 11;
+    const u32 bytes  = bpp / 8;
+    const bool valid = color_map == 0 && (image_type == 2 || image_type == 3 || rle) &&
+                       (gray ? bpp == 8 : (bpp == 24 || bpp == 32));
+    if (!valid) {
+        X_PRINT_ERROR("Unsupported TGA (type %u, %u bpp); expected true-color or grayscale", image_type, bpp);
+        return false;
+    }
+    if (!allocatePixels(out, width, height)) { return false; }
+
+    const u8* src      = data + X_TGA_HEADER_SIZE + id_length;
+    const u8* end      = data + size;
+    const size_t count = (size_t)width * height;
+    size_t written     = 0;
+    while (written < count) {
+        u32 run      = 1;
+        bool literal = true;
+        if (rle) {
+            if (src >= end) { return false; }
+            const u8 packet = *src++;
+            run             = (packet & 0x7F) + 1u;
+            literal         = (packet & 0x80) == 0;
+        }
+        run = (u32)X_MIN((size_t)run, count - written);
+
+        for (u32 i = 0; i < run; ++i) {
+            if (src + bytes > end) { return false; }
+            // File row order may be bottom-up; store top-down
+            const size_t x   = (written + i) % width;
+            const size_t row = (written + i) / width;
+            const size_t y   = top_down ? row : height - 1 - row;
+            tgaStorePixel(src, bytes, out->pixels + (y * width + x) * 4);
+            if (literal) { src += bytes; }
+        }
+        if (!literal) { src += bytes; }
+        written += run;
+    }
+    return true;
+}
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+static const char* extensionOf(const char* path) {
+    const char* dot = strrchr(path, '.');
+    return dot != NULL ? dot + 1 : "";
+}
+
+static bool extensionIs(const char* path, const char* extension) {
+    const char* ext = extensionOf(path);
+    for (; *ext != '\0' && *extension != '\0'; ++ext, ++extension) {
+        if (tolower((u8)*ext) != *extension) { return false; }
+    }
+    return *ext == '\0' && *extension == '\0';
+}
+
+bool xCookImageIsSupported(const char* path) {
+    return extensionIs(path, "ppm") || extensionIs(path, "pam") || extensionIs(path, "tga");
+}
+
+bool xCookImageLoad(const char* path, xCookImage* out) {
+    X_ZERO_STRUCT(out);
+    size_t size = 0;
+    u8* data    = readWholeFile(path, &size);
+    if (data == NULL) { return false; }
+
+    bool ok = false;
+    if (extensionIs(path, "tga")) {
+        ok = loadTga(data, size, out);
+    } else if (size >= 2 && data[0] == 'P' && (data[1] == '6' || data[1] == '7')) {
+        xCookReader reader = {data, size, 2};
+        ok                 = data[1] == '6' ? loadPpm(&reader, out) : loadPam(&reader, out);
+    }
+    X_FREE(data);
+
+    if (!ok) {
+        X_PRINT_ERROR("Failed to decode '%s'", path);
+        xCookImageFree(out);
+    }
+    return ok;
+}
+
+void xCookImageFree(xCookImage* image) {
+    X_FREE(image->pixels);
+    image->width  = 0;
+    image->height = 0;
+}
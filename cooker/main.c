@@ -0,0 +1,445 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#if defined(_MSC_VER)
+    #define _CRT_SECURE_NO_WARNINGS 1
+#endif
+
+#include "cook.h"
+
+#include <hash.h>
+#include <platform.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+    #include <direct.h>
+#else
+    #include <sys/stat.h>
+#endif
+
+#define X_COOK_MAX_PATH 1024
+#define X_COOK_MANIFEST_NAME ".xcook_manifest"
+
+/* Bump when the cooker's output changes for identical inputs and settings */
+#define X_COOK_VERSION 1
+
+typedef enum {
+    X_COOK_FORMAT_AUTO = 0,
+    X_COOK_FORMAT_RGBA8,
+    X_COOK_FORMAT_BC1,
+    X_COOK_FORMAT_BC3,
+    X_COOK_FORMAT_BC7,
+} xCookFormatChoice;
+
+typedef struct {
+    xCookFormatChoice format;
+    xCookMipFilter filter;
+    bool srgb;
+    bool premultiply;
+    bool force;
+    u32 thread_count;
+} xCookOptions;
+
+/* One cooked input: content hash of the source, hash of the settings it was cooked with */
+typedef struct {
+    char* path;
+    u64 content_hash;
+    u32 settings_hash;
+} xCookManifestEntry;
+
+typedef struct {
+    xCookManifestEntry* entries;
+    u32 count;
+    u32 capacity;
+} xCookManifest;
+
+typedef struct {
+    u32 cooked;
+    u32 skipped;
+    u32 failed;
+    u64 source_bytes;
+    u64 output_bytes;
+} xCookStats;
+
+/* ============================================================================
+ * MANIFEST
+ * ============================================================================ */
+
+static void manifestPush(xCookManifest* manifest, const char* path, u64 content_hash, u32 settings_hash) {
+    if (manifest->count == manifest->capacity) {
+        manifest->capacity = X_MAX(manifest->capacity * 2, 64u);
+        manifest->entries  = X_REALLOC(manifest->entries, xCookManifestEntry, manifest->capacity);
+        X_CHECK_ALLOC(manifest->entries);
+    }
+    xCookManifestEntry* entry = &manifest->entries[manifest->count++];
+    entry->path               = X_STRDUP_SAFE(path);
+    entry->content_hash       = content_hash;
+    entry->settings_hash      = settings_hash;
+    X_CHECK_ALLOC(entry->path);
+}
+
+static const xCookManifestEntry* manifestFind(const xCookManifest* manifest, const char* path) {
+    for (u32 i = 0; i < manifest->count; ++i) {
+        if (X_STREQ(manifest->entries[i].path, path)) { return &manifest->entries[i]; }
+    }
+    return NULL;
+}
+
+static void manifestFree(xCookManifest* manifest) {
+    for (u32 i = 0; i < manifest->count; ++i) {
+        X_FREE(manifest->entries[i].path);
+    }
+    X_FREE(manifest->entries);
+    manifest->count    = 0;
+    manifest->capacity = 0;
+}
+
+/* A missing or unreadable manifest just means everything is cooked again */
+static void manifestLoad(xCookManifest* manifest, const char* path) {
+    FILE* file = fopen(path, "r");
+    if (file == NULL) { return; }
+
+    char line[X_COOK_MAX_PATH + 64];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        unsigned long long content_hash;
+        unsigned int settings_hash;
+        int consumed = 0;
+        if (sscanf(line, "%16llx %8x %n", &content_hash, &settings_hash, &consumed) != 2 || consumed == 0) {
+            continue;
+        }
+        char* name                  = line + consumed;
+        name[strcspn(name, "\r\n")] = '\0';
+        if (*name != '\0') { manifestPush(manifest, name, content_hash, settings_hash); }
+    }
+    fclose(file);
+}
+
+static bool manifestSave(const xCookManifest* manifest, const char* path) {
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        X_PRINT_ERROR("Failed to write manifest '%s'", path);
+        return false;
+    }
+    for (u32 i = 0; i < manifest->count; ++i) {
+        const xCookManifestEntry* entry = &manifest->entries[i];
+        fprintf(file,
+                "%016llx %08x %s\n",
+                (unsigned long long)entry->content_hash,
+                entry->settings_hash,
+                entry->path);
+    }
+    fclose(file);
+    return true;
+}
+
+/* ============================================================================
+ * FILE HELPERS
+ * ============================================================================ */
+
+static void collectImage(void* user, const char* relative_path) {
+    if (!xCookImageIsSupported(relative_path)) { return; }
+    // Reuse the manifest list as a plain path list; hashes are filled in later
+    manifestPush((xCookManifest*)user, relative_path, 0, 0);
+}
+
+static bool fileExists(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) { return false; }
+    fclose(file);
+    return true;
+}
+
+static void makeDirectory(const char* path) {
+#if defined(_WIN32)
+    _mkdir(path);
+#else
+    mkdir(path, 0755);
+#endif
+}
+
+/* Create every directory leading up to the file at `path` */
+static void makeParentDirectories(const char* path) {
+    char buffer[X_COOK_MAX_PATH];
+    snprintf(buffer, sizeof(buffer), "%s", path);
+    for (char* c = buffer + 1; *c != '\0'; ++c) {
+        if (*c == '/' || *c == '\\') {
+            const char separator = *c;
+            *c                   = '\0';
+            makeDirectory(buffer);
+            *c = separator;
+        }
+    }
+}
+
+/* `<output>/<relative path without extension>.xtex` */
+static void outputPathFor(const char* output, const char* relative_path, char* out, size_t capacity) {
+    const char* dot = strrchr(relative_path, '.');
+    const int stem  = dot != NULL ? (int)(dot - relative_path) : (int)strlen(relative_path);
+    snprintf(out, capacity, "%s/%.*s.xtex", output, stem, relative_path);
+}
+
+/* ============================================================================
+ * COOKING
+ * ============================================================================ */
+
+static u32 settingsHash(const xCookOptions* options) {
+    const u32 settings[] = {
+      X_COOK_VERSION,
+      (u32)options->format,
+      (u32)options->filter,
+      options->srgb,
+      options->premultiply,
+    };
+    return xHashFnv1a32(settings, sizeof(settings));
+}
+
+static xTextureFormat resolveFormat(xCookFormatChoice choice, bool has_alpha) {
+    switch (choice) {
+        case X_COOK_FORMAT_RGBA8:
+            return X_TEXTURE_FORMAT_RGBA8;
+        case X_COOK_FORMAT_BC1:
+            return X_TEXTURE_FORMAT_BC1;
+        case X_COOK_FORMAT_BC3:
+            return X_TEXTURE_FORMAT_BC3;
+        case X_COOK_FORMAT_BC7:
+            return X_TEXTURE_FORMAT_BC7;
+        case X_COOK_FORMAT_AUTO:
+        default:
+            // BC1 is half the size of BC7 and just as good for opaque color
+            return has_alpha ? X_TEXTURE_FORMAT_BC7 : X_TEXTURE_FORMAT_BC1;
+    }
+}
+
+static bool imageHasAlpha(const xCookImage* image) {
+    const size_t count = (size_t)image->width * image->height;
+    for (size_t i = 0; i < count; ++i) {
+        if (image->pixels[i * 4 + 3] != 255) { return true; }
+    }
+    return false;
+}
+
+/*
+ * Build the blob in memory: header, then every mip in order, each aligned to
+ * X_TEXTURE_BLOB_ALIGN so the runtime can hand the pointers straight to the GPU.
+ */
+static bool cookImage(
+  xJobSystem* jobs, const xCookOptions* options, const xCookImage* image, const char* path, u64* out_bytes) {
+    const bool has_alpha        = imageHasAlpha(image);
+    const xTextureFormat format = resolveFormat(options->format, has_alpha);
+    const bool premultiply      = options->premultiply && has_alpha;
+
+    u32 mip_count = 1;
+    while (mip_count < X_TEXTURE_MAX_MIPS && (X_MAX(image->width, image->height) >> mip_count) > 0) {
+        mip_count++;
+    }
+
+    xTextureBlobHeader header = {0};
+    header.magic              = X_TEXTURE_BLOB_MAGIC;
+    header.version            = X_TEXTURE_BLOB_VERSION;
+    header.format             = (u32)format;
+    header.flags              = premultiply ? X_TEXTURE_BLOB_PREMULTIPLIED : 0;
+    header.width              = image->width;
+    header.height             = image->height;
+    header.mip_count          = mip_count;
+    if (options->srgb) { header.flags |= X_TEXTURE_BLOB_SRGB; }
+
+    u64 total = X_ALIGN_UP(sizeof(xTextureBlobHeader), X_TEXTURE_BLOB_ALIGN);
+    for (u32 i = 0; i < mip_count; ++i) {
+        xTextureBlobMip* mip = &header.mips[i];
+        mip->width           = X_MAX(image->width >> i, 1u);
+        mip->height          = X_MAX(image->height >> i, 1u);
+        mip->size            = (u32)xTextureMipBytes(format, mip->width, mip->height);
+        mip->offset          = (u32)total;
+        total                = X_ALIGN_UP(total + mip->size, X_TEXTURE_BLOB_ALIGN);
+    }
+
+    u8* blob = X_CALLOC(u8, (size_t)total);
+    u8* rgba = X_MALLOC(u8, (size_t)image->width * image->height * 4);
+    if (blob == NULL || rgba == NULL) {
+        X_FREE(blob);
+        X_FREE(rgba);
+        return false;
+    }
+    memcpy(blob, &header, sizeof(header));
+
+    xCookLevel level;
+    bool ok = xCookLevelFromImage(jobs, image, options->srgb, premultiply, &level);
+    for (u32 i = 0; i < mip_count && ok; ++i) {
+        const xTextureBlobMip* mip = &header.mips[i];
+        u8* dst                    = blob + mip->offset;
+        if (xTextureFormatIsBlock(format)) {
+            xCookLevelToRgba8(jobs, &level, options->srgb, rgba);
+            xCookCompress(jobs, format, rgba, level.width, level.height, dst);
+        } else {
+            xCookLevelToRgba8(jobs, &level, options->srgb, dst);
+        }
+
+        // Each level is filtered from the full-precision previous one, never from the quantized result
+        if (i + 1 < mip_count) {
+            xCookLevel next;
+            ok = xCookLevelDownsample(jobs, &level, options->filter, &next);
+            xCookLevelFree(&level);
+            level = next;
+        }
+    }
+    if (ok) { xCookLevelFree(&level); }
+    X_FREE(rgba);
+
+    if (ok) {
+        makeParentDirectories(path);
+        FILE* file = fopen(path, "wb");
+        ok         = file != NULL && fwrite(blob, 1, (size_t)total, file) == (size_t)total;
+        if (file != NULL) { fclose(file); }
+        if (!ok) { X_PRINT_ERROR("Failed to write '%s'", path); }
+    }
+    X_FREE(blob);
+
+    *out_bytes = total;
+    return ok;
+}
+
+/* ============================================================================
+ * MAIN
+ * ============================================================================ */
+
+static void printUsage(void) {
+    fprintf(stderr,
+            "usage: xenc_cook [--format auto|rgba8|bc1|bc3|bc7] [--mips box|kaiser] [--linear] [--no-premultiply]\n"
+            "                 [--force] [--threads N] <input directory> <output directory>\n");
+    fprintf(stderr, "  --format           Output format; auto picks BC1 for opaque images and BC7 otherwise\n");
+    fprintf(stderr, "  --mips             Mip filter (default kaiser)\n");
+    fprintf(stderr, "  --linear           Treat color as linear data instead of sRGB\n");
+    fprintf(stderr, "  --no-premultiply   Keep straight alpha\n");
+    fprintf(stderr, "  --force            Ignore the manifest and cook every input\n");
+    fprintf(stderr, "  --threads N        Worker threads including the main thread (default one per core)\n");
+}
+
+static bool parseFormat(const char* name, xCookFormatChoice* out) {
+    static const char* kNames[] = {"auto", "rgba8", "bc1", "bc3", "bc7"};
+    for (u32 i = 0; i < X_ARRAY_SIZE(kNames); ++i) {
+        if (X_STREQ(name, kNames[i])) {
+            *out = (xCookFormatChoice)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char** argv) {
+    xCookOptions options = {X_COOK_FORMAT_AUTO, X_COOK_MIP_KAISER, true, true, false, 0};
+    const char* input    = NULL;
+    const char* output   = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        const bool has_value = i + 1 < argc;
+        if (X_STREQ(argv[i], "--format") && has_value) {
+            if (!parseFormat(argv[++i], &options.format)) {
+                printUsage();
+                return 1;
+            }
+        } else if (X_STREQ(argv[i], "--mips") && has_value) {
+            ++i;
+            if (!X_STREQ(argv[i], "box") && !X_STREQ(argv[i], "kaiser")) {
+                printUsage();
+                return 1;
+            }
+            options.filter = X_STREQ(argv[i], "box") ? X_COOK_MIP_BOX : X_COOK_MIP_KAISER;
+        } else if (X_STREQ(argv[i], "--threads") && has_value) {
+            options.thread_count = (u32)strtoul(argv[++i], NULL, 10);
+        } else if (X_STREQ(argv[i], "--linear")) {
+            options.srgb = false;
+        } else if (X_STREQ(argv[i], "--no-premultiply")) {
+            options.premultiply = false;
+        } else if (X_STREQ(argv[i], "--force")) {
+            options.force = true;
+        } else if (input == NULL) {
+            input = argv[i];
+        } else if (output == NULL) {
+            output = argv[i];
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+    if (input == NULL || output == NULL) {
+        printUsage();
+        return 1;
+    }
+
+    xCookManifest sources = {0};
+    if (!xPlatformWalkDirectory(input, collectImage, &sources)) { return 1; }
+
+    char manifest_path[X_COOK_MAX_PATH];
+    snprintf(manifest_path, sizeof(manifest_path), "%s/%s", output, X_COOK_MANIFEST_NAME);
+    xCookManifest previous = {0};
+    if (!options.force) { manifestLoad(&previous, manifest_path); }
+
+    makeDirectory(output);
+    xJobSystem* jobs     = xJobSystemCreate(options.thread_count);
+    const u32 settings   = settingsHash(&options);
+    const f64 start      = xPlatformTime();
+    xCookManifest cooked = {0};
+    xCookStats stats     = {0};
+
+    for (u32 i = 0; i < sources.count; ++i) {
+        const char* relative_path = sources.entries[i].path;
+        char source_path[X_COOK_MAX_PATH];
+        char output_path[X_COOK_MAX_PATH * 2];
+        snprintf(source_path, sizeof(source_path), "%s/%s", input, relative_path);
+        outputPathFor(output, relative_path, output_path, sizeof(output_path));
+
+        xMappedFile source;
+        if (!xPlatformMapFile(source_path, &source)) {
+            stats.failed++;
+            continue;
+        }
+        const u64 content_hash = xHashFnv1a64(source.data, source.size);
+        stats.source_bytes += source.size;
+        xPlatformUnmapFile(&source);
+
+        const xCookManifestEntry* entry = manifestFind(&previous, relative_path);
+        if (entry != NULL && entry->content_hash == content_hash && entry->settings_hash == settings &&
+            fileExists(output_path)) {
+            manifestPush(&cooked, relative_path, content_hash, settings);
+            stats.skipped++;
+            continue;
+        }
+
+        xCookImage image;
+        u64 bytes = 0;
+        if (!xCookImageLoad(source_path, &image)) {
+            stats.failed++;
+            continue;
+        }
+        const bool ok = cookImage(jobs, &options, &image, output_path, &bytes);
+        xCookImageFree(&image);
+        if (!ok) {
+            stats.failed++;
+            continue;
+        }
+
+        manifestPush(&cooked, relative_path, content_hash, settings);
+        stats.cooked++;
+        stats.output_bytes += bytes;
+        printf("  %s -> %s\n", relative_path, output_path);
+    }
+
+    // Only entries that cooked or were already up to date survive, so failures retry next run
+    const bool saved = manifestSave(&cooked, manifest_path);
+    printf("Cooked %u, skipped %u, failed %u: %llu source bytes -> %llu output bytes in %.2f s\n",
+           stats.cooked,
+           stats.skipped,
+           stats.failed,
+           (unsigned long long)stats.source_bytes,
+           (unsigned long long)stats.output_bytes,
+           xPlatformTime() - start);
+
+    xJobSystemDestroy(jobs);
+    manifestFree(&cooked);
+    manifestFree(&previous);
+    manifestFree(&sources);
+    return stats.failed == 0 && saved ? 0 : 1;
+}
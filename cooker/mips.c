@@ -0,0 +1,258 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "cook.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+/* Rows per job; mip levels are small enough that finer splits only add overhead */
+#define X_COOK_ROW_GRAIN 8
+
+/* Kaiser-windowed sinc, in destination pixels, as used by most offline texture tools */
+#define X_COOK_KAISER_RADIUS 3
+#define X_COOK_KAISER_ALPHA 4.0
+#define X_COOK_KAISER_TAPS (X_COOK_KAISER_RADIUS * 4)
+
+#define X_COOK_PI 3.14159265358979323846
+
+static f32 sSrgbToLinear[256];
+
+static void buildSrgbTable(void) {
+    if (sSrgbToLinear[255] != 0.0f) { return; }
+    for (u32 i = 0; i < 256; ++i) {
+        const f64 c      = (f64)i / 255.0;
+        sSrgbToLinear[i] = (f32)(c <= 0.04045 ? c / 12.92 : pow((c + 0.055) / 1.055, 2.4));
+    }
+}
+
+X_FORCE_INLINE static u8 linearToSrgb8(f32 value) {
+    const f32 c = X_CLAMP(value, 0.0f, 1.0f);
+    const f32 s = c <= 0.0031308f ? c * 12.92f : 1.055f * powf(c, 1.0f / 2.4f) - 0.055f;
+    return (u8)(s * 255.0f + 0.5f);
+}
+
+X_FORCE_INLINE static u8 unorm8(f32 value) {
+    return (u8)(X_CLAMP(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+static bool allocateLevel(xCookLevel* level, u32 width, u32 height) {
+    level->width  = width;
+    level->height = height;
+    level->pixels = X_MALLOC(xVec4, (size_t)width * height);
+    X_ASSERT_MSG(level->pixels == NULL || X_IS_ALIGNED(level->pixels, 16), "Level allocation is under-aligned");
+    return level->pixels != NULL;
+}
+
+void xCookLevelFree(xCookLevel* level) {
+    X_FREE(level->pixels);
+}
+
+/* ============================================================================
+ * CONVERSION
+ * ============================================================================ */
+
+typedef struct {
+    const xCookImage* image;
+    xCookLevel* level;
+    u8* out;
+    bool srgb;
+    bool premultiply;
+} xCookConvertJob;
+
+static void decodeRows(void* data, u32 begin, u32 end) {
+    const xCookConvertJob* job = (const xCookConvertJob*)data;
+    const u32 width            = job->image->width;
+    for (u32 y = begin; y < end; ++y) {
+        const u8* src = job->image->pixels + (size_t)y * width * 4;
+        xVec4* dst    = job->level->pixels + (size_t)y * width;
+        for (u32 x = 0; x < width; ++x, src += 4) {
+            const f32 a = (f32)src[3] / 255.0f;
+            xVec4 color = xVec4Scale(xVec4Make(src[0], src[1], src[2], src[3]), 1.0f / 255.0f);
+            if (job->srgb) {
+                color = xVec4Make(sSrgbToLinear[src[0]], sSrgbToLinear[src[1]], sSrgbToLinear[src[2]], a);
+            }
+            // Premultiply in linear light so filtering never bleeds color out of transparent texels
+            if (job->premultiply) { color = xVec4Mul(color, xVec4Make(a, a, a, 1.0f)); }
+            dst[x] = color;
+        }
+    }
+}
+
+bool xCookLevelFromImage(xJobSystem* jobs, const xCookImage* image, bool srgb, bool premultiply, xCookLevel* out) {
+    buildSrgbTable();
+    if (!allocateLevel(out, image->width, image->height)) { return false; }
+
+    xCookConvertJob job = {.image = image, .level = out, .srgb = srgb, .premultiply = premultiply};
+    xJobsParallelFor(jobs, image->height, X_COOK_ROW_GRAIN, decodeRows, &job);
+    return true;
+}
+
+static void encodeRows(void* data, u32 begin, u32 end) {
+    const xCookConvertJob* job = (const xCookConvertJob*)data;
+    const u32 width            = job->level->width;
+    for (u32 y = begin; y < end; ++y) {
+        const xVec4* src = job->level->pixels + (size_t)y * width;
+        u8* dst          = job->out + (size_t)y * width * 4;
+        for (u32 x = 0; x < width; ++x, dst += 4) {
+            const xVec4 c = src[x];
+            dst[0]        = job->srgb ? linearToSrgb8(c.x) : unorm8(c.x);
+            dst[1]        = job->srgb ? linearToSrgb8(c.y) : unorm8(c.y);
+            dst[2]        = job->srgb ? linearToSrgb8(c.z) : unorm8(c.z);
+            dst[3]        = unorm8(c.w);
+        }
+    }
+}
+
+void xCookLevelToRgba8(xJobSystem* jobs, const xCookLevel* level, bool srgb, u8* out) {
+    xCookConvertJob job = {.level = (xCookLevel*)level, .out = out, .srgb = srgb};
+    xJobsParallelFor(jobs, level->height, X_COOK_ROW_GRAIN, encodeRows, &job);
+}
+
+/* ============================================================================
+ * DOWNSAMPLING
+ * ============================================================================ */
+
+typedef struct {
+    const xCookLevel* src;
+    xCookLevel* dst;
+    xCookLevel* temp;
+    f32 weights[X_COOK_KAISER_TAPS];
+} xCookFilterJob;
+
+/* 2x2 average; odd edges reuse the last texel */
+static void boxRows(void* data, u32 begin, u32 end) {
+    const xCookFilterJob* job = (const xCookFilterJob*)data;
+    const xCookLevel* src     = job->src;
+    const xCookLevel* dst     = job->dst;
+    const xVec4 quarter       = xVec4Splat(0.25f);
+
+    for (u32 y = begin; y < end; ++y) {
+        const xVec4* row0 = src->pixels + (size_t)X_MIN(y * 2, src->height - 1) * src->width;
+        const xVec4* row1 = src->pixels + (size_t)X_MIN(y * 2 + 1, src->height - 1) * src->width;
+        xVec4* out        = dst->pixels + (size_t)y * dst->width;
+        for (u32 x = 0; x < dst->width; ++x) {
+            const u32 x0    = X_MIN(x * 2, src->width - 1);
+            const u32 x1    = X_MIN(x * 2 + 1, src->width - 1);
+            const xVec4 sum = xVec4Add(xVec4Add(row0[x0], row0[x1]), xVec4Add(row1[x0], row1[x1]));
+            out[x]          = xVec4Mul(sum, quarter);
+        }
+    }
+}
+
+static f64 besselI0(f64 x) {
+    f64 sum  = 1.0;
+    f64 term = 1.0;
+    for (u32 k = 1; k < 32; ++k) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+/*
+ * Weights for the source texels 2i - R*2 + 1 .. 2i + R*2 around destination texel i.
+ * Every destination texel sits at the same phase, so one table serves the whole level.
+ */
+static void buildKaiserWeights(f32* weights) {
+    f64 total = 0.0;
+    f64 raw[X_COOK_KAISER_TAPS];
+    for (u32 k = 0; k < X_COOK_KAISER_TAPS; ++k) {
+        // Distance from the destination center, in destination texels
+        const f64 t      = ((f64)k - (X_COOK_KAISER_TAPS / 2) + 0.5) * 0.5;
+        const f64 sinc   = t == 0.0 ? 1.0 : sin(X_COOK_PI * t) / (X_COOK_PI * t);
+        const f64 ratio  = t / X_COOK_KAISER_RADIUS;
+        const f64 window = besselI0(X_COOK_KAISER_ALPHA * sqrt(X_MAX(1.0 - ratio * ratio, 0.0))) /
+                           besselI0(X_COOK_KAISER_ALPHA);
+        raw[k] = sinc * window;
+        total += raw[k];
+    }
+    for (u32 k = 0; k < X_COOK_KAISER_TAPS; ++k) {
+        weights[k] = (f32)(raw[k] / total);
+    }
+}
+
+/* Horizontal pass: src (w x h) -> temp (w/2 x h) */
+static void kaiserRowsH(void* data, u32 begin, u32 end) {
+    const xCookFilterJob* job = (const xCookFilterJob*)data;
+    const xCookLevel* src     = job->src;
+    const xCookLevel* temp    = job->temp;
+    const s32 last            = (s32)src->width - 1;
+
+    for (u32 y = begin; y < end; ++y) {
+        const xVec4* in = src->pixels + (size_t)y * src->width;
+        xVec4* out      = temp->pixels + (size_t)y * temp->width;
+        if (src->width == temp->width) {
+            memcpy(out, in, sizeof(xVec4) * src->width);
+            continue;
+        }
+        for (u32 x = 0; x < temp->width; ++x) {
+            const s32 first = (s32)(x * 2) - (X_COOK_KAISER_TAPS / 2 - 1);
+            xVec4 sum       = xVec4Splat(0.0f);
+            for (u32 k = 0; k < X_COOK_KAISER_TAPS; ++k) {
+                const s32 sx = X_CLAMP(first + (s32)k, 0, last);
+                sum          = xVec4MulAdd(in[sx], xVec4Splat(job->weights[k]), sum);
+            }
+            out[x] = sum;
+        }
+    }
+}
+
+/* Vertical pass: temp (w/2 x h) -> dst (w/2 x h/2) */
+static void kaiserRowsV(void* data, u32 begin, u32 end) {
+    const xCookFilterJob* job = (const xCookFilterJob*)data;
+    const xCookLevel* temp    = job->temp;
+    const xCookLevel* dst     = job->dst;
+    const s32 last            = (s32)temp->height - 1;
+
+    for (u32 y = begin; y < end; ++y) {
+        xVec4* out = dst->pixels + (size_t)y * dst->width;
+        if (temp->height == dst->height) {
+            memcpy(out, temp->pixels + (size_t)y * temp->width, sizeof(xVec4) * dst->width);
+            continue;
+        }
+        for (u32 x = 0; x < dst->width; ++x) {
+            out[x] = xVec4Splat(0.0f);
+        }
+        // Accumulate whole rows so the inner loop streams through memory
+        const s32 first = (s32)(y * 2) - (X_COOK_KAISER_TAPS / 2 - 1);
+        for (u32 k = 0; k < X_COOK_KAISER_TAPS; ++k) {
+            const s32 sy    = X_CLAMP(first + (s32)k, 0, last);
+            const xVec4* in = temp->pixels + (size_t)sy * temp->width;
+            const xVec4 w   = xVec4Splat(job->weights[k]);
+            for (u32 x = 0; x < dst->width; ++x) {
+                out[x] = xVec4MulAdd(in[x], w, out[x]);
+            }
+        }
+        // Negative lobes can overshoot; keep results displayable
+        for (u32 x = 0; x < dst->width; ++x) {
+            out[x]   = xVec4Max(out[x], xVec4Splat(0.0f));
+            out[x].w = X_MIN(out[x].w, 1.0f);
+        }
+    }
+}
+
+bool xCookLevelDownsample(xJobSystem* jobs, const xCookLevel* src, xCookMipFilter filter, xCookLevel* out) {
+    const u32 width  = X_MAX(src->width / 2, 1u);
+    const u32 height = X_MAX(src->height / 2, 1u);
+    if (!allocateLevel(out, width, height)) { return false; }
+
+    xCookFilterJob job = {.src = src, .dst = out};
+    if (filter == X_COOK_MIP_BOX) {
+        xJobsParallelFor(jobs, height, X_COOK_ROW_GRAIN, boxRows, &job);
+        return true;
+    }
+
+    xCookLevel temp;
+    if (!allocateLevel(&temp, width, src->height)) {
+        xCookLevelFree(out);
+        return false;
+    }
+    job.temp = &temp;
+    buildKaiserWeights(job.weights);
+    xJobsParallelFor(jobs, src->height, X_COOK_ROW_GRAIN, kaiserRowsH, &job);
+    xJobsParallelFor(jobs, height, X_COOK_ROW_GRAIN, kaiserRowsV, &job);
+    xCookLevelFree(&temp);
+    return true;
+}
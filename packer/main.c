@@ -0,0 +1,137 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#if defined(_MSC_VER)
+    #define _CRT_SECURE_NO_WARNINGS 1
+#endif
+
+#include <xpak.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define X_PACK_MAX_PATH 1024
+
+typedef struct {
+    char** paths;
+    u32 count;
+    u32 capacity;
+} xPathList;
+
+static void pushPath(xPathList* list, const char* path) {
+    if (list->count == list->capacity) {
+        list->capacity = X_MAX(list->capacity * 2, 64u);
+        list->paths    = X_REALLOC(list->paths, char*, list->capacity);
+        X_CHECK_ALLOC(list->paths);
+    }
+    list->paths[list->count] = X_STRDUP_SAFE(path);
+    X_CHECK_ALLOC(list->paths[list->count]);
+    list->count++;
+}
+
+static void collectFile(void* user, const char* relative_path) {
+    pushPath((xPathList*)user, relative_path);
+}
+
+static void* readFile(const char* path, u32* out_size) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) {
+        X_PRINT_ERROR("Failed to open '%s'", path);
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (size < 0 || (u64)size > UINT32_MAX) {
+        X_PRINT_ERROR("'%s' is too large to pack", path);
+        fclose(file);
+        return NULL;
+    }
+
+    u8* data = X_MALLOC(u8, (size_t)X_MAX(size, 1L));
+    if (data == NULL || fread(data, 1, (size_t)size, file) != (size_t)size) {
+        X_PRINT_ERROR("Failed to read '%s'", path);
+        X_FREE(data);
+        fclose(file);
+        return NULL;
+    }
+
+    fclose(file);
+    *out_size = (u32)size;
+    return data;
+}
+
+static void printUsage(void) {
+    fprintf(stderr, "usage: xenc_pack [--compress] <input directory> <output.xpak>\n");
+    fprintf(stderr, "  --compress, -c   LZ4-compress entries that shrink by at least 1/8th\n");
+}
+
+int main(int argc, char** argv) {
+    bool compress      = false;
+    const char* input  = NULL;
+    const char* output = NULL;
+
+    for (int i = 1; i < argc; ++i) {
+        if (X_STREQ(argv[i], "--compress") || X_STREQ(argv[i], "-c")) {
+            compress = true;
+        } else if (input == NULL) {
+            input = argv[i];
+        } else if (output == NULL) {
+            output = argv[i];
+        } else {
+            printUsage();
+            return 1;
+        }
+    }
+    if (input == NULL || output == NULL) {
+        printUsage();
+        return 1;
+    }
+
+    xPathList list = {0};
+    if (!xPlatformWalkDirectory(input, collectFile, &list)) { return 1; }
+
+    xPakInput* inputs = X_CALLOC(xPakInput, X_MAX(list.count, 1u));
+    X_CHECK_ALLOC(inputs);
+
+    bool ok       = true;
+    u64 raw_bytes = 0;
+    for (u32 i = 0; i < list.count && ok; ++i) {
+        char full[X_PACK_MAX_PATH];
+        snprintf(full, sizeof(full), "%s/%s", input, list.paths[i]);
+
+        inputs[i].path     = list.paths[i];
+        inputs[i].compress = compress;
+        inputs[i].data     = readFile(full, &inputs[i].size);
+        ok                 = inputs[i].data != NULL;
+        raw_bytes += inputs[i].size;
+    }
+
+    ok = ok && xPakWrite(output, inputs, list.count);
+
+    if (ok) {
+        xPak pak;
+        if (xPakOpen(&pak, output)) {
+            u32 compressed = 0;
+            for (u32 i = 0; i < pak.entry_count; ++i) {
+                if (pak.entries[i].flags & X_PAK_ENTRY_LZ4) { compressed++; }
+            }
+            printf("Packed %u files (%u compressed): %llu bytes -> %llu bytes\n",
+                   pak.entry_count,
+                   compressed,
+                   (unsigned long long)raw_bytes,
+                   (unsigned long long)pak.file.size);
+            xPakClose(&pak);
+        }
+    }
+
+    for (u32 i = 0; i < list.count; ++i) {
+        X_MEM_FREE((void*)inputs[i].data);
+        X_FREE(list.paths[i]);
+    }
+    X_FREE(inputs);
+    X_FREE(list.paths);
+    return ok ? 0 : 1;
+}
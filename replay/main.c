@@ -0,0 +1,191 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#if defined(_MSC_VER)
+    #define _CRT_SECURE_NO_WARNINGS 1
+#endif
+
+#include <capture.h>
+#include <jobs.h>
+#include <platform.h>
+#include <swrast.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef enum {
+    X_REPLAY_BACKEND_NULL,
+    X_REPLAY_BACKEND_SWRAST,
+} xReplayBackend;
+
+typedef struct {
+    const char* path;
+    xReplayBackend backend;
+    u32 threads;  // 0 uses every core
+    u32 loops;
+    bool render_thread;
+    bool print_frames;
+    const char* dump_directory;
+} xReplayOptions;
+
+static void printUsage(void) {
+    fprintf(stderr, "usage: xenc_replay [options] <capture.xcap>\n");
+    fprintf(stderr, "  --backend, -b <null|swrast>  backend to submit to (default null)\n");
+    fprintf(stderr, "  --threads, -t <n>            swrast job threads (default: every core)\n");
+    fprintf(stderr, "  --loops, -n <n>              replay the capture n times (default 1)\n");
+    fprintf(stderr, "  --render-thread              submit on a render thread, as the sandbox does\n");
+    fprintf(stderr, "  --frames                     print every frame's CPU time\n");
+    fprintf(stderr, "  --dump <dir>                 swrast: write every frame to <dir>/frame_<n>.ppm\n");
+}
+
+static bool parseOptions(int argc, char** argv, xReplayOptions* options) {
+    *options = (xReplayOptions) {.loops = 1};
+    for (int i = 1; i < argc; ++i) {
+        const char* arg      = argv[i];
+        const bool has_value = i + 1 < argc;
+        if ((X_STREQ(arg, "--backend") || X_STREQ(arg, "-b")) && has_value) {
+            const char* name = argv[++i];
+            if (X_STREQ(name, "null")) {
+                options->backend = X_REPLAY_BACKEND_NULL;
+            } else if (X_STREQ(name, "swrast")) {
+                options->backend = X_REPLAY_BACKEND_SWRAST;
+            } else {
+                fprintf(stderr, "unknown backend '%s'\n", name);
+                return false;
+            }
+        } else if ((X_STREQ(arg, "--threads") || X_STREQ(arg, "-t")) && has_value) {
+            options->threads = (u32)strtoul(argv[++i], NULL, 10);
+        } else if ((X_STREQ(arg, "--loops") || X_STREQ(arg, "-n")) && has_value) {
+            options->loops = X_MAX((u32)strtoul(argv[++i], NULL, 10), 1u);
+        } else if (X_STREQ(arg, "--render-thread")) {
+            options->render_thread = true;
+        } else if (X_STREQ(arg, "--frames")) {
+            options->print_frames = true;
+        } else if (X_STREQ(arg, "--dump") && has_value) {
+            options->dump_directory = argv[++i];
+        } else if (arg[0] != '-' && options->path == NULL) {
+            options->path = arg;
+        } else {
+            return false;
+        }
+    }
+    return options->path != NULL;
+}
+
+static int compareF64(const void* a, const void* b) {
+    const f64 lhs = *(const f64*)a;
+    const f64 rhs = *(const f64*)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+/* Sorts `times` in place */
+static void printSummary(f64* times, u32 count, f64 wall_seconds) {
+    if (count == 0) {
+        printf("no frames replayed\n");
+        return;
+    }
+
+    f64 total = 0.0;
+    for (u32 i = 0; i < count; ++i) {
+        total += times[i];
+    }
+    qsort(times, count, sizeof(f64), compareF64);
+
+    printf("%u frames in %.3f s (%.1f frames/s)\n", count, wall_seconds, (f64)count / wall_seconds);
+    printf("CPU ms/frame: mean %.4f, min %.4f, p50 %.4f, p95 %.4f, p99 %.4f, max %.4f\n",
+           total * 1000.0 / count,
+           times[0] * 1000.0,
+           times[count / 2] * 1000.0,
+           times[(u32)((u64)count * 95 / 100)] * 1000.0,
+           times[(u32)((u64)count * 99 / 100)] * 1000.0,
+           times[count - 1] * 1000.0);
+}
+
+/*
+ * Replays a capture written by xRendererCaptureBegin as fast as possible and
+ * reports the CPU cost of each frame: the time from its first recorded call
+ * to the return of FrameEnd, which includes sorting and submission unless
+ * --render-thread moves those off the timed thread.
+ */
+int main(int argc, char** argv) {
+    xReplayOptions options;
+    if (!parseOptions(argc, argv, &options)) {
+        printUsage();
+        return 1;
+    }
+
+    xCapture capture;
+    if (!xCaptureOpen(&capture, options.path)) { return 1; }
+    printf("%s: %u frames, %u commands, %ux%u\n",
+           options.path,
+           capture.header->frame_count,
+           capture.header->command_count,
+           capture.header->width,
+           capture.header->height);
+
+    xRenderer* renderer = xRendererCreate();
+    xRendererInitialize(renderer, capture.header->width, capture.header->height);
+
+    xJobSystem* jobs = NULL;
+    xSoftwareBackend sb;
+    if (options.backend == X_REPLAY_BACKEND_SWRAST) {
+        const u32 threads = options.threads > 0 ? options.threads : xPlatformCoreCount();
+        if (threads > 1) { jobs = xJobSystemCreate(threads); }
+        X_CHECK_MSG(xSoftwareBackendInit(&sb, renderer, jobs), "Failed to create software backend");
+        sb.dump_directory = options.dump_directory;
+        xRendererSetBackend(renderer, &sb.backend);
+        printf("backend: swrast (%s kernel, %u threads)\n", sb.kernel_name, threads);
+    } else {
+        printf("backend: null\n");
+    }
+
+    if (options.render_thread) {
+        // swrast then dispatches its tiles from a thread `jobs` doesn't own; they go through its injection queue
+        const xRenderThreadDesc thread_desc = {0};
+        X_CHECK_MSG(xRendererStartThread(renderer, &thread_desc), "Failed to start render thread");
+    }
+
+    xCapturePlayer player;
+    X_CHECK_MSG(xCapturePlayerInit(&player, &capture, renderer), "Failed to create capture player");
+
+    const u32 capacity = X_MAX(capture.header->frame_count, 1u) * options.loops;
+    f64* times         = X_MALLOC(f64, capacity);
+    X_CHECK_ALLOC(times);
+
+    u32 count            = 0;
+    u64 draws            = 0;
+    u32 missing          = 0;
+    const f64 wall_start = xPlatformTime();
+    for (u32 loop = 0; loop < options.loops; ++loop) {
+        if (loop > 0) { xCapturePlayerRewind(&player); }
+        for (;;) {
+            const f64 start    = xPlatformTime();
+            const bool stepped = xCapturePlayerStep(&player);
+            const f64 elapsed  = xPlatformTime() - start;
+            if (!stepped) { break; }
+
+            if (options.print_frames) {
+                printf("frame %5u  %.4f ms  %u draws\n", count, elapsed * 1000.0, renderer->stats.draws);
+            }
+            if (count < capacity) { times[count++] = elapsed; }
+        }
+        draws += player.stats.draws;
+        missing += player.stats.missing;
+    }
+    xRendererWaitIdle(renderer);
+    const f64 wall_seconds = xPlatformTime() - wall_start;
+
+    printSummary(times, count, wall_seconds);
+    if (count > 0) { printf("%.1f draws/frame\n", (f64)draws / count); }
+    if (missing > 0) { printf("%u draws skipped: their mesh was never created in the capture\n", missing); }
+
+    X_FREE(times);
+    xCapturePlayerShutdown(&player);
+    xRendererShutdown(renderer);
+    if (options.backend == X_REPLAY_BACKEND_SWRAST) { xSoftwareBackendShutdown(&sb); }
+    if (jobs != NULL) { xJobSystemDestroy(jobs); }
+    xRendererDestroy(renderer);
+    xCaptureClose(&capture);
+    return 0;
+}
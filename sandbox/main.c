@@ -6,49 +6,173 @@
 #include <stdbool.h>
 
 #include "renderer.h"
+#include "profiler.h"
+#include "frameloop.h"
 
-static xWindow* gWindow     = NULL;
-static xRenderer* gRenderer = NULL;
+typedef struct {
+    xWindow* window;
+    xRenderer* renderer;
+    xFrameLoop* loop;
+    xInputState input;
+    xInputEvent* events;  // X_INPUT_QUEUE_CAPACITY entries
+} xSandbox;
 
-static void onResize(GLFWwindow* window, int width, int height) {
-    X_UNUSED(window);
-    if (gRenderer) { xRendererResize(gRenderer, width, height); }
-    if (gWindow) { xWindowSetDimensions(gWindow, width, height); }
+static void update(void* user, f64 dt) {
+    X_UNUSED(user);
+    X_UNUSED(dt);
+    // Simulate stuff
 }
 
-static void onKey(GLFWwindow* window, int key, int scancode, int action, int mods) {
-    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS) { glfwSetWindowShouldClose(window, GLFW_TRUE); }
+static void render(void* user, f64 alpha) {
+    X_UNUSED(alpha);
+    xSandbox* sandbox = (xSandbox*)user;
+
+    // With the render thread running FrameEnd only publishes the packet; the thread submits and presents it
+    xRendererFrameBegin(sandbox->renderer);
+    // Render stuff
+    xRendererFrameEnd(sandbox->renderer);
+
+    if (!sandbox->renderer->threaded) { xWindowPresent(sandbox->window); }
+}
+
+/* Render thread hooks: it owns the GL context from attach to detach */
+static void renderAttach(void* user) {
+    xWindowBindContext((xWindow*)user);
+}
+
+static void renderPresent(void* user) {
+    xWindowPresent((xWindow*)user);
+}
+
+static void renderDetach(void* user) {
+    X_UNUSED(user);
+    xWindowUnbindContext();
+}
+
+/* Hitches under vsync and uncapped pacing are measured against the primary monitor's refresh */
+static f64 refreshRate(void) {
+    const GLFWvidmode* mode = glfwGetVideoMode(glfwGetPrimaryMonitor());
+    return mode != NULL && mode->refreshRate > 0 ? (f64)mode->refreshRate : 60.0;
+}
+
+/*
+ * F10 cycles vsync -> 144 Hz cap -> uncapped; the cap and uncapped modes present immediately.
+ * The new present mode is queued and applied by the render thread at its next present.
+ */
+static void cyclePacing(xSandbox* sandbox, xFrameLoop* loop) {
+    switch (loop->desc.pacing) {
+        case X_FRAME_PACING_VSYNC:
+            xWindowSetPresentMode(sandbox->window, X_PRESENT_IMMEDIATE);
+            xFrameLoopSetPacing(loop, X_FRAME_PACING_CAPPED, 144.0);
+            break;
+        case X_FRAME_PACING_CAPPED:
+            xFrameLoopSetPacing(loop, X_FRAME_PACING_UNCAPPED, refreshRate());
+            break;
+        case X_FRAME_PACING_UNCAPPED:
+        default:
+            xWindowSetPresentMode(sandbox->window, X_PRESENT_VSYNC);
+            xFrameLoopSetPacing(loop, X_FRAME_PACING_VSYNC, refreshRate());
+            break;
+    }
+}
+
+/* Runs after the frame loop's pacing wait, so the frame simulates input no older than the wait itself */
+static void poll(void* user) {
+    xSandbox* sandbox = (xSandbox*)user;
+    {
+        X_PROFILE_SCOPE("glfwPollEvents");
+        glfwPollEvents();
+    }
+
+    // Handle everything that arrived since last frame in one pass
+    const u32 event_count =
+      X_MIN(xInputDrain(&sandbox->window->input, &sandbox->input, sandbox->events, X_INPUT_QUEUE_CAPACITY),
+            (u32)X_INPUT_QUEUE_CAPACITY);
+    for (u32 i = 0; i < event_count; ++i) {
+        if (sandbox->events[i].type == X_INPUT_EVENT_RESIZE) {
+            xRendererResize(sandbox->renderer, sandbox->events[i].size.width, sandbox->events[i].size.height);
+        }
+    }
+
+    const xInputState* input = &sandbox->input;
+    if (xInputKeyPressed(input, GLFW_KEY_ESCAPE)) { glfwSetWindowShouldClose(sandbox->window->handle, GLFW_TRUE); }
+    // Capture the next 120 frames for chrome://tracing
+    if (xInputKeyPressed(input, GLFW_KEY_F9) && !xProfilerIsCapturing()) {
+        xProfilerCaptureBegin("xenc_trace.json", 120);
+    }
+    // Record the next 600 frames of renderer calls for xenc_replay
+    if (xInputKeyPressed(input, GLFW_KEY_F8) && !xRendererIsCapturing(sandbox->renderer)) {
+        xRendererCaptureBegin(sandbox->renderer, "xenc_frames.xcap", 600);
+    }
+    if (xInputKeyPressed(input, GLFW_KEY_F10)) { cyclePacing(sandbox, sandbox->loop); }
 }
 
 int main(void) {
+    xProfilerInit();
+    xLogStart(NULL);
+
     xWindowInfo window_info;
-    window_info.title     = "XenC Window";
-    window_info.width     = 800;
-    window_info.height    = 600;
-    window_info.resizable = true;
+    window_info.title        = "XenC Window";
+    window_info.width        = 800;
+    window_info.height       = 600;
+    window_info.resizable    = true;
+    window_info.present_mode = X_PRESENT_VSYNC;
 
-    gWindow = xWindowCreate(&window_info);
-    X_ASSERT_MSG(gWindow != NULL, "Window creation returned null ptr");
+    xWindow* window = xWindowCreate(&window_info);
+    X_ASSERT_MSG(window != NULL, "Window creation returned null ptr");
 
-    xWindowSetDimensions(gWindow, 1280, 720);
-    xWindowSetResizeCallback(gWindow, onResize);
-    xWindowSetKeyCallback(gWindow, onKey);
+    xWindowSetDimensions(window, 1280, 720);
 
-    gRenderer = xRendererCreate();
-    xRendererInitialize(gRenderer, gWindow->width, gWindow->height);
+    xRenderer* renderer = xRendererCreate();
+    xRendererInitialize(renderer, window->width, window->height);
 
-    while (!glfwWindowShouldClose(gWindow->handle)) {
-        xRendererFrameBegin(gRenderer);
-        // Render stuff
-        xRendererFrameEnd(gRenderer);
+    // Asset loads go through the streamer; FrameBegin publishes them within its time budget
+    const xStreamerDesc streamer_desc = {0};
+    xStreamer* streamer               = xStreamerCreate(&streamer_desc);
+    X_ASSERT_MSG(streamer != NULL, "Failed to create asset streamer");
+    xRendererSetStreamer(renderer, streamer, 0.0);
 
-        glfwPollEvents();
-        glfwSwapBuffers(gWindow->handle);
+    // Simulation of frame N+1 overlaps submission of frame N on the render thread
+    xWindowUnbindContext();
+    const xRenderThreadDesc thread_desc = {window, renderAttach, renderPresent, renderDetach};
+    if (!xRendererStartThread(renderer, &thread_desc)) { xWindowBindContext(window); }
+
+    xInputEvent events[X_INPUT_QUEUE_CAPACITY];
+    const xFrameLoopDesc loop_desc = {.fixed_hz = 60.0, .target_hz = refreshRate(), .pacing = X_FRAME_PACING_VSYNC};
+    xFrameLoop loop;
+    xFrameLoopInit(&loop, &loop_desc);
+
+    xSandbox sandbox = {.window = window, .renderer = renderer, .loop = &loop, .events = events};
+    xInputStateInit(&sandbox.input);
+    const xFrameLoopCallbacks callbacks = {&sandbox, poll, update, render};
+
+    while (!glfwWindowShouldClose(window->handle)) {
+        xFrameLoopTick(&loop, &callbacks);
+        xProfilerFrameMark();
+        xMemFrameMark();
     }
 
-    xRendererShutdown(gRenderer);
-    xRendererDestroy(gRenderer);
-    xWindowDestroy(gWindow);
+    xFrameLoopStats loop_stats;
+    xFrameLoopGetStats(&loop, &loop_stats);
+    printf("frame time: mean %.3f ms, stddev %.3f ms, p99 %.3f ms, max %.3f ms, %u hitches\n",
+           loop_stats.mean,
+           loop_stats.stddev,
+           loop_stats.p99,
+           loop_stats.max,
+           loop_stats.hitches);
+    xProfilerReport(stdout);
+
+    // Submits whatever is still in flight before the context is torn down with the window
+    xRendererStopThread(renderer);
+    xRendererShutdown(renderer);
+    xRendererDestroy(renderer);
+    xStreamerDestroy(streamer);
+    xWindowDestroy(window);
+    xProfilerShutdown();
+    xLogStop();
+
+    xMemReport(stdout);
+    xMemReportLeaks(stdout);
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,79 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_ARENA
+
+#include "arena.h"
+
+bool xArenaInit(xArena* arena, size_t capacity) {
+    X_ASSERT_MSG(arena != NULL, "arena is NULL");
+    X_ASSERT_MSG(capacity > 0, "capacity == 0");
+
+    arena->base = X_MALLOC(u8, capacity);
+    if (arena->base == NULL) {
+        X_PRINT_ERROR("Failed to allocate arena block (%zu bytes)", capacity);
+        arena->capacity = 0;
+        arena->offset   = 0;
+        arena->peak     = 0;
+        return false;
+    }
+
+    arena->capacity = capacity;
+    arena->offset   = 0;
+    arena->peak     = 0;
+    return true;
+}
+
+void xArenaShutdown(xArena* arena) {
+    X_FREE(arena->base);
+    arena->capacity = 0;
+    arena->offset   = 0;
+}
+
+void* xArenaAllocAligned(xArena* arena, size_t size, size_t align) {
+    X_ASSERT_MSG(X_IS_POW2(align), "Arena alignment must be a power of 2");
+
+    // Align the absolute address rather than the offset so alignments larger than the block's own are honored
+    const uptr base    = (uptr)arena->base;
+    const uptr aligned = X_ALIGN_UP(base + arena->offset, (uptr)align);
+    const size_t start = (size_t)(aligned - base);
+
+    if (X_UNLIKELY(start + size > arena->capacity || start + size < start)) {
+        X_PRINT_ERROR("Arena out of memory (requested %zu bytes, %zu remaining)", size, xArenaRemaining(arena));
+        return NULL;
+    }
+
+    arena->offset = start + size;
+    if (arena->offset > arena->peak) { arena->peak = arena->offset; }
+    return arena->base + start;
+}
+
+void* xArenaAlloc(xArena* arena, size_t size) {
+    return xArenaAllocAligned(arena, size, X_ARENA_DEFAULT_ALIGN);
+}
+
+void* xArenaAllocZeroed(xArena* arena, size_t size, size_t align) {
+    void* ptr = xArenaAllocAligned(arena, size, align);
+    if (ptr != NULL) { memset(ptr, 0, size); }
+    return ptr;
+}
+
+bool xFrameArenaInit(xFrameArena* frame_arena, size_t capacity_per_frame) {
+    for (u32 i = 0; i < X_FRAME_ARENA_COUNT; ++i) {
+        if (!xArenaInit(&frame_arena->arenas[i], capacity_per_frame)) {
+            for (u32 j = 0; j < i; ++j) {
+                xArenaShutdown(&frame_arena->arenas[j]);
+            }
+            return false;
+        }
+    }
+    frame_arena->index = 0;
+    return true;
+}
+
+void xFrameArenaShutdown(xFrameArena* frame_arena) {
+    for (u32 i = 0; i < X_FRAME_ARENA_COUNT; ++i) {
+        xArenaShutdown(&frame_arena->arenas[i]);
+    }
+}
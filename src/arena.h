@@ -0,0 +1,86 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+
+/* Default alignment used by xArenaAlloc (matches malloc's guarantee on 64-bit targets) */
+#define X_ARENA_DEFAULT_ALIGN 16
+
+/*
+ * Linear (bump-pointer) allocator. Allocations are carved out of a single
+ * contiguous block and are never freed individually; the whole arena is reset
+ * at once, or rolled back to a marker taken with xArenaSave.
+ */
+typedef struct {
+    u8* base;
+    size_t capacity;
+    size_t offset;
+    size_t peak;
+} xArena;
+
+/* Opaque rollback point returned by xArenaSave */
+typedef struct {
+    size_t offset;
+} xArenaMarker;
+
+/* Number of frame arenas in flight (current frame + previous frame) */
+#define X_FRAME_ARENA_COUNT 2
+
+/*
+ * Double-buffered frame arena. Data allocated during frame N stays valid until
+ * the start of frame N + 2, so anything handed off at FrameEnd can still be read
+ * while the next frame is being recorded.
+ */
+typedef struct {
+    xArena arenas[X_FRAME_ARENA_COUNT];
+    u32 index;
+} xFrameArena;
+
+bool xArenaInit(xArena* arena, size_t capacity);
+void xArenaShutdown(xArena* arena);
+
+void* xArenaAlloc(xArena* arena, size_t size);
+void* xArenaAllocAligned(xArena* arena, size_t size, size_t align);
+void* xArenaAllocZeroed(xArena* arena, size_t size, size_t align);
+
+X_FORCE_INLINE static void xArenaReset(xArena* arena) {
+    arena->offset = 0;
+}
+
+X_FORCE_INLINE static xArenaMarker xArenaSave(const xArena* arena) {
+    return (xArenaMarker) {arena->offset};
+}
+
+X_FORCE_INLINE static void xArenaRestore(xArena* arena, xArenaMarker marker) {
+    X_ASSERT_MSG(marker.offset <= arena->offset, "Arena marker is newer than the arena's current offset");
+    arena->offset = marker.offset;
+}
+
+X_FORCE_INLINE static size_t xArenaRemaining(const xArena* arena) {
+    return arena->capacity - arena->offset;
+}
+
+bool xFrameArenaInit(xFrameArena* frame_arena, size_t capacity_per_frame);
+void xFrameArenaShutdown(xFrameArena* frame_arena);
+
+/* Flip to the other arena and reset it. O(1), no memory is touched. */
+X_FORCE_INLINE static void xFrameArenaSwap(xFrameArena* frame_arena) {
+    frame_arena->index = (frame_arena->index + 1) % X_FRAME_ARENA_COUNT;
+    xArenaReset(&frame_arena->arenas[frame_arena->index]);
+}
+
+X_FORCE_INLINE static xArena* xFrameArenaCurrent(xFrameArena* frame_arena) {
+    return &frame_arena->arenas[frame_arena->index];
+}
+
+/* Typed allocation helpers */
+#define X_ARENA_NEW(arena, type) ((type*)xArenaAllocZeroed((arena), sizeof(type), _Alignof(type)))
+#define X_ARENA_ARRAY(arena, type, count) ((type*)xArenaAllocAligned((arena), sizeof(type) * (count), _Alignof(type)))
+
+/* Scoped scratch region: everything allocated inside the block is released on exit */
+#define X_ARENA_SCOPE(arena)                                                                                           \
+    for (xArenaMarker _marker = xArenaSave(arena), *_once = &_marker; _once != NULL;                                   \
+         xArenaRestore((arena), _marker), _once = NULL)
@@ -0,0 +1,156 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "backend.h"
+
+#define X_RENDER_STATE_NONE UINT32_MAX
+
+void xRenderSubmit(const xRenderCommandBuffer* buffer,
+                   const xRenderBackend* backend,
+                   u32 width,
+                   u32 height,
+                   xRenderStats* stats) {
+    X_ZERO_STRUCT(stats);
+    backend->begin_frame(backend->user, width, height);
+
+    u32 shader   = X_RENDER_STATE_NONE;
+    u32 material = X_RENDER_STATE_NONE;
+    u32 state    = X_RENDER_STATE_NONE;
+    xRenderViewport viewport;
+    bool has_viewport = false;
+
+    for (u32 i = 0; i < buffer->count; ++i) {
+        const xRenderSortItem* item = &buffer->items[i];
+        const xRenderCommand* cmd   = &buffer->commands[item->command];
+
+        switch (cmd->type) {
+            case X_RENDER_CMD_CLEAR:
+                backend->clear(backend->user, &cmd->clear);
+                stats->clears++;
+                break;
+
+            case X_RENDER_CMD_VIEWPORT:
+                if (!has_viewport || memcmp(&viewport, &cmd->viewport, sizeof(viewport)) != 0) {
+                    viewport     = cmd->viewport;
+                    has_viewport = true;
+                    backend->set_viewport(backend->user, &viewport);
+                    stats->viewport_changes++;
+                }
+                break;
+
+            case X_RENDER_CMD_DRAW: {
+                const u32 key_shader   = X_RENDER_KEY_FIELD(item->key, SHADER);
+                const u32 key_material = X_RENDER_KEY_FIELD(item->key, MATERIAL);
+
+                if (key_shader != shader) {
+                    shader = key_shader;
+                    backend->set_shader(backend->user, shader);
+                    stats->shader_changes++;
+                    // Material bindings are shader-relative, so a new shader invalidates the current one
+                    material = X_RENDER_STATE_NONE;
+                }
+                if (key_material != material) {
+                    material = key_material;
+                    backend->set_material(backend->user, material);
+                    stats->material_changes++;
+                }
+                if (cmd->draw.state != state) {
+                    state = cmd->draw.state;
+                    backend->set_state(backend->user, state);
+                    stats->state_changes++;
+                }
+
+                backend->draw(backend->user, &cmd->draw);
+                stats->draws++;
+            } break;
+        }
+    }
+
+    stats->commands = buffer->count;
+    backend->end_frame(backend->user);
+}
+
+/* ============================================================================
+ * NULL BACKEND
+ * ============================================================================ */
+
+static void nullBeginFrame(void* user, u32 width, u32 height) {
+    xNullBackend* nb     = (xNullBackend*)user;
+    nb->last_key         = 0;
+    nb->current_shader   = X_RENDER_STATE_NONE;
+    nb->current_material = X_RENDER_STATE_NONE;
+    X_UNUSED(width);
+    X_UNUSED(height);
+}
+
+static void nullEndFrame(void* user) {
+    xNullBackend* nb = (xNullBackend*)user;
+    nb->frames++;
+}
+
+static void nullClear(void* user, const xRenderClear* clear) {
+    xNullBackend* nb = (xNullBackend*)user;
+    nb->totals.clears++;
+    X_UNUSED(clear);
+}
+
+static void nullSetViewport(void* user, const xRenderViewport* viewport) {
+    xNullBackend* nb = (xNullBackend*)user;
+    nb->totals.viewport_changes++;
+    X_UNUSED(viewport);
+}
+
+static void nullSetShader(void* user, u32 shader) {
+    xNullBackend* nb   = (xNullBackend*)user;
+    nb->current_shader = shader;
+    nb->totals.shader_changes++;
+}
+
+static void nullSetMaterial(void* user, u32 material) {
+    xNullBackend* nb     = (xNullBackend*)user;
+    nb->current_material = material;
+    nb->totals.material_changes++;
+}
+
+static void nullSetState(void* user, u32 state) {
+    xNullBackend* nb = (xNullBackend*)user;
+    nb->totals.state_changes++;
+    X_UNUSED(state);
+}
+
+static void nullDraw(void* user, const xRenderDraw* draw) {
+    xNullBackend* nb = (xNullBackend*)user;
+
+    // Reconstruct the key the draw was recorded with to verify submission order
+    const u64 key = xRenderKeyMake(draw->layer, X_RENDER_PASS_DRAW, nb->current_shader, nb->current_material, 0.0f,
+                                   false);
+    if (key < (nb->last_key & ~(u64)X_BITMASK(X_RENDER_KEY_DEPTH_BITS))) { nb->order_violations++; }
+    nb->last_key = key;
+
+    nb->totals.draws++;
+    nb->totals.commands++;
+}
+
+static u32 nullUploadTexture(void* user, const xTextureData* data) {
+    xNullBackend* nb    = (xNullBackend*)user;
+    const u32 mip_count = X_MIN(data->desc.mip_count, (u32)X_TEXTURE_MAX_MIPS);
+    for (u32 i = 0; i < mip_count; ++i) {
+        nb->texture_bytes += data->mip_sizes[i];
+    }
+    return ++nb->textures_uploaded;
+}
+
+void xNullBackendInit(xNullBackend* null_backend) {
+    X_ZERO_STRUCT(null_backend);
+    null_backend->backend.user           = null_backend;
+    null_backend->backend.begin_frame    = nullBeginFrame;
+    null_backend->backend.end_frame      = nullEndFrame;
+    null_backend->backend.clear          = nullClear;
+    null_backend->backend.set_viewport   = nullSetViewport;
+    null_backend->backend.set_shader     = nullSetShader;
+    null_backend->backend.set_material   = nullSetMaterial;
+    null_backend->backend.set_state      = nullSetState;
+    null_backend->backend.draw           = nullDraw;
+    null_backend->backend.upload_texture = nullUploadTexture;
+}
@@ -0,0 +1,64 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "commands.h"
+#include "texture.h"
+
+/*
+ * Backend interface the renderer submits sorted commands to. Every callback
+ * receives `user` as its first argument. The submitter only issues
+ * set_shader/set_material/set_state when the value actually changes.
+ */
+typedef struct xRenderBackend {
+    void* user;
+    void (*begin_frame)(void* user, u32 width, u32 height);
+    void (*end_frame)(void* user);
+    void (*clear)(void* user, const xRenderClear* clear);
+    void (*set_viewport)(void* user, const xRenderViewport* viewport);
+    void (*set_shader)(void* user, u32 shader);
+    void (*set_material)(void* user, u32 material);
+    void (*set_state)(void* user, u32 state);
+    void (*draw)(void* user, const xRenderDraw* draw);
+    // Optional: upload texture contents and return the backend's id for them
+    u32 (*upload_texture)(void* user, const xTextureData* data);
+} xRenderBackend;
+
+/* Per-frame submission counters */
+typedef struct {
+    u32 commands;
+    u32 draws;
+    u32 clears;
+    u32 viewport_changes;
+    u32 shader_changes;
+    u32 material_changes;
+    u32 state_changes;
+} xRenderStats;
+
+/* Walk the (already sorted) buffer and forward it to the backend with redundant state changes removed */
+void xRenderSubmit(const xRenderCommandBuffer* buffer,
+                   const xRenderBackend* backend,
+                   u32 width,
+                   u32 height,
+                   xRenderStats* stats);
+
+/*
+ * Null backend: performs no rendering and only records what it was asked to
+ * do, so sorting and state filtering can be measured without a GPU.
+ */
+typedef struct {
+    xRenderBackend backend;
+    xRenderStats totals;
+    u64 frames;
+    u64 last_key;
+    u32 order_violations;
+    u32 current_shader;
+    u32 current_material;
+    u32 textures_uploaded;
+    u64 texture_bytes;
+} xNullBackend;
+
+void xNullBackendInit(xNullBackend* null_backend);
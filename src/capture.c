@@ -0,0 +1,457 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_RENDERER
+
+#include "capture.h"
+
+#include <stdio.h>
+
+/* ============================================================================
+ * RECORDING
+ * ============================================================================ */
+
+struct xCaptureWriter {
+    FILE* file;
+    xCaptureHeader header;
+    xArrayU64 staged;  // u64 words keep every command X_CAPTURE_ALIGN aligned
+    bool failed;
+};
+
+X_STATIC_ASSERT(X_CAPTURE_ALIGN == sizeof(u64), "Staging buffer words must match the capture alignment");
+
+xCaptureWriter* xCaptureWriterOpen(const char* path, u32 width, u32 height) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        X_PRINT_ERROR("Failed to open frame capture '%s'", path);
+        return NULL;
+    }
+
+    xCaptureWriter* writer = X_NEW(xCaptureWriter);
+    if (writer == NULL) {
+        X_PRINT_ERROR("Failed to allocate frame capture writer");
+        fclose(file);
+        return NULL;
+    }
+
+    writer->file             = file;
+    writer->header.magic     = X_CAPTURE_MAGIC;
+    writer->header.version   = X_CAPTURE_VERSION;
+    writer->header.width     = width;
+    writer->header.height    = height;
+    writer->header.file_size = sizeof(xCaptureHeader);
+
+    // Placeholder until close knows the counts
+    if (fwrite(&writer->header, sizeof(xCaptureHeader), 1, file) != 1) {
+        X_PRINT_ERROR("Failed to write frame capture '%s'", path);
+        fclose(file);
+        X_FREE(writer);
+        return NULL;
+    }
+    return writer;
+}
+
+void* xCaptureWriterPush(xCaptureWriter* writer, xCaptureCommandType type, u32 size) {
+    const u32 payload_words = X_ALIGN_UP(size, (u32)X_CAPTURE_ALIGN) / X_CAPTURE_ALIGN;
+    const u32 first         = writer->staged.count;
+    if (!X_ARRAY_RESIZE(&writer->staged, first + 1 + payload_words)) {
+        if (!writer->failed) { X_PRINT_ERROR("Out of memory staging frame capture, dropping commands"); }
+        writer->failed = true;
+        return NULL;
+    }
+
+    xCaptureCommand* command = (xCaptureCommand*)&writer->staged.items[first];
+    command->type            = type;
+    command->size            = payload_words * X_CAPTURE_ALIGN;
+    writer->header.command_count++;
+    if (type == X_CAPTURE_CMD_FRAME_END) { writer->header.frame_count++; }
+    return command + 1;
+}
+
+u32 xCaptureWriterFlush(xCaptureWriter* writer) {
+    const size_t bytes = (size_t)writer->staged.count * sizeof(u64);
+    if (bytes > 0 && fwrite(writer->staged.items, 1, bytes, writer->file) != bytes) {
+        if (!writer->failed) { X_PRINT_ERROR("Failed to write frame capture, the file is incomplete"); }
+        writer->failed = true;
+    }
+    writer->header.file_size += bytes;
+    X_ARRAY_CLEAR(&writer->staged);
+    return writer->header.frame_count;
+}
+
+void xCaptureWriterClose(xCaptureWriter* writer) {
+    if (writer == NULL) { return; }
+
+    xCaptureWriterFlush(writer);
+    fseek(writer->file, 0, SEEK_SET);
+    fwrite(&writer->header, sizeof(xCaptureHeader), 1, writer->file);
+    fclose(writer->file);
+
+    X_ARRAY_FREE(&writer->staged);
+    X_FREE(writer);
+}
+
+/* ============================================================================
+ * READING
+ * ============================================================================ */
+
+/* Smallest payload each command type can carry; variable-size ones are checked further when played */
+static u32 minPayloadSize(u32 type) {
+    switch (type) {
+        case X_CAPTURE_CMD_FRAME_BEGIN:
+        case X_CAPTURE_CMD_FRAME_END:
+            return 0;
+        case X_CAPTURE_CMD_RESIZE:
+            return sizeof(xCaptureResize);
+        case X_CAPTURE_CMD_CLEAR:
+            return sizeof(xCaptureClear);
+        case X_CAPTURE_CMD_VIEWPORT:
+            return sizeof(xCaptureViewport);
+        case X_CAPTURE_CMD_DRAW:
+            return sizeof(xRenderDraw);
+        case X_CAPTURE_CMD_CREATE_TEXTURE:
+            return sizeof(xCaptureTexture);
+        case X_CAPTURE_CMD_CREATE_MESH:
+            return sizeof(xCaptureMesh);
+        case X_CAPTURE_CMD_DESTROY_TEXTURE:
+        case X_CAPTURE_CMD_DESTROY_MESH:
+            return sizeof(xCaptureDestroy);
+        default:
+            return UINT32_MAX;
+    }
+}
+
+/* Recorded handles index the player's tables, which are sized like the renderer's pools */
+static bool handleInRange(const xCaptureCommand* command) {
+    const void* payload = xCapturePayload(command);
+    switch (command->type) {
+        case X_CAPTURE_CMD_DRAW:
+            return X_HANDLE_INDEX(((const xRenderDraw*)payload)->mesh) < X_RENDERER_MAX_MESHES;
+        case X_CAPTURE_CMD_CREATE_TEXTURE:
+            return X_HANDLE_INDEX(((const xCaptureTexture*)payload)->handle) < X_RENDERER_MAX_TEXTURES;
+        case X_CAPTURE_CMD_CREATE_MESH:
+            return X_HANDLE_INDEX(((const xCaptureMesh*)payload)->handle) < X_RENDERER_MAX_MESHES;
+        case X_CAPTURE_CMD_DESTROY_TEXTURE:
+            return X_HANDLE_INDEX(((const xCaptureDestroy*)payload)->handle) < X_RENDERER_MAX_TEXTURES;
+        case X_CAPTURE_CMD_DESTROY_MESH:
+            return X_HANDLE_INDEX(((const xCaptureDestroy*)payload)->handle) < X_RENDERER_MAX_MESHES;
+        default:
+            return true;
+    }
+}
+
+/*
+ * A mesh's vertex and index data fit its payload, use the CPU vertex layout
+ * (the only one the player and the software backend read) and only name
+ * vertices that exist.
+ */
+static bool meshValid(const xCaptureCommand* command) {
+    const xCaptureMesh* mesh  = (const xCaptureMesh*)xCapturePayload(command);
+    const size_t vertex_bytes = mesh->has_vertices ? (size_t)mesh->vertex_count * sizeof(xVertex) : 0;
+    const size_t index_bytes  = mesh->has_indices ? (size_t)mesh->index_count * sizeof(u32) : 0;
+    if (mesh->has_vertices && mesh->vertex_stride != sizeof(xVertex)) { return false; }
+    if (command->size - sizeof(xCaptureMesh) < X_ALIGN_UP(vertex_bytes, X_CAPTURE_ALIGN) + index_bytes) {
+        return false;
+    }
+
+    if (mesh->has_indices) {
+        const u32* indices = (const u32*)((const u8*)(mesh + 1) + X_ALIGN_UP(vertex_bytes, X_CAPTURE_ALIGN));
+        for (u32 i = 0; i < mesh->index_count; ++i) {
+            if (indices[i] >= mesh->vertex_count) { return false; }
+        }
+    }
+    return true;
+}
+
+/* How far into a mesh a draw may reach: its indices, or its vertices when it has none */
+static u32 meshDrawLimit(const xCaptureMesh* mesh) {
+    return mesh->has_indices ? mesh->index_count : mesh->vertex_count;
+}
+
+/*
+ * Track which recorded meshes exist as the commands go by, so each draw can be
+ * checked against the mesh it names at that point. Draws of meshes the capture
+ * never created are skipped by the player and pass here.
+ */
+static bool contentValid(const xCaptureCommand* command, u32* mesh_limits) {
+    const void* payload = xCapturePayload(command);
+    switch (command->type) {
+        case X_CAPTURE_CMD_CREATE_MESH: {
+            if (!meshValid(command)) { return false; }
+            const xCaptureMesh* mesh                  = (const xCaptureMesh*)payload;
+            mesh_limits[X_HANDLE_INDEX(mesh->handle)] = meshDrawLimit(mesh);
+        } break;
+        case X_CAPTURE_CMD_DESTROY_MESH:
+            mesh_limits[X_HANDLE_INDEX(((const xCaptureDestroy*)payload)->handle)] = UINT32_MAX;
+            break;
+        case X_CAPTURE_CMD_DRAW: {
+            const xRenderDraw* draw = (const xRenderDraw*)payload;
+            const u32 limit         = mesh_limits[X_HANDLE_INDEX(draw->mesh)];
+            if (limit != UINT32_MAX && (draw->first_index > limit || draw->index_count > limit - draw->first_index)) {
+                return false;
+            }
+        } break;
+        default:
+            break;
+    }
+    return true;
+}
+
+/*
+ * Frames must nest like the renderer's FrameBegin/FrameEnd, and clears,
+ * viewports and draws only happen inside one, or playback would record them
+ * with no packet open.
+ */
+static bool orderValid(const xCaptureCommand* command, bool* in_frame, u32* frames) {
+    switch (command->type) {
+        case X_CAPTURE_CMD_FRAME_BEGIN:
+            if (*in_frame) { return false; }
+            *in_frame = true;
+            return true;
+        case X_CAPTURE_CMD_FRAME_END:
+            if (!*in_frame) { return false; }
+            *in_frame = false;
+            (*frames)++;
+            return true;
+        case X_CAPTURE_CMD_CLEAR:
+        case X_CAPTURE_CMD_VIEWPORT:
+        case X_CAPTURE_CMD_DRAW:
+            return *in_frame;
+        default:
+            return true;
+    }
+}
+
+bool xCaptureOpen(xCapture* capture, const char* path) {
+    X_ZERO_STRUCT(capture);
+    if (!xPlatformMapFile(path, &capture->file)) { return false; }
+
+    const xCaptureHeader* header = (const xCaptureHeader*)capture->file.data;
+    const size_t size            = capture->file.size;
+    if (size < sizeof(xCaptureHeader) || header->magic != X_CAPTURE_MAGIC || header->version != X_CAPTURE_VERSION ||
+        header->file_size != size) {
+        X_PRINT_ERROR("'%s' is not a valid frame capture", path);
+        xPlatformUnmapFile(&capture->file);
+        return false;
+    }
+
+    // UINT32_MAX marks a recorded mesh index with no live mesh
+    u32* mesh_limits = X_MALLOC(u32, X_RENDERER_MAX_MESHES);
+    if (mesh_limits == NULL) {
+        X_PRINT_ERROR("Failed to allocate frame capture validation table");
+        xPlatformUnmapFile(&capture->file);
+        return false;
+    }
+    memset(mesh_limits, 0xFF, sizeof(u32) * X_RENDERER_MAX_MESHES);
+
+    // Walk every command once here so playback never reads past the mapping, nor has a backend read past a mesh
+    const u8* cursor = capture->file.data + sizeof(xCaptureHeader);
+    const u8* end    = capture->file.data + size;
+    bool in_frame    = false;
+    u32 frames       = 0;
+    for (u32 i = 0; i < header->command_count; ++i) {
+        const xCaptureCommand* command = (const xCaptureCommand*)cursor;
+        if ((size_t)(end - cursor) < sizeof(xCaptureCommand) || command->size % X_CAPTURE_ALIGN != 0 ||
+            command->size > (size_t)(end - cursor) - sizeof(xCaptureCommand) ||
+            command->size < minPayloadSize(command->type) || minPayloadSize(command->type) == UINT32_MAX ||
+            !handleInRange(command) || !contentValid(command, mesh_limits) ||
+            !orderValid(command, &in_frame, &frames)) {
+            X_PRINT_ERROR("Frame capture '%s' is corrupt at command %u", path, i);
+            X_FREE(mesh_limits);
+            xPlatformUnmapFile(&capture->file);
+            return false;
+        }
+        cursor = (const u8*)xCaptureNext(command);
+    }
+    X_FREE(mesh_limits);
+
+    if (in_frame || frames != header->frame_count) {
+        X_PRINT_ERROR("Frame capture '%s' has unbalanced frames (%u complete, header says %u)",
+                      path,
+                      frames,
+                      header->frame_count);
+        xPlatformUnmapFile(&capture->file);
+        return false;
+    }
+
+    capture->header = header;
+    capture->first  = (const xCaptureCommand*)(capture->file.data + sizeof(xCaptureHeader));
+    capture->end    = (const xCaptureCommand*)cursor;
+    return true;
+}
+
+void xCaptureClose(xCapture* capture) {
+    xPlatformUnmapFile(&capture->file);
+    capture->header = NULL;
+    capture->first  = NULL;
+    capture->end    = NULL;
+}
+
+/* ============================================================================
+ * PLAYBACK
+ * ============================================================================ */
+
+bool xCapturePlayerInit(xCapturePlayer* player, const xCapture* capture, xRenderer* renderer) {
+    X_ZERO_STRUCT(player);
+    player->capture  = capture;
+    player->renderer = renderer;
+    player->cursor   = capture->first;
+    player->textures = X_CALLOC(xTextureHandle, X_RENDERER_MAX_TEXTURES);
+    player->meshes   = X_CALLOC(xMeshHandle, X_RENDERER_MAX_MESHES);
+    if (player->textures == NULL || player->meshes == NULL) {
+        X_PRINT_ERROR("Failed to allocate capture handle tables");
+        X_DELETE(player->textures);
+        X_DELETE(player->meshes);
+        return false;
+    }
+    return true;
+}
+
+static void destroyReplayed(xCapturePlayer* player) {
+    for (u32 i = 0; i < X_RENDERER_MAX_TEXTURES; ++i) {
+        if (player->textures[i] != X_HANDLE_INVALID) { xRendererDestroyTexture(player->renderer, player->textures[i]); }
+    }
+    for (u32 i = 0; i < X_RENDERER_MAX_MESHES; ++i) {
+        if (player->meshes[i] != X_HANDLE_INVALID) { xRendererDestroyMesh(player->renderer, player->meshes[i]); }
+    }
+    memset(player->textures, 0, sizeof(xTextureHandle) * X_RENDERER_MAX_TEXTURES);
+    memset(player->meshes, 0, sizeof(xMeshHandle) * X_RENDERER_MAX_MESHES);
+}
+
+void xCapturePlayerShutdown(xCapturePlayer* player) {
+    if (player->textures != NULL && player->meshes != NULL) { destroyReplayed(player); }
+    X_DELETE(player->textures);
+    X_DELETE(player->meshes);
+}
+
+void xCapturePlayerRewind(xCapturePlayer* player) {
+    destroyReplayed(player);
+    player->cursor = player->capture->first;
+    X_ZERO_STRUCT(&player->stats);
+}
+
+/* A recorded index is only reused after its destroy command, which clears the entry */
+static void bindHandle(xHandle* table, xHandle recorded, xHandle live) {
+    table[X_HANDLE_INDEX(recorded)] = live;
+}
+
+/* Live handle for a destroy command's recorded one, unbinding it. X_HANDLE_INVALID if it was never created. */
+static xHandle unbindHandle(xHandle* table, const xCaptureCommand* command) {
+    const u32 index      = X_HANDLE_INDEX(((const xCaptureDestroy*)xCapturePayload(command))->handle);
+    const xHandle handle = table[index];
+    table[index]         = X_HANDLE_INVALID;
+    return handle;
+}
+
+static void createTexture(xCapturePlayer* player, const xCaptureCommand* command) {
+    const xCaptureTexture* recorded = (const xCaptureTexture*)xCapturePayload(command);
+
+    xTextureData data     = {0};
+    data.desc.width       = recorded->width;
+    data.desc.height      = recorded->height;
+    data.desc.layers      = recorded->layers;
+    data.desc.mip_count   = X_MIN(recorded->mip_count, (u32)X_TEXTURE_MAX_MIPS);
+    data.desc.format      = (xTextureFormat)recorded->format;
+    data.desc.srgb        = recorded->srgb != 0;
+    data.flags            = recorded->flags;
+    bool has_data         = false;
+    const u8* mip         = (const u8*)(recorded + 1);
+    const u8* payload_end = (const u8*)xCaptureNext(command);
+    for (u32 i = 0; i < data.desc.mip_count; ++i) {
+        const u32 mip_size = recorded->mip_sizes[i];
+        if (mip_size == 0) { continue; }
+        if ((size_t)(payload_end - mip) < mip_size) { break; }
+
+        data.mips[i]      = mip;
+        data.mip_sizes[i] = mip_size;
+        has_data          = true;
+        mip += X_ALIGN_UP(mip_size, (u32)X_CAPTURE_ALIGN);
+    }
+
+    const xTextureHandle texture = has_data ? xRendererCreateTextureFromData(player->renderer, &data)
+                                            : xRendererCreateTexture(player->renderer, &data.desc);
+    bindHandle(player->textures, recorded->handle, texture);
+    player->stats.textures++;
+}
+
+static void createMesh(xCapturePlayer* player, const xCaptureCommand* command) {
+    // Sizes, layout and indices were all checked by xCaptureOpen
+    const xCaptureMesh* recorded = (const xCaptureMesh*)xCapturePayload(command);
+    const u8* cursor             = (const u8*)(recorded + 1);
+    const size_t vertex_bytes    = recorded->has_vertices ? (size_t)recorded->vertex_count * sizeof(xVertex) : 0;
+
+    const xMeshDesc desc = {
+      .vertex_count  = recorded->vertex_count,
+      .index_count   = recorded->index_count,
+      .vertex_stride = recorded->vertex_stride,
+      .vertices      = recorded->has_vertices ? (const xVertex*)cursor : NULL,
+      .indices       = recorded->has_indices ? (const u32*)(cursor + X_ALIGN_UP(vertex_bytes, X_CAPTURE_ALIGN)) : NULL,
+    };
+    bindHandle(player->meshes, recorded->handle, xRendererCreateMesh(player->renderer, &desc));
+    player->stats.meshes++;
+}
+
+bool xCapturePlayerStep(xCapturePlayer* player) {
+    xRenderer* renderer = player->renderer;
+
+    while (player->cursor < player->capture->end) {
+        const xCaptureCommand* command = player->cursor;
+        const void* payload            = xCapturePayload(command);
+        player->cursor                 = xCaptureNext(command);
+
+        switch ((xCaptureCommandType)command->type) {
+            case X_CAPTURE_CMD_FRAME_BEGIN:
+                xRendererFrameBegin(renderer);
+                break;
+            case X_CAPTURE_CMD_FRAME_END:
+                xRendererFrameEnd(renderer);
+                player->stats.frames++;
+                return true;
+            case X_CAPTURE_CMD_RESIZE: {
+                const xCaptureResize* resize = (const xCaptureResize*)payload;
+                xRendererResize(renderer, resize->width, resize->height);
+            } break;
+            case X_CAPTURE_CMD_CLEAR: {
+                const xCaptureClear* clear = (const xCaptureClear*)payload;
+                xRendererClear(renderer, (u8)clear->layer, clear->color, clear->depth);
+            } break;
+            case X_CAPTURE_CMD_VIEWPORT: {
+                const xCaptureViewport* viewport = (const xCaptureViewport*)payload;
+                xRendererSetViewport(renderer,
+                                     (u8)viewport->layer,
+                                     viewport->viewport.x,
+                                     viewport->viewport.y,
+                                     viewport->viewport.width,
+                                     viewport->viewport.height);
+            } break;
+            case X_CAPTURE_CMD_DRAW: {
+                xRenderDraw draw = *(const xRenderDraw*)payload;
+                draw.mesh        = player->meshes[X_HANDLE_INDEX(draw.mesh)];
+                if (draw.mesh == X_HANDLE_INVALID) {
+                    player->stats.missing++;
+                    break;
+                }
+                xRendererDraw(renderer, &draw);
+                player->stats.draws++;
+            } break;
+            case X_CAPTURE_CMD_CREATE_TEXTURE:
+                createTexture(player, command);
+                break;
+            case X_CAPTURE_CMD_CREATE_MESH:
+                createMesh(player, command);
+                break;
+            case X_CAPTURE_CMD_DESTROY_TEXTURE: {
+                const xTextureHandle texture = unbindHandle(player->textures, command);
+                if (texture != X_HANDLE_INVALID) { xRendererDestroyTexture(renderer, texture); }
+            } break;
+            case X_CAPTURE_CMD_DESTROY_MESH: {
+                const xMeshHandle mesh = unbindHandle(player->meshes, command);
+                if (mesh != X_HANDLE_INVALID) { xRendererDestroyMesh(renderer, mesh); }
+            } break;
+            case X_CAPTURE_CMD_COUNT:
+                break;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,198 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "platform.h"
+#include "renderer.h"
+
+/*
+ * Renderer frame capture. While a capture is open every call crossing the
+ * xRenderer API (frame begin/end, resizes, resource creation and destruction,
+ * clears, viewports, draws) is appended to a binary file, which a player can
+ * feed back into any renderer and backend. Resources alive when the capture
+ * starts are written first, so the file replays on its own.
+ *
+ * Vertex, index and cooked texture data are copied into the file. Textures
+ * created from a bare descriptor (and any alive at capture start, whose
+ * contents the renderer no longer holds) replay as descriptors only.
+ */
+
+#define X_CAPTURE_MAGIC 0x50414358u  // "XCAP"
+#define X_CAPTURE_VERSION 1
+
+/* Every command and payload starts on this boundary so the player can read them in place */
+#define X_CAPTURE_ALIGN 8
+
+typedef enum {
+    X_CAPTURE_CMD_FRAME_BEGIN = 1,  // no payload
+    X_CAPTURE_CMD_FRAME_END,        // no payload
+    X_CAPTURE_CMD_RESIZE,           // xCaptureResize
+    X_CAPTURE_CMD_CLEAR,            // xCaptureClear
+    X_CAPTURE_CMD_VIEWPORT,         // xCaptureViewport
+    X_CAPTURE_CMD_DRAW,             // xRenderDraw
+    X_CAPTURE_CMD_CREATE_TEXTURE,   // xCaptureTexture, then each mip aligned to X_CAPTURE_ALIGN
+    X_CAPTURE_CMD_CREATE_MESH,      // xCaptureMesh, then vertices, then indices aligned to X_CAPTURE_ALIGN
+    X_CAPTURE_CMD_DESTROY_TEXTURE,  // xCaptureDestroy
+    X_CAPTURE_CMD_DESTROY_MESH,     // xCaptureDestroy
+    X_CAPTURE_CMD_COUNT,
+} xCaptureCommandType;
+
+/*
+ * On-disk layout (little endian):
+ *   xCaptureHeader
+ *   commands, each an xCaptureCommand followed by `size` payload bytes
+ * The header is rewritten with the final counts when the capture closes.
+ */
+typedef struct {
+    u32 magic;
+    u32 version;
+    u32 frame_count;
+    u32 command_count;
+    u32 width;  // renderer size when the capture started
+    u32 height;
+    u64 file_size;
+} xCaptureHeader;
+
+typedef struct {
+    u32 type;
+    u32 size;  // payload bytes, a multiple of X_CAPTURE_ALIGN
+} xCaptureCommand;
+
+typedef struct {
+    u32 width;
+    u32 height;
+} xCaptureResize;
+
+typedef struct {
+    u32 layer;
+    u32 color;
+    f32 depth;
+    u32 reserved;
+} xCaptureClear;
+
+typedef struct {
+    u32 layer;
+    xRenderViewport viewport;
+} xCaptureViewport;
+
+/* Handles are the recording renderer's; the player maps them to its own */
+typedef struct {
+    xHandle handle;
+    u32 width;
+    u32 height;
+    u32 layers;
+    u32 mip_count;
+    u32 format;
+    u32 srgb;
+    u32 flags;
+    u32 mip_sizes[X_TEXTURE_MAX_MIPS];  // all zero for descriptor-only textures
+} xCaptureTexture;
+
+typedef struct {
+    xHandle handle;
+    u32 vertex_count;
+    u32 index_count;
+    u32 vertex_stride;
+    u32 has_vertices;
+    u32 has_indices;
+} xCaptureMesh;
+
+typedef struct {
+    xHandle handle;
+    u32 reserved;
+} xCaptureDestroy;
+
+X_STATIC_ASSERT(sizeof(xCaptureHeader) == 32, "xCaptureHeader layout is part of the file format");
+X_STATIC_ASSERT(sizeof(xCaptureCommand) == 8, "xCaptureCommand layout is part of the file format");
+X_STATIC_ASSERT(sizeof(xRenderDraw) == 32, "xRenderDraw is stored as-is in captures");
+X_STATIC_ASSERT(sizeof(xCaptureTexture) % X_CAPTURE_ALIGN == 0, "Texture payload must keep mip data aligned");
+X_STATIC_ASSERT(sizeof(xCaptureMesh) % X_CAPTURE_ALIGN == 0, "Mesh payload must keep vertex data aligned");
+
+/* ============================================================================
+ * RECORDING
+ * ============================================================================ */
+
+/*
+ * Commands are staged in memory and written once per frame. The renderer owns
+ * the writer between xRendererCaptureBegin and the end of the capture; these
+ * are its building blocks.
+ */
+xCaptureWriter* xCaptureWriterOpen(const char* path, u32 width, u32 height);
+
+/* Write what is staged, patch the header and close the file */
+void xCaptureWriterClose(xCaptureWriter* writer);
+
+/* Stage a command and return its zeroed payload (`size` rounded up to X_CAPTURE_ALIGN), or NULL if out of memory */
+void* xCaptureWriterPush(xCaptureWriter* writer, xCaptureCommandType type, u32 size);
+
+/* Write the staged commands out. Returns the number of frames captured so far. */
+u32 xCaptureWriterFlush(xCaptureWriter* writer);
+
+/* ============================================================================
+ * PLAYBACK
+ * ============================================================================ */
+
+/* An open capture; commands are read in place from the mapping */
+typedef struct {
+    xMappedFile file;
+    const xCaptureHeader* header;
+    const xCaptureCommand* first;
+    const xCaptureCommand* end;
+} xCapture;
+
+/*
+ * Maps the file and validates every command up front: bounds, payload size and
+ * handles, mesh layouts, indices and draw ranges, and frame nesting against the
+ * header's frame count, so a malformed file cannot drive the renderer outside a
+ * frame or a backend out of bounds.
+ */
+bool xCaptureOpen(xCapture* capture, const char* path);
+void xCaptureClose(xCapture* capture);
+
+X_FORCE_INLINE static const void* xCapturePayload(const xCaptureCommand* command) {
+    return command + 1;
+}
+
+X_FORCE_INLINE static const xCaptureCommand* xCaptureNext(const xCaptureCommand* command) {
+    return (const xCaptureCommand*)((const u8*)(command + 1) + command->size);
+}
+
+/* Per-pass counts of what the player did */
+typedef struct {
+    u32 frames;
+    u32 draws;
+    u32 textures;
+    u32 meshes;
+    u32 missing;  // draws naming a mesh the capture never created, skipped
+} xCapturePlayerStats;
+
+/*
+ * Drives a renderer from a capture, one frame per step. Mesh and texture data
+ * are handed to the renderer straight from the mapping, so the capture must
+ * stay open while the player is in use.
+ */
+typedef struct {
+    const xCapture* capture;
+    xRenderer* renderer;
+    const xCaptureCommand* cursor;
+    xTextureHandle* textures;  // recorded handle index -> live handle
+    xMeshHandle* meshes;
+    xCapturePlayerStats stats;
+} xCapturePlayer;
+
+bool xCapturePlayerInit(xCapturePlayer* player, const xCapture* capture, xRenderer* renderer);
+
+/* Destroys every resource the player created */
+void xCapturePlayerShutdown(xCapturePlayer* player);
+
+/*
+ * Issue commands up to and including the next frame end. Returns false once
+ * the capture is exhausted; any trailing resource commands have still run.
+ */
+bool xCapturePlayerStep(xCapturePlayer* player);
+
+/* Destroy the replayed resources and start over from the first command */
+void xCapturePlayerRewind(xCapturePlayer* player);
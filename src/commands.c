@@ -0,0 +1,93 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_RENDERER
+
+#include "commands.h"
+
+bool xRenderCommandBufferInit(xRenderCommandBuffer* buffer, u32 capacity) {
+    X_ASSERT_MSG(capacity > 0, "capacity == 0");
+
+    buffer->commands = X_MALLOC(xRenderCommand, capacity);
+    buffer->items    = X_MALLOC(xRenderSortItem, capacity);
+    buffer->count    = 0;
+    buffer->capacity = capacity;
+
+    if (buffer->commands == NULL || buffer->items == NULL) {
+        X_PRINT_ERROR("Failed to allocate render command buffer (%u commands)", capacity);
+        xRenderCommandBufferShutdown(buffer);
+        return false;
+    }
+    return true;
+}
+
+void xRenderCommandBufferShutdown(xRenderCommandBuffer* buffer) {
+    X_DELETE(buffer->commands);
+    X_DELETE(buffer->items);
+    buffer->count    = 0;
+    buffer->capacity = 0;
+}
+
+xRenderCommand* xRenderCommandBufferPush(xRenderCommandBuffer* buffer, u64 key) {
+    if (X_UNLIKELY(buffer->count >= buffer->capacity)) {
+        X_PRINT_ERROR("Render command buffer full (%u commands), dropping command", buffer->capacity);
+        return NULL;
+    }
+
+    const u32 index              = buffer->count++;
+    buffer->items[index].key     = key;
+    buffer->items[index].command = index;
+    return &buffer->commands[index];
+}
+
+void xRenderSortItems(xRenderSortItem* items, xRenderSortItem* scratch, u32 count) {
+    if (count < 2) { return; }
+
+    // Build all eight byte histograms in a single read of the keys
+    u32 histograms[8][256];
+    X_ZERO_ARRAY(histograms);
+    for (u32 i = 0; i < count; ++i) {
+        const u64 key = items[i].key;
+        for (u32 pass = 0; pass < 8; ++pass) {
+            histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+        }
+    }
+
+    xRenderSortItem* src = items;
+    xRenderSortItem* dst = scratch;
+
+    for (u32 pass = 0; pass < 8; ++pass) {
+        u32* histogram  = histograms[pass];
+        const u32 shift = pass * 8;
+
+        // Every key has the same byte here, so this pass would be a plain copy
+        if (histogram[(src[0].key >> shift) & 0xFF] == count) { continue; }
+
+        u32 offset = 0;
+        for (u32 bucket = 0; bucket < 256; ++bucket) {
+            const u32 bucket_count = histogram[bucket];
+            histogram[bucket]      = offset;
+            offset += bucket_count;
+        }
+
+        for (u32 i = 0; i < count; ++i) {
+            const u32 bucket         = (src[i].key >> shift) & 0xFF;
+            dst[histogram[bucket]++] = src[i];
+        }
+
+        X_SWAP(src, dst);
+    }
+
+    if (src != items) { memcpy(items, src, sizeof(xRenderSortItem) * count); }
+}
+
+void xRenderCommandBufferSort(xRenderCommandBuffer* buffer, xArena* arena) {
+    if (buffer->count < 2) { return; }
+
+    X_ARENA_SCOPE(arena) {
+        xRenderSortItem* scratch = X_ARENA_ARRAY(arena, xRenderSortItem, buffer->count);
+        X_CHECK_MSG(scratch != NULL, "Frame arena too small for command sort scratch");
+        xRenderSortItems(buffer->items, scratch, buffer->count);
+    }
+}
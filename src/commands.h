@@ -0,0 +1,143 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "arena.h"
+#include "pool.h"
+
+/*
+ * 64-bit sort key layout (most significant bits first):
+ *
+ *   | layer : 8 | pass : 2 | shader : 14 | material : 16 | depth : 24 |
+ *
+ * Sorting by key groups commands by layer, runs clears and state commands
+ * before the draws of their layer, then minimizes shader and material
+ * switches. Depth is the least significant field so it only breaks ties.
+ */
+#define X_RENDER_KEY_LAYER_BITS 8
+#define X_RENDER_KEY_PASS_BITS 2
+#define X_RENDER_KEY_SHADER_BITS 14
+#define X_RENDER_KEY_MATERIAL_BITS 16
+#define X_RENDER_KEY_DEPTH_BITS 24
+
+#define X_RENDER_KEY_DEPTH_SHIFT 0
+#define X_RENDER_KEY_MATERIAL_SHIFT (X_RENDER_KEY_DEPTH_SHIFT + X_RENDER_KEY_DEPTH_BITS)
+#define X_RENDER_KEY_SHADER_SHIFT (X_RENDER_KEY_MATERIAL_SHIFT + X_RENDER_KEY_MATERIAL_BITS)
+#define X_RENDER_KEY_PASS_SHIFT (X_RENDER_KEY_SHADER_SHIFT + X_RENDER_KEY_SHADER_BITS)
+#define X_RENDER_KEY_LAYER_SHIFT (X_RENDER_KEY_PASS_SHIFT + X_RENDER_KEY_PASS_BITS)
+
+X_STATIC_ASSERT(X_RENDER_KEY_LAYER_SHIFT + X_RENDER_KEY_LAYER_BITS == 64, "Render sort key must be exactly 64 bits");
+
+#define X_RENDER_KEY_FIELD(key, name)                                                                                  \
+    ((u32)(((key) >> X_RENDER_KEY_##name##_SHIFT) & ((1ULL << X_RENDER_KEY_##name##_BITS) - 1)))
+
+#define X_RENDER_MAX_SHADERS (1U << X_RENDER_KEY_SHADER_BITS)
+#define X_RENDER_MAX_MATERIALS (1U << X_RENDER_KEY_MATERIAL_BITS)
+
+typedef enum {
+    X_RENDER_PASS_CLEAR = 0,
+    X_RENDER_PASS_STATE = 1,
+    X_RENDER_PASS_DRAW  = 2,
+} xRenderPass;
+
+typedef enum {
+    X_RENDER_CMD_CLEAR = 0,
+    X_RENDER_CMD_VIEWPORT,
+    X_RENDER_CMD_DRAW,
+} xRenderCommandType;
+
+/* Fixed-function state bits carried by each draw */
+typedef enum {
+    X_RENDER_STATE_DEPTH_TEST  = X_BIT(0),
+    X_RENDER_STATE_DEPTH_WRITE = X_BIT(1),
+    X_RENDER_STATE_BLEND       = X_BIT(2),
+    X_RENDER_STATE_CULL_BACK   = X_BIT(3),
+} xRenderStateBits;
+
+#define X_RENDER_STATE_DEFAULT (X_RENDER_STATE_DEPTH_TEST | X_RENDER_STATE_DEPTH_WRITE | X_RENDER_STATE_CULL_BACK)
+
+typedef struct {
+    u32 color;
+    f32 depth;
+} xRenderClear;
+
+typedef struct {
+    s32 x;
+    s32 y;
+    u32 width;
+    u32 height;
+} xRenderViewport;
+
+typedef struct {
+    u8 layer;
+    u16 shader;
+    u16 material;
+    f32 depth;
+    u32 state;
+    xHandle mesh;
+    u32 first_index;
+    u32 index_count;
+    u32 instance_count;
+} xRenderDraw;
+
+typedef struct {
+    xRenderCommandType type;
+    union {
+        xRenderClear clear;
+        xRenderViewport viewport;
+        xRenderDraw draw;
+    };
+} xRenderCommand;
+
+typedef struct {
+    u64 key;
+    u32 command;
+    u32 padding;
+} xRenderSortItem;
+
+/*
+ * Flat, fixed-capacity command list. Commands are stored in recording order;
+ * a parallel array of (key, index) pairs is radix sorted at submission so the
+ * command payloads themselves never move.
+ */
+typedef struct {
+    xRenderCommand* commands;
+    xRenderSortItem* items;
+    u32 count;
+    u32 capacity;
+} xRenderCommandBuffer;
+
+/* Pack a draw key. Depth is expected in [0, 1]; pass `back_to_front` for translucent layers. */
+X_FORCE_INLINE static u64 xRenderKeyMake(u8 layer, xRenderPass pass, u16 shader, u16 material, f32 depth,
+                                         bool back_to_front) {
+    const f32 clamped = X_CLAMP(depth, 0.0f, 1.0f);
+    u32 quantized     = (u32)(clamped * (f32)X_BITMASK(X_RENDER_KEY_DEPTH_BITS));
+    if (back_to_front) { quantized = X_BITMASK(X_RENDER_KEY_DEPTH_BITS) - quantized; }
+
+    return ((u64)layer << X_RENDER_KEY_LAYER_SHIFT) | ((u64)pass << X_RENDER_KEY_PASS_SHIFT) |
+           ((u64)(shader & X_BITMASK(X_RENDER_KEY_SHADER_BITS)) << X_RENDER_KEY_SHADER_SHIFT) |
+           ((u64)material << X_RENDER_KEY_MATERIAL_SHIFT) | ((u64)quantized << X_RENDER_KEY_DEPTH_SHIFT);
+}
+
+bool xRenderCommandBufferInit(xRenderCommandBuffer* buffer, u32 capacity);
+void xRenderCommandBufferShutdown(xRenderCommandBuffer* buffer);
+
+X_FORCE_INLINE static void xRenderCommandBufferReset(xRenderCommandBuffer* buffer) {
+    buffer->count = 0;
+}
+
+/* Reserve the next command slot. Returns NULL when the buffer is full. */
+xRenderCommand* xRenderCommandBufferPush(xRenderCommandBuffer* buffer, u64 key);
+
+/*
+ * Stable LSD radix sort of the key/index pairs (8 bits per pass). Passes whose
+ * byte is identical across every key are skipped. `scratch` provides the
+ * ping-pong buffer and must be able to hold `count` items.
+ */
+void xRenderSortItems(xRenderSortItem* items, xRenderSortItem* scratch, u32 count);
+
+/* Sort the buffer, taking scratch space from `arena` */
+void xRenderCommandBufferSort(xRenderCommandBuffer* buffer, xArena* arena);
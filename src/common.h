@@ -6,3 +6,4 @@
 
 #include "macros.h"
 #include "typedefs.h"
+#include "memory.h"
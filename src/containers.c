@@ -0,0 +1,129 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_CONTAINERS
+
+#include "containers.h"
+
+/* Smallest heap allocation for a growing array */
+#define X_ARRAY_MIN_CAPACITY 8
+
+/* ============================================================================
+ * DYNAMIC ARRAY
+ * ============================================================================ */
+
+static u32 growCapacity(u32 capacity, u32 required) {
+    const u64 doubled = (u64)capacity * 2;
+    return (u32)X_MIN(X_MAX(doubled, (u64)X_MAX(required, (u32)X_ARRAY_MIN_CAPACITY)), (u64)UINT32_MAX);
+}
+
+bool xArrayGrow(void* items, u32* capacity, u32 count, size_t element_size, size_t align, u32 required, xArena* arena) {
+    const u32 new_capacity = growCapacity(*capacity, required);
+    void* old_items;
+    memcpy(&old_items, items, sizeof(void*));
+
+    void* new_items;
+    if (arena != NULL) {
+        new_items = xArenaAllocAligned(arena, element_size * new_capacity, X_MAX(align, sizeof(void*)));
+        if (new_items != NULL && count > 0) { memcpy(new_items, old_items, element_size * count); }
+    } else {
+        new_items = X_MEM_REALLOC(old_items, element_size * new_capacity);
+    }
+    if (new_items == NULL) {
+        X_PRINT_ERROR("Failed to grow array to %u elements", new_capacity);
+        return false;
+    }
+
+    memcpy(items, &new_items, sizeof(void*));
+    *capacity = new_capacity;
+    return true;
+}
+
+/* ============================================================================
+ * SMALL VECTOR
+ * ============================================================================ */
+
+bool xSmallVecGrow(void* heap, u32* capacity, const void* local, u32 local_capacity, u32 count, size_t element_size) {
+    void* old_heap;
+    memcpy(&old_heap, heap, sizeof(void*));
+
+    const u32 new_capacity = growCapacity(old_heap != NULL ? *capacity : local_capacity, count + 1);
+    void* new_heap         = X_MEM_REALLOC(old_heap, element_size * new_capacity);
+    if (new_heap == NULL) {
+        X_PRINT_ERROR("Failed to grow small vector to %u elements", new_capacity);
+        return false;
+    }
+    if (old_heap == NULL) { memcpy(new_heap, local, element_size * count); }
+
+    memcpy(heap, &new_heap, sizeof(void*));
+    *capacity = new_capacity;
+    return true;
+}
+
+/* ============================================================================
+ * HASH MAP
+ * ============================================================================ */
+
+u8* xHashMapAllocTable(u32 capacity, size_t slot_size, void** slots) {
+    X_ASSERT_MSG(X_IS_POW2(capacity) && capacity >= X_HASHMAP_GROUP_WIDTH, "Hash map capacity must be a power of two");
+
+    // Control bytes come first; capacity is a multiple of 16, so the slots keep malloc's alignment
+    u8* ctrl = (u8*)X_MEM_ALLOC(capacity + slot_size * capacity);
+    if (ctrl == NULL) {
+        X_PRINT_ERROR("Failed to allocate hash map table of %u slots", capacity);
+        return NULL;
+    }
+    memset(ctrl, X_HASHMAP_CTRL_EMPTY, capacity);
+    *slots = ctrl + capacity;
+    return ctrl;
+}
+
+u32 xHashMapNext(const u8* ctrl, u32 capacity, u32 index) {
+    while (index < capacity) {
+        const u32 group = X_ALIGN_DOWN(index, X_HASHMAP_GROUP_WIDTH);
+        const u32 full  = ~xHashMapGroupMatchFree(ctrl + group) & (0xFFFFu << (index - group)) & 0xFFFFu;
+        if (full != 0) { return group + (u32)__builtin_ctz(full); }
+        index = group + X_HASHMAP_GROUP_WIDTH;
+    }
+    return capacity;
+}
+
+/* ============================================================================
+ * SPARSE SET
+ * ============================================================================ */
+
+bool xSparseSetGrowSparse(u32** sparse, u32* sparse_capacity, u32 id) {
+    X_ASSERT_MSG(id != X_SPARSE_SET_NULL, "Sparse set id is reserved");
+    const u32 new_capacity = growCapacity(*sparse_capacity, id + 1);
+    u32* grown             = X_REALLOC(*sparse, u32, new_capacity);
+    if (grown == NULL) {
+        X_PRINT_ERROR("Failed to grow sparse set to cover id %u", id);
+        return false;
+    }
+    memset(grown + *sparse_capacity, 0xFF, sizeof(u32) * (new_capacity - *sparse_capacity));
+    *sparse          = grown;
+    *sparse_capacity = new_capacity;
+    return true;
+}
+
+bool xSparseSetGrowDense(u32** dense, void* values, u32* capacity, size_t value_size, u32 required) {
+    const u32 new_capacity = growCapacity(*capacity, required);
+    u32* grown_dense       = X_REALLOC(*dense, u32, new_capacity);
+    if (grown_dense == NULL) {
+        X_PRINT_ERROR("Failed to grow sparse set to %u entries", new_capacity);
+        return false;
+    }
+    *dense = grown_dense;
+
+    void* old_values;
+    memcpy(&old_values, values, sizeof(void*));
+    void* grown_values = X_MEM_REALLOC(old_values, value_size * new_capacity);
+    if (grown_values == NULL) {
+        X_PRINT_ERROR("Failed to grow sparse set to %u entries", new_capacity);
+        return false;
+    }
+    memcpy(values, &grown_values, sizeof(void*));
+    *capacity = new_capacity;
+    return true;
+}
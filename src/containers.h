@@ -0,0 +1,485 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "arena.h"
+#include "hash.h"
+
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define X_CONTAINERS_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+/*
+ * Type-generic containers. Each one is an anonymous struct declared through a
+ * macro (typedef it to name it) plus X_UPPER operation macros; the typed parts
+ * stay inline and only the rare growth paths go through the type-erased
+ * functions in containers.c. All containers are valid when zero-initialized.
+ */
+
+/* ============================================================================
+ * DYNAMIC ARRAY
+ * ============================================================================ */
+
+/*
+ * Growable array with geometric (2x) growth. Setting `arena` before the first
+ * push takes storage from the arena instead of the heap: growing copies into a
+ * new arena block and abandons the old one, and X_ARRAY_FREE never frees, which
+ * suits lists that live for one frame.
+ */
+#define X_ARRAY(T)                                                                                                     \
+    struct {                                                                                                           \
+        T* items;                                                                                                      \
+        u32 count;                                                                                                     \
+        u32 capacity;                                                                                                  \
+        xArena* arena;                                                                                                 \
+    }
+
+typedef X_ARRAY(u32) xArrayU32;
+typedef X_ARRAY(u64) xArrayU64;
+typedef X_ARRAY(f32) xArrayF32;
+typedef X_ARRAY(void*) xArrayPtr;
+
+/* Type-erased growth for X_ARRAY_RESERVE; `items` points at the array's `items` field */
+bool xArrayGrow(void* items, u32* capacity, u32 count, size_t element_size, size_t align, u32 required, xArena* arena);
+
+#define X_ARRAY_RESERVE(array, n)                                                                                      \
+    ((n) <= (array)->capacity || xArrayGrow(&(array)->items,                                                           \
+                                            &(array)->capacity,                                                        \
+                                            (array)->count,                                                            \
+                                            sizeof(*(array)->items),                                                   \
+                                            _Alignof(__typeof__(*(array)->items)),                                     \
+                                            (n),                                                                       \
+                                            (array)->arena))
+
+/* Evaluates `value` before growing, so pushing one of the array's own elements is safe. Returns false on OOM. */
+#define X_ARRAY_PUSH(array, value)                                                                                     \
+    ({                                                                                                                 \
+        __typeof__(*(array)->items) _value = (value);                                                                  \
+        const bool _ok                     = X_ARRAY_RESERVE((array), (array)->count + 1);                             \
+        if (_ok) { (array)->items[(array)->count++] = _value; }                                                        \
+        _ok;                                                                                                           \
+    })
+
+#define X_ARRAY_PUSH_N(array, values, n)                                                                               \
+    ({                                                                                                                 \
+        const u32 _n   = (n);                                                                                          \
+        const bool _ok = X_ARRAY_RESERVE((array), (array)->count + _n);                                                \
+        if (_ok) {                                                                                                     \
+            memcpy((array)->items + (array)->count, (values), sizeof(*(array)->items) * _n);                           \
+            (array)->count += _n;                                                                                      \
+        }                                                                                                              \
+        _ok;                                                                                                           \
+    })
+
+/* Set the count, zeroing any new elements */
+#define X_ARRAY_RESIZE(array, n)                                                                                       \
+    ({                                                                                                                 \
+        const u32 _n   = (n);                                                                                          \
+        const bool _ok = X_ARRAY_RESERVE((array), _n);                                                                 \
+        if (_ok) {                                                                                                     \
+            if (_n > (array)->count) {                                                                                 \
+                memset((array)->items + (array)->count, 0, sizeof(*(array)->items) * (_n - (array)->count));           \
+            }                                                                                                          \
+            (array)->count = _n;                                                                                       \
+        }                                                                                                              \
+        _ok;                                                                                                           \
+    })
+
+#define X_ARRAY_POP(array) ((array)->items[--(array)->count])
+#define X_ARRAY_LAST(array) ((array)->items[(array)->count - 1])
+#define X_ARRAY_CLEAR(array) ((array)->count = 0)
+
+/* O(1) removal that moves the last element into the hole */
+#define X_ARRAY_REMOVE_SWAP(array, index)                                                                              \
+    do {                                                                                                               \
+        const u32 _index       = (index);                                                                              \
+        (array)->items[_index] = (array)->items[(array)->count - 1];                                                   \
+        (array)->count--;                                                                                              \
+    } while (0)
+
+/* Release heap storage; arena-backed storage is left to the arena. The arena binding is kept. */
+#define X_ARRAY_FREE(array)                                                                                            \
+    do {                                                                                                               \
+        if ((array)->arena == NULL) { X_MEM_FREE((array)->items); }                                                    \
+        (array)->items    = NULL;                                                                                      \
+        (array)->count    = 0;                                                                                         \
+        (array)->capacity = 0;                                                                                         \
+    } while (0)
+
+#define X_ARRAY_FOREACH(type, var, array) for (type* var = (array)->items; var < (array)->items + (array)->count; ++var)
+
+/* ============================================================================
+ * SMALL VECTOR
+ * ============================================================================ */
+
+/*
+ * Array whose first N elements live inside the struct and only spill to the
+ * heap past that. `heap` stays NULL until the first spill, so no pointer ever
+ * refers into the struct itself and it can be moved with memcpy or stored in
+ * another growable array.
+ */
+#define X_SMALL_VEC(T, N)                                                                                              \
+    struct {                                                                                                           \
+        T* heap;                                                                                                       \
+        u32 count;                                                                                                     \
+        u32 capacity;                                                                                                  \
+        T local[N];                                                                                                    \
+    }
+
+/* Type-erased spill/growth; `heap` points at the vector's `heap` field */
+bool xSmallVecGrow(void* heap, u32* capacity, const void* local, u32 local_capacity, u32 count, size_t element_size);
+
+#define X_SMALL_VEC_DATA(vec) ((vec)->heap != NULL ? (vec)->heap : (vec)->local)
+#define X_SMALL_VEC_CAPACITY(vec) ((vec)->heap != NULL ? (vec)->capacity : (u32)X_ARRAY_SIZE((vec)->local))
+#define X_SMALL_VEC_AT(vec, index) (X_SMALL_VEC_DATA(vec)[index])
+
+#define X_SMALL_VEC_PUSH(vec, value)                                                                                   \
+    ({                                                                                                                 \
+        __typeof__((vec)->local[0]) _value = (value);                                                                  \
+        const bool _ok                     = (vec)->count < X_SMALL_VEC_CAPACITY(vec) ||                               \
+                         xSmallVecGrow(&(vec)->heap,                                                                   \
+                                       &(vec)->capacity,                                                               \
+                                       (vec)->local,                                                                   \
+                                       (u32)X_ARRAY_SIZE((vec)->local),                                                \
+                                       (vec)->count,                                                                   \
+                                       sizeof((vec)->local[0]));                                                       \
+        if (_ok) { X_SMALL_VEC_DATA(vec)[(vec)->count++] = _value; }                                                   \
+        _ok;                                                                                                           \
+    })
+
+#define X_SMALL_VEC_POP(vec) (X_SMALL_VEC_DATA(vec)[--(vec)->count])
+#define X_SMALL_VEC_CLEAR(vec) ((vec)->count = 0)
+
+/* Drop any heap storage and return to the inline buffer */
+#define X_SMALL_VEC_FREE(vec)                                                                                          \
+    do {                                                                                                               \
+        X_MEM_FREE((vec)->heap);                                                                                       \
+        (vec)->heap     = NULL;                                                                                        \
+        (vec)->count    = 0;                                                                                           \
+        (vec)->capacity = 0;                                                                                           \
+    } while (0)
+
+/* ============================================================================
+ * HASH MAP
+ * ============================================================================ */
+
+/*
+ * Open-addressing hash map in the style of Swiss tables. Every slot has one
+ * control byte: EMPTY, DELETED, or the low 7 bits of the key's hash (h2) when
+ * full. Slots are probed 16 at a time: one SSE2 compare of the group's control
+ * bytes against h2 yields a bitmask of candidates, so keys are only compared on
+ * a likely match and a miss usually costs a single group. The remaining hash
+ * bits (h1) pick the first group; further groups follow a triangular sequence,
+ * which visits every group of a power-of-two table. Tables stay at most 7/8 full.
+ */
+#define X_HASHMAP_GROUP_WIDTH 16
+#define X_HASHMAP_MIN_CAPACITY 16
+#define X_HASHMAP_CTRL_EMPTY ((u8)0x80)
+#define X_HASHMAP_CTRL_DELETED ((u8)0xFE)
+
+/* Bitmask of the slots in a control group whose byte equals `value` */
+X_FORCE_INLINE static u32 xHashMapGroupMatch(const u8* ctrl, u8 value) {
+#if defined(X_CONTAINERS_SSE2)
+    const __m128i group = _mm_loadu_si128((const __m128i*)ctrl);
+    return (u32)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)value)));
+#else
+    u32 mask = 0;
+    for (u32 i = 0; i < X_HASHMAP_GROUP_WIDTH; ++i) {
+        mask |= (u32)(ctrl[i] == value) << i;
+    }
+    return mask;
+#endif
+}
+
+/* Bitmask of the EMPTY or DELETED slots: the only control bytes with the top bit set */
+X_FORCE_INLINE static u32 xHashMapGroupMatchFree(const u8* ctrl) {
+#if defined(X_CONTAINERS_SSE2)
+    return (u32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)ctrl));
+#else
+    u32 mask = 0;
+    for (u32 i = 0; i < X_HASHMAP_GROUP_WIDTH; ++i) {
+        mask |= (u32)(ctrl[i] >> 7) << i;
+    }
+    return mask;
+#endif
+}
+
+/* One allocation holding `capacity` control bytes (set to EMPTY) followed by the slots */
+u8* xHashMapAllocTable(u32 capacity, size_t slot_size, void** slots);
+
+/* Index of the first full slot at or after `index`, or `capacity` when there are none */
+u32 xHashMapNext(const u8* ctrl, u32 capacity, u32 index);
+
+X_FORCE_INLINE static u64 xHashMapHashU32(u32 key) {
+    return xHashMix64(key);
+}
+
+X_FORCE_INLINE static u64 xHashMapHashU64(u64 key) {
+    return xHashMix64(key);
+}
+
+X_FORCE_INLINE static u64 xHashMapHashStr(const char* key) {
+    return xHashMix64(xHashFnv1a64(key, strlen(key)));
+}
+
+X_FORCE_INLINE static bool xHashMapEqualScalar(u64 a, u64 b) {
+    return a == b;
+}
+
+X_FORCE_INLINE static bool xHashMapEqualStr(const char* a, const char* b) {
+    return strcmp(a, b) == 0;
+}
+
+/* Visit the index of every full slot; read `(map)->slots[index]` */
+#define X_HASHMAP_FOREACH(map, index)                                                                                  \
+    for (u32 index = xHashMapNext((map)->ctrl, (map)->capacity, 0); index < (map)->capacity;                           \
+         index = xHashMapNext((map)->ctrl, (map)->capacity, index + 1))
+
+/*
+ * Define map type `Name` from K to V plus its functions (NameInit, NameShutdown,
+ * NameClear, NameFind, NameInsert, NamePut, NameRemove). HASH(key) must return a
+ * well-mixed u64 and EQUAL(a, b) a bool; the xHashMapHash* and xHashMapEqual*
+ * helpers cover integer and C string keys. Keys and values are copied by value,
+ * so string keys must outlive the map (e.g. interned strings).
+ */
+#define X_HASHMAP(Name, K, V, HASH, EQUAL)                                                                             \
+    typedef struct {                                                                                                   \
+        K key;                                                                                                         \
+        V value;                                                                                                       \
+    } Name##Slot;                                                                                                      \
+                                                                                                                       \
+    typedef struct {                                                                                                   \
+        u8* ctrl;                                                                                                      \
+        Name##Slot* slots;                                                                                             \
+        u32 capacity;                                                                                                  \
+        u32 count;                                                                                                     \
+        u32 growth_left;                                                                                               \
+    } Name;                                                                                                            \
+                                                                                                                       \
+    /* First EMPTY or DELETED slot on the key's probe sequence */                                                      \
+    static inline u32 Name##FindFree(const Name* map, u64 hash) {                                                      \
+        const u32 mask = map->capacity / X_HASHMAP_GROUP_WIDTH - 1;                                                    \
+        u32 group      = (u32)(hash >> 7) & mask;                                                                      \
+        for (u32 step = 1;; ++step) {                                                                                  \
+            const u32 free_bits = xHashMapGroupMatchFree(map->ctrl + group * X_HASHMAP_GROUP_WIDTH);                   \
+            if (free_bits != 0) { return group * X_HASHMAP_GROUP_WIDTH + (u32)__builtin_ctz(free_bits); }              \
+            group = (group + step) & mask;                                                                             \
+        }                                                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool Name##Rehash(Name* map, u32 capacity) {                                                         \
+        void* slots = NULL;                                                                                            \
+        u8* ctrl    = xHashMapAllocTable(capacity, sizeof(Name##Slot), &slots);                                        \
+        if (ctrl == NULL) { return false; }                                                                            \
+                                                                                                                       \
+        Name old         = *map;                                                                                       \
+        map->ctrl        = ctrl;                                                                                       \
+        map->slots       = (Name##Slot*)slots;                                                                         \
+        map->capacity    = capacity;                                                                                   \
+        map->growth_left = capacity - capacity / 8 - old.count;                                                        \
+        for (u32 i = xHashMapNext(old.ctrl, old.capacity, 0); i < old.capacity;                                        \
+             i = xHashMapNext(old.ctrl, old.capacity, i + 1)) {                                                        \
+            const u64 hash   = HASH(old.slots[i].key);                                                                 \
+            const u32 slot   = Name##FindFree(map, hash);                                                              \
+            map->ctrl[slot]  = (u8)(hash & 0x7F);                                                                      \
+            map->slots[slot] = old.slots[i];                                                                           \
+        }                                                                                                              \
+        X_MEM_FREE(old.ctrl);                                                                                          \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    /* `capacity` is a hint in elements; 0 defers allocation to the first insert */                                    \
+    static inline bool Name##Init(Name* map, u32 capacity) {                                                           \
+        X_ZERO_STRUCT(map);                                                                                            \
+        if (capacity == 0) { return true; }                                                                            \
+        u32 slots = X_HASHMAP_MIN_CAPACITY;                                                                            \
+        while (slots - slots / 8 < capacity) {                                                                         \
+            slots *= 2;                                                                                                \
+        }                                                                                                              \
+        return Name##Rehash(map, slots);                                                                               \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline void Name##Shutdown(Name* map) {                                                                     \
+        X_MEM_FREE(map->ctrl);                                                                                         \
+        X_ZERO_STRUCT(map);                                                                                            \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline void Name##Clear(Name* map) {                                                                        \
+        if (map->capacity == 0) { return; }                                                                            \
+        memset(map->ctrl, X_HASHMAP_CTRL_EMPTY, map->capacity);                                                        \
+        map->count       = 0;                                                                                          \
+        map->growth_left = map->capacity - map->capacity / 8;                                                          \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline V* Name##Find(const Name* map, K key) {                                                              \
+        if (map->count == 0) { return NULL; }                                                                          \
+        const u64 hash = HASH(key);                                                                                    \
+        const u8 h2    = (u8)(hash & 0x7F);                                                                            \
+        const u32 mask = map->capacity / X_HASHMAP_GROUP_WIDTH - 1;                                                    \
+        u32 group      = (u32)(hash >> 7) & mask;                                                                      \
+        for (u32 step = 1;; ++step) {                                                                                  \
+            const u8* ctrl = map->ctrl + group * X_HASHMAP_GROUP_WIDTH;                                                \
+            for (u32 bits = xHashMapGroupMatch(ctrl, h2); bits != 0; bits &= bits - 1) {                               \
+                Name##Slot* slot = &map->slots[group * X_HASHMAP_GROUP_WIDTH + (u32)__builtin_ctz(bits)];              \
+                if (EQUAL(slot->key, key)) { return &slot->value; }                                                    \
+            }                                                                                                          \
+            if (xHashMapGroupMatch(ctrl, X_HASHMAP_CTRL_EMPTY) != 0) { return NULL; }                                  \
+            group = (group + step) & mask;                                                                             \
+        }                                                                                                              \
+    }                                                                                                                  \
+                                                                                                                       \
+    /*                                                                                                                 \
+     * Value slot for `key`, inserting it (value left uninitialized) when missing.                                     \
+     * `inserted` may be NULL. Returns NULL only when the table cannot grow.                                           \
+     */                                                                                                                \
+    static inline V* Name##Insert(Name* map, K key, bool* inserted) {                                                  \
+        V* existing = Name##Find(map, key);                                                                            \
+        if (inserted != NULL) { *inserted = existing == NULL; }                                                        \
+        if (existing != NULL) { return existing; }                                                                     \
+                                                                                                                       \
+        const u64 hash = HASH(key);                                                                                    \
+        u32 slot       = map->capacity > 0 ? Name##FindFree(map, hash) : 0;                                            \
+        if (map->capacity == 0 || (map->growth_left == 0 && map->ctrl[slot] == X_HASHMAP_CTRL_EMPTY)) {                \
+            /* Out of room: double, or rehash in place when tombstones are what fill the table */                      \
+            u32 capacity = X_MAX(map->capacity, (u32)X_HASHMAP_MIN_CAPACITY);                                          \
+            if ((map->count + 1) * 2 > capacity - capacity / 8) { capacity *= 2; }                                     \
+            if (!Name##Rehash(map, capacity)) { return NULL; }                                                         \
+            slot = Name##FindFree(map, hash);                                                                          \
+        }                                                                                                              \
+                                                                                                                       \
+        map->growth_left -= map->ctrl[slot] == X_HASHMAP_CTRL_EMPTY;                                                   \
+        map->ctrl[slot]      = (u8)(hash & 0x7F);                                                                      \
+        map->slots[slot].key = key;                                                                                    \
+        map->count++;                                                                                                  \
+        return &map->slots[slot].value;                                                                                \
+    }                                                                                                                  \
+                                                                                                                       \
+    static inline bool Name##Put(Name* map, K key, V value) {                                                          \
+        V* slot = Name##Insert(map, key, NULL);                                                                        \
+        if (slot == NULL) { return false; }                                                                            \
+        *slot = value;                                                                                                 \
+        return true;                                                                                                   \
+    }                                                                                                                  \
+                                                                                                                       \
+    /*                                                                                                                 \
+     * A slot whose group still has an EMPTY byte can go straight back to EMPTY:                                       \
+     * probes already stop at that group, so none can be cut short.                                                    \
+     */                                                                                                                \
+    static inline bool Name##Remove(Name* map, K key) {                                                                \
+        V* value = Name##Find(map, key);                                                                               \
+        if (value == NULL) { return false; }                                                                           \
+        const u32 slot  = (u32)(X_CONTAINER_OF(value, Name##Slot, value) - map->slots);                                \
+        const u8* group = map->ctrl + X_ALIGN_DOWN(slot, X_HASHMAP_GROUP_WIDTH);                                       \
+        if (xHashMapGroupMatch(group, X_HASHMAP_CTRL_EMPTY) != 0) {                                                    \
+            map->ctrl[slot] = X_HASHMAP_CTRL_EMPTY;                                                                    \
+            map->growth_left++;                                                                                        \
+        } else {                                                                                                       \
+            map->ctrl[slot] = X_HASHMAP_CTRL_DELETED;                                                                  \
+        }                                                                                                              \
+        map->count--;                                                                                                  \
+        return true;                                                                                                   \
+    }
+
+/* ============================================================================
+ * SPARSE SET
+ * ============================================================================ */
+
+#define X_SPARSE_SET_NULL UINT32_MAX
+
+/*
+ * Map from small integer ids (entity ids, pool indices) to values kept densely
+ * packed. `sparse[id]` is the id's position in `dense`/`values`, so lookup is a
+ * single indexed load, removal swaps the last element into the hole, and
+ * iteration walks a contiguous array. Memory is proportional to the largest id.
+ */
+#define X_SPARSE_SET(T)                                                                                                \
+    struct {                                                                                                           \
+        u32* sparse;                                                                                                   \
+        u32 sparse_capacity;                                                                                           \
+        u32* dense;                                                                                                    \
+        T* values;                                                                                                     \
+        u32 count;                                                                                                     \
+        u32 capacity;                                                                                                  \
+    }
+
+/* Type-erased growth: the sparse array to cover `id`, the dense arrays to hold `required` entries */
+bool xSparseSetGrowSparse(u32** sparse, u32* sparse_capacity, u32 id);
+bool xSparseSetGrowDense(u32** dense, void* values, u32* capacity, size_t value_size, u32 required);
+
+#define X_SPARSE_SET_CONTAINS(set, id) ((id) < (set)->sparse_capacity && (set)->sparse[id] != X_SPARSE_SET_NULL)
+
+/* Pointer to the id's value, or NULL */
+#define X_SPARSE_SET_GET(set, id)                                                                                      \
+    ({                                                                                                                 \
+        const u32 _id = (id);                                                                                          \
+        X_SPARSE_SET_CONTAINS((set), _id) ? &(set)->values[(set)->sparse[_id]] : NULL;                                 \
+    })
+
+/* Add or overwrite. Returns false on OOM. */
+#define X_SPARSE_SET_INSERT(set, id, value)                                                                            \
+    ({                                                                                                                 \
+        const u32 _id                      = (id);                                                                     \
+        __typeof__(*(set)->values) _value = (value);                                                                   \
+        bool _ok                           = true;                                                                     \
+        if (X_SPARSE_SET_CONTAINS((set), _id)) {                                                                       \
+            (set)->values[(set)->sparse[_id]] = _value;                                                                \
+        } else {                                                                                                       \
+            _ok = (_id < (set)->sparse_capacity ||                                                                     \
+                   xSparseSetGrowSparse(&(set)->sparse, &(set)->sparse_capacity, _id)) &&                              \
+                  ((set)->count < (set)->capacity || xSparseSetGrowDense(&(set)->dense,                                \
+                                                                         &(set)->values,                               \
+                                                                         &(set)->capacity,                             \
+                                                                         sizeof(*(set)->values),                       \
+                                                                         (set)->count + 1));                           \
+            if (_ok) {                                                                                                 \
+                (set)->sparse[_id]          = (set)->count;                                                            \
+                (set)->dense[(set)->count]  = _id;                                                                     \
+                (set)->values[(set)->count] = _value;                                                                  \
+                (set)->count++;                                                                                        \
+            }                                                                                                          \
+        }                                                                                                              \
+        _ok;                                                                                                           \
+    })
+
+/* Swap-remove; the order of `dense` changes. Returns false if the id was not present. */
+#define X_SPARSE_SET_REMOVE(set, id)                                                                                   \
+    ({                                                                                                                 \
+        const u32 _id  = (id);                                                                                         \
+        const bool _ok = X_SPARSE_SET_CONTAINS((set), _id);                                                            \
+        if (_ok) {                                                                                                     \
+            const u32 _index                    = (set)->sparse[_id];                                                  \
+            const u32 _last                     = --(set)->count;                                                      \
+            (set)->dense[_index]                = (set)->dense[_last];                                                 \
+            (set)->values[_index]               = (set)->values[_last];                                                \
+            (set)->sparse[(set)->dense[_index]] = _index;                                                              \
+            (set)->sparse[_id]                  = X_SPARSE_SET_NULL;                                                   \
+        }                                                                                                              \
+        _ok;                                                                                                           \
+    })
+
+#define X_SPARSE_SET_CLEAR(set)                                                                                        \
+    do {                                                                                                               \
+        for (u32 _i = 0; _i < (set)->count; ++_i) {                                                                    \
+            (set)->sparse[(set)->dense[_i]] = X_SPARSE_SET_NULL;                                                       \
+        }                                                                                                              \
+        (set)->count = 0;                                                                                              \
+    } while (0)
+
+#define X_SPARSE_SET_FREE(set)                                                                                         \
+    do {                                                                                                               \
+        X_MEM_FREE((set)->sparse);                                                                                     \
+        X_MEM_FREE((set)->dense);                                                                                      \
+        X_MEM_FREE((set)->values);                                                                                     \
+        (set)->sparse          = NULL;                                                                                 \
+        (set)->dense           = NULL;                                                                                 \
+        (set)->values          = NULL;                                                                                 \
+        (set)->sparse_capacity = 0;                                                                                    \
+        (set)->count           = 0;                                                                                    \
+        (set)->capacity        = 0;                                                                                    \
+    } while (0)
@@ -0,0 +1,622 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_RENDERER
+
+#include "cull.h"
+#include "platform.h"
+
+#include <math.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+    #define X_CULL_X86 1
+    #include <immintrin.h>
+#endif
+
+/* ============================================================================
+ * BOUNDS AND FRUSTUM
+ * ============================================================================ */
+
+static bool boundsReserve(xCullBounds* bounds, u32 capacity) {
+    if (capacity <= bounds->capacity) { return true; }
+
+    f32** arrays[] = {&bounds->center_x,
+                      &bounds->center_y,
+                      &bounds->center_z,
+                      &bounds->extent_x,
+                      &bounds->extent_y,
+                      &bounds->extent_z};
+    X_FOREACH(f32**, array, arrays) {
+        f32* grown = X_REALLOC(**array, f32, capacity);
+        if (grown == NULL) {
+            X_PRINT_ERROR("Failed to grow cull bounds to %u objects", capacity);
+            return false;
+        }
+        **array = grown;
+    }
+    bounds->capacity = capacity;
+    return true;
+}
+
+bool xCullBoundsInit(xCullBounds* bounds, u32 capacity) {
+    X_ZERO_STRUCT(bounds);
+    return boundsReserve(bounds, X_MAX(capacity, 64u));
+}
+
+void xCullBoundsShutdown(xCullBounds* bounds) {
+    X_FREE(bounds->center_x);
+    X_FREE(bounds->center_y);
+    X_FREE(bounds->center_z);
+    X_FREE(bounds->extent_x);
+    X_FREE(bounds->extent_y);
+    X_FREE(bounds->extent_z);
+    bounds->count    = 0;
+    bounds->capacity = 0;
+}
+
+u32 xCullBoundsPush(xCullBounds* bounds, const xAabb* box) {
+    if (bounds->count == bounds->capacity && !boundsReserve(bounds, X_MAX(bounds->capacity * 2, 64u))) {
+        return UINT32_MAX;
+    }
+    const u32 index = bounds->count++;
+    xCullBoundsSet(bounds, index, box);
+    return index;
+}
+
+static xVec4 matrixRow(const xMat4* m, u32 r) {
+    return xVec4Make(m->cols[0].v[r], m->cols[1].v[r], m->cols[2].v[r], m->cols[3].v[r]);
+}
+
+static xVec4 normalizePlane(xVec4 plane) {
+    const f32 length = sqrtf(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+    return length > 0.0f ? xVec4Scale(plane, 1.0f / length) : plane;
+}
+
+xFrustum xFrustumFromMatrix(const xMat4* view_projection) {
+    const xVec4 x = matrixRow(view_projection, 0);
+    const xVec4 y = matrixRow(view_projection, 1);
+    const xVec4 z = matrixRow(view_projection, 2);
+    const xVec4 w = matrixRow(view_projection, 3);
+
+    xFrustum frustum;
+    frustum.planes[0] = normalizePlane(xVec4Add(w, x));  // left
+    frustum.planes[1] = normalizePlane(xVec4Sub(w, x));  // right
+    frustum.planes[2] = normalizePlane(xVec4Add(w, y));  // bottom
+    frustum.planes[3] = normalizePlane(xVec4Sub(w, y));  // top
+    frustum.planes[4] = normalizePlane(xVec4Add(w, z));  // near
+    frustum.planes[5] = normalizePlane(xVec4Sub(w, z));  // far
+    return frustum;
+}
+
+/* ============================================================================
+ * FRUSTUM KERNELS
+ * ============================================================================ */
+
+/*
+ * A box is outside when it lies fully behind any one plane: its center's signed
+ * distance plus the box's projected radius |n| . extent is still negative. Boxes
+ * that straddle a corner of the frustum pass, which only costs a wasted draw.
+ */
+static u32 frustumScalar(const xFrustum* frustum, const xCullBounds* bounds, u32 begin, u32 end, u32* out) {
+    u32 count = 0;
+    for (u32 i = begin; i < end; ++i) {
+        bool inside = true;
+        for (u32 p = 0; p < 6 && inside; ++p) {
+            const xVec4 n  = frustum->planes[p];
+            const f32 dist = n.x * bounds->center_x[i] + n.y * bounds->center_y[i] + n.z * bounds->center_z[i] + n.w;
+            const f32 radius =
+              fabsf(n.x) * bounds->extent_x[i] + fabsf(n.y) * bounds->extent_y[i] + fabsf(n.z) * bounds->extent_z[i];
+            inside = dist + radius >= 0.0f;
+        }
+        // Branchless append; `out` always has room for one entry per tested object
+        out[count] = i;
+        count += inside;
+    }
+    return count;
+}
+
+#if defined(X_CULL_X86)
+
+static u32 frustumSse2(const xFrustum* frustum, const xCullBounds* bounds, u32 begin, u32 end, u32* out) {
+    const __m128 sign_bit = _mm_set1_ps(-0.0f);
+    const __m128 zero     = _mm_setzero_ps();
+
+    __m128 nx[6], ny[6], nz[6], nw[6];
+    __m128 ax[6], ay[6], az[6];
+    for (u32 p = 0; p < 6; ++p) {
+        nx[p] = _mm_set1_ps(frustum->planes[p].x);
+        ny[p] = _mm_set1_ps(frustum->planes[p].y);
+        nz[p] = _mm_set1_ps(frustum->planes[p].z);
+        nw[p] = _mm_set1_ps(frustum->planes[p].w);
+        ax[p] = _mm_andnot_ps(sign_bit, nx[p]);
+        ay[p] = _mm_andnot_ps(sign_bit, ny[p]);
+        az[p] = _mm_andnot_ps(sign_bit, nz[p]);
+    }
+
+    u32 count = 0;
+    u32 i     = begin;
+    for (; i + 4 <= end; i += 4) {
+        const __m128 cx = _mm_loadu_ps(bounds->center_x + i);
+        const __m128 cy = _mm_loadu_ps(bounds->center_y + i);
+        const __m128 cz = _mm_loadu_ps(bounds->center_z + i);
+        const __m128 ex = _mm_loadu_ps(bounds->extent_x + i);
+        const __m128 ey = _mm_loadu_ps(bounds->extent_y + i);
+        const __m128 ez = _mm_loadu_ps(bounds->extent_z + i);
+
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (u32 p = 0; p < 6; ++p) {
+            __m128 d = _mm_add_ps(_mm_mul_ps(nx[p], cx), nw[p]);
+            d        = _mm_add_ps(d, _mm_mul_ps(ny[p], cy));
+            d        = _mm_add_ps(d, _mm_mul_ps(nz[p], cz));
+            d        = _mm_add_ps(d, _mm_mul_ps(ax[p], ex));
+            d        = _mm_add_ps(d, _mm_mul_ps(ay[p], ey));
+            d        = _mm_add_ps(d, _mm_mul_ps(az[p], ez));
+            inside   = _mm_and_ps(inside, _mm_cmpge_ps(d, zero));
+        }
+
+        for (u32 bits = (u32)_mm_movemask_ps(inside); bits != 0; bits &= bits - 1) {
+            out[count++] = i + (u32)__builtin_ctz(bits);
+        }
+    }
+    return count + frustumScalar(frustum, bounds, i, end, out + count);
+}
+
+    #if defined(__GNUC__) || defined(__clang__)
+        #define X_CULL_HAS_AVX2 1
+
+__attribute__((target("avx2,fma"))) static u32
+frustumAvx2(const xFrustum* frustum, const xCullBounds* bounds, u32 begin, u32 end, u32* out) {
+    const __m256 sign_bit = _mm256_set1_ps(-0.0f);
+    const __m256 zero     = _mm256_setzero_ps();
+
+    __m256 nx[6], ny[6], nz[6], nw[6];
+    __m256 ax[6], ay[6], az[6];
+    for (u32 p = 0; p < 6; ++p) {
+        nx[p] = _mm256_set1_ps(frustum->planes[p].x);
+        ny[p] = _mm256_set1_ps(frustum->planes[p].y);
+        nz[p] = _mm256_set1_ps(frustum->planes[p].z);
+        nw[p] = _mm256_set1_ps(frustum->planes[p].w);
+        ax[p] = _mm256_andnot_ps(sign_bit, nx[p]);
+        ay[p] = _mm256_andnot_ps(sign_bit, ny[p]);
+        az[p] = _mm256_andnot_ps(sign_bit, nz[p]);
+    }
+
+    u32 count = 0;
+    u32 i     = begin;
+    for (; i + 8 <= end; i += 8) {
+        const __m256 cx = _mm256_loadu_ps(bounds->center_x + i);
+        const __m256 cy = _mm256_loadu_ps(bounds->center_y + i);
+        const __m256 cz = _mm256_loadu_ps(bounds->center_z + i);
+        const __m256 ex = _mm256_loadu_ps(bounds->extent_x + i);
+        const __m256 ey = _mm256_loadu_ps(bounds->extent_y + i);
+        const __m256 ez = _mm256_loadu_ps(bounds->extent_z + i);
+
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (u32 p = 0; p < 6; ++p) {
+            __m256 d = _mm256_fmadd_ps(nx[p], cx, nw[p]);
+            d        = _mm256_fmadd_ps(ny[p], cy, d);
+            d        = _mm256_fmadd_ps(nz[p], cz, d);
+            d        = _mm256_fmadd_ps(ax[p], ex, d);
+            d        = _mm256_fmadd_ps(ay[p], ey, d);
+            d        = _mm256_fmadd_ps(az[p], ez, d);
+            inside   = _mm256_and_ps(inside, _mm256_cmp_ps(d, zero, _CMP_GE_OQ));
+        }
+
+        for (u32 bits = (u32)_mm256_movemask_ps(inside); bits != 0; bits &= bits - 1) {
+            out[count++] = i + (u32)__builtin_ctz(bits);
+        }
+    }
+    return count + frustumScalar(frustum, bounds, i, end, out + count);
+}
+    #endif
+#endif
+
+/* ============================================================================
+ * COARSE DEPTH BUFFER
+ * ============================================================================ */
+
+static xVec4 projectToPixels(const xCuller* culler, xVec4 clip) {
+    const f32 inverse_w = 1.0f / clip.w;
+    const f32 x         = (clip.x * inverse_w * 0.5f + 0.5f) * (f32)culler->depth_width;
+    const f32 y         = (0.5f - clip.y * inverse_w * 0.5f) * (f32)culler->depth_height;
+    return xVec4Make(x, y, 0.0f, clip.w);
+}
+
+/* Clip-space corners of a center/extent box: the center transform plus signed column sums */
+static void boxCorners(const xMat4* m, xVec4 center, xVec4 extent, xVec4 corners[8]) {
+    const xVec4 base = xMat4MulVec4(m, xVec4Make(center.x, center.y, center.z, 1.0f));
+    const xVec4 dx   = xVec4Scale(m->cols[0], extent.x);
+    const xVec4 dy   = xVec4Scale(m->cols[1], extent.y);
+    const xVec4 dz   = xVec4Scale(m->cols[2], extent.z);
+    for (u32 i = 0; i < 8; ++i) {
+        xVec4 corner = base;
+        corner       = (i & 1) ? xVec4Add(corner, dx) : xVec4Sub(corner, dx);
+        corner       = (i & 2) ? xVec4Add(corner, dy) : xVec4Sub(corner, dy);
+        corner       = (i & 4) ? xVec4Add(corner, dz) : xVec4Sub(corner, dz);
+        corners[i]   = corner;
+    }
+}
+
+static f32 cross2(f32 ax, f32 ay, f32 bx, f32 by, f32 px, f32 py) {
+    return (bx - ax) * (py - ay) - (by - ay) * (px - ax);
+}
+
+/* Andrew's monotone chain over the eight projected corners; writes a counter-clockwise hull */
+static u32 convexHull(xVec4 points[8], f32* hull_x, f32* hull_y) {
+    for (u32 i = 1; i < 8; ++i) {
+        const xVec4 key = points[i];
+        u32 j           = i;
+        for (; j > 0 && (points[j - 1].x > key.x || (points[j - 1].x == key.x && points[j - 1].y > key.y)); --j) {
+            points[j] = points[j - 1];
+        }
+        points[j] = key;
+    }
+
+    // Lower then upper chain; the last point of each chain is the first of the other
+    f32 xs[16];
+    f32 ys[16];
+    u32 count = 0;
+    for (u32 pass = 0; pass < 2; ++pass) {
+        const u32 chain = count;
+        for (u32 k = 0; k < 8; ++k) {
+            const xVec4 p = points[pass == 0 ? k : 7 - k];
+            while (count >= chain + 2 &&
+                   cross2(xs[count - 2], ys[count - 2], xs[count - 1], ys[count - 1], p.x, p.y) <= 0.0f) {
+                --count;
+            }
+            xs[count]   = p.x;
+            ys[count++] = p.y;
+        }
+        --count;
+    }
+
+    for (u32 i = 0; i < count; ++i) {
+        hull_x[i] = xs[i];
+        hull_y[i] = ys[i];
+    }
+    return count;
+}
+
+static bool occluderReserve(xCuller* culler, u32 count) {
+    if (count <= culler->occluder_capacity) { return true; }
+    xCullOccluder* occluders = X_REALLOC(culler->occluders, xCullOccluder, count);
+    if (occluders == NULL) {
+        X_PRINT_ERROR("Failed to allocate %u cull occluders", count);
+        return false;
+    }
+    culler->occluders         = occluders;
+    culler->occluder_capacity = count;
+    return true;
+}
+
+/* Project every occluder once up front; the raster bands then only read the results */
+static void prepareOccluders(xCuller* culler, const xAabb* boxes, u32 count) {
+    culler->occluder_count = 0;
+    if (!occluderReserve(culler, count)) { return; }
+
+    for (u32 i = 0; i < count; ++i) {
+        const xVec4 center = xVec4Scale(xVec4Add(boxes[i].min, boxes[i].max), 0.5f);
+        const xVec4 extent = xVec4Scale(xVec4Sub(boxes[i].max, boxes[i].min), 0.5f);
+        xVec4 corners[8];
+        boxCorners(&culler->view_projection, center, extent, corners);
+
+        // Occluders crossing the eye plane have no usable projection; dropping one only loses culling
+        bool in_front = true;
+        f32 depth     = 0.0f;
+        for (u32 c = 0; c < 8; ++c) {
+            in_front   = in_front && corners[c].w > X_CULL_NEAR_W;
+            depth      = X_MAX(depth, corners[c].w);
+            corners[c] = projectToPixels(culler, corners[c]);
+        }
+        if (!in_front) { continue; }
+
+        xCullOccluder* occluder = &culler->occluders[culler->occluder_count];
+        occluder->vertex_count  = convexHull(corners, occluder->x, occluder->y);
+        occluder->depth         = depth;
+
+        f32 min_x = INFINITY;
+        f32 min_y = INFINITY;
+        f32 max_x = -INFINITY;
+        f32 max_y = -INFINITY;
+        for (u32 v = 0; v < occluder->vertex_count; ++v) {
+            min_x = X_MIN(min_x, occluder->x[v]);
+            min_y = X_MIN(min_y, occluder->y[v]);
+            max_x = X_MAX(max_x, occluder->x[v]);
+            max_y = X_MAX(max_y, occluder->y[v]);
+        }
+        occluder->x0 = (s32)X_MAX(floorf(min_x), 0.0f);
+        occluder->y0 = (s32)X_MAX(floorf(min_y), 0.0f);
+        occluder->x1 = (s32)X_MIN(ceilf(max_x), (f32)culler->depth_width);
+        occluder->y1 = (s32)X_MIN(ceilf(max_y), (f32)culler->depth_height);
+        if (occluder->vertex_count >= 3 && occluder->x0 < occluder->x1 && occluder->y0 < occluder->y1) {
+            culler->occluder_count++;
+        }
+    }
+}
+
+/*
+ * A pixel is only written when its whole square lies inside the hull: each edge
+ * function at the pixel center must clear half the edge's L1 extent. That keeps
+ * the buffer conservative no matter where inside a pixel an object lands.
+ */
+static void rasterOccluder(const xCullOccluder* occluder, f32* depth, u32 stride, s32 y0, s32 y1) {
+    // Edge functions as a * x + b * y + c, with the coverage bias folded into c
+    const u32 n = occluder->vertex_count;
+    f32 a[8];
+    f32 b[8];
+    f32 c[8];
+    for (u32 e = 0; e < n; ++e) {
+        const u32 next = e + 1 < n ? e + 1 : 0;
+        const f32 dx   = occluder->x[next] - occluder->x[e];
+        const f32 dy   = occluder->y[next] - occluder->y[e];
+        a[e]           = -dy;
+        b[e]           = dx;
+        c[e]           = dy * occluder->x[e] - dx * occluder->y[e] - 0.5f * (fabsf(dx) + fabsf(dy));
+    }
+
+    for (s32 y = X_MAX(y0, occluder->y0); y < X_MIN(y1, occluder->y1); ++y) {
+        const f32 py = (f32)y + 0.5f;
+        f32 row_c[8];
+        for (u32 e = 0; e < n; ++e) {
+            row_c[e] = b[e] * py + c[e];
+        }
+
+        f32* row = depth + (size_t)y * stride;
+        for (s32 x = occluder->x0; x < occluder->x1; ++x) {
+            const f32 px = (f32)x + 0.5f;
+            bool inside  = true;
+            for (u32 e = 0; e < n; ++e) {
+                inside &= a[e] * px + row_c[e] >= 0.0f;
+            }
+            if (inside) { row[x] = X_MIN(row[x], occluder->depth); }
+        }
+    }
+}
+
+/* One job per row of tiles: clear, draw every occluder clipped to the band, then reduce to tile maxima */
+static void rasterBands(void* data, u32 begin, u32 end) {
+    xCuller* culler  = (xCuller*)data;
+    const u32 stride = culler->depth_width;
+
+    for (u32 band = begin; band < end; ++band) {
+        const s32 y0 = (s32)(band * X_CULL_TILE_SIZE);
+        const s32 y1 = y0 + X_CULL_TILE_SIZE;
+        f32* rows    = culler->depth + (size_t)y0 * stride;
+        for (u32 i = 0; i < stride * X_CULL_TILE_SIZE; ++i) {
+            rows[i] = INFINITY;
+        }
+
+        for (u32 i = 0; i < culler->occluder_count; ++i) {
+            rasterOccluder(&culler->occluders[i], culler->depth, stride, y0, y1);
+        }
+
+        for (u32 tx = 0; tx < culler->tiles_x; ++tx) {
+            f32 tile_max = 0.0f;
+            for (u32 y = 0; y < X_CULL_TILE_SIZE; ++y) {
+                const f32* row = rows + (size_t)y * stride + tx * X_CULL_TILE_SIZE;
+                for (u32 x = 0; x < X_CULL_TILE_SIZE; ++x) {
+                    tile_max = X_MAX(tile_max, row[x]);
+                }
+            }
+            culler->tile_max[band * culler->tiles_x + tx] = tile_max;
+        }
+    }
+}
+
+/* True only when the object's nearest point is behind the farthest occluder depth in every tile it touches */
+static bool isOccluded(const xCuller* culler, const xCullBounds* bounds, u32 index) {
+    const xVec4 center = xVec4Make(bounds->center_x[index], bounds->center_y[index], bounds->center_z[index], 0.0f);
+    const xVec4 extent = xVec4Make(bounds->extent_x[index], bounds->extent_y[index], bounds->extent_z[index], 0.0f);
+    xVec4 corners[8];
+    boxCorners(&culler->view_projection, center, extent, corners);
+
+    f32 nearest = INFINITY;
+    f32 min_x   = INFINITY;
+    f32 min_y   = INFINITY;
+    f32 max_x   = -INFINITY;
+    f32 max_y   = -INFINITY;
+    for (u32 c = 0; c < 8; ++c) {
+        if (corners[c].w <= X_CULL_NEAR_W) { return false; }
+        const xVec4 p = projectToPixels(culler, corners[c]);
+        nearest       = X_MIN(nearest, p.w);
+        min_x         = X_MIN(min_x, p.x);
+        min_y         = X_MIN(min_y, p.y);
+        max_x         = X_MAX(max_x, p.x);
+        max_y         = X_MAX(max_y, p.y);
+    }
+
+    const f32 tile_size = (f32)X_CULL_TILE_SIZE;
+    const s32 tx0       = (s32)X_MAX(floorf(min_x / tile_size), 0.0f);
+    const s32 ty0       = (s32)X_MAX(floorf(min_y / tile_size), 0.0f);
+    const s32 tx1       = (s32)X_MIN(floorf(max_x / tile_size), (f32)culler->tiles_x - 1.0f);
+    const s32 ty1       = (s32)X_MIN(floorf(max_y / tile_size), (f32)culler->tiles_y - 1.0f);
+    if (tx0 > tx1 || ty0 > ty1) { return false; }
+
+    for (s32 ty = ty0; ty <= ty1; ++ty) {
+        const f32* row = culler->tile_max + (size_t)ty * culler->tiles_x;
+        for (s32 tx = tx0; tx <= tx1; ++tx) {
+            if (row[tx] >= nearest) { return false; }
+        }
+    }
+    return true;
+}
+
+/* ============================================================================
+ * CULLER
+ * ============================================================================ */
+
+typedef struct {
+    xCuller* culler;
+    const xCullBounds* bounds;
+    const xFrustum* frustum;
+    u32 count;  // objects for the frustum pass, visible entries for the occlusion pass
+} xCullJob;
+
+static void frustumChunks(void* data, u32 begin, u32 end) {
+    const xCullJob* job = (const xCullJob*)data;
+    xCuller* culler     = job->culler;
+    for (u32 chunk = begin; chunk < end; ++chunk) {
+        const u32 first             = chunk * X_CULL_CHUNK_SIZE;
+        const u32 last              = X_MIN(first + X_CULL_CHUNK_SIZE, job->count);
+        u32* out                    = culler->visible + first;
+        culler->chunk_counts[chunk] = culler->frustum_kernel(job->frustum, job->bounds, first, last, out);
+    }
+}
+
+/* Filters each chunk of the visible list in place; the write cursor never passes the read cursor */
+static void occlusionChunks(void* data, u32 begin, u32 end) {
+    const xCullJob* job = (const xCullJob*)data;
+    xCuller* culler     = job->culler;
+    for (u32 chunk = begin; chunk < end; ++chunk) {
+        const u32 first = chunk * X_CULL_CHUNK_SIZE;
+        const u32 last  = X_MIN(first + X_CULL_CHUNK_SIZE, job->count);
+        u32* out        = culler->visible + first;
+        u32 count       = 0;
+        for (u32 i = first; i < last; ++i) {
+            const u32 index = culler->visible[i];
+            out[count]      = index;
+            count += !isOccluded(culler, job->bounds, index);
+        }
+        culler->chunk_counts[chunk] = count;
+    }
+}
+
+/* Slide each chunk's survivors down behind the previous ones, keeping ascending order */
+static u32 compactChunks(xCuller* culler, u32 chunk_count) {
+    u32 total = 0;
+    for (u32 chunk = 0; chunk < chunk_count; ++chunk) {
+        const u32 first = chunk * X_CULL_CHUNK_SIZE;
+        const u32 count = culler->chunk_counts[chunk];
+        if (first != total) { memmove(culler->visible + total, culler->visible + first, count * sizeof(u32)); }
+        total += count;
+    }
+    return total;
+}
+
+static bool cullerReserve(xCuller* culler, u32 count) {
+    if (count > culler->visible_capacity) {
+        u32* visible = X_REALLOC(culler->visible, u32, count);
+        if (visible == NULL) {
+            X_PRINT_ERROR("Failed to allocate visible list for %u objects", count);
+            return false;
+        }
+        culler->visible          = visible;
+        culler->visible_capacity = count;
+    }
+
+    const u32 chunk_count = (count + X_CULL_CHUNK_SIZE - 1) / X_CULL_CHUNK_SIZE;
+    if (chunk_count > culler->chunk_capacity) {
+        u32* chunk_counts = X_REALLOC(culler->chunk_counts, u32, chunk_count);
+        if (chunk_counts == NULL) {
+            X_PRINT_ERROR("Failed to allocate %u cull chunks", chunk_count);
+            return false;
+        }
+        culler->chunk_counts   = chunk_counts;
+        culler->chunk_capacity = chunk_count;
+    }
+    return true;
+}
+
+bool xCullerInit(xCuller* culler, xJobSystem* jobs, u32 depth_width, u32 depth_height) {
+    X_ZERO_STRUCT(culler);
+    culler->jobs = jobs;
+    xCullerSetKernel(culler, X_CULL_KERNEL_BEST);
+
+    if (depth_width == 0 || depth_height == 0) { return true; }
+
+    culler->depth_width  = X_ALIGN_UP(depth_width, X_CULL_TILE_SIZE);
+    culler->depth_height = X_ALIGN_UP(depth_height, X_CULL_TILE_SIZE);
+    culler->tiles_x      = culler->depth_width / X_CULL_TILE_SIZE;
+    culler->tiles_y      = culler->depth_height / X_CULL_TILE_SIZE;
+    culler->depth        = X_MALLOC(f32, (size_t)culler->depth_width * culler->depth_height);
+    culler->tile_max     = X_MALLOC(f32, (size_t)culler->tiles_x * culler->tiles_y);
+    if (culler->depth == NULL || culler->tile_max == NULL) {
+        X_PRINT_ERROR("Failed to allocate %ux%u cull depth buffer", culler->depth_width, culler->depth_height);
+        xCullerShutdown(culler);
+        return false;
+    }
+    return true;
+}
+
+void xCullerShutdown(xCuller* culler) {
+    X_FREE(culler->visible);
+    X_FREE(culler->chunk_counts);
+    X_FREE(culler->depth);
+    X_FREE(culler->tile_max);
+    X_FREE(culler->occluders);
+    culler->visible_capacity  = 0;
+    culler->chunk_capacity    = 0;
+    culler->occluder_capacity = 0;
+    culler->depth_width       = 0;
+    culler->depth_height      = 0;
+}
+
+bool xCullerSetKernel(xCuller* culler, xCullKernel kernel) {
+    switch (kernel) {
+        case X_CULL_KERNEL_SCALAR:
+            culler->frustum_kernel = frustumScalar;
+            culler->kernel_name    = "scalar";
+            return true;
+#if defined(X_CULL_X86)
+        case X_CULL_KERNEL_SSE2:
+            culler->frustum_kernel = frustumSse2;
+            culler->kernel_name    = "sse2";
+            return true;
+#endif
+#if defined(X_CULL_HAS_AVX2)
+        case X_CULL_KERNEL_AVX2:
+            if (!__builtin_cpu_supports("avx2") || !__builtin_cpu_supports("fma")) { return false; }
+            culler->frustum_kernel = frustumAvx2;
+            culler->kernel_name    = "avx2";
+            return true;
+#endif
+        case X_CULL_KERNEL_BEST:
+            return xCullerSetKernel(culler, X_CULL_KERNEL_AVX2) || xCullerSetKernel(culler, X_CULL_KERNEL_SSE2) ||
+                   xCullerSetKernel(culler, X_CULL_KERNEL_SCALAR);
+        default:
+            return false;
+    }
+}
+
+u32 xCullerRun(xCuller* culler,
+               const xCullBounds* bounds,
+               const xMat4* view_projection,
+               const xAabb* occluders,
+               u32 occluder_count) {
+    X_ZERO_STRUCT(&culler->stats);
+    culler->stats.tested    = bounds->count;
+    culler->view_projection = *view_projection;
+    if (!cullerReserve(culler, bounds->count)) { return 0; }
+
+    const xFrustum frustum = xFrustumFromMatrix(view_projection);
+    xCullJob job           = {culler, bounds, &frustum, bounds->count};
+
+    f64 start       = xPlatformTime();
+    u32 chunk_count = (bounds->count + X_CULL_CHUNK_SIZE - 1) / X_CULL_CHUNK_SIZE;
+    xJobsParallelFor(culler->jobs, chunk_count, 1, frustumChunks, &job);
+    u32 visible                   = compactChunks(culler, chunk_count);
+    culler->stats.frustum_culled  = bounds->count - visible;
+    culler->stats.frustum_seconds = xPlatformTime() - start;
+
+    if (culler->depth != NULL && occluder_count > 0 && visible > 0) {
+        start = xPlatformTime();
+        prepareOccluders(culler, occluders, occluder_count);
+        xJobsParallelFor(culler->jobs, culler->tiles_y, 1, rasterBands, culler);
+        culler->stats.occluders      = culler->occluder_count;
+        culler->stats.raster_seconds = xPlatformTime() - start;
+
+        start       = xPlatformTime();
+        job.count   = visible;
+        chunk_count = (visible + X_CULL_CHUNK_SIZE - 1) / X_CULL_CHUNK_SIZE;
+        xJobsParallelFor(culler->jobs, chunk_count, 1, occlusionChunks, &job);
+        const u32 unoccluded            = compactChunks(culler, chunk_count);
+        culler->stats.occlusion_culled  = visible - unoccluded;
+        culler->stats.occlusion_seconds = xPlatformTime() - start;
+        visible                         = unoccluded;
+    }
+
+    culler->stats.visible = visible;
+    return visible;
+}
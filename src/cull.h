@@ -0,0 +1,164 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "jobs.h"
+#include "spatial.h"
+#include "vecmath.h"
+
+/* Objects per frustum job; each chunk writes its survivors at its own offset before compaction */
+#define X_CULL_CHUNK_SIZE 16384
+
+/* Coarse depth buffer tile; occlusion tests read one max depth per tile */
+#define X_CULL_TILE_SIZE 8
+
+/* Clip-space w below which a corner counts as behind the eye */
+#define X_CULL_NEAR_W 1e-3f
+
+/* ============================================================================
+ * BOUNDS AND FRUSTUM
+ * ============================================================================ */
+
+/*
+ * Object bounds in SoA form (center and half-extent per axis) so the frustum
+ * kernels can load 4 or 8 objects per register. Indices are the caller's object
+ * ids and appear unchanged in the visible list.
+ */
+typedef struct {
+    f32* center_x;
+    f32* center_y;
+    f32* center_z;
+    f32* extent_x;
+    f32* extent_y;
+    f32* extent_z;
+    u32 count;
+    u32 capacity;
+} xCullBounds;
+
+bool xCullBoundsInit(xCullBounds* bounds, u32 capacity);
+void xCullBoundsShutdown(xCullBounds* bounds);
+
+/* Append a box, growing the arrays as needed. Returns the object index or UINT32_MAX on allocation failure. */
+u32 xCullBoundsPush(xCullBounds* bounds, const xAabb* box);
+
+X_FORCE_INLINE static void xCullBoundsSet(xCullBounds* bounds, u32 index, const xAabb* box) {
+    X_ASSERT_MSG(index < bounds->count, "Cull bounds index out of range");
+    bounds->center_x[index] = (box->min.x + box->max.x) * 0.5f;
+    bounds->center_y[index] = (box->min.y + box->max.y) * 0.5f;
+    bounds->center_z[index] = (box->min.z + box->max.z) * 0.5f;
+    bounds->extent_x[index] = (box->max.x - box->min.x) * 0.5f;
+    bounds->extent_y[index] = (box->max.y - box->min.y) * 0.5f;
+    bounds->extent_z[index] = (box->max.z - box->min.z) * 0.5f;
+}
+
+/* Six normalized planes facing inward; a point p is inside when dot(plane.xyz, p) + plane.w >= 0 */
+typedef struct {
+    xVec4 planes[6];
+} xFrustum;
+
+/* Extract the planes of a column-major view-projection matrix with GL clip conventions (-w <= z <= w) */
+xFrustum xFrustumFromMatrix(const xMat4* view_projection);
+
+/* ============================================================================
+ * CULLER
+ * ============================================================================ */
+
+typedef enum {
+    X_CULL_KERNEL_BEST = 0,
+    X_CULL_KERNEL_SCALAR,
+    X_CULL_KERNEL_SSE2,
+    X_CULL_KERNEL_AVX2,
+} xCullKernel;
+
+/* Tests objects [begin, end) and writes the indices of the ones touching the frustum to `out`; returns how many */
+typedef u32 (*xCullFrustumFn)(const xFrustum* frustum, const xCullBounds* bounds, u32 begin, u32 end, u32* out);
+
+/* An occluder projected to the coarse buffer: convex hull of its corners in pixels, drawn at its farthest depth */
+typedef struct {
+    f32 x[8];
+    f32 y[8];
+    u32 vertex_count;
+    f32 depth;
+    s32 x0;
+    s32 y0;
+    s32 x1;
+    s32 y1;
+} xCullOccluder;
+
+typedef struct {
+    u32 tested;
+    u32 visible;
+    u32 frustum_culled;
+    u32 occlusion_culled;
+    u32 occluders;  // occluders actually rasterized (ones crossing the near plane are skipped)
+    f64 frustum_seconds;
+    f64 raster_seconds;
+    f64 occlusion_seconds;
+} xCullStats;
+
+/*
+ * Visibility stage run before frame submission: a SIMD frustum test over every
+ * object split across the job system, then an optional occlusion pass against a
+ * coarse CPU depth buffer filled from a handful of caller-chosen occluder boxes.
+ *
+ * The depth buffer stores clip-space w (view depth). Occluders are rasterized as
+ * the 2D hull of their projected corners at their farthest depth, and objects are
+ * tested with their screen rectangle at their nearest depth against the per-tile
+ * maximum, so both sides are conservative and nothing visible is ever culled.
+ */
+typedef struct {
+    xJobSystem* jobs;
+    xCullFrustumFn frustum_kernel;
+    const char* kernel_name;
+
+    u32* visible;  // object indices in ascending order, `stats.visible` entries
+    u32 visible_capacity;
+    u32* chunk_counts;
+    u32 chunk_capacity;
+
+    // Coarse occlusion buffer, disabled when depth_width is 0
+    u32 depth_width;
+    u32 depth_height;
+    u32 tiles_x;
+    u32 tiles_y;
+    f32* depth;
+    f32* tile_max;
+    xCullOccluder* occluders;
+    u32 occluder_count;
+    u32 occluder_capacity;
+
+    xMat4 view_projection;
+    xCullStats stats;
+} xCuller;
+
+/*
+ * `jobs` may be NULL to run on the calling thread. A depth size of 0x0 disables
+ * occlusion culling; otherwise both sides are rounded up to whole tiles.
+ */
+bool xCullerInit(xCuller* culler, xJobSystem* jobs, u32 depth_width, u32 depth_height);
+void xCullerShutdown(xCuller* culler);
+
+/* Select the frustum kernel. Returns false if the CPU or build does not support it. */
+bool xCullerSetKernel(xCuller* culler, xCullKernel kernel);
+
+/*
+ * Run the frustum test and, when occluders are given and the depth buffer is
+ * enabled, the occlusion pass. Returns the visible count; the indices are in
+ * `culler->visible` until the next call.
+ */
+u32 xCullerRun(xCuller* culler,
+               const xCullBounds* bounds,
+               const xMat4* view_projection,
+               const xAabb* occluders,
+               u32 occluder_count);
+
+X_FORCE_INLINE static const u32* xCullerVisible(const xCuller* culler) {
+    return culler->visible;
+}
+
+X_FORCE_INLINE static const xCullStats* xCullerStats(const xCuller* culler) {
+    return &culler->stats;
+}
@@ -0,0 +1,479 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_ECS
+
+#include "ecs.h"
+
+typedef struct {
+    u32 type;
+    xEntity entity;
+    u64 mask;
+    u32 component;
+    u32 size;
+} xEcsCommandHeader;
+
+#define X_ECS_COMMAND_ALIGN 8
+
+X_STATIC_ASSERT(sizeof(xEcsCommandHeader) % X_ECS_COMMAND_ALIGN == 0, "Command header must keep payloads aligned");
+
+/* ============================================================================
+ * ARCHETYPES
+ * ============================================================================ */
+
+/* Iterate the set bits of a component mask, lowest id first */
+#define X_ECS_FOREACH_COMPONENT(mask, id)                                                                              \
+    for (u64 _bits = (mask), id = 0; _bits != 0 && ((id = (u64)__builtin_ctzll(_bits)), true); _bits &= _bits - 1)
+
+static u32 findOrCreateArchetype(xEcsWorld* world, u64 mask) {
+    for (u32 i = 0; i < world->archetype_count; ++i) {
+        if (world->archetypes[i].mask == mask) { return i; }
+    }
+
+    // Rows are the entity id plus one element of every column; reserve worst-case padding between columns
+    u32 row_size = sizeof(xEntity);
+    u32 columns  = 0;
+    X_ECS_FOREACH_COMPONENT(mask, id) {
+        X_ASSERT_MSG(id < world->component_count, "Unregistered component in archetype mask");
+        row_size += world->components[id].size;
+        columns++;
+    }
+
+    const u32 padding = (columns + 1) * X_ECS_COLUMN_ALIGN;
+    X_CHECK_MSG(row_size + padding <= X_ECS_CHUNK_SIZE, "Component set does not fit in one chunk row");
+
+    if (world->archetype_count == world->archetype_capacity) {
+        const u32 capacity      = X_MAX(world->archetype_capacity * 2, 16u);
+        xEcsArchetype* expanded = X_REALLOC(world->archetypes, xEcsArchetype, capacity);
+        X_CHECK_ALLOC(expanded);
+        world->archetypes         = expanded;
+        world->archetype_capacity = capacity;
+    }
+
+    xEcsArchetype* archetype = &world->archetypes[world->archetype_count];
+    X_ZERO_STRUCT(archetype);
+    archetype->mask         = mask;
+    archetype->column_count = columns;
+    archetype->row_capacity = (X_ECS_CHUNK_SIZE - padding) / row_size;
+
+    // Entity ids first, then one column per component in id order
+    u32 offset = X_ALIGN_UP(sizeof(xEntity) * archetype->row_capacity, X_ECS_COLUMN_ALIGN);
+    X_ECS_FOREACH_COMPONENT(mask, id) {
+        archetype->offsets[id] = offset;
+        offset = X_ALIGN_UP(offset + world->components[id].size * archetype->row_capacity, X_ECS_COLUMN_ALIGN);
+    }
+    X_ASSERT_MSG(offset <= X_ECS_CHUNK_SIZE, "Archetype columns overflow the chunk");
+
+    return world->archetype_count++;
+}
+
+static xEntity* chunkEntities(const xEcsChunk* chunk) {
+    return (xEntity*)chunk->data;
+}
+
+static void* columnAt(const xEcsWorld* world, const xEcsArchetype* archetype, u32 chunk, u32 row, u64 id) {
+    return archetype->chunks[chunk].data + archetype->offsets[id] + (size_t)row * world->components[id].size;
+}
+
+/* Append a row; all chunks but the last are always full */
+static void allocRow(xEcsArchetype* archetype, u32* out_chunk, u32* out_row) {
+    const u32 chunk = archetype->entity_count / archetype->row_capacity;
+    const u32 row   = archetype->entity_count % archetype->row_capacity;
+
+    if (chunk == archetype->chunk_count) {
+        if (archetype->chunk_count == archetype->chunk_capacity) {
+            const u32 capacity  = X_MAX(archetype->chunk_capacity * 2, 4u);
+            xEcsChunk* expanded = X_REALLOC(archetype->chunks, xEcsChunk, capacity);
+            X_CHECK_ALLOC(expanded);
+            archetype->chunks         = expanded;
+            archetype->chunk_capacity = capacity;
+        }
+
+        xEcsChunk* fresh = &archetype->chunks[archetype->chunk_count++];
+        fresh->data      = X_MALLOC(u8, X_ECS_CHUNK_SIZE);
+        fresh->count     = 0;
+        X_CHECK_ALLOC(fresh->data);
+        X_ASSERT_MSG(X_IS_ALIGNED(fresh->data, X_ECS_COLUMN_ALIGN), "Chunk allocation is under-aligned");
+    }
+
+    archetype->chunks[chunk].count++;
+    archetype->entity_count++;
+    *out_chunk = chunk;
+    *out_row   = row;
+}
+
+/* Swap-remove: the archetype's last row fills the hole so chunks stay dense */
+static void removeRow(xEcsWorld* world, xEcsArchetype* archetype, u32 chunk, u32 row) {
+    const u32 last       = archetype->entity_count - 1;
+    const u32 last_chunk = last / archetype->row_capacity;
+    const u32 last_row   = last % archetype->row_capacity;
+
+    if (last_chunk != chunk || last_row != row) {
+        const xEntity moved                          = chunkEntities(&archetype->chunks[last_chunk])[last_row];
+        chunkEntities(&archetype->chunks[chunk])[row] = moved;
+        X_ECS_FOREACH_COMPONENT(archetype->mask, id) {
+            memcpy(columnAt(world, archetype, chunk, row, id),
+                   columnAt(world, archetype, last_chunk, last_row, id),
+                   world->components[id].size);
+        }
+
+        xEcsRecord* record = (xEcsRecord*)xPoolGet(&world->entities, moved);
+        record->chunk      = chunk;
+        record->row        = row;
+    }
+
+    archetype->chunks[last_chunk].count--;
+    archetype->entity_count--;
+}
+
+/* Move an entity to the archetype for `mask`, keeping shared components and zeroing new ones */
+static void moveEntity(xEcsWorld* world, xEntity entity, u64 mask) {
+    const u32 destination = findOrCreateArchetype(world, mask);
+    xEcsRecord* record    = (xEcsRecord*)xPoolGet(&world->entities, entity);
+    xEcsArchetype* src    = &world->archetypes[record->archetype];
+    xEcsArchetype* dst    = &world->archetypes[destination];
+
+    u32 chunk, row;
+    allocRow(dst, &chunk, &row);
+    chunkEntities(&dst->chunks[chunk])[row] = entity;
+
+    X_ECS_FOREACH_COMPONENT(dst->mask, id) {
+        void* to = columnAt(world, dst, chunk, row, id);
+        if (src->mask & X_ECS_MASK(id)) {
+            memcpy(to, columnAt(world, src, record->chunk, record->row, id), world->components[id].size);
+        } else {
+            memset(to, 0, world->components[id].size);
+        }
+    }
+
+    removeRow(world, src, record->chunk, record->row);
+    record->archetype = destination;
+    record->chunk     = chunk;
+    record->row       = row;
+}
+
+/* ============================================================================
+ * WORLD
+ * ============================================================================ */
+
+bool xEcsWorldInit(xEcsWorld* world, u32 max_entities) {
+    X_ASSERT_MSG(world != NULL, "world is NULL");
+
+    X_ZERO_STRUCT(world);
+    for (u32 i = 0; i < X_JOB_MAX_THREADS; ++i) {
+        world->deferred[i].components = world->components;
+    }
+    atomic_init(&world->iterating, 0);
+    mtx_init(&world->foreign_lock, mtx_plain);
+    if (!xPoolInit(&world->entities, sizeof(xEcsRecord), max_entities)) {
+        X_PRINT_ERROR("Failed to allocate ECS entity table (%u entities)", max_entities);
+        return false;
+    }
+
+    // Archetype 0 is the empty set so entities always have a home
+    findOrCreateArchetype(world, 0);
+    return true;
+}
+
+void xEcsWorldShutdown(xEcsWorld* world) {
+    for (u32 i = 0; i < world->archetype_count; ++i) {
+        xEcsArchetype* archetype = &world->archetypes[i];
+        for (u32 c = 0; c < archetype->chunk_count; ++c) {
+            X_FREE(archetype->chunks[c].data);
+        }
+        X_FREE(archetype->chunks);
+    }
+    for (u32 i = 0; i < X_JOB_MAX_THREADS; ++i) {
+        X_FREE(world->deferred[i].data);
+    }
+    X_ARRAY_FOREACH(xEcsForeignBuffer*, foreign, &world->foreign) {
+        X_FREE((*foreign)->buffer.data);
+        X_FREE(*foreign);
+    }
+    X_ARRAY_FREE(&world->foreign);
+    mtx_destroy(&world->foreign_lock);
+
+    X_DELETE(world->archetypes);
+    X_DELETE(world->scratch_views);
+    xPoolShutdown(&world->entities);
+    world->archetype_count    = 0;
+    world->archetype_capacity = 0;
+}
+
+xComponentId xEcsRegisterComponent(xEcsWorld* world, const char* name, u32 size, u32 align) {
+    X_ASSERT_MSG(align <= X_ECS_COLUMN_ALIGN, "Component alignment exceeds X_ECS_COLUMN_ALIGN");
+    X_ASSERT_MSG(world->archetype_count <= 1, "Components must be registered before entities are created");
+
+    if (world->component_count == X_ECS_MAX_COMPONENTS) {
+        X_PRINT_ERROR("Too many ECS components (max %d), cannot register '%s'", X_ECS_MAX_COMPONENTS, name);
+        return UINT32_MAX;
+    }
+
+    const xComponentId id  = world->component_count++;
+    world->components[id] = (xComponentInfo) {size, align, name};
+    return id;
+}
+
+xEntity xEcsCreate(xEcsWorld* world, u64 mask) {
+    X_ASSERT_MSG(atomic_load_explicit(&world->iterating, memory_order_relaxed) == 0,
+                 "Structural change during a query; use xEcsDeferred");
+
+    const u32 index = findOrCreateArchetype(world, mask);
+    const xEntity entity = xPoolAcquire(&world->entities);
+    if (entity == X_HANDLE_INVALID) {
+        X_PRINT_ERROR("ECS entity limit reached (%u)", world->entities.capacity);
+        return X_HANDLE_INVALID;
+    }
+
+    xEcsArchetype* archetype = &world->archetypes[index];
+    xEcsRecord* record       = (xEcsRecord*)xPoolGet(&world->entities, entity);
+    record->archetype        = index;
+    allocRow(archetype, &record->chunk, &record->row);
+
+    chunkEntities(&archetype->chunks[record->chunk])[record->row] = entity;
+    X_ECS_FOREACH_COMPONENT(mask, id) {
+        memset(columnAt(world, archetype, record->chunk, record->row, id), 0, world->components[id].size);
+    }
+    return entity;
+}
+
+void xEcsDestroy(xEcsWorld* world, xEntity entity) {
+    X_ASSERT_MSG(atomic_load_explicit(&world->iterating, memory_order_relaxed) == 0,
+                 "Structural change during a query; use xEcsDeferred");
+    if (!xEcsIsAlive(world, entity)) { return; }
+
+    const xEcsRecord* record = (const xEcsRecord*)xPoolGet(&world->entities, entity);
+    removeRow(world, &world->archetypes[record->archetype], record->chunk, record->row);
+    xPoolRelease(&world->entities, entity);
+}
+
+void* xEcsAdd(xEcsWorld* world, xEntity entity, xComponentId component) {
+    X_ASSERT_MSG(atomic_load_explicit(&world->iterating, memory_order_relaxed) == 0,
+                 "Structural change during a query; use xEcsDeferred");
+    X_ASSERT_MSG(component < world->component_count, "Unregistered component");
+
+    const u64 mask = xEcsMaskOf(world, entity);
+    if (!(mask & X_ECS_MASK(component))) { moveEntity(world, entity, mask | X_ECS_MASK(component)); }
+    return xEcsGet(world, entity, component);
+}
+
+void xEcsRemove(xEcsWorld* world, xEntity entity, xComponentId component) {
+    X_ASSERT_MSG(atomic_load_explicit(&world->iterating, memory_order_relaxed) == 0,
+                 "Structural change during a query; use xEcsDeferred");
+
+    const u64 mask = xEcsMaskOf(world, entity);
+    if (mask & X_ECS_MASK(component)) { moveEntity(world, entity, mask & ~X_ECS_MASK(component)); }
+}
+
+/* ============================================================================
+ * QUERIES
+ * ============================================================================ */
+
+X_FORCE_INLINE static bool queryMatches(xEcsQuery query, u64 mask) {
+    return (mask & query.all) == query.all && (mask & query.none) == 0;
+}
+
+void xEcsQueryEach(xEcsWorld* world, xEcsQuery query, xEcsSystemFn fn, void* user) {
+    atomic_fetch_add_explicit(&world->iterating, 1, memory_order_relaxed);
+
+    for (u32 i = 0; i < world->archetype_count; ++i) {
+        const xEcsArchetype* archetype = &world->archetypes[i];
+        if (archetype->entity_count == 0 || !queryMatches(query, archetype->mask)) { continue; }
+
+        for (u32 c = 0; c < archetype->chunk_count; ++c) {
+            const xEcsChunk* chunk = &archetype->chunks[c];
+            if (chunk->count == 0) { break; }
+
+            const xEcsView view = {archetype, chunkEntities(chunk), chunk->data, chunk->count};
+            fn(&view, user);
+        }
+    }
+
+    atomic_fetch_sub_explicit(&world->iterating, 1, memory_order_relaxed);
+}
+
+typedef struct {
+    const xEcsView* views;
+    xEcsSystemFn fn;
+    void* user;
+} xEcsParallelContext;
+
+static void runSystemJob(void* data, u32 begin, u32 end) {
+    const xEcsParallelContext* context = (const xEcsParallelContext*)data;
+    for (u32 i = begin; i < end; ++i) {
+        context->fn(&context->views[i], context->user);
+    }
+}
+
+void xEcsQueryParallel(xEcsWorld* world, xJobSystem* jobs, xEcsQuery query, xEcsSystemFn fn, void* user) {
+    // Flatten matching chunks first so the job system sees one evenly sized item per chunk
+    u32 count = 0;
+    for (u32 i = 0; i < world->archetype_count; ++i) {
+        const xEcsArchetype* archetype = &world->archetypes[i];
+        if (archetype->entity_count == 0 || !queryMatches(query, archetype->mask)) { continue; }
+
+        const u32 used = (archetype->entity_count + archetype->row_capacity - 1) / archetype->row_capacity;
+        if (count + used > world->scratch_capacity) {
+            const u32 capacity = X_MAX(world->scratch_capacity * 2, count + used);
+            xEcsView* expanded = X_REALLOC(world->scratch_views, xEcsView, capacity);
+            X_CHECK_ALLOC(expanded);
+            world->scratch_views    = expanded;
+            world->scratch_capacity = capacity;
+        }
+
+        for (u32 c = 0; c < used; ++c) {
+            const xEcsChunk* chunk       = &archetype->chunks[c];
+            world->scratch_views[count++] = (xEcsView) {archetype, chunkEntities(chunk), chunk->data, chunk->count};
+        }
+    }
+
+    xEcsParallelContext context = {world->scratch_views, fn, user};
+    if (jobs != NULL) { world->jobs = jobs; }
+    atomic_fetch_add_explicit(&world->iterating, 1, memory_order_relaxed);
+    xJobsParallelFor(jobs, count, 1, runSystemJob, &context);
+    atomic_fetch_sub_explicit(&world->iterating, 1, memory_order_relaxed);
+}
+
+u32 xEcsQueryCount(const xEcsWorld* world, xEcsQuery query) {
+    u32 count = 0;
+    for (u32 i = 0; i < world->archetype_count; ++i) {
+        if (queryMatches(query, world->archetypes[i].mask)) { count += world->archetypes[i].entity_count; }
+    }
+    return count;
+}
+
+/* ============================================================================
+ * DEFERRED COMMANDS
+ * ============================================================================ */
+
+static xEcsCommandBuffer* foreignBuffer(xEcsWorld* world) {
+    const thrd_t self         = thrd_current();
+    xEcsCommandBuffer* buffer = NULL;
+
+    mtx_lock(&world->foreign_lock);
+    X_ARRAY_FOREACH(xEcsForeignBuffer*, foreign, &world->foreign) {
+        if (thrd_equal((*foreign)->owner, self)) {
+            buffer = &(*foreign)->buffer;
+            break;
+        }
+    }
+    if (buffer == NULL) {
+        // Entries are allocated one by one so a buffer never moves while its thread records into it
+        xEcsForeignBuffer* foreign = X_NEW(xEcsForeignBuffer);
+        if (foreign != NULL && X_ARRAY_PUSH(&world->foreign, foreign)) {
+            foreign->owner             = self;
+            foreign->buffer.components = world->components;
+            buffer                     = &foreign->buffer;
+        } else {
+            X_PRINT_ERROR("Failed to allocate a deferred ECS buffer for a foreign thread");
+            X_FREE(foreign);
+        }
+    }
+    mtx_unlock(&world->foreign_lock);
+    return buffer;
+}
+
+xEcsCommandBuffer* xEcsDeferred(xEcsWorld* world) {
+    const u32 index = world->jobs != NULL ? xJobsThreadIndex(world->jobs) : UINT32_MAX;
+    return index != UINT32_MAX ? &world->deferred[index] : foreignBuffer(world);
+}
+
+static void pushCommand(xEcsCommandBuffer* buffer, const xEcsCommandHeader* header, const void* data) {
+    const size_t payload = X_ALIGN_UP((size_t)header->size, X_ECS_COMMAND_ALIGN);
+    const size_t needed  = buffer->size + sizeof(xEcsCommandHeader) + payload;
+
+    if (needed > buffer->capacity) {
+        const size_t capacity = X_MAX(buffer->capacity * 2, X_MAX(needed, (size_t)1024));
+        u8* expanded          = X_REALLOC(buffer->data, u8, capacity);
+        X_CHECK_ALLOC(expanded);
+        buffer->data     = expanded;
+        buffer->capacity = capacity;
+    }
+
+    memcpy(buffer->data + buffer->size, header, sizeof(xEcsCommandHeader));
+    if (header->size > 0) { memcpy(buffer->data + buffer->size + sizeof(xEcsCommandHeader), data, header->size); }
+    buffer->size = needed;
+}
+
+void xEcsCmdCreate(xEcsCommandBuffer* buffer, u64 mask) {
+    const xEcsCommandHeader header = {X_ECS_CMD_CREATE, X_HANDLE_INVALID, mask, 0, 0};
+    pushCommand(buffer, &header, NULL);
+}
+
+void xEcsCmdDestroy(xEcsCommandBuffer* buffer, xEntity entity) {
+    const xEcsCommandHeader header = {X_ECS_CMD_DESTROY, entity, 0, 0, 0};
+    pushCommand(buffer, &header, NULL);
+}
+
+void xEcsCmdAdd(xEcsCommandBuffer* buffer, xEntity entity, xComponentId component, const void* data, u32 size) {
+    X_ASSERT_MSG(component < X_ECS_MAX_COMPONENTS, "Component id out of range");
+    const u32 component_size = buffer->components[component].size;
+    if (data != NULL && size != component_size) {
+        X_PRINT_ERROR("Deferred add of '%s' with %u bytes of data, the component has %u",
+                      buffer->components[component].name != NULL ? buffer->components[component].name : "?",
+                      size,
+                      component_size);
+        size = X_MIN(size, component_size);
+    }
+    const xEcsCommandHeader header = {X_ECS_CMD_ADD, entity, 0, component, data != NULL ? size : 0};
+    pushCommand(buffer, &header, data);
+}
+
+void xEcsCmdRemove(xEcsCommandBuffer* buffer, xEntity entity, xComponentId component) {
+    const xEcsCommandHeader header = {X_ECS_CMD_REMOVE, entity, 0, component, 0};
+    pushCommand(buffer, &header, NULL);
+}
+
+static void applyCommands(xEcsWorld* world, const xEcsCommandBuffer* buffer) {
+    xEntity created = X_HANDLE_INVALID;
+    size_t cursor   = 0;
+
+    while (cursor < buffer->size) {
+        xEcsCommandHeader header;
+        memcpy(&header, buffer->data + cursor, sizeof(header));
+        const u8* payload = buffer->data + cursor + sizeof(header);
+        cursor += sizeof(header) + X_ALIGN_UP((size_t)header.size, X_ECS_COMMAND_ALIGN);
+
+        const xEntity entity = header.entity == X_ECS_CREATED ? created : header.entity;
+        if (header.type != X_ECS_CMD_CREATE && !xEcsIsAlive(world, entity)) { continue; }
+
+        switch (header.type) {
+            case X_ECS_CMD_CREATE:
+                created = xEcsCreate(world, header.mask);
+                break;
+            case X_ECS_CMD_DESTROY:
+                xEcsDestroy(world, entity);
+                break;
+            case X_ECS_CMD_ADD: {
+                // Checked when recorded; the clamp keeps a bad size from ever overrunning the column
+                void* component = xEcsAdd(world, entity, header.component);
+                const u32 size  = X_MIN(header.size, world->components[header.component].size);
+                if (size > 0) { memcpy(component, payload, size); }
+                break;
+            }
+            case X_ECS_CMD_REMOVE:
+                xEcsRemove(world, entity, header.component);
+                break;
+            default:
+                X_ASSERT_MSG(false, "Unknown ECS command");
+                break;
+        }
+    }
+}
+
+void xEcsFlush(xEcsWorld* world) {
+    for (u32 i = 0; i < X_JOB_MAX_THREADS; ++i) {
+        xEcsCommandBuffer* buffer = &world->deferred[i];
+        if (buffer->size == 0) { continue; }
+
+        applyCommands(world, buffer);
+        buffer->size = 0;
+    }
+    X_ARRAY_FOREACH(xEcsForeignBuffer*, foreign, &world->foreign) {
+        if ((*foreign)->buffer.size == 0) { continue; }
+
+        applyCommands(world, &(*foreign)->buffer);
+        (*foreign)->buffer.size = 0;
+    }
+}
@@ -0,0 +1,212 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "containers.h"
+#include "pool.h"
+#include "jobs.h"
+
+/* Bytes per archetype chunk; sized to stay resident in L1/L2 while a system walks it */
+#define X_ECS_CHUNK_SIZE 16384
+
+/* Component ids index a 64-bit mask */
+#define X_ECS_MAX_COMPONENTS 64
+
+/* Every column starts on this boundary, so component alignment may not exceed it */
+#define X_ECS_COLUMN_ALIGN 16
+
+/* Stand-in for "the entity made by the previous xEcsCmdCreate in this buffer" */
+#define X_ECS_CREATED ((xEntity)UINT32_MAX)
+
+#define X_ECS_MASK(id) ((u64)1 << (id))
+
+typedef xHandle xEntity;
+typedef u32 xComponentId;
+
+typedef struct {
+    u32 size;
+    u32 align;
+    const char* name;
+} xComponentInfo;
+
+/* Fixed-size block holding `count` rows of one archetype, one SoA column per component */
+typedef struct {
+    u8* data;
+    u32 count;
+} xEcsChunk;
+
+/*
+ * All entities with exactly the same component set. Column offsets are the same
+ * for every chunk, so a query resolves them once per archetype and then only
+ * walks dense arrays. `offsets` is indexed by component id; unused ids are 0.
+ */
+typedef struct {
+    u64 mask;
+    u32 row_capacity;
+    u32 column_count;
+    u32 offsets[X_ECS_MAX_COMPONENTS];
+    xEcsChunk* chunks;
+    u32 chunk_count;
+    u32 chunk_capacity;
+    u32 entity_count;
+} xEcsArchetype;
+
+/* Where an entity's components live */
+typedef struct {
+    u32 archetype;
+    u32 chunk;
+    u32 row;
+} xEcsRecord;
+
+typedef enum {
+    X_ECS_CMD_CREATE,
+    X_ECS_CMD_DESTROY,
+    X_ECS_CMD_ADD,
+    X_ECS_CMD_REMOVE,
+} xEcsCommandType;
+
+/*
+ * Deferred structural changes. Commands are packed into a byte stream as a
+ * header followed by optional component data, and applied in record order by
+ * xEcsFlush.
+ */
+typedef struct {
+    u8* data;
+    size_t size;
+    size_t capacity;
+    const xComponentInfo* components;  // the owning world's, to check payload sizes when they are recorded
+} xEcsCommandBuffer;
+
+/* Deferred buffer of one thread outside the world's job system */
+typedef struct {
+    thrd_t owner;
+    xEcsCommandBuffer buffer;
+} xEcsForeignBuffer;
+
+typedef X_ARRAY(xEcsForeignBuffer*) xEcsForeignBufferArray;
+
+/* A single chunk handed to a system. Columns are resolved with xEcsViewColumn. */
+typedef struct {
+    const xEcsArchetype* archetype;
+    const xEntity* entities;
+    u8* data;
+    u32 count;
+} xEcsView;
+
+typedef struct {
+    xComponentInfo components[X_ECS_MAX_COMPONENTS];
+    u32 component_count;
+
+    xEcsArchetype* archetypes;
+    u32 archetype_count;
+    u32 archetype_capacity;
+
+    /* xEcsRecord per entity; the pool's generations double as entity generations */
+    xPool entities;
+
+    /* One deferred buffer per thread of `jobs` (the last system to run a parallel query) so they never contend */
+    xEcsCommandBuffer deferred[X_JOB_MAX_THREADS];
+    const xJobSystem* jobs;
+
+    /* Any other thread gets a buffer of its own, found (or added) under `foreign_lock` */
+    xEcsForeignBufferArray foreign;
+    mtx_t foreign_lock;
+
+    /* Chunk list gathered by xEcsQueryParallel */
+    xEcsView* scratch_views;
+    u32 scratch_capacity;
+
+    /* Non-zero while a query runs; immediate structural changes assert on it */
+    atomic_uint iterating;
+} xEcsWorld;
+
+typedef struct {
+    u64 all;
+    u64 none;
+} xEcsQuery;
+
+typedef void (*xEcsSystemFn)(const xEcsView* view, void* user);
+
+bool xEcsWorldInit(xEcsWorld* world, u32 max_entities);
+void xEcsWorldShutdown(xEcsWorld* world);
+
+/* Returns the new id, or UINT32_MAX if all ids are taken. `align` must be <= X_ECS_COLUMN_ALIGN. */
+xComponentId xEcsRegisterComponent(xEcsWorld* world, const char* name, u32 size, u32 align);
+
+#define X_ECS_REGISTER(world, type) xEcsRegisterComponent((world), #type, sizeof(type), _Alignof(type))
+
+/*
+ * Immediate structural changes. These move rows between chunks and so must not
+ * be called while a query is running; record them with the xEcsCmd* functions
+ * instead and xEcsFlush afterwards.
+ */
+xEntity xEcsCreate(xEcsWorld* world, u64 mask);
+void xEcsDestroy(xEcsWorld* world, xEntity entity);
+void* xEcsAdd(xEcsWorld* world, xEntity entity, xComponentId component);
+void xEcsRemove(xEcsWorld* world, xEntity entity, xComponentId component);
+
+X_FORCE_INLINE static bool xEcsIsAlive(const xEcsWorld* world, xEntity entity) {
+    return xPoolIsValid(&world->entities, entity);
+}
+
+X_FORCE_INLINE static u64 xEcsMaskOf(const xEcsWorld* world, xEntity entity) {
+    const xEcsRecord* record = (const xEcsRecord*)xPoolGet(&world->entities, entity);
+    return world->archetypes[record->archetype].mask;
+}
+
+/* Returns NULL if the entity does not have the component */
+X_FORCE_INLINE static void* xEcsGet(const xEcsWorld* world, xEntity entity, xComponentId component) {
+    const xEcsRecord* record        = (const xEcsRecord*)xPoolGet(&world->entities, entity);
+    const xEcsArchetype* archetype = &world->archetypes[record->archetype];
+    if (!(archetype->mask & X_ECS_MASK(component))) { return NULL; }
+    return archetype->chunks[record->chunk].data + archetype->offsets[component] +
+           (size_t)record->row * world->components[component].size;
+}
+
+X_FORCE_INLINE static void* xEcsViewColumn(const xEcsView* view, xComponentId component) {
+    X_ASSERT_MSG(view->archetype->mask & X_ECS_MASK(component), "Component is not part of this view");
+    return view->data + view->archetype->offsets[component];
+}
+
+#define X_ECS_COLUMN(view, type, component) ((type*)xEcsViewColumn((view), (component)))
+
+/* Call `fn` once per non-empty chunk whose archetype has every `all` bit and no `none` bit */
+void xEcsQueryEach(xEcsWorld* world, xEcsQuery query, xEcsSystemFn fn, void* user);
+
+/*
+ * As xEcsQueryEach, but chunks are spread across `jobs`. `fn` must only touch
+ * its own chunk. Not reentrant: systems may not start another parallel query.
+ */
+void xEcsQueryParallel(xEcsWorld* world, xJobSystem* jobs, xEcsQuery query, xEcsSystemFn fn, void* user);
+
+/* Number of live entities matching the query */
+u32 xEcsQueryCount(const xEcsWorld* world, xEcsQuery query);
+
+/*
+ * Deferred buffer for the calling thread: its index in the job system that ran
+ * the world's parallel queries, or a buffer of its own for threads that system
+ * doesn't own (the lookup takes a lock). Returns NULL only if that buffer
+ * cannot be allocated.
+ */
+xEcsCommandBuffer* xEcsDeferred(xEcsWorld* world);
+
+void xEcsCmdCreate(xEcsCommandBuffer* buffer, u64 mask);
+void xEcsCmdDestroy(xEcsCommandBuffer* buffer, xEntity entity);
+
+/*
+ * Add `component` to `entity` (or X_ECS_CREATED), copying `data` into it if
+ * non-NULL. A `size` other than the component's is reported, and at most the
+ * component's size is copied.
+ */
+void xEcsCmdAdd(xEcsCommandBuffer* buffer, xEntity entity, xComponentId component, const void* data, u32 size);
+void xEcsCmdRemove(xEcsCommandBuffer* buffer, xEntity entity, xComponentId component);
+
+/*
+ * Apply every deferred buffer in thread order, then the foreign ones in the
+ * order their threads first recorded, and empty them. Commands on dead
+ * entities are skipped. No thread may be recording meanwhile.
+ */
+void xEcsFlush(xEcsWorld* world);
@@ -0,0 +1,131 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "frameloop.h"
+#include "platform.h"
+#include "profiler.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#define X_FRAME_LOOP_DEFAULT_HZ 60.0
+#define X_FRAME_LOOP_DEFAULT_MAX_STEPS 8
+
+/* Sleep most of the way, then spin: OS sleeps routinely overshoot by a millisecond or more */
+static void waitUntil(f64 deadline) {
+    const f64 remaining = deadline - xPlatformTime();
+    if (remaining > X_FRAME_LOOP_SPIN_SECONDS) { xPlatformSleep(remaining - X_FRAME_LOOP_SPIN_SECONDS); }
+    while (xPlatformTime() < deadline) {}
+}
+
+static void recordFrameTime(xFrameLoop* loop, f64 seconds) {
+    loop->history[loop->history_cursor] = (f32)(seconds * 1000.0);
+    loop->history_cursor                = (loop->history_cursor + 1) % X_FRAME_LOOP_HISTORY;
+    loop->history_count                 = X_MIN(loop->history_count + 1, (u32)X_FRAME_LOOP_HISTORY);
+}
+
+void xFrameLoopInit(xFrameLoop* loop, const xFrameLoopDesc* desc) {
+    X_ZERO_STRUCT(loop);
+    loop->desc = *desc;
+    if (loop->desc.fixed_hz <= 0.0) { loop->desc.fixed_hz = X_FRAME_LOOP_DEFAULT_HZ; }
+    if (loop->desc.target_hz <= 0.0) { loop->desc.target_hz = X_FRAME_LOOP_DEFAULT_HZ; }
+    if (loop->desc.max_steps == 0) { loop->desc.max_steps = X_FRAME_LOOP_DEFAULT_MAX_STEPS; }
+
+    loop->fixed_dt  = 1.0 / loop->desc.fixed_hz;
+    loop->last_time = xPlatformTime();
+    loop->deadline  = loop->last_time;
+}
+
+void xFrameLoopSetPacing(xFrameLoop* loop, xFramePacing pacing, f64 target_hz) {
+    loop->desc.pacing    = pacing;
+    loop->desc.target_hz = target_hz > 0.0 ? target_hz : X_FRAME_LOOP_DEFAULT_HZ;
+    loop->deadline       = xPlatformTime();
+}
+
+u32 xFrameLoopTick(xFrameLoop* loop, const xFrameLoopCallbacks* callbacks) {
+    if (loop->desc.pacing == X_FRAME_PACING_CAPPED) {
+        X_PROFILE_SCOPE("xFrameLoopWait");
+        waitUntil(loop->deadline);
+    }
+
+    // Polling before the wait would hand the simulation input that is a whole wait old
+    if (callbacks->poll != NULL) { callbacks->poll(callbacks->user); }
+
+    // Read after polling, which may have changed the pacing
+    const bool capped = loop->desc.pacing == X_FRAME_PACING_CAPPED;
+    const f64 period  = 1.0 / loop->desc.target_hz;
+    const f64 now     = xPlatformTime();
+    if (capped) {
+        // Deadlines advance by whole periods so pacing does not drift; after a hitch, restart from now
+        loop->deadline += period;
+        if (loop->deadline < now) { loop->deadline = now + period; }
+    }
+
+    const f64 frame_time = now - loop->last_time;
+    loop->last_time      = now;
+    loop->accumulator += frame_time;
+    // The first frame only measures the gap since init
+    if (loop->frame_count > 0) { recordFrameTime(loop, frame_time); }
+
+    u32 steps = 0;
+    while (loop->accumulator >= loop->fixed_dt) {
+        if (steps == loop->desc.max_steps) {
+            // Too far behind to catch up: drop the backlog instead of spiralling
+            const f64 behind = floor(loop->accumulator / loop->fixed_dt);
+            loop->dropped_steps += (u64)behind;
+            loop->accumulator -= behind * loop->fixed_dt;
+            break;
+        }
+        if (callbacks->update != NULL) { callbacks->update(callbacks->user, loop->fixed_dt); }
+        loop->accumulator -= loop->fixed_dt;
+        steps++;
+    }
+
+    loop->step_count += steps;
+    loop->alpha = loop->accumulator / loop->fixed_dt;
+    if (callbacks->render != NULL) { callbacks->render(callbacks->user, loop->alpha); }
+
+    loop->frame_count++;
+    return steps;
+}
+
+static int compareF32(const void* a, const void* b) {
+    const f32 lhs = *(const f32*)a;
+    const f32 rhs = *(const f32*)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+void xFrameLoopGetStats(const xFrameLoop* loop, xFrameLoopStats* out) {
+    X_ZERO_STRUCT(out);
+    const u32 n = loop->history_count;
+    if (n == 0) { return; }
+
+    f32 sorted[X_FRAME_LOOP_HISTORY];
+    memcpy(sorted, loop->history, sizeof(f32) * n);
+    qsort(sorted, n, sizeof(f32), compareF32);
+
+    f64 sum = 0.0;
+    for (u32 i = 0; i < n; ++i) {
+        sum += sorted[i];
+    }
+    const f64 mean = sum / (f64)n;
+
+    f64 variance = 0.0;
+    for (u32 i = 0; i < n; ++i) {
+        variance += (sorted[i] - mean) * (sorted[i] - mean);
+    }
+
+    // Against the target, not the mean: a loop that is uniformly slow is all hitches, not none
+    const f64 target = 1000.0 / loop->desc.target_hz;
+    for (u32 i = 0; i < n; ++i) {
+        if (sorted[i] > target * 1.5) { out->hitches++; }
+    }
+
+    out->frames = n;
+    out->mean   = mean;
+    out->min    = sorted[0];
+    out->max    = sorted[n - 1];
+    out->stddev = sqrt(variance / (f64)n);
+    out->p99    = sorted[(u32)(0.99 * (n - 1) + 0.5)];
+}
@@ -0,0 +1,86 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+
+/* Frame times kept for jitter statistics */
+#define X_FRAME_LOOP_HISTORY 240
+
+/* Precise pacing sleeps until this long before the deadline, then spins */
+#define X_FRAME_LOOP_SPIN_SECONDS 0.002
+
+typedef enum {
+    /* No waiting in the loop; the swap chain's vsync blocks in present */
+    X_FRAME_PACING_VSYNC,
+    /* Render as fast as possible */
+    X_FRAME_PACING_UNCAPPED,
+    /* Hold each frame to `target_hz` with a coarse sleep followed by a short spin */
+    X_FRAME_PACING_CAPPED,
+} xFramePacing;
+
+typedef struct {
+    /* Simulation rate in Hz */
+    f64 fixed_hz;
+    /*
+     * Frame cap for X_FRAME_PACING_CAPPED. In the other modes it is the rate the
+     * game expects (the display refresh under vsync) and only sets the hitch threshold.
+     */
+    f64 target_hz;
+    xFramePacing pacing;
+    /* Fixed steps allowed per frame before the loop drops time rather than spiral */
+    u32 max_steps;
+} xFrameLoopDesc;
+
+/*
+ * `poll` runs once per frame after the pacing wait, so input is as fresh as
+ * possible when the frame simulates it; poll window events and drain input
+ * there. `update` then runs zero or more times with the fixed step and `render`
+ * once with the interpolation alpha.
+ */
+typedef struct {
+    void* user;
+    void (*poll)(void* user);
+    void (*update)(void* user, f64 dt);
+    void (*render)(void* user, f64 alpha);
+} xFrameLoopCallbacks;
+
+/* Frame-to-frame timing over the history window, in milliseconds */
+typedef struct {
+    u32 frames;
+    f64 mean;
+    f64 min;
+    f64 max;
+    f64 stddev;
+    f64 p99;
+    /* Frames that took longer than 1.5x the target frame time, 1 / target_hz */
+    u32 hitches;
+} xFrameLoopStats;
+
+typedef struct {
+    xFrameLoopDesc desc;
+    f64 fixed_dt;
+    f64 accumulator;
+    f64 last_time;
+    f64 deadline;
+    f64 alpha;
+    u64 frame_count;
+    u64 step_count;
+    u64 dropped_steps;
+
+    f32 history[X_FRAME_LOOP_HISTORY];
+    u32 history_cursor;
+    u32 history_count;
+} xFrameLoop;
+
+void xFrameLoopInit(xFrameLoop* loop, const xFrameLoopDesc* desc);
+
+/* Change pacing mode or frame cap at runtime; the accumulator is kept */
+void xFrameLoopSetPacing(xFrameLoop* loop, xFramePacing pacing, f64 target_hz);
+
+/* Run one frame: pace, poll, advance the fixed-step simulation, then render. Returns the number of updates run. */
+u32 xFrameLoopTick(xFrameLoop* loop, const xFrameLoopCallbacks* callbacks);
+
+void xFrameLoopGetStats(const xFrameLoop* loop, xFrameLoopStats* out);
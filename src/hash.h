@@ -0,0 +1,92 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+
+#define X_FNV1A32_OFFSET 2166136261u
+#define X_FNV1A32_PRIME 16777619u
+#define X_FNV1A64_OFFSET 14695981039346656037ull
+#define X_FNV1A64_PRIME 1099511628211ull
+
+X_FORCE_INLINE static u32 xHashFnv1a32(const void* data, size_t size) {
+    const u8* bytes = (const u8*)data;
+    u32 hash        = X_FNV1A32_OFFSET;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * X_FNV1A32_PRIME;
+    }
+    return hash;
+}
+
+X_FORCE_INLINE static u64 xHashFnv1a64(const void* data, size_t size) {
+    const u8* bytes = (const u8*)data;
+    u64 hash        = X_FNV1A64_OFFSET;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * X_FNV1A64_PRIME;
+    }
+    return hash;
+}
+
+/*
+ * FNV-1a 64 of a string literal (up to X_HASH_LITERAL_MAX_LENGTH bytes) as a
+ * constant expression: the compiler folds it even at -O0, so it can initialize
+ * statics and comparisons against it are plain integer compares. Equals
+ * xHashFnv1a64(s, strlen(s)) for the same bytes. C does not treat it as an
+ * integer constant expression, so it cannot be a case label.
+ *
+ * Pasting "" onto the argument rejects anything but a literal, and longer
+ * literals fail to compile instead of hashing a prefix.
+ */
+#define X_HASH_LITERAL_MAX_LENGTH 64
+#define X_HASH_LITERAL64(s)                                                                                            \
+    (X_FNV1A64_LITERAL_64(X_FNV1A64_OFFSET, "" s, 0) +                                                                 \
+     0 * sizeof(char[sizeof(s) - 1 <= X_HASH_LITERAL_MAX_LENGTH ? 1 : -1]))
+
+/* One FNV-1a step for byte i; past the end it XORs 0 and multiplies by 1, leaving the hash unchanged */
+#define X_FNV1A64_LITERAL_STEP(h, s, i)                                                                                \
+    (((h) ^ (u64)(u8)((i) < sizeof(s) - 1 ? (s)[(i) < sizeof(s) - 1 ? (i) : 0] : 0)) *                                \
+     ((i) < sizeof(s) - 1 ? X_FNV1A64_PRIME : 1ull))
+#define X_FNV1A64_LITERAL_4(h, s, i)                                                                                   \
+    X_FNV1A64_LITERAL_STEP(                                                                                            \
+      X_FNV1A64_LITERAL_STEP(X_FNV1A64_LITERAL_STEP(X_FNV1A64_LITERAL_STEP(h, s, i), s, (i) + 1), s, (i) + 2),         \
+      s,                                                                                                               \
+      (i) + 3)
+#define X_FNV1A64_LITERAL_16(h, s, i)                                                                                  \
+    X_FNV1A64_LITERAL_4(                                                                                               \
+      X_FNV1A64_LITERAL_4(X_FNV1A64_LITERAL_4(X_FNV1A64_LITERAL_4(h, s, i), s, (i) + 4), s, (i) + 8), s, (i) + 12)
+#define X_FNV1A64_LITERAL_64(h, s, i)                                                                                  \
+    X_FNV1A64_LITERAL_16(                                                                                              \
+      X_FNV1A64_LITERAL_16(X_FNV1A64_LITERAL_16(X_FNV1A64_LITERAL_16(h, s, i), s, (i) + 16), s, (i) + 32),             \
+      s,                                                                                                               \
+      (i) + 48)
+
+/*
+ * Asset path id: FNV-1a 64 over the path with separators folded to '/' and
+ * ASCII letters lowercased, so "Textures\\Grass.png" and "textures/grass.png"
+ * name the same asset.
+ */
+X_FORCE_INLINE static u64 xHashPath(const char* path) {
+    u64 hash = X_FNV1A64_OFFSET;
+    for (const char* c = path; *c != '\0'; ++c) {
+        u8 byte = (u8)*c;
+        if (byte == '\\') {
+            byte = '/';
+        } else if (byte >= 'A' && byte <= 'Z') {
+            byte = (u8)(byte - 'A' + 'a');
+        }
+        hash = (hash ^ byte) * X_FNV1A64_PRIME;
+    }
+    return hash;
+}
+
+/* Finalizer from SplitMix64: spreads every input bit over the whole result, for hashing integer keys */
+X_FORCE_INLINE static u64 xHashMix64(u64 key) {
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ull;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBull;
+    key ^= key >> 31;
+    return key;
+}
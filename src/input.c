@@ -0,0 +1,110 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "input.h"
+
+#define X_INPUT_QUEUE_MASK (X_INPUT_QUEUE_CAPACITY - 1)
+
+X_STATIC_ASSERT(X_IS_POW2(X_INPUT_QUEUE_CAPACITY), "Input queue capacity must be a power of 2");
+X_STATIC_ASSERT(sizeof(xInputEvent) == 24, "Input events should stay compact");
+
+void xInputQueueInit(xInputQueue* queue) {
+    atomic_init(&queue->head, 0);
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->dropped, 0);
+}
+
+bool xInputQueuePush(xInputQueue* queue, const xInputEvent* event) {
+    const u32 head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    const u32 tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    if (X_UNLIKELY(head - tail >= X_INPUT_QUEUE_CAPACITY)) {
+        atomic_fetch_add_explicit(&queue->dropped, 1, memory_order_relaxed);
+        return false;
+    }
+
+    queue->events[head & X_INPUT_QUEUE_MASK] = *event;
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    return true;
+}
+
+bool xInputQueuePop(xInputQueue* queue, xInputEvent* out) {
+    const u32 tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    const u32 head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    if (tail == head) { return false; }
+
+    *out = queue->events[tail & X_INPUT_QUEUE_MASK];
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+void xInputStateInit(xInputState* state) {
+    X_ZERO_STRUCT(state);
+}
+
+void xInputStateApply(xInputState* state, const xInputEvent* event) {
+    switch (event->type) {
+        case X_INPUT_EVENT_KEY: {
+            const s32 key = event->key.code;
+            if (key < 0 || key >= X_INPUT_MAX_KEYS) { break; }
+            if (event->action == X_INPUT_RELEASE) {
+                state->keys[key >> 5] &= ~X_BIT(key & 31);
+            } else {
+                state->keys[key >> 5] |= X_BIT(key & 31);
+            }
+            break;
+        }
+        case X_INPUT_EVENT_MOUSE_BUTTON: {
+            const s32 button = event->button;
+            if (button < 0 || button >= X_INPUT_MAX_MOUSE_BUTTONS) { break; }
+            if (event->action == X_INPUT_RELEASE) {
+                X_BIT_CLEAR(state->buttons, button);
+            } else {
+                X_BIT_SET(state->buttons, button);
+            }
+            break;
+        }
+        case X_INPUT_EVENT_MOUSE_MOVE:
+            // The first position has nothing to move from; measuring it from (0, 0) would jerk the camera
+            if (state->has_mouse_position) {
+                state->mouse_dx += event->position.x - state->mouse_x;
+                state->mouse_dy += event->position.y - state->mouse_y;
+            }
+            state->mouse_x            = event->position.x;
+            state->mouse_y            = event->position.y;
+            state->has_mouse_position = true;
+            break;
+        case X_INPUT_EVENT_MOUSE_SCROLL:
+            state->scroll_x += event->scroll.x;
+            state->scroll_y += event->scroll.y;
+            break;
+        case X_INPUT_EVENT_CLOSE:
+            state->close_requested = true;
+            break;
+        default:
+            break;
+    }
+}
+
+u32 xInputDrain(xInputQueue* queue, xInputState* state, xInputEvent* out, u32 capacity) {
+    memcpy(state->previous_keys, state->keys, sizeof(state->keys));
+    state->previous_buttons = state->buttons;
+    state->mouse_dx         = 0.0f;
+    state->mouse_dy         = 0.0f;
+    state->scroll_x         = 0.0f;
+    state->scroll_y         = 0.0f;
+
+    // Claim everything published so far with one acquire, then release the slots with one store
+    const u32 tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    const u32 head = atomic_load_explicit(&queue->head, memory_order_acquire);
+
+    u32 count = 0;
+    for (u32 i = tail; i != head; ++i, ++count) {
+        const xInputEvent* event = &queue->events[i & X_INPUT_QUEUE_MASK];
+        xInputStateApply(state, event);
+        if (out != NULL && count < capacity) { out[count] = *event; }
+    }
+
+    atomic_store_explicit(&queue->tail, head, memory_order_release);
+    return count;
+}
@@ -0,0 +1,140 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+
+#include <stdatomic.h>
+
+/* Queued events per window. Must be a power of 2. */
+#define X_INPUT_QUEUE_CAPACITY 1024
+
+/* Key codes follow GLFW (GLFW_KEY_LAST is 348) */
+#define X_INPUT_MAX_KEYS 512
+#define X_INPUT_KEY_WORDS (X_INPUT_MAX_KEYS / 32)
+#define X_INPUT_MAX_MOUSE_BUTTONS 8
+
+typedef enum {
+    X_INPUT_EVENT_KEY,
+    X_INPUT_EVENT_CHAR,
+    X_INPUT_EVENT_MOUSE_BUTTON,
+    X_INPUT_EVENT_MOUSE_MOVE,
+    X_INPUT_EVENT_MOUSE_SCROLL,
+    X_INPUT_EVENT_RESIZE,
+    X_INPUT_EVENT_CLOSE,
+} xInputEventType;
+
+typedef enum {
+    X_INPUT_RELEASE,
+    X_INPUT_PRESS,
+    X_INPUT_REPEAT,
+} xInputAction;
+
+/* Compact POD event; `time` is the platform clock in seconds when the event was queued */
+typedef struct {
+    f64 time;
+    u8 type;
+    u8 action;
+    u16 mods;
+    union {
+        struct {
+            s32 code;
+            s32 scancode;
+        } key;
+        u32 codepoint;
+        s32 button;
+        struct {
+            f32 x;
+            f32 y;
+        } position;
+        struct {
+            f32 x;
+            f32 y;
+        } scroll;
+        struct {
+            u32 width;
+            u32 height;
+        } size;
+    };
+} xInputEvent;
+
+/*
+ * Single-producer single-consumer ring. The producer is whichever thread pumps
+ * the platform events; the game drains it once per frame. Events that arrive
+ * while the ring is full are dropped and counted.
+ */
+typedef struct {
+    atomic_uint head;
+    atomic_uint tail;
+    atomic_uint dropped;
+    xInputEvent events[X_INPUT_QUEUE_CAPACITY];
+} xInputQueue;
+
+/* Keyboard and mouse state as of the last drained event, plus the previous frame's for edge queries */
+typedef struct {
+    u32 keys[X_INPUT_KEY_WORDS];
+    u32 previous_keys[X_INPUT_KEY_WORDS];
+    u32 buttons;
+    u32 previous_buttons;
+    f32 mouse_x;
+    f32 mouse_y;
+    f32 mouse_dx;
+    f32 mouse_dy;
+    f32 scroll_x;
+    f32 scroll_y;
+    bool has_mouse_position;  // false until the first cursor event, which seeds the position without a delta
+    bool close_requested;
+} xInputState;
+
+void xInputQueueInit(xInputQueue* queue);
+
+/* Producer side. Returns false (and counts a drop) when the ring is full. */
+bool xInputQueuePush(xInputQueue* queue, const xInputEvent* event);
+
+/* Consumer side. Returns false when the ring is empty. */
+bool xInputQueuePop(xInputQueue* queue, xInputEvent* out);
+
+void xInputStateInit(xInputState* state);
+
+/* Fold one event into the key/button bitsets and mouse accumulators */
+void xInputStateApply(xInputState* state, const xInputEvent* event);
+
+/*
+ * Start a new frame: snapshot the bitsets for pressed/released queries, then
+ * drain every queued event in one pass, applying it to `state`. Up to
+ * `capacity` events are also copied to `out` (may be NULL) for consumers that
+ * want the raw stream. Returns the number of events drained.
+ */
+u32 xInputDrain(xInputQueue* queue, xInputState* state, xInputEvent* out, u32 capacity);
+
+X_FORCE_INLINE static bool xInputBitTest(const u32* bits, s32 index) {
+    return index >= 0 && index < X_INPUT_MAX_KEYS && (bits[index >> 5] & X_BIT(index & 31)) != 0;
+}
+
+X_FORCE_INLINE static bool xInputKeyDown(const xInputState* state, s32 key) {
+    return xInputBitTest(state->keys, key);
+}
+
+/* True only on the frame the key went down. Taps shorter than a frame only show up in the event stream. */
+X_FORCE_INLINE static bool xInputKeyPressed(const xInputState* state, s32 key) {
+    return xInputBitTest(state->keys, key) && !xInputBitTest(state->previous_keys, key);
+}
+
+X_FORCE_INLINE static bool xInputKeyReleased(const xInputState* state, s32 key) {
+    return !xInputBitTest(state->keys, key) && xInputBitTest(state->previous_keys, key);
+}
+
+X_FORCE_INLINE static bool xInputMouseDown(const xInputState* state, s32 button) {
+    return button >= 0 && button < X_INPUT_MAX_MOUSE_BUTTONS && X_BIT_CHECK(state->buttons, button);
+}
+
+X_FORCE_INLINE static bool xInputMousePressed(const xInputState* state, s32 button) {
+    return xInputMouseDown(state, button) && !X_BIT_CHECK(state->previous_buttons, button);
+}
+
+X_FORCE_INLINE static bool xInputMouseReleased(const xInputState* state, s32 button) {
+    return button >= 0 && button < X_INPUT_MAX_MOUSE_BUTTONS && !X_BIT_CHECK(state->buttons, button) &&
+           X_BIT_CHECK(state->previous_buttons, button);
+}
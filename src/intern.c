@@ -0,0 +1,112 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_CONTAINERS
+
+#include "intern.h"
+
+/* Copy the bytes into the current block, opening a new block when it is full */
+static const char* storeString(xInternTable* table, const char* string, u32 length) {
+    const size_t size = (size_t)length + 1;
+    if (table->blocks.count == 0 || xArenaRemaining(&X_ARRAY_LAST(&table->blocks)) < size) {
+        xArena block;
+        if (!xArenaInit(&block, X_MAX(size, table->block_size))) { return NULL; }
+        if (!X_ARRAY_PUSH(&table->blocks, block)) {
+            xArenaShutdown(&block);
+            return NULL;
+        }
+    }
+
+    char* copy = (char*)xArenaAllocAligned(&X_ARRAY_LAST(&table->blocks), size, 1);
+    memcpy(copy, string, length);
+    copy[length] = '\0';
+    table->bytes += size;
+    return copy;
+}
+
+bool xInternInit(xInternTable* table, size_t block_size) {
+    X_ZERO_STRUCT(table);
+    table->block_size = block_size > 0 ? block_size : X_INTERN_DEFAULT_BLOCK_SIZE;
+    if (mtx_init(&table->lock, mtx_plain) != thrd_success) {
+        X_PRINT_ERROR("Failed to create intern table mutex");
+        return false;
+    }
+    xInternMapInit(&table->map, 0);
+    return true;
+}
+
+void xInternShutdown(xInternTable* table) {
+    X_ARRAY_FOREACH(xArena, block, &table->blocks) {
+        xArenaShutdown(block);
+    }
+    X_ARRAY_FREE(&table->blocks);
+    X_ARRAY_FREE(&table->entries);
+    xInternMapShutdown(&table->map);
+    mtx_destroy(&table->lock);
+    table->bytes = 0;
+}
+
+xStringId xInternRange(xInternTable* table, const char* string, u32 length, u32* index) {
+    const xStringId id = xStringIdMake(string, length);
+    if (index != NULL) { *index = X_INTERN_INDEX_INVALID; }
+
+    mtx_lock(&table->lock);
+    bool inserted    = false;
+    u32* slot        = xInternMapInsert(&table->map, id, &inserted);
+    xStringId result = X_STRING_ID_INVALID;
+    if (slot != NULL) {
+        if (!inserted) {
+            const xInternEntry* entry = &table->entries.items[*slot];
+            if (entry->length == length && memcmp(entry->string, string, length) == 0) {
+                result = id;
+                if (index != NULL) { *index = *slot; }
+            } else {
+                X_PRINT_ERROR("String id collision between \"%s\" and \"%.*s\"", entry->string, (int)length, string);
+            }
+        } else {
+            const char* copy         = storeString(table, string, length);
+            const xInternEntry entry = {copy, length, id};
+            if (copy != NULL && X_ARRAY_PUSH(&table->entries, entry)) {
+                *slot  = table->entries.count - 1;
+                result = id;
+                if (index != NULL) { *index = *slot; }
+            } else {
+                X_PRINT_ERROR("Failed to intern \"%.*s\"", (int)length, string);
+                xInternMapRemove(&table->map, id);
+            }
+        }
+    }
+    mtx_unlock(&table->lock);
+    return result;
+}
+
+const char* xInternLookup(xInternTable* table, xStringId id) {
+    mtx_lock(&table->lock);
+    const u32* slot    = xInternMapFind(&table->map, id);
+    const char* string = slot != NULL ? table->entries.items[*slot].string : NULL;
+    mtx_unlock(&table->lock);
+    return string;
+}
+
+u32 xInternIndex(xInternTable* table, xStringId id) {
+    mtx_lock(&table->lock);
+    const u32* slot = xInternMapFind(&table->map, id);
+    const u32 index = slot != NULL ? *slot : X_INTERN_INDEX_INVALID;
+    mtx_unlock(&table->lock);
+    return index;
+}
+
+const char* xInternString(xInternTable* table, u32 index) {
+    mtx_lock(&table->lock);
+    const char* string = index < table->entries.count ? table->entries.items[index].string : NULL;
+    mtx_unlock(&table->lock);
+    return string;
+}
+
+u32 xInternCount(xInternTable* table) {
+    mtx_lock(&table->lock);
+    const u32 count = table->entries.count;
+    mtx_unlock(&table->lock);
+    return count;
+}
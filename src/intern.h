@@ -0,0 +1,82 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "arena.h"
+#include "containers.h"
+#include "hash.h"
+
+#include <threads.h>
+
+/* String storage is carved from arena blocks of this size; longer strings get a block of their own */
+#define X_INTERN_DEFAULT_BLOCK_SIZE (64 * 1024)
+
+/*
+ * 64-bit string id: FNV-1a 64 over the string's bytes. X_STRING_ID("name")
+ * computes the same value from a literal at compile time, so code can compare
+ * names as integers without touching the table at all.
+ */
+typedef u64 xStringId;
+
+#define X_STRING_ID_INVALID ((xStringId)0)
+#define X_STRING_ID(literal) ((xStringId)X_HASH_LITERAL64(literal))
+
+/* Dense 32-bit index of an interned string, in interning order */
+#define X_INTERN_INDEX_INVALID UINT32_MAX
+
+X_FORCE_INLINE static xStringId xStringIdMake(const char* string, size_t length) {
+    return xHashFnv1a64(string, length);
+}
+
+typedef struct {
+    const char* string;  // NUL-terminated, lives until xInternShutdown
+    u32 length;
+    xStringId id;
+} xInternEntry;
+
+X_HASHMAP(xInternMap, xStringId, u32, xHashMapHashU64, xHashMapEqualScalar)
+
+/*
+ * Each distinct string is stored once in arena blocks that never move, so the
+ * returned pointers and ids stay valid for the table's lifetime. Two different
+ * strings with the same 64-bit id are reported as an error instead of silently
+ * aliasing. All calls are serialized by a mutex, so the table can be shared by
+ * the asset streamer and the game thread.
+ */
+typedef struct {
+    mtx_t lock;
+    size_t block_size;
+    X_ARRAY(xArena) blocks;
+    X_ARRAY(xInternEntry) entries;
+    xInternMap map;  // id -> entry index
+    size_t bytes;
+} xInternTable;
+
+/* `block_size` of 0 picks X_INTERN_DEFAULT_BLOCK_SIZE */
+bool xInternInit(xInternTable* table, size_t block_size);
+void xInternShutdown(xInternTable* table);
+
+/*
+ * Intern `length` bytes (no NUL needed) and return their id, or
+ * X_STRING_ID_INVALID on allocation failure or a hash collision. `index`
+ * receives the dense index and may be NULL.
+ */
+xStringId xInternRange(xInternTable* table, const char* string, u32 length, u32* index);
+
+X_FORCE_INLINE static xStringId xIntern(xInternTable* table, const char* string) {
+    return xInternRange(table, string, (u32)strlen(string), NULL);
+}
+
+/* Interned copy of the string behind `id`, or NULL if it was never interned */
+const char* xInternLookup(xInternTable* table, xStringId id);
+
+/* Dense index of `id`, or X_INTERN_INDEX_INVALID */
+u32 xInternIndex(xInternTable* table, xStringId id);
+
+/* String at a dense index, or NULL when out of range */
+const char* xInternString(xInternTable* table, u32 index);
+
+u32 xInternCount(xInternTable* table);
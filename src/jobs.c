@@ -0,0 +1,350 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_JOBS
+
+#include "jobs.h"
+#include "platform.h"
+
+#define X_JOB_QUEUE_MASK (X_JOB_QUEUE_CAPACITY - 1)
+#define X_JOB_SPIN_COUNT 64
+
+X_STATIC_ASSERT(X_IS_POW2(X_JOB_QUEUE_CAPACITY), "Job queue capacity must be a power of 2");
+
+/* The system that owns the calling thread and its index in it; a thread belongs to at most one */
+static _Thread_local const xJobSystem* tJobSystem = NULL;
+static _Thread_local u32 tThreadIndex             = UINT32_MAX;
+
+typedef struct {
+    xJobSystem* jobs;
+    u32 index;
+} xJobThreadArgs;
+
+/* ============================================================================
+ * CHASE-LEV DEQUE
+ * ============================================================================ */
+
+static bool dequePush(xJobDeque* deque, const xJob* job) {
+    const s64 bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    const s64 top    = atomic_load_explicit(&deque->top, memory_order_acquire);
+    if (bottom - top >= X_JOB_QUEUE_CAPACITY) { return false; }
+
+    deque->slots[bottom & X_JOB_QUEUE_MASK] = *job;
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    return true;
+}
+
+static bool dequePop(xJobDeque* deque, xJob* out) {
+    const s64 bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    s64 top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+
+    if (top > bottom) {
+        // Empty: undo the speculative decrement
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        return false;
+    }
+
+    *out         = deque->slots[bottom & X_JOB_QUEUE_MASK];
+    bool success = true;
+    if (top == bottom) {
+        // Last job: race any thief for it
+        success = atomic_compare_exchange_strong_explicit(
+          &deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+    return success;
+}
+
+static bool dequeSteal(xJobDeque* deque, xJob* out) {
+    s64 top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    const s64 bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (top >= bottom) { return false; }
+
+    // Copy before claiming: once the CAS succeeds the owner may reuse the slot. A copy
+    // torn by a concurrent push is always discarded because the CAS then fails.
+    *out = deque->slots[top & X_JOB_QUEUE_MASK];
+    return atomic_compare_exchange_strong_explicit(
+      &deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+}
+
+/* ============================================================================
+ * INJECTION QUEUE
+ * ============================================================================ */
+
+/* Returns how many of `count` jobs fit; the rest must be retried once workers make room */
+static u32 injectPush(xJobInjectQueue* queue, const xJob* batch, u32 count, xJobCounter* counter) {
+    mtx_lock(&queue->lock);
+    const u32 pushed = X_MIN(count, (u32)X_JOB_QUEUE_CAPACITY - queue->count);
+    for (u32 i = 0; i < pushed; ++i) {
+        xJob* slot    = &queue->slots[(queue->head + queue->count + i) & X_JOB_QUEUE_MASK];
+        *slot         = batch[i];
+        slot->counter = counter;
+    }
+    queue->count += pushed;
+    atomic_store_explicit(&queue->pending, queue->count, memory_order_release);
+    mtx_unlock(&queue->lock);
+    return pushed;
+}
+
+static bool injectPop(xJobInjectQueue* queue, xJob* out) {
+    if (atomic_load_explicit(&queue->pending, memory_order_acquire) == 0) { return false; }
+
+    mtx_lock(&queue->lock);
+    const bool found = queue->count > 0;
+    if (found) {
+        *out        = queue->slots[queue->head];
+        queue->head = (queue->head + 1) & X_JOB_QUEUE_MASK;
+        queue->count--;
+        atomic_store_explicit(&queue->pending, queue->count, memory_order_release);
+    }
+    mtx_unlock(&queue->lock);
+    return found;
+}
+
+/* ============================================================================
+ * SCHEDULING
+ * ============================================================================ */
+
+static u32 threadIndexIn(const xJobSystem* jobs) {
+    return tJobSystem == jobs ? tThreadIndex : UINT32_MAX;
+}
+
+static void executeJob(const xJob* job) {
+    job->fn(job->data, job->begin, job->end);
+    if (job->counter != NULL) { atomic_fetch_sub_explicit(&job->counter->pending, 1, memory_order_acq_rel); }
+}
+
+static bool findJob(xJobSystem* jobs, u32 index, xJob* out) {
+    xJobWorker* self = &jobs->workers[index];
+    if (dequePop(&self->deque, out)) { return true; }
+    if (injectPop(&jobs->inject, out)) { return true; }
+
+    // Start stealing at a random victim so thieves spread out
+    self->rng ^= self->rng << 13;
+    self->rng ^= self->rng >> 17;
+    self->rng ^= self->rng << 5;
+    const u32 start = self->rng % jobs->thread_count;
+
+    for (u32 i = 0; i < jobs->thread_count; ++i) {
+        const u32 victim = (start + i) % jobs->thread_count;
+        if (victim == index) { continue; }
+        if (dequeSteal(&jobs->workers[victim].deque, out)) { return true; }
+    }
+    return false;
+}
+
+static bool tryRunOne(xJobSystem* jobs, u32 index) {
+    xJob job;
+    if (!findJob(jobs, index, &job)) { return false; }
+
+    atomic_fetch_sub_explicit(&jobs->queued, 1, memory_order_relaxed);
+    executeJob(&job);
+    return true;
+}
+
+static int workerMain(void* arg) {
+    xJobThreadArgs args = *(xJobThreadArgs*)arg;
+    X_FREE(arg);
+
+    xJobSystem* jobs = args.jobs;
+    tJobSystem       = jobs;
+    tThreadIndex     = args.index;
+
+    while (!atomic_load_explicit(&jobs->quit, memory_order_acquire)) {
+        bool ran = false;
+        for (u32 spin = 0; spin < X_JOB_SPIN_COUNT && !ran; ++spin) {
+            ran = tryRunOne(jobs, args.index);
+            if (!ran) { thrd_yield(); }
+        }
+        if (ran) { continue; }
+
+        // Nothing to do: sleep until a submitter bumps `queued`
+        atomic_fetch_add_explicit(&jobs->sleepers, 1, memory_order_seq_cst);
+        mtx_lock(&jobs->lock);
+        while (atomic_load_explicit(&jobs->queued, memory_order_seq_cst) == 0 &&
+               !atomic_load_explicit(&jobs->quit, memory_order_acquire)) {
+            cnd_wait(&jobs->wake, &jobs->lock);
+        }
+        mtx_unlock(&jobs->lock);
+        atomic_fetch_sub_explicit(&jobs->sleepers, 1, memory_order_seq_cst);
+    }
+    return 0;
+}
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+xJobSystem* xJobSystemCreate(u32 thread_count) {
+    X_ASSERT_MSG(tJobSystem == NULL, "Calling thread already belongs to a job system");
+
+    xJobSystem* jobs = X_NEW(xJobSystem);
+    if (jobs == NULL) {
+        X_PRINT_ERROR("Failed to allocate job system");
+        return NULL;
+    }
+
+    jobs->thread_count = X_CLAMP(thread_count == 0 ? xPlatformCoreCount() : thread_count, 1u, (u32)X_JOB_MAX_THREADS);
+    jobs->workers      = X_CALLOC(xJobWorker, jobs->thread_count);
+    if (jobs->workers == NULL) {
+        X_PRINT_ERROR("Failed to allocate %u job workers", jobs->thread_count);
+        X_FREE(jobs);
+        return NULL;
+    }
+
+    atomic_init(&jobs->queued, 0);
+    atomic_init(&jobs->sleepers, 0);
+    atomic_init(&jobs->quit, false);
+    mtx_init(&jobs->lock, mtx_plain);
+    cnd_init(&jobs->wake);
+    mtx_init(&jobs->inject.lock, mtx_plain);
+    atomic_init(&jobs->inject.pending, 0);
+
+    for (u32 i = 0; i < jobs->thread_count; ++i) {
+        xJobWorker* worker = &jobs->workers[i];
+        atomic_init(&worker->deque.top, 0);
+        atomic_init(&worker->deque.bottom, 0);
+        worker->rng = 0x9E3779B9u * (i + 1);
+    }
+
+    tJobSystem   = jobs;
+    tThreadIndex = 0;
+    for (u32 i = 1; i < jobs->thread_count; ++i) {
+        xJobThreadArgs* args = X_NEW(xJobThreadArgs);
+        X_CHECK_ALLOC(args);
+        args->jobs  = jobs;
+        args->index = i;
+
+        if (thrd_create(&jobs->workers[i].thread, workerMain, args) != thrd_success) {
+            X_PRINT_ERROR("Failed to spawn job worker %u", i);
+            X_FREE(args);
+            jobs->thread_count = i;
+            break;
+        }
+    }
+
+    return jobs;
+}
+
+void xJobSystemDestroy(xJobSystem* jobs) {
+    X_ASSERT_MSG(threadIndexIn(jobs) == 0, "Job system must be destroyed by the thread that created it");
+
+    // Drain anything still queued so no counter is left dangling
+    while (tryRunOne(jobs, 0)) {}
+
+    atomic_store_explicit(&jobs->quit, true, memory_order_release);
+    mtx_lock(&jobs->lock);
+    cnd_broadcast(&jobs->wake);
+    mtx_unlock(&jobs->lock);
+
+    for (u32 i = 1; i < jobs->thread_count; ++i) {
+        thrd_join(jobs->workers[i].thread, NULL);
+    }
+
+    cnd_destroy(&jobs->wake);
+    mtx_destroy(&jobs->lock);
+    mtx_destroy(&jobs->inject.lock);
+    X_FREE(jobs->workers);
+    X_FREE(jobs);
+    tJobSystem   = NULL;
+    tThreadIndex = UINT32_MAX;
+}
+
+u32 xJobsThreadIndex(const xJobSystem* jobs) {
+    return threadIndexIn(jobs);
+}
+
+static void wakeSleepers(xJobSystem* jobs) {
+    if (atomic_load_explicit(&jobs->sleepers, memory_order_seq_cst) > 0) {
+        mtx_lock(&jobs->lock);
+        cnd_broadcast(&jobs->wake);
+        mtx_unlock(&jobs->lock);
+    }
+}
+
+/* Foreign submissions go through the locked queue; when it is full, wait for the workers to drain it */
+static void runForeign(xJobSystem* jobs, const xJob* batch, u32 count, xJobCounter* counter) {
+    if (jobs->thread_count == 1) {
+        // No workers to hand the jobs to, so run them here like xJobsParallelFor does
+        for (u32 i = 0; i < count; ++i) {
+            xJob job    = batch[i];
+            job.counter = counter;
+            executeJob(&job);
+        }
+        return;
+    }
+
+    while (count > 0) {
+        const u32 pushed = injectPush(&jobs->inject, batch, count, counter);
+        atomic_fetch_add_explicit(&jobs->queued, pushed, memory_order_seq_cst);
+        wakeSleepers(jobs);
+        batch += pushed;
+        count -= pushed;
+        if (count > 0) { thrd_yield(); }
+    }
+}
+
+void xJobsRun(xJobSystem* jobs, const xJob* batch, u32 count, xJobCounter* counter) {
+    if (counter != NULL) { atomic_fetch_add_explicit(&counter->pending, count, memory_order_relaxed); }
+
+    const u32 index = threadIndexIn(jobs);
+    if (index == UINT32_MAX) {
+        runForeign(jobs, batch, count, counter);
+        return;
+    }
+
+    xJobWorker* self = &jobs->workers[index];
+    for (u32 i = 0; i < count; ++i) {
+        xJob job    = batch[i];
+        job.counter = counter;
+
+        if (!dequePush(&self->deque, &job)) {
+            // Queue full: do the work now rather than dropping it
+            executeJob(&job);
+            continue;
+        }
+        atomic_fetch_add_explicit(&jobs->queued, 1, memory_order_seq_cst);
+    }
+
+    wakeSleepers(jobs);
+}
+
+void xJobsWait(xJobSystem* jobs, xJobCounter* counter) {
+    // Foreign threads have no deque and must not run jobs, which expect a valid thread index
+    const u32 index = threadIndexIn(jobs);
+    while (!xJobCounterDone(counter)) {
+        if (index == UINT32_MAX || !tryRunOne(jobs, index)) { thrd_yield(); }
+    }
+}
+
+void xJobsParallelFor(xJobSystem* jobs, u32 count, u32 grain, xJobFn fn, void* data) {
+    if (count == 0) { return; }
+    grain = X_MAX(grain, 1u);
+
+    if (jobs == NULL || jobs->thread_count == 1 || count <= grain) {
+        fn(data, 0, count);
+        return;
+    }
+
+    xJobCounter counter;
+    xJobCounterInit(&counter);
+
+    // Submit in small batches so huge ranges never overflow a deque
+    xJob batch[64];
+    u32 batch_count = 0;
+    for (u32 begin = 0; begin < count; begin += grain) {
+        batch[batch_count++] = (xJob) {fn, data, begin, X_MIN(begin + grain, count), NULL};
+        if (batch_count == X_ARRAY_SIZE(batch)) {
+            xJobsRun(jobs, batch, batch_count, &counter);
+            batch_count = 0;
+        }
+    }
+    if (batch_count > 0) { xJobsRun(jobs, batch, batch_count, &counter); }
+
+    xJobsWait(jobs, &counter);
+}
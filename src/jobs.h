@@ -0,0 +1,105 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+
+#include <stdatomic.h>
+#include <threads.h>
+
+/* Per-thread deque and job ring capacity. Must be a power of 2. */
+#define X_JOB_QUEUE_CAPACITY 4096
+
+/* Upper bound on threads in a job system, including the creating thread */
+#define X_JOB_MAX_THREADS 64
+
+/* Jobs receive their user pointer and the index range they cover */
+typedef void (*xJobFn)(void* data, u32 begin, u32 end);
+
+/* Number of outstanding jobs in a batch; wait on it with xJobsWait */
+typedef struct {
+    atomic_uint pending;
+} xJobCounter;
+
+typedef struct {
+    xJobFn fn;
+    void* data;
+    u32 begin;
+    u32 end;
+    xJobCounter* counter;
+} xJob;
+
+/*
+ * Chase-Lev work-stealing deque. The owning thread pushes and pops at the
+ * bottom without contention; other threads steal from the top with a CAS.
+ * Jobs are stored by value so no separate job allocation is needed.
+ */
+typedef struct {
+    _Alignas(64) atomic_llong top;
+    _Alignas(64) atomic_llong bottom;
+    _Alignas(64) xJob slots[X_JOB_QUEUE_CAPACITY];
+} xJobDeque;
+
+typedef struct {
+    xJobDeque deque;
+    u32 rng;
+    thrd_t thread;
+} xJobWorker;
+
+/* FIFO for jobs submitted by threads the system doesn't own. Workers check it between their own deque and stealing. */
+typedef struct {
+    mtx_t lock;
+    u32 head;
+    u32 count;
+    atomic_uint pending;  // mirrors `count` so workers can skip the lock while it is empty
+    xJob slots[X_JOB_QUEUE_CAPACITY];
+} xJobInjectQueue;
+
+/*
+ * One worker per core. Index 0 belongs to the thread that created the system,
+ * which runs jobs whenever it waits on a counter. Any thread may submit and
+ * wait: foreign threads (a render thread, say) go through the injection queue
+ * and block without running jobs, so jobs only ever run on the system's own
+ * threads and xJobsThreadIndex is always valid inside one. The exception is a
+ * single-thread system, which has no workers to hand them to and runs a
+ * foreign thread's jobs inline, as xJobsParallelFor always does.
+ */
+typedef struct {
+    xJobWorker* workers;
+    u32 thread_count;
+    atomic_uint queued;
+    atomic_uint sleepers;
+    atomic_bool quit;
+    mtx_t lock;
+    cnd_t wake;
+    xJobInjectQueue inject;
+} xJobSystem;
+
+/* `thread_count` includes the calling thread; 0 picks one per core */
+xJobSystem* xJobSystemCreate(u32 thread_count);
+void xJobSystemDestroy(xJobSystem* jobs);
+
+/* Index of the calling thread within `jobs`, or UINT32_MAX if `jobs` doesn't own it */
+u32 xJobsThreadIndex(const xJobSystem* jobs);
+
+X_FORCE_INLINE static void xJobCounterInit(xJobCounter* counter) {
+    atomic_init(&counter->pending, 0);
+}
+
+X_FORCE_INLINE static bool xJobCounterDone(xJobCounter* counter) {
+    return atomic_load_explicit(&counter->pending, memory_order_acquire) == 0;
+}
+
+/* Queue `count` jobs and add them to `counter` (may be NULL for fire-and-forget) */
+void xJobsRun(xJobSystem* jobs, const xJob* batch, u32 count, xJobCounter* counter);
+
+/* Block until `counter` reaches zero. Threads owned by `jobs` run queued jobs in the meantime. */
+void xJobsWait(xJobSystem* jobs, xJobCounter* counter);
+
+/*
+ * Split [0, count) into chunks of at most `grain` indices, run them across all
+ * threads and return when every chunk is done. Runs inline when `jobs` is NULL.
+ */
+void xJobsParallelFor(xJobSystem* jobs, u32 count, u32 grain, xJobFn fn, void* data);
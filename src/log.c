@@ -0,0 +1,884 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "log.h"
+#include "common.h"
+
+#include <limits.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <threads.h>
+#include <time.h>
+#include <wchar.h>
+
+#define X_LOG_RING_MASK (X_LOG_RING_SIZE - 1)
+#define X_LOG_BATCH_SIZE 16384
+#define X_LOG_NO_THREAD 0xFFFF
+
+X_STATIC_ASSERT(X_IS_POW2(X_LOG_RING_SIZE), "Log ring size must be a power of 2");
+X_STATIC_ASSERT(X_LOG_MAX_RECORD <= X_LOG_RING_SIZE / 2, "A record must fit in a drained ring however it wraps");
+X_STATIC_ASSERT(X_LOG_MAX_LINE * 2 <= X_LOG_BATCH_SIZE, "The write batch must hold a full line");
+
+/* Record header, followed by `arg_bytes` of encoded arguments. Padding records only set `size` and `level`. */
+typedef struct {
+    u32 size;   // whole record in bytes, a multiple of 8
+    u16 level;  // X_LOG_LEVEL_COUNT pads the ring out to its end
+    u16 thread;
+    u32 line;
+    u32 arg_bytes;
+    u64 timestamp;  // nanoseconds since the logger was first used
+    const char* format;
+    const char* file;
+} xLogRecord;
+
+X_STATIC_ASSERT(sizeof(xLogRecord) % 8 == 0, "Record headers must keep arguments 8-byte aligned");
+
+/* Single-producer single-consumer: the owning thread advances head, whoever holds gLog.lock advances tail */
+typedef struct {
+    _Alignas(64) atomic_uint head;
+    _Alignas(64) atomic_uint tail;
+    atomic_uint dropped;
+    u32 reported;  // drops already written out, consumer only
+    u32 id;
+    _Alignas(16) u8 data[X_LOG_RING_SIZE];
+} xLogRing;
+
+static struct {
+    _Atomic(xLogRing*) rings[X_LOG_MAX_THREADS];
+    atomic_uint ring_count;
+
+    // Rings whose thread has exited, handed back by the ring_key destructor
+    mtx_t free_lock;
+    u32 free_rings[X_LOG_MAX_THREADS];
+    u32 free_count;
+    tss_t ring_key;
+    atomic_int level;
+    atomic_bool running;
+    atomic_bool stop;
+    u64 base_ns;
+
+    mtx_t lock;  // held while draining, so each ring has one consumer at a time
+    cnd_t wake;
+    thrd_t writer;
+    FILE* file;  // NULL writes to stderr
+    char batch[X_LOG_BATCH_SIZE];
+    u32 batch_size;
+} gLog = {.level = X_LOG_COMPILE_LEVEL};
+
+static once_flag sLogOnce = ONCE_FLAG_INIT;
+
+static _Thread_local xLogRing* tRing    = NULL;
+static _Thread_local bool tRingDisabled = false;
+
+static const char* kLevelNames[X_LOG_LEVEL_COUNT] = {"DEBUG", "INFO", "WARN", "ERROR", "FATAL"};
+
+static u64 monotonicNs(void) {
+    struct timespec ts;
+#if defined(_WIN32)
+    timespec_get(&ts, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return (u64)ts.tv_sec * 1000000000ull + (u64)ts.tv_nsec;
+}
+
+/*
+ * Runs as a thread exits. Records it left in the ring are still drained as
+ * usual; the next thread to take the ring simply appends after them, so it
+ * stays single-producer.
+ */
+static void releaseRing(void* ring) {
+    mtx_lock(&gLog.free_lock);
+    gLog.free_rings[gLog.free_count++] = ((xLogRing*)ring)->id;
+    mtx_unlock(&gLog.free_lock);
+    tRing = NULL;
+}
+
+static void initLogger(void) {
+    mtx_init(&gLog.lock, mtx_plain);
+    mtx_init(&gLog.free_lock, mtx_plain);
+    cnd_init(&gLog.wake);
+    tss_create(&gLog.ring_key, releaseRing);
+    gLog.base_ns = monotonicNs();
+}
+
+/* Registered rings; the counter can overshoot when registration fails past the limit */
+static u32 ringCount(void) {
+    return X_MIN(atomic_load_explicit(&gLog.ring_count, memory_order_acquire), (u32)X_LOG_MAX_THREADS);
+}
+
+/* A ring some exited thread gave back, or NULL */
+static xLogRing* reuseRing(void) {
+    xLogRing* ring = NULL;
+    mtx_lock(&gLog.free_lock);
+    if (gLog.free_count > 0) {
+        ring = atomic_load_explicit(&gLog.rings[gLog.free_rings[--gLog.free_count]], memory_order_relaxed);
+    }
+    mtx_unlock(&gLog.free_lock);
+    return ring;
+}
+
+static xLogRing* newRing(void) {
+    const u32 index = atomic_fetch_add_explicit(&gLog.ring_count, 1, memory_order_relaxed);
+    if (index >= X_LOG_MAX_THREADS) { return NULL; }
+
+    // Straight from libc and never freed, only recycled: the tracking allocator logs
+    xLogRing* ring = (xLogRing*)calloc(1, sizeof(xLogRing));
+    if (ring == NULL) { return NULL; }
+    ring->id = index;
+    atomic_store_explicit(&gLog.rings[index], ring, memory_order_release);
+    return ring;
+}
+
+static xLogRing* threadRing(void) {
+    if (X_LIKELY(tRing != NULL) || tRingDisabled) { return tRing; }
+
+    xLogRing* ring = reuseRing();
+    if (ring == NULL) { ring = newRing(); }
+    if (ring == NULL) {
+        // Every slot is held by a live thread; this one writes synchronously from now on
+        tRingDisabled = true;
+        return NULL;
+    }
+
+    // The main thread never runs the destructor, which is fine: its ring lives as long as the process
+    tss_set(gLog.ring_key, ring);
+    tRing = ring;
+    return ring;
+}
+
+/* ============================================================================
+ * FORMAT SPECIFICATIONS
+ * ============================================================================ */
+
+typedef enum {
+    X_LOG_ARG_SIGNED,
+    X_LOG_ARG_UNSIGNED,
+    X_LOG_ARG_DOUBLE,
+    X_LOG_ARG_STRING,
+    X_LOG_ARG_WIDE_STRING,  // %ls, stored converted to multibyte
+    X_LOG_ARG_WIDE_CHAR,    // %lc, likewise
+    X_LOG_ARG_POINTER,
+    X_LOG_ARG_COUNT_OUT,  // %n: consumed, never written
+} xLogArg;
+
+/* One printf conversion, split into the parts the writer needs to rebuild it with canonical argument types */
+typedef struct {
+    const char* flags;
+    u32 flag_count;
+    const char* width;
+    u32 width_length;
+    const char* precision;
+    u32 precision_length;
+    bool width_star;
+    bool precision_star;
+    bool has_precision;
+    char length[3];
+    char conversion;
+    xLogArg arg;
+} xLogSpec;
+
+static bool isOneOf(char c, const char* set) {
+    return c != '\0' && strchr(set, c) != NULL;
+}
+
+/* Parse the conversion following a '%'. Returns the character after it, or NULL if it is not one we know. */
+static const char* parseSpec(const char* p, xLogSpec* spec) {
+    X_ZERO_STRUCT(spec);
+    spec->flags = p;
+    while (isOneOf(*p, "-+ #0'")) {
+        p++;
+    }
+    spec->flag_count = (u32)(p - spec->flags);
+
+    if (*p == '*') {
+        spec->width_star = true;
+        p++;
+    } else {
+        spec->width = p;
+        while (*p >= '0' && *p <= '9') {
+            p++;
+        }
+        spec->width_length = (u32)(p - spec->width);
+    }
+
+    if (*p == '.') {
+        spec->has_precision = true;
+        p++;
+        if (*p == '*') {
+            spec->precision_star = true;
+            p++;
+        } else {
+            spec->precision = p;
+            while (*p >= '0' && *p <= '9') {
+                p++;
+            }
+            spec->precision_length = (u32)(p - spec->precision);
+        }
+    }
+
+    for (u32 i = 0; i < 2 && isOneOf(*p, "hljztLq"); ++i) {
+        spec->length[i] = *p++;
+    }
+
+    spec->conversion = *p;
+    switch (*p) {
+        case 'd':
+        case 'i':
+            spec->arg = X_LOG_ARG_SIGNED;
+            break;
+        case 'c':
+            spec->arg = spec->length[0] == 'l' ? X_LOG_ARG_WIDE_CHAR : X_LOG_ARG_SIGNED;
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            spec->arg = X_LOG_ARG_UNSIGNED;
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            spec->arg = X_LOG_ARG_DOUBLE;
+            break;
+        case 's':
+            spec->arg = spec->length[0] == 'l' ? X_LOG_ARG_WIDE_STRING : X_LOG_ARG_STRING;
+            break;
+        case 'p':
+            spec->arg = X_LOG_ARG_POINTER;
+            break;
+        case 'n':
+            spec->arg = X_LOG_ARG_COUNT_OUT;
+            break;
+        default:
+            return NULL;
+    }
+    return p + 1;
+}
+
+/* ============================================================================
+ * ENCODING
+ * ============================================================================ */
+
+typedef struct {
+    u8* data;
+    u32 size;
+    u32 capacity;
+} xLogEncoder;
+
+static bool putSlot(xLogEncoder* encoder, u64 bits) {
+    if (encoder->size + sizeof(u64) > encoder->capacity) { return false; }
+    memcpy(encoder->data + encoder->size, &bits, sizeof(u64));
+    encoder->size += sizeof(u64);
+    return true;
+}
+
+/*
+ * Length-prefixed and padded to 8 bytes; truncated to whatever room is left.
+ * No more than `limit` bytes are read, as printf does for a precision, so
+ * '%.*s' may point at text without a terminator.
+ */
+static bool putString(xLogEncoder* encoder, const char* text, u32 limit) {
+    if (text == NULL) { text = "(null)"; }
+    if (encoder->size + sizeof(u64) > encoder->capacity) { return false; }
+
+    const u32 room   = encoder->capacity - encoder->size - (u32)sizeof(u64);
+    const u32 length = (u32)strnlen(text, X_MIN(room, limit));
+    const u64 header = length;
+    memcpy(encoder->data + encoder->size, &header, sizeof(u64));
+    memcpy(encoder->data + encoder->size + sizeof(u64), text, length);
+    encoder->size += (u32)sizeof(u64) + X_ALIGN_UP(length, 8u);
+    encoder->size = X_MIN(encoder->size, encoder->capacity);
+    return true;
+}
+
+/*
+ * As putString, after converting to the current locale's multibyte encoding;
+ * unrepresentable characters become '?'. `limit` bounds the converted bytes,
+ * and no character is read once it is reached.
+ */
+static bool putWideString(xLogEncoder* encoder, const wchar_t* text, u32 limit) {
+    if (text == NULL) { return putString(encoder, NULL, limit); }
+    if (encoder->size + sizeof(u64) > encoder->capacity) { return false; }
+
+    char* out      = (char*)encoder->data + encoder->size + sizeof(u64);
+    const u32 room = X_MIN(encoder->capacity - encoder->size - (u32)sizeof(u64), limit);
+    u32 length     = 0;
+    mbstate_t state;
+    memset(&state, 0, sizeof(state));
+    for (; length < room && *text != L'\0'; ++text) {
+        char bytes[MB_LEN_MAX];
+        size_t count = wcrtomb(bytes, *text, &state);
+        if (count == (size_t)-1) {
+            bytes[0] = '?';
+            count    = 1;
+            memset(&state, 0, sizeof(state));
+        }
+        if (length + count > room) { break; }
+        memcpy(out + length, bytes, count);
+        length += (u32)count;
+    }
+
+    const u64 header = length;
+    memcpy(encoder->data + encoder->size, &header, sizeof(u64));
+    encoder->size += (u32)sizeof(u64) + X_ALIGN_UP(length, 8u);
+    encoder->size = X_MIN(encoder->size, encoder->capacity);
+    return true;
+}
+
+/* Integers are narrowed as printf would, then widened to 64 bits so the writer needs one type per class */
+static u64 readSigned(const xLogSpec* spec, va_list* args) {
+    const char* length = spec->length;
+    if (length[0] == 'h' && length[1] == 'h') { return (u64)(s64)(signed char)va_arg(*args, int); }
+    if (length[0] == 'l' && length[1] == 'l') { return (u64)va_arg(*args, long long); }
+    switch (length[0]) {
+        case 'h':
+            return (u64)(s64)(short)va_arg(*args, int);
+        case 'l':
+            return (u64)(s64)va_arg(*args, long);
+        case 'q':
+            return (u64)va_arg(*args, long long);
+        case 'j':
+            return (u64)va_arg(*args, intmax_t);
+        case 'z':
+        case 't':
+            return (u64)(s64)va_arg(*args, ptrdiff_t);
+        default:
+            return (u64)(s64)va_arg(*args, int);
+    }
+}
+
+static u64 readUnsigned(const xLogSpec* spec, va_list* args) {
+    const char* length = spec->length;
+    if (length[0] == 'h' && length[1] == 'h') { return (unsigned char)va_arg(*args, unsigned); }
+    if (length[0] == 'l' && length[1] == 'l') { return va_arg(*args, unsigned long long); }
+    switch (length[0]) {
+        case 'h':
+            return (unsigned short)va_arg(*args, unsigned);
+        case 'l':
+            return va_arg(*args, unsigned long);
+        case 'q':
+            return va_arg(*args, unsigned long long);
+        case 'j':
+            return va_arg(*args, uintmax_t);
+        case 'z':
+        case 't':
+            return va_arg(*args, size_t);
+        default:
+            return va_arg(*args, unsigned);
+    }
+}
+
+/* Returns false once the record is full; the writer then marks the line as truncated */
+static bool encodeArgs(xLogEncoder* encoder, const char* format, va_list* args) {
+    for (const char* p = format; *p != '\0';) {
+        if (*p++ != '%') { continue; }
+        if (*p == '%') {
+            p++;
+            continue;
+        }
+
+        xLogSpec spec;
+        const char* next = parseSpec(p, &spec);
+        if (next == NULL) { return true; }
+        p = next;
+
+        if (spec.width_star && !putSlot(encoder, (u64)(s64)va_arg(*args, int))) { return false; }
+
+        // Strings must not be read past their precision; a negative '*' precision means none
+        s64 precision = -1;
+        if (spec.precision_star) {
+            precision = va_arg(*args, int);
+            if (!putSlot(encoder, (u64)precision)) { return false; }
+        } else if (spec.has_precision) {
+            precision = strtoll(spec.precision, NULL, 10);
+        }
+        const u32 limit = precision < 0 ? UINT32_MAX : (u32)X_MIN(precision, (s64)UINT32_MAX);
+
+        bool ok = true;
+        switch (spec.arg) {
+            case X_LOG_ARG_SIGNED:
+                ok = putSlot(encoder, readSigned(&spec, args));
+                break;
+            case X_LOG_ARG_UNSIGNED:
+                ok = putSlot(encoder, readUnsigned(&spec, args));
+                break;
+            case X_LOG_ARG_DOUBLE: {
+                const f64 value = spec.length[0] == 'L' ? (f64)va_arg(*args, long double) : va_arg(*args, f64);
+                u64 bits;
+                memcpy(&bits, &value, sizeof(bits));
+                ok = putSlot(encoder, bits);
+                break;
+            }
+            case X_LOG_ARG_STRING:
+                ok = putString(encoder, va_arg(*args, const char*), limit);
+                break;
+            case X_LOG_ARG_WIDE_STRING:
+                ok = putWideString(encoder, va_arg(*args, const wchar_t*), limit);
+                break;
+            case X_LOG_ARG_WIDE_CHAR: {
+                const wchar_t wide[2] = {(wchar_t)va_arg(*args, wint_t), L'\0'};
+                ok                    = putWideString(encoder, wide, UINT32_MAX);
+                break;
+            }
+            case X_LOG_ARG_POINTER:
+                ok = putSlot(encoder, (u64)(uintptr_t)va_arg(*args, void*));
+                break;
+            case X_LOG_ARG_COUNT_OUT:
+                (void)va_arg(*args, void*);
+                break;
+        }
+        if (!ok) { return false; }
+    }
+    return true;
+}
+
+/* ============================================================================
+ * FORMATTING
+ * ============================================================================ */
+
+typedef struct {
+    char* data;
+    u32 size;
+    u32 capacity;  // one byte is always kept for the newline
+} xLogLine;
+
+static void appendText(xLogLine* line, const char* text, u32 length) {
+    length = X_MIN(length, line->capacity - 1 - line->size);
+    memcpy(line->data + line->size, text, length);
+    line->size += length;
+}
+
+static void appendFormatted(xLogLine* line, const char* spec, ...) X_LOG_PRINTF(2, 3);
+
+static void appendFormatted(xLogLine* line, const char* spec, ...) {
+    const u32 room = line->capacity - line->size;
+    va_list args;
+    va_start(args, spec);
+    const int written = vsnprintf(line->data + line->size, room, spec, args);
+    va_end(args);
+    if (written > 0) { line->size += X_MIN((u32)written, room - 1); }
+}
+
+typedef struct {
+    const u8* cursor;
+    const u8* end;
+} xLogDecoder;
+
+static bool takeSlot(xLogDecoder* decoder, u64* out) {
+    if (decoder->cursor + sizeof(u64) > decoder->end) { return false; }
+    memcpy(out, decoder->cursor, sizeof(u64));
+    decoder->cursor += sizeof(u64);
+    return true;
+}
+
+/* Rebuild `spec` with resolved '*' values and a canonical length: ll for integers, none for doubles */
+static void buildSpec(char* out, u32 capacity, const xLogSpec* spec, s64 width, bool has_width, const char* length) {
+    u32 n    = 0;
+    out[n++] = '%';
+    for (u32 i = 0; i < spec->flag_count && n < capacity - 40; ++i) {
+        out[n++] = spec->flags[i];
+    }
+    if (has_width) {
+        if (width < 0) { out[n++] = '-'; }
+        n += (u32)snprintf(out + n, capacity - n, "%lld", (long long)X_ABS(width));
+    }
+    if (spec->has_precision) {
+        out[n++] = '.';
+        out[n++] = '*';
+    }
+    n += (u32)snprintf(out + n, capacity - n, "%s%c", length, spec->conversion);
+}
+
+static void formatArgs(xLogLine* line, const xLogRecord* record) {
+    xLogDecoder decoder = {(const u8*)(record + 1), (const u8*)(record + 1) + record->arg_bytes};
+
+    const char* p = record->format;
+    while (*p != '\0') {
+        const char* percent = strchr(p, '%');
+        if (percent == NULL) {
+            appendText(line, p, (u32)strlen(p));
+            return;
+        }
+        appendText(line, p, (u32)(percent - p));
+        if (percent[1] == '%') {
+            appendText(line, "%", 1);
+            p = percent + 2;
+            continue;
+        }
+
+        xLogSpec spec;
+        const char* next = parseSpec(percent + 1, &spec);
+        if (next == NULL) {
+            appendText(line, percent, (u32)strlen(percent));
+            return;
+        }
+        p = next;
+
+        u64 width     = 0;
+        u64 precision = 0;
+        if (spec.width_star && !takeSlot(&decoder, &width)) { break; }
+        if (spec.precision_star && !takeSlot(&decoder, &precision)) { break; }
+        if (!spec.width_star && spec.width_length > 0) { width = (u64)strtoll(spec.width, NULL, 10); }
+        if (!spec.precision_star && spec.has_precision) { precision = (u64)strtoll(spec.precision, NULL, 10); }
+
+        // -1 when there is no precision; a negative '*' precision means none too
+        const bool has_width = spec.width_star || spec.width_length > 0;
+        const int shown      = !spec.has_precision || (s64)precision < 0 ? -1 : (int)X_MIN(precision, (u64)INT32_MAX);
+
+        char rebuilt[64];
+        u64 value = 0;
+        switch (spec.arg) {
+            case X_LOG_ARG_SIGNED:
+            case X_LOG_ARG_UNSIGNED: {
+                if (!takeSlot(&decoder, &value)) { goto truncated; }
+                const bool is_char = spec.conversion == 'c';
+                spec.has_precision = spec.has_precision && !is_char;
+                buildSpec(rebuilt, sizeof(rebuilt), &spec, (s64)width, has_width, is_char ? "" : "ll");
+                if (is_char) {
+                    appendFormatted(line, rebuilt, (int)value);
+                } else if (spec.has_precision) {
+                    appendFormatted(line, rebuilt, shown, (long long)value);
+                } else {
+                    appendFormatted(line, rebuilt, (long long)value);
+                }
+                break;
+            }
+            case X_LOG_ARG_DOUBLE: {
+                if (!takeSlot(&decoder, &value)) { goto truncated; }
+                f64 number;
+                memcpy(&number, &value, sizeof(number));
+                buildSpec(rebuilt, sizeof(rebuilt), &spec, (s64)width, has_width, "");
+                if (spec.has_precision) {
+                    appendFormatted(line, rebuilt, shown, number);
+                } else {
+                    appendFormatted(line, rebuilt, number);
+                }
+                break;
+            }
+            case X_LOG_ARG_STRING:
+            case X_LOG_ARG_WIDE_STRING:
+            case X_LOG_ARG_WIDE_CHAR: {
+                if (!takeSlot(&decoder, &value)) { goto truncated; }
+                const u32 stored = (u32)X_MIN(value, (u64)(decoder.end - decoder.cursor));
+                const bool whole = shown < 0 || spec.arg == X_LOG_ARG_WIDE_CHAR;
+                const int length = whole ? (int)stored : (int)X_MIN((u32)shown, stored);
+
+                // Always printed as a narrow '%.*s': the stored bytes carry no terminator
+                xLogSpec string_spec      = spec;
+                string_spec.has_precision = true;
+                string_spec.conversion    = 's';
+                buildSpec(rebuilt, sizeof(rebuilt), &string_spec, (s64)width, has_width, "");
+                appendFormatted(line, rebuilt, length, (const char*)decoder.cursor);
+                decoder.cursor += X_ALIGN_UP(stored, 8u);
+                break;
+            }
+            case X_LOG_ARG_POINTER:
+                if (!takeSlot(&decoder, &value)) { goto truncated; }
+                buildSpec(rebuilt, sizeof(rebuilt), &spec, (s64)width, has_width, "");
+                appendFormatted(line, rebuilt, (void*)(uintptr_t)value);
+                break;
+            case X_LOG_ARG_COUNT_OUT:
+                break;
+        }
+    }
+    return;
+
+truncated:
+    appendText(line, " <truncated>", 12);
+}
+
+/* ============================================================================
+ * WRITING (gLog.lock held)
+ * ============================================================================ */
+
+static FILE* sink(void) {
+    return gLog.file != NULL ? gLog.file : stderr;
+}
+
+static void flushBatch(void) {
+    if (gLog.batch_size > 0) { fwrite(gLog.batch, 1, gLog.batch_size, sink()); }
+    fflush(sink());
+    gLog.batch_size = 0;
+}
+
+static xLogLine beginLine(void) {
+    if (gLog.batch_size + X_LOG_MAX_LINE > X_LOG_BATCH_SIZE) {
+        fwrite(gLog.batch, 1, gLog.batch_size, sink());
+        gLog.batch_size = 0;
+    }
+    return (xLogLine) {gLog.batch + gLog.batch_size, 0, X_LOG_MAX_LINE};
+}
+
+static void endLine(xLogLine* line) {
+    line->data[line->size++] = '\n';
+    gLog.batch_size += line->size;
+}
+
+static void emitRecord(const xLogRecord* record) {
+    xLogLine line = beginLine();
+    appendFormatted(&line, "[%11.6f] [%-5s] ", (f64)record->timestamp * 1e-9, kLevelNames[record->level]);
+    if (record->thread != X_LOG_NO_THREAD) {
+        appendFormatted(&line, "T%u %s:%u: ", record->thread, record->file, record->line);
+    } else {
+        appendFormatted(&line, "T? %s:%u: ", record->file, record->line);
+    }
+    formatArgs(&line, record);
+    endLine(&line);
+}
+
+/* Next real record in `ring`, stepping over (and releasing) padding */
+static const xLogRecord* peekRecord(xLogRing* ring, u32* tail, u32 head) {
+    while (*tail != head) {
+        const xLogRecord* record = (const xLogRecord*)(ring->data + (*tail & X_LOG_RING_MASK));
+        if (record->level != X_LOG_LEVEL_COUNT) { return record; }
+        *tail += record->size;
+        atomic_store_explicit(&ring->tail, *tail, memory_order_release);
+    }
+    return NULL;
+}
+
+/* Write out everything published so far, merged across threads in timestamp order */
+static void drainLocked(void) {
+    xLogRing* rings[X_LOG_MAX_THREADS];
+    u32 heads[X_LOG_MAX_THREADS];
+    u32 tails[X_LOG_MAX_THREADS];
+
+    const u32 count = ringCount();
+    for (u32 i = 0; i < count; ++i) {
+        rings[i] = atomic_load_explicit(&gLog.rings[i], memory_order_acquire);
+        heads[i] = rings[i] != NULL ? atomic_load_explicit(&rings[i]->head, memory_order_acquire) : 0;
+        tails[i] = rings[i] != NULL ? atomic_load_explicit(&rings[i]->tail, memory_order_relaxed) : 0;
+    }
+
+    for (;;) {
+        const xLogRecord* oldest = NULL;
+        u32 oldest_ring          = 0;
+        for (u32 i = 0; i < count; ++i) {
+            if (rings[i] == NULL) { continue; }
+            const xLogRecord* record = peekRecord(rings[i], &tails[i], heads[i]);
+            if (record != NULL && (oldest == NULL || record->timestamp < oldest->timestamp)) {
+                oldest      = record;
+                oldest_ring = i;
+            }
+        }
+        if (oldest == NULL) { break; }
+
+        emitRecord(oldest);
+        tails[oldest_ring] += oldest->size;
+        atomic_store_explicit(&rings[oldest_ring]->tail, tails[oldest_ring], memory_order_release);
+    }
+
+    for (u32 i = 0; i < count; ++i) {
+        if (rings[i] == NULL) { continue; }
+        const u32 dropped = atomic_load_explicit(&rings[i]->dropped, memory_order_relaxed);
+        if (dropped == rings[i]->reported) { continue; }
+
+        xLogLine line = beginLine();
+        appendFormatted(&line, "[logger] T%u dropped %u records (ring full)", i, dropped - rings[i]->reported);
+        endLine(&line);
+        rings[i]->reported = dropped;
+    }
+
+    flushBatch();
+}
+
+/* ============================================================================
+ * WRITER THREAD
+ * ============================================================================ */
+
+static int writerMain(void* arg) {
+    X_UNUSED(arg);
+    mtx_lock(&gLog.lock);
+    while (!atomic_load_explicit(&gLog.stop, memory_order_acquire)) {
+        drainLocked();
+
+        struct timespec deadline;
+        timespec_get(&deadline, TIME_UTC);
+        deadline.tv_nsec += X_LOG_FLUSH_INTERVAL_MS * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec += 1;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        cnd_timedwait(&gLog.wake, &gLog.lock, &deadline);
+    }
+    drainLocked();
+    mtx_unlock(&gLog.lock);
+    return 0;
+}
+
+bool xLogStart(const char* path) {
+    call_once(&sLogOnce, initLogger);
+    if (atomic_load_explicit(&gLog.running, memory_order_acquire)) {
+        X_PRINT_ERROR("Log writer is already running");
+        return false;
+    }
+
+    FILE* file = NULL;
+    if (path != NULL) {
+        file = fopen(path, "a");
+        if (file == NULL) {
+            X_PRINT_ERROR("Failed to open log file '%s'", path);
+            return false;
+        }
+    }
+
+    mtx_lock(&gLog.lock);
+    drainLocked();
+    gLog.file = file;
+    mtx_unlock(&gLog.lock);
+
+    atomic_store_explicit(&gLog.stop, false, memory_order_release);
+    if (thrd_create(&gLog.writer, writerMain, NULL) != thrd_success) {
+        mtx_lock(&gLog.lock);
+        gLog.file = NULL;
+        mtx_unlock(&gLog.lock);
+        if (file != NULL) { fclose(file); }
+        X_PRINT_ERROR("Failed to start log writer thread");
+        return false;
+    }
+    atomic_store_explicit(&gLog.running, true, memory_order_release);
+    return true;
+}
+
+void xLogStop(void) {
+    if (!atomic_exchange_explicit(&gLog.running, false, memory_order_acq_rel)) { return; }
+
+    // Records published before this point are written by the writer's final drain or the one below
+    atomic_store_explicit(&gLog.stop, true, memory_order_release);
+    cnd_signal(&gLog.wake);
+    thrd_join(gLog.writer, NULL);
+
+    mtx_lock(&gLog.lock);
+    drainLocked();
+    if (gLog.file != NULL) {
+        fclose(gLog.file);
+        gLog.file = NULL;
+    }
+    mtx_unlock(&gLog.lock);
+}
+
+void xLogFlush(void) {
+    call_once(&sLogOnce, initLogger);
+    mtx_lock(&gLog.lock);
+    drainLocked();
+    mtx_unlock(&gLog.lock);
+}
+
+/* ============================================================================
+ * LOGGING
+ * ============================================================================ */
+
+void xLogSetLevel(xLogLevel level) {
+    atomic_store_explicit(&gLog.level, (int)level, memory_order_relaxed);
+}
+
+xLogLevel xLogGetLevel(void) {
+    return (xLogLevel)atomic_load_explicit(&gLog.level, memory_order_relaxed);
+}
+
+u64 xLogDropped(void) {
+    u64 dropped     = 0;
+    const u32 count = ringCount();
+    for (u32 i = 0; i < count; ++i) {
+        const xLogRing* ring = atomic_load_explicit(&gLog.rings[i], memory_order_acquire);
+        if (ring != NULL) { dropped += atomic_load_explicit(&ring->dropped, memory_order_relaxed); }
+    }
+    return dropped;
+}
+
+static bool ringPush(xLogRing* ring, const xLogRecord* record, bool* crossed_half) {
+    const u32 head   = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    const u32 tail   = atomic_load_explicit(&ring->tail, memory_order_acquire);
+    const u32 offset = head & X_LOG_RING_MASK;
+
+    // Records never wrap: the rest of the ring becomes padding when one does not fit before the end
+    const u32 padding = offset + record->size > X_LOG_RING_SIZE ? X_LOG_RING_SIZE - offset : 0;
+    const u32 used    = head - tail;
+    if (used + padding + record->size > X_LOG_RING_SIZE) { return false; }
+
+    if (padding > 0) {
+        xLogRecord* pad = (xLogRecord*)(ring->data + offset);
+        pad->size       = padding;
+        pad->level      = X_LOG_LEVEL_COUNT;
+    }
+    memcpy(ring->data + ((head + padding) & X_LOG_RING_MASK), record, record->size);
+    atomic_store_explicit(&ring->head, head + padding + record->size, memory_order_release);
+
+    *crossed_half = used < X_LOG_RING_SIZE / 2 && used + padding + record->size >= X_LOG_RING_SIZE / 2;
+    return true;
+}
+
+static void logRecord(xLogLevel level, const char* file, u32 line, const char* format, va_list* args) {
+    call_once(&sLogOnce, initLogger);
+
+    _Alignas(16) u8 storage[X_LOG_MAX_RECORD];
+    xLogRecord* record  = (xLogRecord*)storage;
+    xLogEncoder encoder = {storage + sizeof(xLogRecord), 0, X_LOG_MAX_RECORD - (u32)sizeof(xLogRecord)};
+    encodeArgs(&encoder, format, args);
+
+    xLogRing* ring    = threadRing();
+    record->size      = (u32)sizeof(xLogRecord) + X_ALIGN_UP(encoder.size, 8u);
+    record->level     = (u16)level;
+    record->thread    = ring != NULL ? (u16)ring->id : X_LOG_NO_THREAD;
+    record->line      = line;
+    record->arg_bytes = encoder.size;
+    record->timestamp = monotonicNs() - gLog.base_ns;
+    record->format    = format;
+    record->file      = file;
+
+    // Threads past X_LOG_MAX_THREADS write their own records
+    if (ring == NULL) {
+        mtx_lock(&gLog.lock);
+        drainLocked();
+        emitRecord(record);
+        flushBatch();
+        mtx_unlock(&gLog.lock);
+        return;
+    }
+
+    bool crossed_half = false;
+    if (!ringPush(ring, record, &crossed_half)) {
+        if (level < X_LOG_LEVEL_FATAL) {
+            atomic_fetch_add_explicit(&ring->dropped, 1, memory_order_relaxed);
+            return;
+        }
+
+        // Fatal records are never dropped: make room by draining on this thread
+        xLogFlush();
+        ringPush(ring, record, &crossed_half);
+    }
+
+    if (!atomic_load_explicit(&gLog.running, memory_order_acquire)) {
+        xLogFlush();
+    } else if (crossed_half || level >= X_LOG_LEVEL_ERROR) {
+        cnd_signal(&gLog.wake);
+    }
+}
+
+void xLogWrite(xLogLevel level, const char* file, u32 line, const char* format, ...) {
+    if ((int)level < atomic_load_explicit(&gLog.level, memory_order_relaxed)) { return; }
+
+    va_list args;
+    va_start(args, format);
+    logRecord(level, file, line, format, &args);
+    va_end(args);
+}
+
+void xLogPanic(const char* file, u32 line, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    logRecord(X_LOG_LEVEL_FATAL, file, line, format, &args);
+    va_end(args);
+
+    // Whatever other threads logged before the failure goes out too
+    xLogFlush();
+    abort();
+}
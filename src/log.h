@@ -0,0 +1,96 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "typedefs.h"
+
+/*
+ * Asynchronous logger behind X_PRINT_ERROR, X_DEBUG_PRINT, X_CHECK and
+ * X_ASSERT. A logging thread never formats: it appends a binary record (format
+ * pointer, raw arguments, timestamp, thread, level) to its own single-producer
+ * ring and returns. The writer thread started by xLogStart merges the rings in
+ * timestamp order, formats the records and writes them out in batches. Until
+ * xLogStart, and after xLogStop, every record is written by the thread that
+ * logged it before the call returns, exactly like the fprintf it replaces.
+ *
+ * Format strings and file names are stored by pointer, so they must be string
+ * literals (or otherwise outlive the logger). %s arguments are copied into the
+ * record; %ls and %lc are converted to the current locale's multibyte encoding
+ * first, with '?' for characters it cannot represent. %n is ignored. A full
+ * ring drops the record and counts it rather than block the caller.
+ *
+ * A thread's ring goes back to a free list when the thread exits and is reused
+ * by the next thread to log, so T<n> in the output names a ring slot.
+ */
+
+typedef enum {
+    X_LOG_LEVEL_DEBUG,
+    X_LOG_LEVEL_INFO,
+    X_LOG_LEVEL_WARN,
+    X_LOG_LEVEL_ERROR,
+    X_LOG_LEVEL_FATAL,
+    X_LOG_LEVEL_COUNT,
+} xLogLevel;
+
+/* Records below this level compile to nothing (XENC_LOG_LEVEL in CMake) */
+#ifndef X_LOG_COMPILE_LEVEL
+    #ifdef NDEBUG
+        #define X_LOG_COMPILE_LEVEL X_LOG_LEVEL_INFO
+    #else
+        #define X_LOG_COMPILE_LEVEL X_LOG_LEVEL_DEBUG
+    #endif
+#endif
+
+/* Bytes per thread ring. Must be a power of 2. */
+#define X_LOG_RING_SIZE 65536
+
+/* Threads logging at the same time; any beyond this write their records synchronously */
+#define X_LOG_MAX_THREADS 64
+
+/* Largest encoded record; longer %s arguments are truncated to fit */
+#define X_LOG_MAX_RECORD 1024
+
+/* Longest formatted line, prefix included */
+#define X_LOG_MAX_LINE 2048
+
+/* The writer thread wakes at least this often, and whenever a ring passes half full */
+#define X_LOG_FLUSH_INTERVAL_MS 10
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define X_LOG_PRINTF(fmt_index, first_arg) __attribute__((format(printf, fmt_index, first_arg)))
+    #define X_LOG_NORETURN __attribute__((noreturn))
+#else
+    #define X_LOG_PRINTF(fmt_index, first_arg)
+    #define X_LOG_NORETURN
+#endif
+
+/* Start the writer thread, appending to `path` or writing to stderr when it is NULL */
+bool xLogStart(const char* path);
+
+/* Write everything still queued and join the writer thread */
+void xLogStop(void);
+
+/* Records below `level` are discarded when logged. Defaults to X_LOG_COMPILE_LEVEL. */
+void xLogSetLevel(xLogLevel level);
+xLogLevel xLogGetLevel(void);
+
+/* Format and write every queued record from every thread before returning */
+void xLogFlush(void);
+
+/* Records lost to full rings since startup */
+u64 xLogDropped(void);
+
+void xLogWrite(xLogLevel level, const char* file, u32 line, const char* format, ...) X_LOG_PRINTF(4, 5);
+
+/* Log at X_LOG_LEVEL_FATAL, flush every thread's records and abort() */
+X_LOG_NORETURN void xLogPanic(const char* file, u32 line, const char* format, ...) X_LOG_PRINTF(3, 4);
+
+#define X_LOG(level, fmt, ...)                                                                                         \
+    ((level) >= X_LOG_COMPILE_LEVEL ? xLogWrite((level), __FILE__, __LINE__, fmt, ##__VA_ARGS__) : (void)0)
+
+#define X_LOG_DEBUG(fmt, ...) X_LOG(X_LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#define X_LOG_INFO(fmt, ...) X_LOG(X_LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#define X_LOG_WARN(fmt, ...) X_LOG(X_LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#define X_LOG_ERROR(fmt, ...) X_LOG(X_LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
@@ -11,6 +11,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+#include "log.h"
+
 /*
  * macros.h - Graphics and Game Development Utility Macros (C11)
  *
@@ -135,14 +137,20 @@
  * MEMORY MANAGEMENT MACROS (SAFETY FOCUSED)
  * ============================================================================ */
 
+/*
+ * X_MEM_ALLOC / X_MEM_CALLOC / X_MEM_REALLOC / X_MEM_FREE come from memory.h:
+ * plain libc unless the build enables X_MEMORY_TRACKING. Everything below goes
+ * through them, so memory from these macros must only be released with X_FREE.
+ */
+
 /* Safe malloc with type */
-#define X_MALLOC(type, count) ((type*)malloc(sizeof(type) * (count)))
+#define X_MALLOC(type, count) ((type*)X_MEM_ALLOC(sizeof(type) * (count)))
 
 /* Safe calloc with type (zeroed memory) */
-#define X_CALLOC(type, count) ((type*)calloc((count), sizeof(type)))
+#define X_CALLOC(type, count) ((type*)X_MEM_CALLOC((count), sizeof(type)))
 
 /* Safe realloc with type */
-#define X_REALLOC(ptr, type, count) ((type*)realloc((ptr), sizeof(type) * (count)))
+#define X_REALLOC(ptr, type, count) ((type*)X_MEM_REALLOC((ptr), sizeof(type) * (count)))
 
 /* Allocate single object */
 #define X_NEW(type) X_CALLOC(type, 1)
@@ -150,7 +158,7 @@
 /* Safe free that nullifies pointer */
 #define X_FREE(ptr)                                                                                                    \
     do {                                                                                                               \
-        free(ptr);                                                                                                     \
+        X_MEM_FREE(ptr);                                                                                               \
         (ptr) = NULL;                                                                                                  \
     } while (0)
 
@@ -158,7 +166,7 @@
 #define X_DELETE(ptr)                                                                                                  \
     do {                                                                                                               \
         if ((ptr) != NULL) {                                                                                           \
-            free(ptr);                                                                                                 \
+            X_MEM_FREE(ptr);                                                                                           \
             (ptr) = NULL;                                                                                              \
         }                                                                                                              \
     } while (0)
@@ -182,7 +190,7 @@
 /* Duplicate memory */
 #define X_MEMDUP(src, size)                                                                                            \
     ({                                                                                                                 \
-        void* _new = malloc(size);                                                                                     \
+        void* _new = X_MEM_ALLOC(size);                                                                                \
         if (_new != NULL) memcpy(_new, (src), (size));                                                                 \
         _new;                                                                                                          \
     })
@@ -201,7 +209,8 @@
 
 /* Color manipulation (RGBA) */
 #define X_COLOR_RGBA(r, g, b, a)                                                                                       \
-    ((uint32_t)(((uint8_t)(r)) | ((uint8_t)(g) << 8) | ((uint8_t)(b) << 16) | ((uint8_t)(a) << 24)))
+    ((uint32_t)(uint8_t)(r) | ((uint32_t)(uint8_t)(g) << 8) | ((uint32_t)(uint8_t)(b) << 16) |                         \
+     ((uint32_t)(uint8_t)(a) << 24))
 
 #define X_COLOR_RGB(r, g, b) X_COLOR_RGBA(r, g, b, 255)
 
@@ -274,7 +283,7 @@
         char* _dup     = NULL;                                                                                         \
         if (_s != NULL) {                                                                                              \
             size_t _len = strlen(_s) + 1;                                                                              \
-            _dup        = (char*)malloc(_len);                                                                         \
+            _dup        = (char*)X_MEM_ALLOC(_len);                                                                    \
             if (_dup != NULL) memcpy(_dup, _s, _len);                                                                  \
         }                                                                                                              \
         _dup;                                                                                                          \
@@ -297,23 +306,18 @@
  * DEBUG & LOGGING MACROS
  * ============================================================================ */
 
+/* Routed through the asynchronous logger (log.h); failed checks flush every thread's records before aborting */
 #ifndef NDEBUG
-    #define X_DEBUG_PRINT(fmt, ...) fprintf(stderr, "[DEBUG] %s:%d: " fmt "\n", __FILE__, __LINE__, ##__VA_ARGS__)
+    #define X_DEBUG_PRINT(fmt, ...) X_LOG(X_LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
 
     #define X_ASSERT(cond)                                                                                             \
         do {                                                                                                           \
-            if (X_UNLIKELY(!(cond))) {                                                                                 \
-                fprintf(stderr, "Assertion failed: %s, file %s, line %d\n", #cond, __FILE__, __LINE__);                \
-                abort();                                                                                               \
-            }                                                                                                          \
+            if (X_UNLIKELY(!(cond))) { xLogPanic(__FILE__, __LINE__, "Assertion failed: %s", #cond); }                 \
         } while (0)
 
     #define X_ASSERT_MSG(cond, msg)                                                                                    \
         do {                                                                                                           \
-            if (X_UNLIKELY(!(cond))) {                                                                                 \
-                fprintf(stderr, "Assertion failed: %s (%s), file %s, line %d\n", #cond, msg, __FILE__, __LINE__);      \
-                abort();                                                                                               \
-            }                                                                                                          \
+            if (X_UNLIKELY(!(cond))) { xLogPanic(__FILE__, __LINE__, "Assertion failed: %s (%s)", #cond, msg); }       \
         } while (0)
 #else
     #define X_DEBUG_PRINT(fmt, ...) ((void)0)
@@ -321,26 +325,19 @@
     #define X_ASSERT_MSG(cond, msg) ((void)0)
 #endif
 
-#define X_PRINT_ERROR(fmt, ...) fprintf(stderr, "[ERROR] %s:%d: " fmt "\n", __FILE__, __LINE__, ##__VA_ARGS__)
+#define X_PRINT_ERROR(fmt, ...) X_LOG(X_LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
 
 /* Runtime error checking (always active) */
 #define X_CHECK(cond)                                                                                                  \
     do {                                                                                                               \
-        if (X_UNLIKELY(!(cond))) {                                                                                     \
-            fprintf(stderr, "Check failed: %s, file %s, line %d\n", #cond, __FILE__, __LINE__);                        \
-            abort();                                                                                                   \
-        }                                                                                                              \
+        if (X_UNLIKELY(!(cond))) { xLogPanic(__FILE__, __LINE__, "Check failed: %s", #cond); }                         \
     } while (0)
 
 #define X_CHECK_MSG(cond, msg)                                                                                         \
     do {                                                                                                               \
-        if (X_UNLIKELY(!(cond))) {                                                                                     \
-            fprintf(stderr, "Check failed: %s (%s), file %s, line %d\n", #cond, msg, __FILE__, __LINE__);              \
-            abort();                                                                                                   \
-        }                                                                                                              \
+        if (X_UNLIKELY(!(cond))) { xLogPanic(__FILE__, __LINE__, "Check failed: %s (%s)", #cond, msg); }               \
     } while (0)
 
-/* Verify allocation succeeded */
 #define X_CHECK_ALLOC(ptr) X_CHECK_MSG((ptr) != NULL, "Memory allocation failed")
 
 /* ============================================================================
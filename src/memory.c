@@ -0,0 +1,378 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "memory.h"
+
+#if X_MEMORY_TRACKING
+
+    #include <stdatomic.h>
+
+    #define X_MEM_HEADER_MAGIC 0xA11Cu
+    #define X_MEM_FREED_MAGIC 0xDEADu
+
+/* Sits in front of every tracked block; 16 bytes so the user pointer keeps malloc's alignment */
+typedef struct {
+    u64 size;
+    u32 callsite;
+    u16 tag;
+    u16 magic;
+} xMemHeader;
+
+X_STATIC_ASSERT(sizeof(xMemHeader) == 16, "xMemHeader must preserve 16-byte alignment");
+
+/*
+ * Written only by the owning thread (relaxed load + store, no read-modify-write)
+ * and summed by readers. Threads past X_MEM_MAX_THREADS share gMem.shared, which
+ * uses atomic adds instead.
+ */
+typedef struct {
+    atomic_ullong allocs[X_MEM_TAG_COUNT];
+    atomic_ullong bytes[X_MEM_TAG_COUNT];
+} xMemThreadCounters;
+
+/* Live bytes need one global value per tag so the high-water mark is exact */
+typedef struct {
+    _Alignas(64) atomic_llong live_bytes;
+    atomic_llong live_count;
+    atomic_ullong peak_bytes;
+} xMemTagLive;
+
+typedef struct {
+    atomic_ullong key;  // 0 while empty
+    atomic_bool ready;  // file/line/tag are published
+    const char* file;
+    u32 line;
+    xMemTag tag;
+    atomic_llong live_bytes;
+    atomic_llong live_count;
+} xMemCallsite;
+
+static void* libcAlloc(void* user, size_t size) {
+    X_UNUSED(user);
+    return malloc(size);
+}
+
+static void* libcRealloc(void* user, void* ptr, size_t size) {
+    X_UNUSED(user);
+    return realloc(ptr, size);
+}
+
+static void libcFree(void* user, void* ptr) {
+    X_UNUSED(user);
+    free(ptr);
+}
+
+static const xAllocator kLibcAllocator = {libcAlloc, libcRealloc, libcFree, NULL};
+
+static const char* kTagNames[X_MEM_TAG_COUNT] = {
+  "general",
+  "arena",
+  "containers",
+  "renderer",
+  "assets",
+  "jobs",
+  "ecs",
+  "spatial",
+  "platform",
+  "profiler",
+  "particles",
+  "transform",
+};
+
+static struct {
+    xAllocator allocator;
+    xMemTagLive live[X_MEM_TAG_COUNT];
+    _Atomic(xMemThreadCounters*) threads[X_MEM_MAX_THREADS];
+    atomic_uint thread_count;
+    xMemThreadCounters shared;
+    xMemCallsite callsites[X_MEM_MAX_CALLSITES];
+    u64 frame_allocs[X_MEM_TAG_COUNT];  // totals at the last xMemFrameMark, main thread only
+    u64 frame_bytes[X_MEM_TAG_COUNT];
+    u64 last_frame_allocs[X_MEM_TAG_COUNT];
+    u64 last_frame_bytes[X_MEM_TAG_COUNT];
+} gMem = {.allocator = {libcAlloc, libcRealloc, libcFree, NULL}};
+
+static _Thread_local xMemThreadCounters* tCounters = NULL;
+
+/* ============================================================================
+ * COUNTERS
+ * ============================================================================ */
+
+static xMemThreadCounters* threadCounters(void) {
+    if (X_LIKELY(tCounters != NULL)) { return tCounters; }
+
+    const u32 index = atomic_fetch_add_explicit(&gMem.thread_count, 1, memory_order_relaxed);
+    if (index >= X_MEM_MAX_THREADS) {
+        tCounters = &gMem.shared;
+        return tCounters;
+    }
+
+    // Straight from libc and never freed: the block outlives its thread so its totals stay in the sums
+    xMemThreadCounters* counters = (xMemThreadCounters*)calloc(1, sizeof(xMemThreadCounters));
+    if (counters == NULL) { counters = &gMem.shared; }
+    atomic_store_explicit(&gMem.threads[index], counters, memory_order_release);
+    tCounters = counters;
+    return counters;
+}
+
+static void bump(atomic_ullong* counter, u64 amount, bool shared) {
+    if (shared) {
+        atomic_fetch_add_explicit(counter, amount, memory_order_relaxed);
+    } else {
+        const u64 value = atomic_load_explicit(counter, memory_order_relaxed);
+        atomic_store_explicit(counter, value + amount, memory_order_relaxed);
+    }
+}
+
+static void sumCounters(xMemTag tag, u64* allocs, u64* bytes) {
+    const u32 count = X_MIN(atomic_load_explicit(&gMem.thread_count, memory_order_acquire), (u32)X_MEM_MAX_THREADS);
+    *allocs         = atomic_load_explicit(&gMem.shared.allocs[tag], memory_order_relaxed);
+    *bytes          = atomic_load_explicit(&gMem.shared.bytes[tag], memory_order_relaxed);
+    for (u32 i = 0; i < count; ++i) {
+        const xMemThreadCounters* counters = atomic_load_explicit(&gMem.threads[i], memory_order_acquire);
+        if (counters == NULL || counters == &gMem.shared) { continue; }
+        *allocs += atomic_load_explicit(&counters->allocs[tag], memory_order_relaxed);
+        *bytes += atomic_load_explicit(&counters->bytes[tag], memory_order_relaxed);
+    }
+}
+
+/* ============================================================================
+ * CALL SITES
+ * ============================================================================ */
+
+/* Slot 0 collects everything once the table is full */
+static u32 findCallsite(const char* file, u32 line, xMemTag tag) {
+    u64 key = ((u64)(uptr)file * 0x9E3779B97F4A7C15ull) ^ ((u64)line * 0xC2B2AE3D27D4EB4Full);
+    key     = (key ^ (key >> 29)) | 1;
+
+    u32 index = (u32)(key >> 32) & (X_MEM_MAX_CALLSITES - 1);
+    for (u32 probe = 0; probe < X_MEM_MAX_CALLSITES; ++probe, index = (index + 1) & (X_MEM_MAX_CALLSITES - 1)) {
+        if (index == 0) { continue; }
+        xMemCallsite* site = &gMem.callsites[index];
+        u64 current        = atomic_load_explicit(&site->key, memory_order_acquire);
+        if (current == key) { return index; }
+        if (current != 0) { continue; }
+
+        if (atomic_compare_exchange_strong_explicit(&site->key,
+                                                    &current,
+                                                    key,
+                                                    memory_order_acq_rel,
+                                                    memory_order_acquire)) {
+            site->file = file;
+            site->line = line;
+            site->tag  = tag;
+            atomic_store_explicit(&site->ready, true, memory_order_release);
+            return index;
+        }
+        if (current == key) { return index; }
+    }
+    return 0;
+}
+
+/* ============================================================================
+ * ACCOUNTING
+ * ============================================================================ */
+
+static void recordAlloc(xMemHeader* header, size_t size, xMemTag tag, const char* file, u32 line) {
+    X_ASSERT_MSG((u32)tag < X_MEM_TAG_COUNT, "Invalid memory tag");
+    header->size     = size;
+    header->tag      = (u16)tag;
+    header->magic    = X_MEM_HEADER_MAGIC;
+    header->callsite = findCallsite(file, line, tag);
+
+    xMemThreadCounters* counters = threadCounters();
+    const bool shared            = counters == &gMem.shared;
+    bump(&counters->allocs[tag], 1, shared);
+    bump(&counters->bytes[tag], size, shared);
+
+    xMemTagLive* live = &gMem.live[tag];
+    const s64 now     = atomic_fetch_add_explicit(&live->live_bytes, (s64)size, memory_order_relaxed) + (s64)size;
+    atomic_fetch_add_explicit(&live->live_count, 1, memory_order_relaxed);
+    u64 peak = atomic_load_explicit(&live->peak_bytes, memory_order_relaxed);
+    while (now > 0 && (u64)now > peak &&
+           !atomic_compare_exchange_weak_explicit(&live->peak_bytes,
+                                                  &peak,
+                                                  (u64)now,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {}
+
+    xMemCallsite* site = &gMem.callsites[header->callsite];
+    atomic_fetch_add_explicit(&site->live_bytes, (s64)size, memory_order_relaxed);
+    atomic_fetch_add_explicit(&site->live_count, 1, memory_order_relaxed);
+}
+
+static void recordFree(const xMemHeader* header) {
+    xMemTagLive* live = &gMem.live[header->tag];
+    atomic_fetch_sub_explicit(&live->live_bytes, (s64)header->size, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&live->live_count, 1, memory_order_relaxed);
+
+    xMemCallsite* site = &gMem.callsites[header->callsite];
+    atomic_fetch_sub_explicit(&site->live_bytes, (s64)header->size, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&site->live_count, 1, memory_order_relaxed);
+}
+
+static xMemHeader* headerOf(void* ptr) {
+    xMemHeader* header = (xMemHeader*)ptr - 1;
+    X_CHECK_MSG(header->magic != X_MEM_FREED_MAGIC, "Double free of a tracked allocation");
+    X_CHECK_MSG(header->magic == X_MEM_HEADER_MAGIC, "Freeing memory that was not allocated through X_MALLOC");
+    return header;
+}
+
+/* ============================================================================
+ * ALLOCATION
+ * ============================================================================ */
+
+void* xMemAlloc(size_t size, xMemTag tag, const char* file, u32 line) {
+    xMemHeader* header = (xMemHeader*)gMem.allocator.alloc(gMem.allocator.user, sizeof(xMemHeader) + size);
+    if (header == NULL) { return NULL; }
+    recordAlloc(header, size, tag, file, line);
+    return header + 1;
+}
+
+void* xMemCalloc(size_t count, size_t size, xMemTag tag, const char* file, u32 line) {
+    if (size != 0 && count > (SIZE_MAX - sizeof(xMemHeader)) / size) { return NULL; }
+    void* ptr = xMemAlloc(count * size, tag, file, line);
+    if (ptr != NULL) { memset(ptr, 0, count * size); }
+    return ptr;
+}
+
+void* xMemRealloc(void* ptr, size_t size, xMemTag tag, const char* file, u32 line) {
+    if (ptr == NULL) { return xMemAlloc(size, tag, file, line); }
+
+    // The block is charged to whoever resized it last
+    xMemHeader* old_header = headerOf(ptr);
+    const xMemHeader old   = *old_header;
+
+    const size_t bytes = sizeof(xMemHeader) + size;
+    xMemHeader* header = (xMemHeader*)gMem.allocator.realloc(gMem.allocator.user, old_header, bytes);
+    if (header == NULL) { return NULL; }
+
+    recordFree(&old);
+    recordAlloc(header, size, tag, file, line);
+    return header + 1;
+}
+
+void xMemFree(void* ptr) {
+    if (ptr == NULL) { return; }
+    xMemHeader* header = headerOf(ptr);
+    recordFree(header);
+    header->magic = X_MEM_FREED_MAGIC;
+    gMem.allocator.free(gMem.allocator.user, header);
+}
+
+bool xMemSetAllocator(const xAllocator* allocator) {
+    gMem.allocator = allocator != NULL ? *allocator : kLibcAllocator;
+    return true;
+}
+
+/* ============================================================================
+ * STATS
+ * ============================================================================ */
+
+void xMemFrameMark(void) {
+    for (u32 tag = 0; tag < X_MEM_TAG_COUNT; ++tag) {
+        u64 allocs, bytes;
+        sumCounters((xMemTag)tag, &allocs, &bytes);
+        gMem.last_frame_allocs[tag] = allocs - gMem.frame_allocs[tag];
+        gMem.last_frame_bytes[tag]  = bytes - gMem.frame_bytes[tag];
+        gMem.frame_allocs[tag]      = allocs;
+        gMem.frame_bytes[tag]       = bytes;
+    }
+}
+
+void xMemGetStats(xMemTag tag, xMemStats* out) {
+    const xMemTagLive* live = &gMem.live[tag];
+    const s64 live_bytes    = atomic_load_explicit(&live->live_bytes, memory_order_relaxed);
+    const s64 live_count    = atomic_load_explicit(&live->live_count, memory_order_relaxed);
+
+    out->live_bytes   = live_bytes > 0 ? (u64)live_bytes : 0;
+    out->live_count   = live_count > 0 ? (u64)live_count : 0;
+    out->peak_bytes   = atomic_load_explicit(&live->peak_bytes, memory_order_relaxed);
+    out->frame_allocs = gMem.last_frame_allocs[tag];
+    out->frame_bytes  = gMem.last_frame_bytes[tag];
+    sumCounters(tag, &out->total_allocs, &out->total_bytes);
+}
+
+const char* xMemTagName(xMemTag tag) {
+    return (u32)tag < X_MEM_TAG_COUNT ? kTagNames[tag] : "unknown";
+}
+
+void xMemReport(FILE* out) {
+    fprintf(out,
+            "%-12s %12s %12s %10s %12s %14s %10s %12s\n",
+            "tag",
+            "live KiB",
+            "peak KiB",
+            "live",
+            "allocs",
+            "total KiB",
+            "allocs/fr",
+            "KiB/frame");
+    for (u32 tag = 0; tag < X_MEM_TAG_COUNT; ++tag) {
+        xMemStats stats;
+        xMemGetStats((xMemTag)tag, &stats);
+        if (stats.total_allocs == 0) { continue; }
+        fprintf(out,
+                "%-12s %12.1f %12.1f %10llu %12llu %14.1f %10llu %12.1f\n",
+                kTagNames[tag],
+                (f64)stats.live_bytes / 1024.0,
+                (f64)stats.peak_bytes / 1024.0,
+                (unsigned long long)stats.live_count,
+                (unsigned long long)stats.total_allocs,
+                (f64)stats.total_bytes / 1024.0,
+                (unsigned long long)stats.frame_allocs,
+                (f64)stats.frame_bytes / 1024.0);
+    }
+}
+
+static int compareLiveBytes(const void* a, const void* b) {
+    const s64 lhs = atomic_load_explicit(&gMem.callsites[*(const u32*)a].live_bytes, memory_order_relaxed);
+    const s64 rhs = atomic_load_explicit(&gMem.callsites[*(const u32*)b].live_bytes, memory_order_relaxed);
+    return (lhs < rhs) - (lhs > rhs);
+}
+
+u64 xMemReportLeaks(FILE* out) {
+    static u32 order[X_MEM_MAX_CALLSITES];
+    u32 count = 0;
+    for (u32 i = 0; i < X_MEM_MAX_CALLSITES; ++i) {
+        if (atomic_load_explicit(&gMem.callsites[i].live_count, memory_order_relaxed) > 0) { order[count++] = i; }
+    }
+    if (count == 0) { return 0; }
+    qsort(order, count, sizeof(u32), compareLiveBytes);
+
+    u64 leaked_count = 0;
+    u64 leaked_bytes = 0;
+    fprintf(out, "[memory] live allocations at shutdown:\n");
+    for (u32 i = 0; i < count; ++i) {
+        xMemCallsite* site = &gMem.callsites[order[i]];
+        const s64 bytes    = atomic_load_explicit(&site->live_bytes, memory_order_relaxed);
+        const s64 allocs   = atomic_load_explicit(&site->live_count, memory_order_relaxed);
+        if (order[i] == 0 || !atomic_load_explicit(&site->ready, memory_order_acquire)) {
+            fprintf(out,
+                    "  %-48s %-10s %8lld x %12lld bytes\n",
+                    "(call site table full)",
+                    "",
+                    (long long)allocs,
+                    (long long)bytes);
+        } else {
+            fprintf(out,
+                    "  %s:%-*u %-10s %8lld x %12lld bytes\n",
+                    site->file,
+                    X_MAX(1, 47 - (int)strlen(site->file)),
+                    site->line,
+                    kTagNames[site->tag],
+                    (long long)allocs,
+                    (long long)bytes);
+        }
+        leaked_count += (u64)allocs;
+        leaked_bytes += (u64)bytes;
+    }
+    fprintf(out,
+            "  %llu allocations, %llu bytes\n",
+            (unsigned long long)leaked_count,
+            (unsigned long long)leaked_bytes);
+    return leaked_count;
+}
+
+#endif
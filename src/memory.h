@@ -0,0 +1,136 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+
+/*
+ * Allocation tracking behind X_MALLOC / X_CALLOC / X_REALLOC / X_FREE.
+ *
+ * Builds without X_MEMORY_TRACKING (the default) expand those macros straight
+ * to libc and every function below to an empty inline, so nothing is left at
+ * runtime; xMemSetAllocator reports an error and returns false there, since
+ * there is no indirection to install into. With tracking on, each allocation carries a 16-byte header naming
+ * its size, subsystem tag and call site. The bytes come from the installed
+ * xAllocator (libc unless xMemSetAllocator says otherwise).
+ *
+ * A translation unit charges its allocations to a subsystem by defining
+ * X_MEM_TAG before its first include:
+ *
+ *     #define X_MEM_TAG X_MEM_TAG_RENDERER
+ *     #include "renderer.h"
+ */
+
+#ifndef X_MEMORY_TRACKING
+    #define X_MEMORY_TRACKING 0
+#endif
+
+#ifndef X_MEM_TAG
+    #define X_MEM_TAG X_MEM_TAG_GENERAL
+#endif
+
+/* Threads with their own counters; later threads share one atomic fallback block */
+#define X_MEM_MAX_THREADS 64
+
+/* Distinct allocation call sites remembered for the leak report. Must be a power of 2. */
+#define X_MEM_MAX_CALLSITES 4096
+
+typedef enum {
+    X_MEM_TAG_GENERAL,
+    X_MEM_TAG_ARENA,
+    X_MEM_TAG_CONTAINERS,
+    X_MEM_TAG_RENDERER,
+    X_MEM_TAG_ASSETS,
+    X_MEM_TAG_JOBS,
+    X_MEM_TAG_ECS,
+    X_MEM_TAG_SPATIAL,
+    X_MEM_TAG_PLATFORM,
+    X_MEM_TAG_PROFILER,
+    X_MEM_TAG_PARTICLES,
+    X_MEM_TAG_TRANSFORM,
+    X_MEM_TAG_COUNT,
+} xMemTag;
+
+/* Backing allocator. Install before the first allocation; pointers never move between allocators. */
+typedef struct {
+    void* (*alloc)(void* user, size_t size);
+    void* (*realloc)(void* user, void* ptr, size_t size);
+    void (*free)(void* user, void* ptr);
+    void* user;
+} xAllocator;
+
+typedef struct {
+    u64 live_bytes;
+    u64 peak_bytes;
+    u64 live_count;
+    u64 total_allocs;  // a realloc counts as an allocation of its new size
+    u64 total_bytes;
+    u64 frame_allocs;  // during the last frame closed by xMemFrameMark
+    u64 frame_bytes;
+} xMemStats;
+
+#if X_MEMORY_TRACKING
+
+void* xMemAlloc(size_t size, xMemTag tag, const char* file, u32 line);
+void* xMemCalloc(size_t count, size_t size, xMemTag tag, const char* file, u32 line);
+void* xMemRealloc(void* ptr, size_t size, xMemTag tag, const char* file, u32 line);
+void xMemFree(void* ptr);
+
+    #define X_MEM_ALLOC(size) xMemAlloc((size), X_MEM_TAG, __FILE__, __LINE__)
+    #define X_MEM_CALLOC(count, size) xMemCalloc((count), (size), X_MEM_TAG, __FILE__, __LINE__)
+    #define X_MEM_REALLOC(ptr, size) xMemRealloc((ptr), (size), X_MEM_TAG, __FILE__, __LINE__)
+    #define X_MEM_FREE(ptr) xMemFree(ptr)
+
+/* NULL restores libc. Returns false if the allocator could not be installed. */
+bool xMemSetAllocator(const xAllocator* allocator);
+
+/* Close the current frame for the per-frame allocation rate. Call once per frame from one thread. */
+void xMemFrameMark(void);
+
+void xMemGetStats(xMemTag tag, xMemStats* out);
+const char* xMemTagName(xMemTag tag);
+
+/* Per-tag table of live, peak and per-frame numbers */
+void xMemReport(FILE* out);
+
+/* Print every call site that still owns memory, largest first. Returns the number of live allocations. */
+u64 xMemReportLeaks(FILE* out);
+
+#else
+
+    #define X_MEM_ALLOC(size) malloc(size)
+    #define X_MEM_CALLOC(count, size) calloc((count), (size))
+    #define X_MEM_REALLOC(ptr, size) realloc((ptr), (size))
+    #define X_MEM_FREE(ptr) free(ptr)
+
+/* Untracked builds always allocate from libc, so anything but NULL is refused instead of silently ignored */
+X_FORCE_INLINE static bool xMemSetAllocator(const xAllocator* allocator) {
+    if (allocator == NULL) { return true; }
+    X_PRINT_ERROR("Custom allocators need X_MEMORY_TRACKING (XENC_MEMORY_TRACKING); allocations stay on libc");
+    return false;
+}
+
+X_FORCE_INLINE static void xMemFrameMark(void) {}
+
+X_FORCE_INLINE static void xMemGetStats(xMemTag tag, xMemStats* out) {
+    X_UNUSED(tag);
+    X_ZERO_STRUCT(out);
+}
+
+X_FORCE_INLINE static const char* xMemTagName(xMemTag tag) {
+    X_UNUSED(tag);
+    return "";
+}
+
+X_FORCE_INLINE static void xMemReport(FILE* out) {
+    X_UNUSED(out);
+}
+
+X_FORCE_INLINE static u64 xMemReportLeaks(FILE* out) {
+    X_UNUSED(out);
+    return 0;
+}
+
+#endif
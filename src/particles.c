@@ -0,0 +1,503 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_PARTICLES
+
+#include "particles.h"
+#include "profiler.h"
+
+#include <threads.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #include <immintrin.h>
+    #define X_PARTICLES_HAS_AVX2 1
+#endif
+
+X_STATIC_ASSERT(X_PARTICLE_JOB_GRAIN % X_PARTICLE_LANES == 0, "Chunks must start on a full SIMD block");
+
+/* Velocity gain and damping for one step, hoisted out of the kernels */
+typedef struct {
+    f32 dt;
+    f32 gravity[3];  // already scaled by dt
+    f32 damping;
+} xParticleStep;
+
+/* Size and color endpoints as floats, so the kernels only lerp */
+typedef struct {
+    f32 size_start;
+    f32 size_end;
+    f32 color_start[4];
+    f32 color_end[4];
+} xParticleLook;
+
+/* Returns the survivors of [begin, end), packed from `begin` */
+typedef u32 (*xParticleUpdateFn)(const xParticleStreams* s, u32 begin, u32 end, const xParticleStep* step);
+
+typedef void (*xParticleInstanceFn)(const xParticleStreams* s,
+                                    u32 begin,
+                                    u32 end,
+                                    const xParticleLook* look,
+                                    xParticleInstance* out);
+
+/* ============================================================================
+ * SCALAR KERNELS
+ * ============================================================================ */
+
+/* Every particle is written at `dst`; only the alive bit decides whether `dst` moves past it */
+static u32 compactScalar(const xParticleStreams* s, u32 begin, u32 end, u32 dst, const xParticleStep* step) {
+    for (u32 i = begin; i < end; ++i) {
+        const f32 vx  = (s->vx[i] + step->gravity[0]) * step->damping;
+        const f32 vy  = (s->vy[i] + step->gravity[1]) * step->damping;
+        const f32 vz  = (s->vz[i] + step->gravity[2]) * step->damping;
+        const f32 px  = s->px[i] + vx * step->dt;
+        const f32 py  = s->py[i] + vy * step->dt;
+        const f32 pz  = s->pz[i] + vz * step->dt;
+        const f32 age = s->age[i] + step->dt;
+        const f32 inv = s->inv_lifetime[i];
+
+        s->px[dst]           = px;
+        s->py[dst]           = py;
+        s->pz[dst]           = pz;
+        s->vx[dst]           = vx;
+        s->vy[dst]           = vy;
+        s->vz[dst]           = vz;
+        s->age[dst]          = age;
+        s->inv_lifetime[dst] = inv;
+        dst += (u32)(age * inv < 1.0f);
+    }
+    return dst;
+}
+
+static u32 updateScalar(const xParticleStreams* s, u32 begin, u32 end, const xParticleStep* step) {
+    return compactScalar(s, begin, end, begin, step) - begin;
+}
+
+static u32 packColor(const xParticleLook* look, f32 k) {
+    return X_COLOR_RGBA((u32)(X_LERP(look->color_start[0], look->color_end[0], k) + 0.5f),
+                        (u32)(X_LERP(look->color_start[1], look->color_end[1], k) + 0.5f),
+                        (u32)(X_LERP(look->color_start[2], look->color_end[2], k) + 0.5f),
+                        (u32)(X_LERP(look->color_start[3], look->color_end[3], k) + 0.5f));
+}
+
+static void instancesScalar(const xParticleStreams* s,
+                            u32 begin,
+                            u32 end,
+                            const xParticleLook* look,
+                            xParticleInstance* out) {
+    for (u32 i = begin; i < end; ++i) {
+        const f32 t = X_CLAMP(s->age[i] * s->inv_lifetime[i], 0.0f, 1.0f);
+        const f32 k = X_SMOOTHSTEP(t);
+        out[i]      = (xParticleInstance) {s->px[i],
+                                           s->py[i],
+                                           s->pz[i],
+                                           X_LERP(look->size_start, look->size_end, k),
+                                           packColor(look, k)};
+    }
+}
+
+/* ============================================================================
+ * SSE2 KERNELS
+ * ============================================================================ */
+
+#if defined(X_MATH_SSE2)
+
+static u32 updateSse2(const xParticleStreams* s, u32 begin, u32 end, const xParticleStep* step) {
+    const __m128 dt      = _mm_set1_ps(step->dt);
+    const __m128 gx      = _mm_set1_ps(step->gravity[0]);
+    const __m128 gy      = _mm_set1_ps(step->gravity[1]);
+    const __m128 gz      = _mm_set1_ps(step->gravity[2]);
+    const __m128 damping = _mm_set1_ps(step->damping);
+    const __m128 one     = _mm_set1_ps(1.0f);
+
+    u32 dst = begin;
+    u32 i   = begin;
+    for (; i + 4 <= end; i += 4) {
+        _Alignas(16) f32 lanes[X_PARTICLE_STREAM_COUNT][4];
+
+        const __m128 vx  = _mm_mul_ps(_mm_add_ps(_mm_load_ps(s->vx + i), gx), damping);
+        const __m128 vy  = _mm_mul_ps(_mm_add_ps(_mm_load_ps(s->vy + i), gy), damping);
+        const __m128 vz  = _mm_mul_ps(_mm_add_ps(_mm_load_ps(s->vz + i), gz), damping);
+        const __m128 age = _mm_add_ps(_mm_load_ps(s->age + i), dt);
+        const __m128 inv = _mm_load_ps(s->inv_lifetime + i);
+        _mm_store_ps(lanes[0], _mm_add_ps(_mm_load_ps(s->px + i), _mm_mul_ps(vx, dt)));
+        _mm_store_ps(lanes[1], _mm_add_ps(_mm_load_ps(s->py + i), _mm_mul_ps(vy, dt)));
+        _mm_store_ps(lanes[2], _mm_add_ps(_mm_load_ps(s->pz + i), _mm_mul_ps(vz, dt)));
+        _mm_store_ps(lanes[3], vx);
+        _mm_store_ps(lanes[4], vy);
+        _mm_store_ps(lanes[5], vz);
+        _mm_store_ps(lanes[6], age);
+        _mm_store_ps(lanes[7], inv);
+        const u32 alive = (u32)_mm_movemask_ps(_mm_cmplt_ps(_mm_mul_ps(age, inv), one));
+
+        // No cross-lane permute before SSSE3, so scatter the four lanes and advance by the mask
+        for (u32 lane = 0; lane < 4; ++lane) {
+            s->px[dst]           = lanes[0][lane];
+            s->py[dst]           = lanes[1][lane];
+            s->pz[dst]           = lanes[2][lane];
+            s->vx[dst]           = lanes[3][lane];
+            s->vy[dst]           = lanes[4][lane];
+            s->vz[dst]           = lanes[5][lane];
+            s->age[dst]          = lanes[6][lane];
+            s->inv_lifetime[dst] = lanes[7][lane];
+            dst += (alive >> lane) & 1;
+        }
+    }
+    return compactScalar(s, i, end, dst, step) - begin;
+}
+
+static void instancesSse2(const xParticleStreams* s,
+                          u32 begin,
+                          u32 end,
+                          const xParticleLook* look,
+                          xParticleInstance* out) {
+    const __m128 zero       = _mm_setzero_ps();
+    const __m128 one        = _mm_set1_ps(1.0f);
+    const __m128 three      = _mm_set1_ps(3.0f);
+    const __m128 two        = _mm_set1_ps(2.0f);
+    const __m128 size_start = _mm_set1_ps(look->size_start);
+    const __m128 size_delta = _mm_set1_ps(look->size_end - look->size_start);
+    __m128 color_start[4];
+    __m128 color_delta[4];
+    for (u32 c = 0; c < 4; ++c) {
+        color_start[c] = _mm_set1_ps(look->color_start[c]);
+        color_delta[c] = _mm_set1_ps(look->color_end[c] - look->color_start[c]);
+    }
+
+    u32 i = begin;
+    for (; i + 4 <= end; i += 4) {
+        const __m128 t = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_load_ps(s->age + i), _mm_load_ps(s->inv_lifetime + i)),
+                                               zero),
+                                    one);
+        const __m128 k = _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(three, _mm_mul_ps(two, t)));
+
+        __m128i color = _mm_setzero_si128();
+        for (u32 c = 0; c < 4; ++c) {
+            const __m128i channel = _mm_cvtps_epi32(_mm_add_ps(color_start[c], _mm_mul_ps(color_delta[c], k)));
+            color                 = _mm_or_si128(color, _mm_slli_epi32(channel, (int)(c * 8)));
+        }
+
+        _Alignas(16) f32 sizes[4];
+        _Alignas(16) u32 colors[4];
+        _mm_store_ps(sizes, _mm_add_ps(size_start, _mm_mul_ps(size_delta, k)));
+        _mm_store_si128((__m128i*)colors, color);
+        for (u32 lane = 0; lane < 4; ++lane) {
+            const u32 j = i + lane;
+            out[j]      = (xParticleInstance) {s->px[j], s->py[j], s->pz[j], sizes[lane], colors[lane]};
+        }
+    }
+    instancesScalar(s, i, end, look, out);
+}
+
+#endif
+
+/* ============================================================================
+ * AVX2 KERNELS
+ * ============================================================================ */
+
+#if defined(X_PARTICLES_HAS_AVX2)
+
+/* For each 8-bit alive mask, the source lanes of the survivors in order */
+static _Alignas(32) u32 sCompressTable[256][8];
+static once_flag sCompressOnce = ONCE_FLAG_INIT;
+
+static void buildCompressTable(void) {
+    for (u32 mask = 0; mask < 256; ++mask) {
+        u32 count = 0;
+        for (u32 lane = 0; lane < 8; ++lane) {
+            if (mask & (1u << lane)) { sCompressTable[mask][count++] = lane; }
+        }
+        while (count < 8) {
+            sCompressTable[mask][count++] = 0;
+        }
+    }
+}
+
+__attribute__((target("avx2,fma"))) static u32
+updateAvx2(const xParticleStreams* s, u32 begin, u32 end, const xParticleStep* step) {
+    const __m256 dt      = _mm256_set1_ps(step->dt);
+    const __m256 gx      = _mm256_set1_ps(step->gravity[0]);
+    const __m256 gy      = _mm256_set1_ps(step->gravity[1]);
+    const __m256 gz      = _mm256_set1_ps(step->gravity[2]);
+    const __m256 damping = _mm256_set1_ps(step->damping);
+    const __m256 one     = _mm256_set1_ps(1.0f);
+
+    u32 dst = begin;
+    u32 i   = begin;
+    for (; i + 8 <= end; i += 8) {
+        const __m256 vx  = _mm256_mul_ps(_mm256_add_ps(_mm256_load_ps(s->vx + i), gx), damping);
+        const __m256 vy  = _mm256_mul_ps(_mm256_add_ps(_mm256_load_ps(s->vy + i), gy), damping);
+        const __m256 vz  = _mm256_mul_ps(_mm256_add_ps(_mm256_load_ps(s->vz + i), gz), damping);
+        const __m256 px  = _mm256_fmadd_ps(vx, dt, _mm256_load_ps(s->px + i));
+        const __m256 py  = _mm256_fmadd_ps(vy, dt, _mm256_load_ps(s->py + i));
+        const __m256 pz  = _mm256_fmadd_ps(vz, dt, _mm256_load_ps(s->pz + i));
+        const __m256 age = _mm256_add_ps(_mm256_load_ps(s->age + i), dt);
+        const __m256 inv = _mm256_load_ps(s->inv_lifetime + i);
+        const u32 alive  = (u32)_mm256_movemask_ps(_mm256_cmp_ps(_mm256_mul_ps(age, inv), one, _CMP_LT_OQ));
+
+        // Pack the survivors to the front of each register and store all eight lanes; the
+        // tail lanes land on slots that were already loaded and are overwritten or past the end
+        const __m256i perm = _mm256_load_si256((const __m256i*)sCompressTable[alive]);
+        _mm256_storeu_ps(s->px + dst, _mm256_permutevar8x32_ps(px, perm));
+        _mm256_storeu_ps(s->py + dst, _mm256_permutevar8x32_ps(py, perm));
+        _mm256_storeu_ps(s->pz + dst, _mm256_permutevar8x32_ps(pz, perm));
+        _mm256_storeu_ps(s->vx + dst, _mm256_permutevar8x32_ps(vx, perm));
+        _mm256_storeu_ps(s->vy + dst, _mm256_permutevar8x32_ps(vy, perm));
+        _mm256_storeu_ps(s->vz + dst, _mm256_permutevar8x32_ps(vz, perm));
+        _mm256_storeu_ps(s->age + dst, _mm256_permutevar8x32_ps(age, perm));
+        _mm256_storeu_ps(s->inv_lifetime + dst, _mm256_permutevar8x32_ps(inv, perm));
+        dst += (u32)__builtin_popcount(alive);
+    }
+    return compactScalar(s, i, end, dst, step) - begin;
+}
+
+__attribute__((target("avx2,fma"))) static void instancesAvx2(const xParticleStreams* s,
+                                                              u32 begin,
+                                                              u32 end,
+                                                              const xParticleLook* look,
+                                                              xParticleInstance* out) {
+    const __m256 zero       = _mm256_setzero_ps();
+    const __m256 one        = _mm256_set1_ps(1.0f);
+    const __m256 three      = _mm256_set1_ps(3.0f);
+    const __m256 minus_two  = _mm256_set1_ps(-2.0f);
+    const __m256 size_start = _mm256_set1_ps(look->size_start);
+    const __m256 size_delta = _mm256_set1_ps(look->size_end - look->size_start);
+    __m256 color_start[4];
+    __m256 color_delta[4];
+    for (u32 c = 0; c < 4; ++c) {
+        color_start[c] = _mm256_set1_ps(look->color_start[c]);
+        color_delta[c] = _mm256_set1_ps(look->color_end[c] - look->color_start[c]);
+    }
+
+    u32 i = begin;
+    for (; i + 8 <= end; i += 8) {
+        const __m256 t = _mm256_min_ps(
+          _mm256_max_ps(_mm256_mul_ps(_mm256_load_ps(s->age + i), _mm256_load_ps(s->inv_lifetime + i)), zero),
+          one);
+        const __m256 k = _mm256_mul_ps(_mm256_mul_ps(t, t), _mm256_fmadd_ps(minus_two, t, three));
+
+        __m256i color = _mm256_setzero_si256();
+        for (u32 c = 0; c < 4; ++c) {
+            const __m256i channel = _mm256_cvtps_epi32(_mm256_fmadd_ps(color_delta[c], k, color_start[c]));
+            color                 = _mm256_or_si256(color, _mm256_sllv_epi32(channel, _mm256_set1_epi32((int)(c * 8))));
+        }
+
+        _Alignas(32) f32 sizes[8];
+        _Alignas(32) u32 colors[8];
+        _mm256_store_ps(sizes, _mm256_fmadd_ps(size_delta, k, size_start));
+        _mm256_store_si256((__m256i*)colors, color);
+        for (u32 lane = 0; lane < 8; ++lane) {
+            const u32 j = i + lane;
+            out[j]      = (xParticleInstance) {s->px[j], s->py[j], s->pz[j], sizes[lane], colors[lane]};
+        }
+    }
+    instancesScalar(s, i, end, look, out);
+}
+
+#endif
+
+/* ============================================================================
+ * DISPATCH
+ * ============================================================================ */
+
+static bool pathSupported(xMathPath path) {
+    switch (path) {
+        case X_MATH_PATH_SCALAR:
+            return true;
+#if defined(X_MATH_SSE2)
+        case X_MATH_PATH_SSE2:
+            return true;
+#endif
+#if defined(X_PARTICLES_HAS_AVX2)
+        case X_MATH_PATH_AVX2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+        default:
+            return false;
+    }
+}
+
+static xParticleUpdateFn updateKernel(xMathPath path) {
+    switch (path) {
+#if defined(X_PARTICLES_HAS_AVX2)
+        case X_MATH_PATH_AVX2:
+            return updateAvx2;
+#endif
+#if defined(X_MATH_SSE2)
+        case X_MATH_PATH_SSE2:
+            return updateSse2;
+#endif
+        default:
+            return updateScalar;
+    }
+}
+
+static xParticleInstanceFn instanceKernel(xMathPath path) {
+    switch (path) {
+#if defined(X_PARTICLES_HAS_AVX2)
+        case X_MATH_PATH_AVX2:
+            return instancesAvx2;
+#endif
+#if defined(X_MATH_SSE2)
+        case X_MATH_PATH_SSE2:
+            return instancesSse2;
+#endif
+        default:
+            return instancesScalar;
+    }
+}
+
+bool xParticleEmitterSetPath(xParticleEmitter* emitter, xMathPath path) {
+    if (!pathSupported(path)) { return false; }
+#if defined(X_PARTICLES_HAS_AVX2)
+    if (path == X_MATH_PATH_AVX2) { call_once(&sCompressOnce, buildCompressTable); }
+#endif
+    emitter->path = path;
+    return true;
+}
+
+/* ============================================================================
+ * EMITTER
+ * ============================================================================ */
+
+bool xParticleEmitterInit(xParticleEmitter* emitter, u32 capacity, const xParticleParams* params) {
+    X_ASSERT_MSG(params != NULL, "params is NULL");
+    X_ZERO_STRUCT(emitter);
+
+    capacity                   = X_ALIGN_UP(X_MAX(capacity, 1u), X_PARTICLE_LANES);
+    const size_t stream_bytes  = X_ALIGN_UP((size_t)capacity * sizeof(f32), (size_t)X_PARTICLE_ALIGN);
+    const size_t storage_bytes = stream_bytes * X_PARTICLE_STREAM_COUNT + X_PARTICLE_ALIGN;
+
+    emitter->storage     = X_MEM_ALLOC(storage_bytes);
+    emitter->chunk_count = capacity / X_PARTICLE_JOB_GRAIN + 1;
+    emitter->chunk_alive = X_MALLOC(u32, emitter->chunk_count);
+    if (emitter->storage == NULL || emitter->chunk_alive == NULL) {
+        X_PRINT_ERROR("Failed to allocate particle emitter (%u particles)", capacity);
+        xParticleEmitterShutdown(emitter);
+        return false;
+    }
+
+    // One block, each stream starting on its own X_PARTICLE_ALIGN boundary
+    u8* base = (u8*)X_ALIGN_UP((uintptr_t)emitter->storage, (uintptr_t)X_PARTICLE_ALIGN);
+    for (u32 i = 0; i < X_PARTICLE_STREAM_COUNT; ++i) {
+        emitter->s.streams[i] = (f32*)(base + stream_bytes * i);
+    }
+
+    emitter->capacity = capacity;
+    emitter->rng      = 0x9E3779B9u;
+    emitter->params   = *params;
+    if (!xParticleEmitterSetPath(emitter, xMathActivePath())) { emitter->path = X_MATH_PATH_SCALAR; }
+    return true;
+}
+
+void xParticleEmitterShutdown(xParticleEmitter* emitter) {
+    X_FREE(emitter->storage);
+    X_DELETE(emitter->chunk_alive);
+    X_ZERO_STRUCT(emitter);
+}
+
+static f32 randomUnit(u32* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return (f32)(*state & 0xFFFFFF) / (f32)0xFFFFFF;
+}
+
+u32 xParticleEmitterSpawn(xParticleEmitter* emitter, const xParticleSpawn* spawn, u32 count) {
+    count                     = X_MIN(count, emitter->capacity - emitter->count);
+    const xParticleStreams* s = &emitter->s;
+    const f32 jitter          = spawn->velocity_jitter;
+
+    for (u32 n = 0; n < count; ++n) {
+        const u32 i        = emitter->count + n;
+        const f32 lifetime = X_LERP(spawn->lifetime_min, spawn->lifetime_max, randomUnit(&emitter->rng));
+        s->px[i]           = spawn->position[0];
+        s->py[i]           = spawn->position[1];
+        s->pz[i]           = spawn->position[2];
+        s->vx[i]           = spawn->velocity[0] + jitter * (randomUnit(&emitter->rng) * 2.0f - 1.0f);
+        s->vy[i]           = spawn->velocity[1] + jitter * (randomUnit(&emitter->rng) * 2.0f - 1.0f);
+        s->vz[i]           = spawn->velocity[2] + jitter * (randomUnit(&emitter->rng) * 2.0f - 1.0f);
+        s->age[i]          = 0.0f;
+        s->inv_lifetime[i] = 1.0f / X_MAX(lifetime, 1e-4f);
+    }
+    emitter->count += count;
+    return count;
+}
+
+typedef struct {
+    xParticleEmitter* emitter;
+    xParticleUpdateFn fn;
+    xParticleStep step;
+} xParticleUpdateJob;
+
+static void updateJob(void* data, u32 begin, u32 end) {
+    xParticleUpdateJob* job = (xParticleUpdateJob*)data;
+    const u32 survived      = job->fn(&job->emitter->s, begin, end, &job->step);
+
+    job->emitter->chunk_alive[begin / X_PARTICLE_JOB_GRAIN] = survived;
+}
+
+void xParticleEmitterUpdate(xParticleEmitter* emitter, f32 dt, xJobSystem* jobs) {
+    X_PROFILE_FUNCTION();
+    const u32 count = emitter->count;
+    if (count == 0) { return; }
+
+    const xParticleParams* params = &emitter->params;
+    xParticleUpdateJob job        = {
+      .emitter = emitter,
+      .fn      = updateKernel(emitter->path),
+      .step    = {.dt      = dt,
+                  .gravity = {params->gravity[0] * dt, params->gravity[1] * dt, params->gravity[2] * dt},
+                  .damping = 1.0f / (1.0f + params->drag * dt)},
+    };
+
+    // Each chunk compacts in place; survivors of later chunks are then slid down behind earlier ones
+    const u32 chunks = (count + X_PARTICLE_JOB_GRAIN - 1) / X_PARTICLE_JOB_GRAIN;
+    memset(emitter->chunk_alive, 0, sizeof(u32) * chunks);
+    xJobsParallelFor(jobs, count, X_PARTICLE_JOB_GRAIN, updateJob, &job);
+
+    u32 alive = 0;
+    for (u32 chunk = 0; chunk < chunks; ++chunk) {
+        const u32 begin    = chunk * X_PARTICLE_JOB_GRAIN;
+        const u32 survived = emitter->chunk_alive[chunk];
+        if (survived > 0 && begin != alive) {
+            for (u32 stream = 0; stream < X_PARTICLE_STREAM_COUNT; ++stream) {
+                memmove(emitter->s.streams[stream] + alive,
+                        emitter->s.streams[stream] + begin,
+                        sizeof(f32) * survived);
+            }
+        }
+        alive += survived;
+    }
+    emitter->count = alive;
+}
+
+typedef struct {
+    const xParticleStreams* s;
+    xParticleInstanceFn fn;
+    xParticleLook look;
+    xParticleInstance* out;
+} xParticleInstanceJob;
+
+static void instanceJob(void* data, u32 begin, u32 end) {
+    const xParticleInstanceJob* job = (const xParticleInstanceJob*)data;
+    job->fn(job->s, begin, end, &job->look, job->out);
+}
+
+u32 xParticleEmitterWriteInstances(const xParticleEmitter* emitter, xParticleInstance* out, xJobSystem* jobs) {
+    X_PROFILE_FUNCTION();
+    const xParticleParams* params = &emitter->params;
+    xParticleInstanceJob job      = {
+      .s    = &emitter->s,
+      .fn   = instanceKernel(emitter->path),
+      .look = {.size_start = params->size_start, .size_end = params->size_end},
+      .out  = out,
+    };
+    for (u32 c = 0; c < 4; ++c) {
+        job.look.color_start[c] = (f32)((params->color_start >> (c * 8)) & 0xFF);
+        job.look.color_end[c]   = (f32)((params->color_end >> (c * 8)) & 0xFF);
+    }
+
+    xJobsParallelFor(jobs, emitter->count, X_PARTICLE_JOB_GRAIN, instanceJob, &job);
+    return emitter->count;
+}
@@ -0,0 +1,107 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "jobs.h"
+#include "vecmath.h"
+
+/*
+ * Data-oriented particles. Each emitter keeps its particles as SoA float
+ * streams in one allocation, every stream padded to X_PARTICLE_ALIGN bytes so
+ * the kernels can use full-width aligned loads. One fused pass integrates,
+ * applies gravity and drag, ages and compacts: survivors are written back at
+ * a running index that advances by the alive mask, so there is no branch on
+ * whether a particle died. A second pass evaluates size and color over
+ * lifetime and writes the GPU instance stream.
+ *
+ * Kernels come in scalar, SSE2 and AVX2 flavors selected at runtime from the
+ * xMathPath of the build and CPU; NEON builds run the scalar kernels.
+ */
+
+/* Stream alignment in bytes and the padding granularity of the capacity, in particles */
+#define X_PARTICLE_ALIGN 64
+#define X_PARTICLE_LANES 8
+
+/* Particles per job when an emitter is split across cores. Must be a multiple of X_PARTICLE_LANES. */
+#define X_PARTICLE_JOB_GRAIN 32768
+
+#define X_PARTICLE_STREAM_COUNT 8
+
+/* Per-instance vertex stream: bind with an attribute divisor of 1 and expand a billboard per instance */
+typedef struct {
+    f32 x;
+    f32 y;
+    f32 z;
+    f32 size;
+    u32 color;  // X_COLOR_RGBA
+} xParticleInstance;
+
+X_STATIC_ASSERT(sizeof(xParticleInstance) == 20, "xParticleInstance is uploaded as-is");
+
+typedef union {
+    struct {
+        f32* px;
+        f32* py;
+        f32* pz;
+        f32* vx;
+        f32* vy;
+        f32* vz;
+        f32* age;
+        f32* inv_lifetime;
+    };
+    f32* streams[X_PARTICLE_STREAM_COUNT];
+} xParticleStreams;
+
+/* Behaviour shared by every particle of an emitter. Size and color follow X_SMOOTHSTEP of normalized age. */
+typedef struct {
+    f32 gravity[3];
+    f32 drag;  // per second: velocity scales by 1 / (1 + drag * dt) each step
+    f32 size_start;
+    f32 size_end;
+    u32 color_start;  // X_COLOR_RGBA
+    u32 color_end;
+} xParticleParams;
+
+/* Spawn burst: every axis of the velocity gets a uniform offset in [-jitter, jitter] */
+typedef struct {
+    f32 position[3];
+    f32 velocity[3];
+    f32 velocity_jitter;
+    f32 lifetime_min;
+    f32 lifetime_max;
+} xParticleSpawn;
+
+typedef struct {
+    xParticleStreams s;
+    u32 count;
+    u32 capacity;
+    void* storage;
+    u32* chunk_alive;  // survivors per X_PARTICLE_JOB_GRAIN chunk during an update
+    u32 chunk_count;
+    u32 rng;
+    xMathPath path;
+    xParticleParams params;
+} xParticleEmitter;
+
+/* `capacity` is rounded up to a multiple of X_PARTICLE_LANES */
+bool xParticleEmitterInit(xParticleEmitter* emitter, u32 capacity, const xParticleParams* params);
+void xParticleEmitterShutdown(xParticleEmitter* emitter);
+
+/* Pick a kernel flavor; false if the build or CPU cannot run it. Emitters start on the best one. */
+bool xParticleEmitterSetPath(xParticleEmitter* emitter, xMathPath path);
+
+/* Append up to `count` particles. Returns how many fit. */
+u32 xParticleEmitterSpawn(xParticleEmitter* emitter, const xParticleSpawn* spawn, u32 count);
+
+/* Step every particle by `dt` seconds and drop the expired ones. Chunks run on `jobs` when it is not NULL. */
+void xParticleEmitterUpdate(xParticleEmitter* emitter, f32 dt, xJobSystem* jobs);
+
+/*
+ * Write one instance per live particle into `out`, which must hold
+ * emitter->count entries; it may be mapped GPU memory as it is only written,
+ * front to back. Returns the instance count.
+ */
+u32 xParticleEmitterWriteInstances(const xParticleEmitter* emitter, xParticleInstance* out, xJobSystem* jobs);
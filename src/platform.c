@@ -0,0 +1,255 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "platform.h"
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <dirent.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
+u32 xPlatformCoreCount(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return X_MAX((u32)info.dwNumberOfProcessors, 1u);
+#else
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (u32)count : 1u;
+#endif
+}
+
+f64 xPlatformTime(void) {
+#if defined(_WIN32)
+    static LARGE_INTEGER frequency;
+    if (frequency.QuadPart == 0) { QueryPerformanceFrequency(&frequency); }
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (f64)counter.QuadPart / (f64)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (f64)ts.tv_sec + (f64)ts.tv_nsec * 1e-9;
+#endif
+}
+
+void xPlatformSleep(f64 seconds) {
+    if (seconds <= 0.0) { return; }
+#if defined(_WIN32)
+    Sleep((DWORD)(seconds * 1000.0));
+#else
+    struct timespec ts;
+    ts.tv_sec  = (time_t)seconds;
+    ts.tv_nsec = (long)((seconds - (f64)ts.tv_sec) * 1e9);
+    nanosleep(&ts, NULL);
+#endif
+}
+
+bool xPlatformMapFile(const char* path, xMappedFile* out) {
+    X_ZERO_STRUCT(out);
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        X_PRINT_ERROR("Failed to open '%s' for mapping", path);
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        X_PRINT_ERROR("Cannot map empty or unreadable file '%s'", path);
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    void* view     = mapping != NULL ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+    if (view == NULL) {
+        X_PRINT_ERROR("Failed to map '%s'", path);
+        if (mapping != NULL) { CloseHandle(mapping); }
+        CloseHandle(file);
+        return false;
+    }
+
+    out->data    = (const u8*)view;
+    out->size    = (size_t)size.QuadPart;
+    out->file    = file;
+    out->mapping = mapping;
+    return true;
+#else
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        X_PRINT_ERROR("Failed to open '%s' for mapping", path);
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        X_PRINT_ERROR("Cannot map empty or unreadable file '%s'", path);
+        close(fd);
+        return false;
+    }
+
+    // The mapping keeps its own reference to the file, so the descriptor can go right away
+    void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        X_PRINT_ERROR("Failed to map '%s'", path);
+        return false;
+    }
+
+    out->data = (const u8*)view;
+    out->size = (size_t)st.st_size;
+    return true;
+#endif
+}
+
+void xPlatformUnmapFile(xMappedFile* file) {
+    if (file->data == NULL) { return; }
+#if defined(_WIN32)
+    UnmapViewOfFile(file->data);
+    CloseHandle((HANDLE)file->mapping);
+    CloseHandle((HANDLE)file->file);
+#else
+    munmap((void*)file->data, file->size);
+#endif
+    X_ZERO_STRUCT(file);
+}
+
+bool xPlatformFileOpen(const char* path, xPlatformFile* out, u64* size) {
+    *out = X_PLATFORM_FILE_INVALID;
+#if defined(_WIN32)
+    const DWORD flags = FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN;
+    HANDLE file       = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, flags, NULL);
+    if (file == INVALID_HANDLE_VALUE) { return false; }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        CloseHandle(file);
+        return false;
+    }
+    *out  = (xPlatformFile)file;
+    *size = (u64)file_size.QuadPart;
+    return true;
+#else
+    const int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) { return false; }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    *out  = (xPlatformFile)fd;
+    *size = (u64)st.st_size;
+    return true;
+#endif
+}
+
+void xPlatformFileClose(xPlatformFile file) {
+    if (file == X_PLATFORM_FILE_INVALID) { return; }
+#if defined(_WIN32)
+    CloseHandle((HANDLE)file);
+#else
+    close((int)file);
+#endif
+}
+
+s64 xPlatformFileRead(xPlatformFile file, void* dst, u64 size, u64 offset) {
+    u64 total = 0;
+    while (total < size) {
+#if defined(_WIN32)
+        // An explicit offset in the OVERLAPPED makes ReadFile positional even on a synchronous handle
+        OVERLAPPED overlapped = {0};
+        const u64 at          = offset + total;
+        overlapped.Offset     = (DWORD)at;
+        overlapped.OffsetHigh = (DWORD)(at >> 32);
+        DWORD read            = 0;
+        const DWORD chunk     = (DWORD)X_MIN(size - total, (u64)(1u << 30));
+        if (!ReadFile((HANDLE)file, (u8*)dst + total, chunk, &read, &overlapped)) {
+            return GetLastError() == ERROR_HANDLE_EOF ? (s64)total : -1;
+        }
+#else
+        const ssize_t read = pread((int)file, (u8*)dst + total, (size_t)(size - total), (off_t)(offset + total));
+        if (read < 0 && errno == EINTR) { continue; }
+        if (read < 0) { return -1; }
+#endif
+        if (read == 0) { break; }
+        total += (u64)read;
+    }
+    return (s64)total;
+}
+
+#define X_PLATFORM_MAX_PATH 1024
+
+static bool walkDirectory(const char* root, const char* relative, xPlatformFileVisitor visit, void* user) {
+    char directory[X_PLATFORM_MAX_PATH];
+    snprintf(directory, sizeof(directory), "%s%s%s", root, relative[0] ? "/" : "", relative);
+
+#if defined(_WIN32)
+    char pattern[X_PLATFORM_MAX_PATH + 2];
+    snprintf(pattern, sizeof(pattern), "%s/*", directory);
+
+    WIN32_FIND_DATAA found;
+    HANDLE find = FindFirstFileA(pattern, &found);
+    if (find == INVALID_HANDLE_VALUE) {
+        X_PRINT_ERROR("Failed to open directory '%s'", directory);
+        return false;
+    }
+
+    bool ok = true;
+    do {
+        const char* name = found.cFileName;
+        if (X_STREQ(name, ".") || X_STREQ(name, "..")) { continue; }
+
+        char child[X_PLATFORM_MAX_PATH];
+        snprintf(child, sizeof(child), "%s%s%s", relative, relative[0] ? "/" : "", name);
+        if (found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+            ok = walkDirectory(root, child, visit, user);
+        } else {
+            visit(user, child);
+        }
+    } while (ok && FindNextFileA(find, &found));
+    FindClose(find);
+    return ok;
+#else
+    DIR* dir = opendir(directory);
+    if (dir == NULL) {
+        X_PRINT_ERROR("Failed to open directory '%s'", directory);
+        return false;
+    }
+
+    bool ok = true;
+    for (struct dirent* item = readdir(dir); item != NULL && ok; item = readdir(dir)) {
+        const char* name = item->d_name;
+        if (X_STREQ(name, ".") || X_STREQ(name, "..")) { continue; }
+
+        char child[X_PLATFORM_MAX_PATH];
+        char full[X_PLATFORM_MAX_PATH * 2];
+        snprintf(child, sizeof(child), "%s%s%s", relative, relative[0] ? "/" : "", name);
+        snprintf(full, sizeof(full), "%s/%s", root, child);
+
+        struct stat st;
+        if (stat(full, &st) != 0) { continue; }
+        if (S_ISDIR(st.st_mode)) {
+            ok = walkDirectory(root, child, visit, user);
+        } else if (S_ISREG(st.st_mode)) {
+            visit(user, child);
+        }
+    }
+    closedir(dir);
+    return ok;
+#endif
+}
+
+bool xPlatformWalkDirectory(const char* root, xPlatformFileVisitor visit, void* user) {
+    return walkDirectory(root, "", visit, user);
+}
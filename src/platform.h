@@ -0,0 +1,45 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+
+/* Number of logical processors available to the process (at least 1) */
+u32 xPlatformCoreCount(void);
+
+/* Monotonic clock in seconds, arbitrary epoch */
+f64 xPlatformTime(void);
+
+/* Coarse OS sleep; may overshoot by up to the scheduler quantum */
+void xPlatformSleep(f64 seconds);
+
+/* Read-only view of a whole file */
+typedef struct {
+    const u8* data;
+    size_t size;
+    void* file;
+    void* mapping;
+} xMappedFile;
+
+bool xPlatformMapFile(const char* path, xMappedFile* out);
+void xPlatformUnmapFile(xMappedFile* file);
+
+/* Native file handle (a descriptor on POSIX, a HANDLE on Windows) for positional reads */
+typedef iptr xPlatformFile;
+
+#define X_PLATFORM_FILE_INVALID ((xPlatformFile)-1)
+
+/* Open read-only and report the size. Safe to read from several threads at once. */
+bool xPlatformFileOpen(const char* path, xPlatformFile* out, u64* size);
+void xPlatformFileClose(xPlatformFile file);
+
+/* pread-style read at `offset`; returns bytes read (short at end of file) or -1 on error */
+s64 xPlatformFileRead(xPlatformFile file, void* dst, u64 size, u64 offset);
+
+/* Called once per regular file with its path relative to the walk root, using '/' separators */
+typedef void (*xPlatformFileVisitor)(void* user, const char* relative_path);
+
+/* Recursively visit every regular file under `root`. Order is unspecified. */
+bool xPlatformWalkDirectory(const char* root, xPlatformFileVisitor visit, void* user);
@@ -0,0 +1,102 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_ARENA
+
+#include "pool.h"
+
+static void resetFreeList(xPool* pool) {
+    for (u32 i = 0; i < pool->capacity; ++i) {
+        pool->next_free[i] = i + 1 < pool->capacity ? i + 1 : X_POOL_END;
+    }
+    pool->free_head = pool->capacity > 0 ? 0 : X_POOL_END;
+    pool->count     = 0;
+    memset(pool->alive, 0, sizeof(u64) * ((pool->capacity + 63) / 64));
+}
+
+bool xPoolInit(xPool* pool, u32 element_size, u32 capacity) {
+    X_ASSERT_MSG(pool != NULL, "pool is NULL");
+    X_ASSERT_MSG(element_size > 0, "element_size == 0");
+    X_ASSERT_MSG(capacity > 0 && capacity <= X_HANDLE_MAX_CAPACITY, "Pool capacity out of range");
+
+    X_ZERO_STRUCT(pool);
+    pool->element_size = element_size;
+    pool->capacity     = capacity;
+    pool->data         = X_MALLOC(u8, (size_t)element_size * capacity);
+    pool->generations  = X_MALLOC(u32, capacity);
+    pool->next_free    = X_MALLOC(u32, capacity);
+    pool->alive        = X_MALLOC(u64, (capacity + 63) / 64);
+
+    if (pool->data == NULL || pool->generations == NULL || pool->next_free == NULL || pool->alive == NULL) {
+        X_PRINT_ERROR("Failed to allocate pool storage (%u x %u bytes)", capacity, element_size);
+        xPoolShutdown(pool);
+        return false;
+    }
+
+    for (u32 i = 0; i < capacity; ++i) {
+        pool->generations[i] = 1;
+    }
+    resetFreeList(pool);
+    return true;
+}
+
+void xPoolShutdown(xPool* pool) {
+    X_DELETE(pool->data);
+    X_DELETE(pool->generations);
+    X_DELETE(pool->next_free);
+    X_DELETE(pool->alive);
+    pool->capacity = 0;
+    pool->count    = 0;
+}
+
+static u32 bumpGeneration(u32 generation) {
+    generation = (generation + 1) & X_HANDLE_GENERATION_MASK;
+    return generation == 0 ? 1 : generation;
+}
+
+xHandle xPoolAcquire(xPool* pool) {
+    const u32 index = pool->free_head;
+    if (X_UNLIKELY(index == X_POOL_END)) { return X_HANDLE_INVALID; }
+
+    pool->free_head = pool->next_free[index];
+    pool->count++;
+    pool->alive[index >> 6] |= (u64)1 << (index & 63);
+    memset(xPoolAt(pool, index), 0, pool->element_size);
+
+    return xPoolHandleAt(pool, index);
+}
+
+void xPoolRelease(xPool* pool, xHandle handle) {
+    X_ASSERT_MSG(xPoolIsValid(pool, handle), "Releasing a stale or invalid pool handle");
+    if (!xPoolIsValid(pool, handle)) { return; }
+
+    const u32 index          = X_HANDLE_INDEX(handle);
+    pool->generations[index] = bumpGeneration(pool->generations[index]);
+    pool->alive[index >> 6] &= ~((u64)1 << (index & 63));
+    pool->next_free[index] = pool->free_head;
+    pool->free_head        = index;
+    pool->count--;
+}
+
+void xPoolClear(xPool* pool) {
+    for (u32 i = 0; i < pool->capacity; ++i) {
+        if (xPoolIsAliveAt(pool, i)) { pool->generations[i] = bumpGeneration(pool->generations[i]); }
+    }
+    resetFreeList(pool);
+}
+
+u32 xPoolNextAlive(const xPool* pool, u32 index) {
+    if (index >= pool->capacity) { return X_POOL_END; }
+
+    const u32 word_count = (pool->capacity + 63) / 64;
+    u32 word             = index >> 6;
+    u64 bits             = pool->alive[word] & (~(u64)0 << (index & 63));
+
+    while (bits == 0) {
+        if (++word >= word_count) { return X_POOL_END; }
+        bits = pool->alive[word];
+    }
+
+    return (word << 6) + (u32)__builtin_ctzll(bits);
+}
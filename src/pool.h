@@ -0,0 +1,88 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+
+/*
+ * Generational handle: the low bits index a pool slot, the high bits hold the
+ * slot's generation at the time the handle was issued. Releasing a slot bumps
+ * its generation, so any handle still referring to the old object goes stale.
+ */
+typedef u32 xHandle;
+
+#define X_HANDLE_INDEX_BITS 20
+#define X_HANDLE_GENERATION_BITS (32 - X_HANDLE_INDEX_BITS)
+#define X_HANDLE_INDEX_MASK X_BITMASK(X_HANDLE_INDEX_BITS)
+#define X_HANDLE_GENERATION_MASK X_BITMASK(X_HANDLE_GENERATION_BITS)
+#define X_HANDLE_MAX_CAPACITY (1U << X_HANDLE_INDEX_BITS)
+
+/* Generation 0 is never issued, so a zeroed handle is always invalid */
+#define X_HANDLE_INVALID ((xHandle)0)
+
+#define X_HANDLE_MAKE(index, generation) ((xHandle)(((generation) << X_HANDLE_INDEX_BITS) | (index)))
+#define X_HANDLE_INDEX(handle) ((u32)(handle) & X_HANDLE_INDEX_MASK)
+#define X_HANDLE_GENERATION(handle) ((u32)(handle) >> X_HANDLE_INDEX_BITS)
+
+/*
+ * Fixed-capacity pool of same-sized objects. Storage is a single contiguous
+ * array so live objects can be walked linearly; free slots are threaded through
+ * an index free list for O(1) acquire and release.
+ */
+typedef struct {
+    u8* data;
+    u32* generations;
+    u32* next_free;
+    u64* alive;
+    u32 element_size;
+    u32 capacity;
+    u32 count;
+    u32 free_head;
+} xPool;
+
+#define X_POOL_END UINT32_MAX
+
+bool xPoolInit(xPool* pool, u32 element_size, u32 capacity);
+void xPoolShutdown(xPool* pool);
+
+/* Returns X_HANDLE_INVALID when the pool is full. The object is zeroed. */
+xHandle xPoolAcquire(xPool* pool);
+void xPoolRelease(xPool* pool, xHandle handle);
+
+/* Drop every object at once, invalidating all outstanding handles */
+void xPoolClear(xPool* pool);
+
+X_FORCE_INLINE static bool xPoolIsAliveAt(const xPool* pool, u32 index) {
+    return (pool->alive[index >> 6] >> (index & 63)) & 1;
+}
+
+X_FORCE_INLINE static bool xPoolIsValid(const xPool* pool, xHandle handle) {
+    const u32 index = X_HANDLE_INDEX(handle);
+    return handle != X_HANDLE_INVALID && index < pool->capacity && xPoolIsAliveAt(pool, index) &&
+           pool->generations[index] == X_HANDLE_GENERATION(handle);
+}
+
+X_FORCE_INLINE static void* xPoolAt(const xPool* pool, u32 index) {
+    return pool->data + (size_t)index * pool->element_size;
+}
+
+/* Resolve a handle. Stale or foreign handles trip X_ASSERT in debug builds. */
+X_FORCE_INLINE static void* xPoolGet(const xPool* pool, xHandle handle) {
+    X_ASSERT_MSG(xPoolIsValid(pool, handle), "Stale or invalid pool handle");
+    return xPoolAt(pool, X_HANDLE_INDEX(handle));
+}
+
+X_FORCE_INLINE static xHandle xPoolHandleAt(const xPool* pool, u32 index) {
+    return X_HANDLE_MAKE(index, pool->generations[index]);
+}
+
+/* Index of the first live slot at or after `index`, or X_POOL_END */
+u32 xPoolNextAlive(const xPool* pool, u32 index);
+
+/* Walk live objects in storage order */
+#define X_POOL_FOREACH(pool, type, var)                                                                                \
+    for (u32 _idx = xPoolNextAlive((pool), 0), _keep = 1; _idx != X_POOL_END;                                         \
+         _idx = xPoolNextAlive((pool), _idx + 1), _keep = 1)                                                           \
+        for (type* var = (type*)xPoolAt((pool), _idx); _keep; _keep = 0)
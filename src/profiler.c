@@ -0,0 +1,370 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_PROFILER
+
+#include "profiler.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#define X_PROFILE_RING_MASK (X_PROFILE_RING_SIZE - 1)
+#define X_PROFILE_ZONE_MASK (X_PROFILE_MAX_ZONES - 1)
+#define X_PROFILE_CALIBRATION_NS 2000000ull
+
+X_STATIC_ASSERT(X_IS_POW2(X_PROFILE_RING_SIZE), "Profile ring size must be a power of 2");
+X_STATIC_ASSERT(X_IS_POW2(X_PROFILE_MAX_ZONES), "Profile zone table size must be a power of 2");
+
+typedef struct {
+    const char* name;
+    u64 begin;
+    u64 end;
+    u32 depth;
+    u32 padding;
+} xProfileEvent;
+
+/* Single-producer single-consumer: the owning thread advances head, xProfilerFrameMark advances tail */
+typedef struct {
+    _Alignas(64) atomic_uint head;
+    _Alignas(64) atomic_uint tail;
+    atomic_uint dropped;
+    u32 id;
+    xProfileEvent events[X_PROFILE_RING_SIZE];
+} xProfileRing;
+
+typedef struct {
+    const char* name;
+    u32 hash;
+    u32 depth;
+    u64 frame_ticks;
+    u32 frame_calls;
+    u32 history_count;
+    u32 history_cursor;
+    f32 history[X_PROFILE_HISTORY];
+    u32 history_calls[X_PROFILE_HISTORY];  // calls in the frame of the matching `history` entry
+} xProfileZoneSlot;
+
+static struct {
+    _Atomic(xProfileRing*) rings[X_PROFILE_MAX_THREADS];
+    atomic_uint ring_count;
+
+    f64 ticks_per_ms;
+    u64 base_ticks;
+    u64 base_ns;
+    u64 last_frame;
+
+    xProfileZoneSlot zones[X_PROFILE_MAX_ZONES];
+    u16 zone_order[X_PROFILE_MAX_ZONES];
+    u32 zone_count;
+
+    FILE* capture;
+    u32 capture_frames;
+    bool capture_first;
+} gProfiler;
+
+static _Thread_local xProfileRing* tRing = NULL;
+static _Thread_local u32 tDepth          = 0;
+
+/* Registered rings; the counter can overshoot when registration fails past the limit */
+static u32 ringCount(void) {
+    return X_MIN(atomic_load_explicit(&gProfiler.ring_count, memory_order_acquire), (u32)X_PROFILE_MAX_THREADS);
+}
+
+static u64 monotonicNs(void) {
+    struct timespec ts;
+#if defined(_WIN32)
+    timespec_get(&ts, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return (u64)ts.tv_sec * 1000000000ull + (u64)ts.tv_nsec;
+}
+
+/* ============================================================================
+ * RECORDING
+ * ============================================================================ */
+
+static xProfileRing* registerThread(void) {
+    const u32 index = atomic_fetch_add_explicit(&gProfiler.ring_count, 1, memory_order_relaxed);
+    if (index >= X_PROFILE_MAX_THREADS) {
+        X_PRINT_ERROR("Too many profiled threads (max %d)", X_PROFILE_MAX_THREADS);
+        return NULL;
+    }
+
+    xProfileRing* ring = X_NEW(xProfileRing);
+    if (ring == NULL) { return NULL; }
+    ring->id = index;
+    atomic_store_explicit(&gProfiler.rings[index], ring, memory_order_release);
+    return ring;
+}
+
+xProfileZone xProfileZoneBegin(const char* name) {
+    tDepth++;
+    return (xProfileZone) {name, xProfileNow()};
+}
+
+void xProfileZoneEnd(xProfileZone* zone) {
+    const u64 end = xProfileNow();
+    tDepth--;
+
+    if (X_UNLIKELY(tRing == NULL)) {
+        tRing = registerThread();
+        if (tRing == NULL) { return; }
+    }
+
+    const u32 head = atomic_load_explicit(&tRing->head, memory_order_relaxed);
+    const u32 tail = atomic_load_explicit(&tRing->tail, memory_order_acquire);
+    if (X_UNLIKELY(head - tail >= X_PROFILE_RING_SIZE)) {
+        // Never block the instrumented thread; the loss shows up in the report
+        atomic_fetch_add_explicit(&tRing->dropped, 1, memory_order_relaxed);
+        return;
+    }
+
+    tRing->events[head & X_PROFILE_RING_MASK] = (xProfileEvent) {zone->name, zone->begin, end, tDepth, 0};
+    atomic_store_explicit(&tRing->head, head + 1, memory_order_release);
+}
+
+f64 xProfileTicksToMs(u64 ticks) {
+    return gProfiler.ticks_per_ms > 0.0 ? (f64)ticks / gProfiler.ticks_per_ms : 0.0;
+}
+
+/* ============================================================================
+ * AGGREGATION
+ * ============================================================================ */
+
+static u32 hashName(const char* name) {
+    u32 hash = 2166136261u;
+    for (const char* c = name; *c != '\0'; ++c) {
+        hash = (hash ^ (u8)*c) * 16777619u;
+    }
+    return hash;
+}
+
+static xProfileZoneSlot* findZone(const char* name, bool create) {
+    const u32 hash = hashName(name);
+    for (u32 probe = 0; probe < X_PROFILE_MAX_ZONES; ++probe) {
+        xProfileZoneSlot* slot = &gProfiler.zones[(hash + probe) & X_PROFILE_ZONE_MASK];
+        if (slot->name == NULL) {
+            if (!create) { return NULL; }
+            slot->name  = name;
+            slot->hash  = hash;
+            slot->depth = UINT32_MAX;
+            gProfiler.zone_order[gProfiler.zone_count++] = (u16)(slot - gProfiler.zones);
+            return slot;
+        }
+        if (slot->hash == hash && (slot->name == name || X_STREQ(slot->name, name))) { return slot; }
+    }
+    return NULL;
+}
+
+static void writeTraceEvent(const char* name, u64 begin, u64 end, u32 tid) {
+    fprintf(gProfiler.capture, "%s\n{\"name\":\"", gProfiler.capture_first ? "" : ",");
+    for (const char* c = name; *c != '\0'; ++c) {
+        if (*c == '"' || *c == '\\') { fputc('\\', gProfiler.capture); }
+        fputc(*c, gProfiler.capture);
+    }
+
+    // Chrome trace timestamps are microseconds
+    const f64 ts  = xProfileTicksToMs(begin - gProfiler.base_ticks) * 1000.0;
+    const f64 dur = xProfileTicksToMs(end - begin) * 1000.0;
+    fprintf(gProfiler.capture, "\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", tid, ts, dur);
+    gProfiler.capture_first = false;
+}
+
+static void recordEvent(const xProfileEvent* event, u32 tid) {
+    xProfileZoneSlot* slot = findZone(event->name, true);
+    if (slot != NULL) {
+        slot->frame_ticks += event->end - event->begin;
+        slot->frame_calls++;
+        slot->depth = X_MIN(slot->depth, event->depth);
+    }
+    if (gProfiler.capture != NULL) { writeTraceEvent(event->name, event->begin, event->end, tid); }
+}
+
+static void finishCapture(void) {
+    if (gProfiler.capture == NULL) { return; }
+    fprintf(gProfiler.capture, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    fclose(gProfiler.capture);
+    gProfiler.capture = NULL;
+}
+
+void xProfilerInit(void) {
+    X_ZERO_STRUCT(&gProfiler.zones);
+    gProfiler.zone_count = 0;
+    gProfiler.base_ns    = monotonicNs();
+    gProfiler.base_ticks = xProfileNow();
+
+#if X_PROFILE_HAS_TSC
+    // Spin briefly for a first TSC rate estimate; xProfilerFrameMark refines it over a longer baseline
+    u64 ns;
+    do {
+        ns = monotonicNs();
+    } while (ns - gProfiler.base_ns < X_PROFILE_CALIBRATION_NS);
+    gProfiler.ticks_per_ms = (f64)(xProfileNow() - gProfiler.base_ticks) * 1e6 / (f64)(ns - gProfiler.base_ns);
+#else
+    gProfiler.ticks_per_ms = 1e6;
+#endif
+
+    gProfiler.last_frame = xProfileNow();
+}
+
+void xProfilerShutdown(void) {
+    finishCapture();
+
+    // Rings belong to their threads until here, so every other profiled thread must have exited
+    const u32 count = ringCount();
+    for (u32 i = 0; i < count; ++i) {
+        xProfileRing* ring = atomic_exchange_explicit(&gProfiler.rings[i], NULL, memory_order_acq_rel);
+        X_FREE(ring);
+    }
+    atomic_store_explicit(&gProfiler.ring_count, 0, memory_order_release);
+    tRing = NULL;
+}
+
+void xProfilerFrameMark(void) {
+    const u64 now = xProfileNow();
+
+#if X_PROFILE_HAS_TSC
+    const u64 elapsed_ns = monotonicNs() - gProfiler.base_ns;
+    if (elapsed_ns > 100 * X_PROFILE_CALIBRATION_NS) {
+        gProfiler.ticks_per_ms = (f64)(now - gProfiler.base_ticks) * 1e6 / (f64)elapsed_ns;
+    }
+#endif
+
+    const u32 count = ringCount();
+    for (u32 i = 0; i < count; ++i) {
+        xProfileRing* ring = atomic_load_explicit(&gProfiler.rings[i], memory_order_acquire);
+        if (ring == NULL) { continue; }
+
+        const u32 head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        u32 tail       = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+        for (; tail != head; ++tail) {
+            recordEvent(&ring->events[tail & X_PROFILE_RING_MASK], ring->id);
+        }
+        atomic_store_explicit(&ring->tail, tail, memory_order_release);
+    }
+
+    const xProfileEvent frame = {X_PROFILE_FRAME_ZONE, gProfiler.last_frame, now, 0, 0};
+    recordEvent(&frame, tRing != NULL ? tRing->id : 0);
+    gProfiler.last_frame = now;
+
+    for (u32 i = 0; i < gProfiler.zone_count; ++i) {
+        xProfileZoneSlot* slot = &gProfiler.zones[gProfiler.zone_order[i]];
+        if (slot->frame_calls == 0) { continue; }
+
+        slot->history[slot->history_cursor]       = (f32)xProfileTicksToMs(slot->frame_ticks);
+        slot->history_calls[slot->history_cursor] = slot->frame_calls;
+        slot->history_cursor                      = (slot->history_cursor + 1) % X_PROFILE_HISTORY;
+        slot->history_count                       = X_MIN(slot->history_count + 1, (u32)X_PROFILE_HISTORY);
+        slot->frame_ticks                         = 0;
+        slot->frame_calls                         = 0;
+    }
+
+    if (gProfiler.capture != NULL && --gProfiler.capture_frames == 0) { finishCapture(); }
+}
+
+bool xProfilerCaptureBegin(const char* path, u32 frames) {
+    finishCapture();
+    if (frames == 0) { return false; }
+
+    gProfiler.capture = fopen(path, "w");
+    if (gProfiler.capture == NULL) {
+        X_PRINT_ERROR("Failed to open profile capture '%s'", path);
+        return false;
+    }
+
+    fprintf(gProfiler.capture, "{\"traceEvents\":[");
+    gProfiler.capture_frames = frames;
+    gProfiler.capture_first  = true;
+    return true;
+}
+
+bool xProfilerIsCapturing(void) {
+    return gProfiler.capture != NULL;
+}
+
+/* ============================================================================
+ * REPORTING
+ * ============================================================================ */
+
+static int compareF32(const void* a, const void* b) {
+    const f32 lhs = *(const f32*)a;
+    const f32 rhs = *(const f32*)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static void computeStats(const xProfileZoneSlot* slot, xProfileStats* out) {
+    f32 sorted[X_PROFILE_HISTORY];
+    const u32 n = slot->history_count;
+    memcpy(sorted, slot->history, sizeof(f32) * n);
+    qsort(sorted, n, sizeof(f32), compareF32);
+
+    f64 sum   = 0.0;
+    u64 calls = 0;
+    for (u32 i = 0; i < n; ++i) {
+        sum += sorted[i];
+        calls += slot->history_calls[i];
+    }
+
+    X_ZERO_STRUCT(out);
+    out->name   = slot->name;
+    out->depth  = slot->depth == UINT32_MAX ? 0 : slot->depth;
+    out->frames = n;
+    if (n == 0) { return; }
+
+    out->calls_per_frame = (f64)calls / (f64)n;
+    out->min             = sorted[0];
+    out->max             = sorted[n - 1];
+    out->mean            = sum / (f64)n;
+    out->p50             = sorted[(u32)(0.50 * (n - 1) + 0.5)];
+    out->p95             = sorted[(u32)(0.95 * (n - 1) + 0.5)];
+    out->p99             = sorted[(u32)(0.99 * (n - 1) + 0.5)];
+}
+
+bool xProfilerGetStats(const char* name, xProfileStats* out) {
+    const xProfileZoneSlot* slot = findZone(name, false);
+    if (slot == NULL) { return false; }
+    computeStats(slot, out);
+    return true;
+}
+
+void xProfilerReport(FILE* stream) {
+    fprintf(stream,
+            "%-32s %8s %9s %9s %9s %9s %9s %9s\n",
+            "zone (ms/frame)",
+            "calls",
+            "min",
+            "mean",
+            "p50",
+            "p95",
+            "p99",
+            "max");
+
+    for (u32 i = 0; i < gProfiler.zone_count; ++i) {
+        xProfileStats stats;
+        computeStats(&gProfiler.zones[gProfiler.zone_order[i]], &stats);
+        if (stats.frames == 0) { continue; }
+
+        fprintf(stream,
+                "%*s%-*s %8.1f %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f\n",
+                (int)stats.depth * 2,
+                "",
+                32 - (int)X_MIN(stats.depth * 2, 16u),
+                stats.name,
+                stats.calls_per_frame,
+                stats.min,
+                stats.mean,
+                stats.p50,
+                stats.p95,
+                stats.p99,
+                stats.max);
+    }
+
+    const u32 count = ringCount();
+    for (u32 i = 0; i < count; ++i) {
+        xProfileRing* ring = atomic_load_explicit(&gProfiler.rings[i], memory_order_acquire);
+        const u32 dropped  = ring != NULL ? atomic_load_explicit(&ring->dropped, memory_order_relaxed) : 0;
+        if (dropped > 0) { fprintf(stream, "thread %u dropped %u events (ring full)\n", i, dropped); }
+    }
+}
@@ -0,0 +1,119 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+
+#include <stdio.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <x86intrin.h>
+    #endif
+    #define X_PROFILE_HAS_TSC 1
+#else
+    #define X_PROFILE_HAS_TSC 0
+#endif
+
+/* Zones compile to nothing unless the build enables them (XENC_PROFILE in CMake) */
+#ifndef X_PROFILE_ENABLED
+    #define X_PROFILE_ENABLED 0
+#endif
+
+/* Events per thread ring. Must be a power of 2. */
+#define X_PROFILE_RING_SIZE 32768
+
+#define X_PROFILE_MAX_THREADS 64
+
+/* Distinct zone names tracked by the per-frame aggregator */
+#define X_PROFILE_MAX_ZONES 256
+
+/* Frames of history kept for min/max/percentile reporting */
+#define X_PROFILE_HISTORY 256
+
+/* Name of the pseudo-zone spanning consecutive xProfilerFrameMark calls */
+#define X_PROFILE_FRAME_ZONE "Frame"
+
+typedef struct {
+    const char* name;
+    u64 begin;
+} xProfileZone;
+
+/* Per-zone statistics over the history window, in milliseconds per frame */
+typedef struct {
+    const char* name;
+    u32 depth;
+    u32 frames;
+    f64 calls_per_frame;
+    f64 min;
+    f64 max;
+    f64 mean;
+    f64 p50;
+    f64 p95;
+    f64 p99;
+} xProfileStats;
+
+/* Raw timestamp: TSC ticks on x86, nanoseconds elsewhere */
+X_FORCE_INLINE static u64 xProfileNow(void) {
+#if X_PROFILE_HAS_TSC
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (u64)ts.tv_sec * 1000000000ull + (u64)ts.tv_nsec;
+#endif
+}
+
+/* Calibrates the timestamp clock. Call once from the main thread before any zone. */
+void xProfilerInit(void);
+void xProfilerShutdown(void);
+
+xProfileZone xProfileZoneBegin(const char* name);
+void xProfileZoneEnd(xProfileZone* zone);
+
+/*
+ * Close the current frame: drain every thread's ring into the aggregator (and
+ * the trace file, if capturing). Call once per frame from the main thread.
+ */
+void xProfilerFrameMark(void);
+
+/* Write the next `frames` frames of events to `path` as Chrome trace JSON (chrome://tracing, Perfetto) */
+bool xProfilerCaptureBegin(const char* path, u32 frames);
+bool xProfilerIsCapturing(void);
+
+/* Stats for a zone by name (compared by string), false if it was never recorded */
+bool xProfilerGetStats(const char* name, xProfileStats* out);
+
+/* Print every zone's stats, in first-seen order and indented by nesting depth */
+void xProfilerReport(FILE* stream);
+
+/* Converts a span of raw timestamps to milliseconds */
+f64 xProfileTicksToMs(u64 ticks);
+
+/*
+ * X_PROFILE_SCOPE("name") times the rest of the enclosing block. Names must
+ * outlive the profiler (string literals or __func__). Scopes rely on the
+ * cleanup attribute, so compilers without it only get explicit BEGIN/END pairs.
+ */
+#if X_PROFILE_ENABLED
+    #define X_PROFILE_BEGIN(var, name) xProfileZone var = xProfileZoneBegin(name)
+    #define X_PROFILE_END(var) xProfileZoneEnd(&(var))
+    #if defined(__GNUC__) || defined(__clang__)
+        #define X_PROFILE_SCOPE(name)                                                                                  \
+            xProfileZone X_CONCAT(_profile_zone_, __LINE__) __attribute__((cleanup(xProfileZoneEnd))) =                \
+              xProfileZoneBegin(name)
+    #else
+        #define X_PROFILE_SCOPE(name) ((void)0)
+    #endif
+#else
+    #define X_PROFILE_BEGIN(var, name) ((void)0)
+    #define X_PROFILE_END(var) ((void)0)
+    #define X_PROFILE_SCOPE(name) ((void)0)
+#endif
+
+#define X_PROFILE_FUNCTION() X_PROFILE_SCOPE(__func__)
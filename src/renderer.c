@@ -2,10 +2,14 @@
 // Created: 11/21/2025.
 //
 
+#define X_MEM_TAG X_MEM_TAG_RENDERER
+
 #include "renderer.h"
+#include "capture.h"
+#include "profiler.h"
 
 xRenderer* xRendererCreate() {
-    xRenderer* renderer = X_MALLOC(xRenderer, sizeof(xRenderer));
+    xRenderer* renderer = X_NEW(xRenderer);
     X_ASSERT_MSG(renderer != NULL, "Failed to create renderer");
     return renderer;
 }
@@ -15,13 +19,604 @@ void xRendererDestroy(xRenderer* renderer) {
 }
 
 void xRendererInitialize(xRenderer* renderer, u32 width, u32 height) {
-    renderer->width  = width;
-    renderer->height = height;
+    renderer->width         = width;
+    renderer->height        = height;
+    renderer->frame_index   = 0;
+    renderer->packet        = NULL;
+    renderer->commands      = NULL;
+    renderer->streamer      = NULL;
+    renderer->stream_budget = X_RENDERER_STREAM_BUDGET_SECONDS;
+    renderer->threaded      = false;
+    renderer->capture       = NULL;
+    X_ZERO_STRUCT(&renderer->uploads);
+    X_ZERO_STRUCT(&renderer->releases);
+    X_ZERO_STRUCT(&renderer->stats);
+    atomic_init(&renderer->published, 0);
+    atomic_init(&renderer->retired, 0);
+    atomic_init(&renderer->main_waiting, false);
+    atomic_init(&renderer->render_waiting, false);
+    atomic_init(&renderer->stop, false);
+
+    const bool arena_ok = xFrameArenaInit(&renderer->frame_arena, X_RENDERER_FRAME_ARENA_SIZE);
+    X_CHECK_MSG(arena_ok, "Failed to allocate renderer frame arena");
+
+    const bool pools_ok = xPoolInit(&renderer->textures, sizeof(xTexture), X_RENDERER_MAX_TEXTURES) &&
+                          xPoolInit(&renderer->meshes, sizeof(xMesh), X_RENDERER_MAX_MESHES);
+    X_CHECK_MSG(pools_ok, "Failed to allocate renderer resource pools");
+
+    for (u32 i = 0; i < X_RENDERER_FRAME_PACKETS; ++i) {
+        xRenderFramePacket* packet = &renderer->packets[i];
+        X_ZERO_STRUCT(packet);
+        const bool commands_ok = xRenderCommandBufferInit(&packet->commands, X_RENDERER_MAX_COMMANDS);
+        packet->sort_scratch   = X_MALLOC(xRenderSortItem, X_RENDERER_MAX_COMMANDS);
+        X_CHECK_MSG(commands_ok && packet->sort_scratch != NULL, "Failed to allocate renderer frame packets");
+    }
+
+    const bool sync_ok = mtx_init(&renderer->lock, mtx_plain) == thrd_success &&
+                         cnd_init(&renderer->work) == thrd_success && cnd_init(&renderer->space) == thrd_success;
+    X_CHECK_MSG(sync_ok, "Failed to create renderer synchronization primitives");
+
+    xNullBackendInit(&renderer->null_backend);
+    renderer->backend = &renderer->null_backend.backend;
 }
 
-void xRendererShutdown(xRenderer* renderer) {}
+static void releaseRetired(xRenderer* renderer, u64 retired) {
+    u32 kept = 0;
+    X_ARRAY_FOREACH(xRenderRelease, release, &renderer->releases) {
+        if (release->retire_at <= retired) {
+            xPoolRelease(release->pool, release->handle);
+        } else {
+            renderer->releases.items[kept++] = *release;
+        }
+    }
+    renderer->releases.count = kept;
+}
+
+static void freeUploads(xRenderUploadArray* uploads) {
+    X_ARRAY_FOREACH(xRenderUpload, upload, uploads) {
+        X_MEM_FREE(upload->storage);
+    }
+    X_ARRAY_FREE(uploads);
+}
+
+void xRendererShutdown(xRenderer* renderer) {
+    xRendererCaptureEnd(renderer);
+    if (renderer->threaded) { xRendererStopThread(renderer); }
+    releaseRetired(renderer, UINT64_MAX);
+
+    if (renderer->textures.count > 0) { X_DEBUG_PRINT("%u texture(s) still alive at shutdown", renderer->textures.count); }
+    if (renderer->meshes.count > 0) { X_DEBUG_PRINT("%u mesh(es) still alive at shutdown", renderer->meshes.count); }
+
+    for (u32 i = 0; i < X_RENDERER_FRAME_PACKETS; ++i) {
+        xRenderFramePacket* packet = &renderer->packets[i];
+        xRenderCommandBufferShutdown(&packet->commands);
+        X_DELETE(packet->sort_scratch);
+        freeUploads(&packet->uploads);
+    }
+    freeUploads(&renderer->uploads);
+    X_ARRAY_FREE(&renderer->releases);
+    renderer->packet   = NULL;
+    renderer->commands = NULL;
+
+    cnd_destroy(&renderer->space);
+    cnd_destroy(&renderer->work);
+    mtx_destroy(&renderer->lock);
+    xPoolShutdown(&renderer->meshes);
+    xPoolShutdown(&renderer->textures);
+    xFrameArenaShutdown(&renderer->frame_arena);
+}
+
+/* ============================================================================
+ * CAPTURE
+ * ============================================================================ */
+
+static void captureResize(xCaptureWriter* writer, u32 width, u32 height) {
+    xCaptureResize* resize = xCaptureWriterPush(writer, X_CAPTURE_CMD_RESIZE, sizeof(xCaptureResize));
+    if (resize == NULL) { return; }
+    resize->width  = width;
+    resize->height = height;
+}
+
+/* `data` is NULL for descriptor-only textures */
+static void captureTexture(xCaptureWriter* writer,
+                           xTextureHandle handle,
+                           const xTextureDesc* desc,
+                           const xTextureData* data) {
+    const u32 mip_count = X_MIN(desc->mip_count, (u32)X_TEXTURE_MAX_MIPS);
+    u32 size            = sizeof(xCaptureTexture);
+    for (u32 i = 0; data != NULL && i < mip_count; ++i) {
+        size += X_ALIGN_UP(data->mip_sizes[i], (u32)X_CAPTURE_ALIGN);
+    }
+
+    xCaptureTexture* texture = xCaptureWriterPush(writer, X_CAPTURE_CMD_CREATE_TEXTURE, size);
+    if (texture == NULL) { return; }
+    texture->handle    = handle;
+    texture->width     = desc->width;
+    texture->height    = desc->height;
+    texture->layers    = desc->layers;
+    texture->mip_count = desc->mip_count;
+    texture->format    = desc->format;
+    texture->srgb      = desc->srgb;
+    if (data == NULL) { return; }
+
+    texture->flags = data->flags;
+    u8* mip        = (u8*)(texture + 1);
+    for (u32 i = 0; i < mip_count; ++i) {
+        texture->mip_sizes[i] = data->mip_sizes[i];
+        memcpy(mip, data->mips[i], data->mip_sizes[i]);
+        mip += X_ALIGN_UP(data->mip_sizes[i], (u32)X_CAPTURE_ALIGN);
+    }
+}
+
+/* Vertices and indices are copied: the mesh only borrows them */
+static void captureMesh(xCaptureWriter* writer, xMeshHandle handle, const xMeshDesc* desc) {
+    const u32 vertex_bytes = desc->vertices != NULL ? desc->vertex_count * (u32)sizeof(xVertex) : 0;
+    const u32 index_bytes  = desc->indices != NULL ? desc->index_count * (u32)sizeof(u32) : 0;
+    const u32 size         = sizeof(xCaptureMesh) + X_ALIGN_UP(vertex_bytes, (u32)X_CAPTURE_ALIGN) + index_bytes;
+
+    xCaptureMesh* mesh = xCaptureWriterPush(writer, X_CAPTURE_CMD_CREATE_MESH, size);
+    if (mesh == NULL) { return; }
+    mesh->handle        = handle;
+    mesh->vertex_count  = desc->vertex_count;
+    mesh->index_count   = desc->index_count;
+    mesh->vertex_stride = desc->vertex_stride;
+    mesh->has_vertices  = desc->vertices != NULL;
+    mesh->has_indices   = desc->indices != NULL;
+
+    u8* data = (u8*)(mesh + 1);
+    if (vertex_bytes > 0) { memcpy(data, desc->vertices, vertex_bytes); }
+    if (index_bytes > 0) { memcpy(data + X_ALIGN_UP(vertex_bytes, (u32)X_CAPTURE_ALIGN), desc->indices, index_bytes); }
+}
+
+static void captureDestroy(xCaptureWriter* writer, xCaptureCommandType type, xHandle handle) {
+    xCaptureDestroy* destroy = xCaptureWriterPush(writer, type, sizeof(xCaptureDestroy));
+    if (destroy != NULL) { destroy->handle = handle; }
+}
+
+/* Destroyed already, but still in the pool until the packets that may use it retire */
+static bool isPendingRelease(const xRenderer* renderer, const xPool* pool, xHandle handle) {
+    X_ARRAY_FOREACH(xRenderRelease, release, &renderer->releases) {
+        if (release->pool == pool && release->handle == handle) { return true; }
+    }
+    return false;
+}
+
+bool xRendererCaptureBegin(xRenderer* renderer, const char* path, u32 frames) {
+    if (renderer->packet != NULL) {
+        X_PRINT_ERROR("Cannot start a frame capture while a frame is being recorded");
+        return false;
+    }
+    xRendererCaptureEnd(renderer);
+
+    xCaptureWriter* writer = xCaptureWriterOpen(path, renderer->width, renderer->height);
+    if (writer == NULL) { return false; }
+
+    // The capture must replay on its own, so it starts with the renderer's current state
+    captureResize(writer, renderer->width, renderer->height);
+    const xPool* textures = &renderer->textures;
+    for (u32 i = xPoolNextAlive(textures, 0); i != X_POOL_END; i = xPoolNextAlive(textures, i + 1)) {
+        const xTextureHandle handle = xPoolHandleAt(textures, i);
+        if (isPendingRelease(renderer, textures, handle)) { continue; }
+        captureTexture(writer, handle, &((const xTexture*)xPoolAt(textures, i))->desc, NULL);
+    }
+    const xPool* meshes = &renderer->meshes;
+    for (u32 i = xPoolNextAlive(meshes, 0); i != X_POOL_END; i = xPoolNextAlive(meshes, i + 1)) {
+        const xMeshHandle handle = xPoolHandleAt(meshes, i);
+        if (isPendingRelease(renderer, meshes, handle)) { continue; }
+        captureMesh(writer, handle, &((const xMesh*)xPoolAt(meshes, i))->desc);
+    }
+    xCaptureWriterFlush(writer);
+
+    renderer->capture        = writer;
+    renderer->capture_frames = frames;
+    return true;
+}
+
+void xRendererCaptureEnd(xRenderer* renderer) {
+    // Ended mid-frame: close the frame in the file so it still replays as whole frames
+    if (renderer->capture != NULL && renderer->packet != NULL) {
+        xCaptureWriterPush(renderer->capture, X_CAPTURE_CMD_FRAME_END, 0);
+    }
+    xCaptureWriterClose(renderer->capture);
+    renderer->capture = NULL;
+}
 
 void xRendererResize(xRenderer* renderer, u32 width, u32 height) {
     renderer->width  = width;
     renderer->height = height;
-}
\ No newline at end of file
+    if (X_UNLIKELY(renderer->capture != NULL)) { captureResize(renderer->capture, width, height); }
+}
+
+void xRendererSetStreamer(xRenderer* renderer, xStreamer* streamer, f64 budget_seconds) {
+    renderer->streamer      = streamer;
+    renderer->stream_budget = budget_seconds > 0.0 ? budget_seconds : X_RENDERER_STREAM_BUDGET_SECONDS;
+}
+
+void xRendererSetBackend(xRenderer* renderer, const xRenderBackend* backend) {
+    renderer->backend = backend != NULL ? backend : &renderer->null_backend.backend;
+}
+
+/* ============================================================================
+ * BACK END
+ * ============================================================================ */
+
+/* Runs on whichever thread owns submission: the render thread, or the main thread inside FrameEnd */
+static void submitPacket(xRenderer* renderer, xRenderFramePacket* packet) {
+    X_PROFILE_FUNCTION();
+    const xRenderBackend* backend = packet->backend;
+
+    X_ARRAY_FOREACH(xRenderUpload, upload, &packet->uploads) {
+        // The handle cannot be recycled before this packet retires, so the slot is still ours to write
+        if (backend->upload_texture != NULL) {
+            xTexture* texture = xRendererTextureAt(renderer, upload->texture);
+            texture->gpu_id   = backend->upload_texture(backend->user, &upload->data);
+        }
+        X_MEM_FREE(upload->storage);
+    }
+    X_ARRAY_CLEAR(&packet->uploads);
+
+    {
+        X_PROFILE_SCOPE("xRenderSortItems");
+        xRenderSortItems(packet->commands.items, packet->sort_scratch, packet->commands.count);
+    }
+    {
+        X_PROFILE_SCOPE("xRenderSubmit");
+        xRenderSubmit(&packet->commands, backend, packet->width, packet->height, &packet->stats);
+    }
+}
+
+static void wakeIfWaiting(xRenderer* renderer, atomic_bool* waiting, cnd_t* cond) {
+    // Paired with the seq_cst flag stores in waitForRetired and renderThreadMain's wait for work: either the
+    // waiter sees the new counter or we see its flag and signal under the lock it holds until cnd_wait releases it
+    if (!atomic_load(waiting)) { return; }
+    mtx_lock(&renderer->lock);
+    cnd_signal(cond);
+    mtx_unlock(&renderer->lock);
+}
+
+static int renderThreadMain(void* arg) {
+    xRenderer* renderer           = (xRenderer*)arg;
+    const xRenderThreadDesc* desc = &renderer->thread_desc;
+    if (desc->attach != NULL) { desc->attach(desc->user); }
+
+    u64 next = atomic_load(&renderer->retired);
+    for (;;) {
+        if (atomic_load(&renderer->published) <= next) {
+            X_PROFILE_SCOPE("xRendererWaitForWork");
+            mtx_lock(&renderer->lock);
+            atomic_store(&renderer->render_waiting, true);
+            while (atomic_load(&renderer->published) <= next && !atomic_load(&renderer->stop)) {
+                cnd_wait(&renderer->work, &renderer->lock);
+            }
+            atomic_store(&renderer->render_waiting, false);
+            mtx_unlock(&renderer->lock);
+        }
+        // Stop only once everything published has been submitted
+        if (atomic_load(&renderer->published) <= next) { break; }
+
+        submitPacket(renderer, &renderer->packets[next % X_RENDERER_FRAME_PACKETS]);
+        if (desc->present != NULL) {
+            X_PROFILE_SCOPE("xRendererPresent");
+            desc->present(desc->user);
+        }
+
+        atomic_store(&renderer->retired, ++next);
+        wakeIfWaiting(renderer, &renderer->main_waiting, &renderer->space);
+    }
+
+    if (desc->detach != NULL) { desc->detach(desc->user); }
+    return 0;
+}
+
+/* ============================================================================
+ * FRONT END
+ * ============================================================================ */
+
+static void waitForRetired(xRenderer* renderer, u64 target) {
+    if (atomic_load(&renderer->retired) >= target) { return; }
+
+    X_PROFILE_SCOPE("xRendererWaitForPacket");
+    mtx_lock(&renderer->lock);
+    atomic_store(&renderer->main_waiting, true);
+    while (atomic_load(&renderer->retired) < target) {
+        cnd_wait(&renderer->space, &renderer->lock);
+    }
+    atomic_store(&renderer->main_waiting, false);
+    mtx_unlock(&renderer->lock);
+}
+
+bool xRendererStartThread(xRenderer* renderer, const xRenderThreadDesc* desc) {
+    X_ASSERT_MSG(desc != NULL, "desc is NULL");
+    X_ASSERT_MSG(renderer->packet == NULL, "Cannot start the render thread while a frame is being recorded");
+    if (renderer->threaded) {
+        X_PRINT_ERROR("Render thread is already running");
+        return false;
+    }
+
+    renderer->thread_desc = *desc;
+    atomic_store(&renderer->stop, false);
+    if (thrd_create(&renderer->thread, renderThreadMain, renderer) != thrd_success) {
+        X_PRINT_ERROR("Failed to spawn render thread");
+        return false;
+    }
+    renderer->threaded = true;
+    return true;
+}
+
+void xRendererStopThread(xRenderer* renderer) {
+    if (!renderer->threaded) { return; }
+
+    mtx_lock(&renderer->lock);
+    atomic_store(&renderer->stop, true);
+    cnd_signal(&renderer->work);
+    mtx_unlock(&renderer->lock);
+
+    thrd_join(renderer->thread, NULL);
+    renderer->threaded = false;
+    releaseRetired(renderer, atomic_load(&renderer->retired));
+}
+
+void xRendererWaitIdle(xRenderer* renderer) {
+    waitForRetired(renderer, atomic_load(&renderer->published));
+    releaseRetired(renderer, atomic_load(&renderer->retired));
+}
+
+void xRendererFrameBegin(xRenderer* renderer) {
+    X_PROFILE_FUNCTION();
+    X_ASSERT_MSG(renderer->packet == NULL, "FrameBegin called twice without FrameEnd");
+
+    // The slot is free once the packet published X_RENDERER_FRAME_PACKETS frames ago has retired,
+    // which also means nothing in flight still points into the frame arena about to be reset
+    const u64 published = atomic_load(&renderer->published);
+    if (published >= X_RENDERER_FRAME_PACKETS) { waitForRetired(renderer, published - X_RENDERER_FRAME_PACKETS + 1); }
+
+    const u64 retired = atomic_load(&renderer->retired);
+    if (retired > 0) { renderer->stats = renderer->packets[(retired - 1) % X_RENDERER_FRAME_PACKETS].stats; }
+    releaseRetired(renderer, retired);
+
+    renderer->packet   = &renderer->packets[published % X_RENDERER_FRAME_PACKETS];
+    renderer->commands = &renderer->packet->commands;
+    xFrameArenaSwap(&renderer->frame_arena);
+    xRenderCommandBufferReset(renderer->commands);
+    if (X_UNLIKELY(renderer->capture != NULL)) { xCaptureWriterPush(renderer->capture, X_CAPTURE_CMD_FRAME_BEGIN, 0); }
+    // Completion callbacks run here, so uploads for freshly loaded assets land before recording starts
+    if (renderer->streamer != NULL) { xStreamerUpdate(renderer->streamer, renderer->stream_budget); }
+}
+
+void xRendererFrameEnd(xRenderer* renderer) {
+    X_PROFILE_FUNCTION();
+    X_ASSERT_MSG(renderer->packet != NULL, "FrameEnd called without FrameBegin");
+
+    xRenderFramePacket* packet = renderer->packet;
+    packet->frame_index        = renderer->frame_index++;
+    packet->width              = renderer->width;
+    packet->height             = renderer->height;
+    packet->backend            = renderer->backend;
+    X_SWAP(packet->uploads, renderer->uploads);
+    renderer->packet   = NULL;
+    renderer->commands = NULL;
+
+    if (X_UNLIKELY(renderer->capture != NULL)) {
+        xCaptureWriterPush(renderer->capture, X_CAPTURE_CMD_FRAME_END, 0);
+        const u32 captured = xCaptureWriterFlush(renderer->capture);
+        if (renderer->capture_frames > 0 && captured >= renderer->capture_frames) { xRendererCaptureEnd(renderer); }
+    }
+
+    const u64 published = atomic_load(&renderer->published) + 1;
+    if (renderer->threaded) {
+        atomic_store(&renderer->published, published);
+        wakeIfWaiting(renderer, &renderer->render_waiting, &renderer->work);
+        return;
+    }
+
+    submitPacket(renderer, packet);
+    renderer->stats = packet->stats;
+    atomic_store(&renderer->published, published);
+    atomic_store(&renderer->retired, published);
+    releaseRetired(renderer, published);
+}
+
+void xRendererClear(xRenderer* renderer, u8 layer, u32 color, f32 depth) {
+    X_ASSERT_MSG(renderer->commands != NULL, "Clear recorded outside FrameBegin/FrameEnd");
+    if (X_UNLIKELY(renderer->capture != NULL)) {
+        xCaptureClear* clear = xCaptureWriterPush(renderer->capture, X_CAPTURE_CMD_CLEAR, sizeof(xCaptureClear));
+        if (clear != NULL) { *clear = (xCaptureClear) {layer, color, depth, 0}; }
+    }
+
+    const u64 key       = xRenderKeyMake(layer, X_RENDER_PASS_CLEAR, 0, 0, 0.0f, false);
+    xRenderCommand* cmd = xRenderCommandBufferPush(renderer->commands, key);
+    if (cmd == NULL) { return; }
+
+    cmd->type        = X_RENDER_CMD_CLEAR;
+    cmd->clear.color = color;
+    cmd->clear.depth = depth;
+}
+
+void xRendererSetViewport(xRenderer* renderer, u8 layer, s32 x, s32 y, u32 width, u32 height) {
+    X_ASSERT_MSG(renderer->commands != NULL, "Viewport recorded outside FrameBegin/FrameEnd");
+    if (X_UNLIKELY(renderer->capture != NULL)) {
+        xCaptureViewport* viewport =
+          xCaptureWriterPush(renderer->capture, X_CAPTURE_CMD_VIEWPORT, sizeof(xCaptureViewport));
+        if (viewport != NULL) { *viewport = (xCaptureViewport) {layer, {x, y, width, height}}; }
+    }
+
+    const u64 key       = xRenderKeyMake(layer, X_RENDER_PASS_STATE, 0, 0, 0.0f, false);
+    xRenderCommand* cmd = xRenderCommandBufferPush(renderer->commands, key);
+    if (cmd == NULL) { return; }
+
+    cmd->type     = X_RENDER_CMD_VIEWPORT;
+    cmd->viewport = (xRenderViewport) {x, y, width, height};
+}
+
+void xRendererDraw(xRenderer* renderer, const xRenderDraw* draw) {
+    X_ASSERT_MSG(renderer->commands != NULL, "Draw recorded outside FrameBegin/FrameEnd");
+    X_ASSERT_MSG(draw->shader < X_RENDER_MAX_SHADERS, "Shader id does not fit in the sort key");
+    // Checked here rather than in the backend, which may run on the render thread and resolves handles unchecked
+    X_ASSERT_MSG(draw->mesh == X_HANDLE_INVALID || xPoolIsValid(&renderer->meshes, draw->mesh),
+                 "Draw references a stale or destroyed mesh");
+    if (X_UNLIKELY(renderer->capture != NULL)) {
+        // Field by field so the struct's padding bytes stay zero in the file
+        xRenderDraw* recorded = xCaptureWriterPush(renderer->capture, X_CAPTURE_CMD_DRAW, sizeof(xRenderDraw));
+        if (recorded != NULL) {
+            recorded->layer          = draw->layer;
+            recorded->shader         = draw->shader;
+            recorded->material       = draw->material;
+            recorded->depth          = draw->depth;
+            recorded->state          = draw->state;
+            recorded->mesh           = draw->mesh;
+            recorded->first_index    = draw->first_index;
+            recorded->index_count    = draw->index_count;
+            recorded->instance_count = draw->instance_count;
+        }
+    }
+
+    const bool back_to_front = (draw->state & X_RENDER_STATE_BLEND) != 0;
+    const u64 key =
+      xRenderKeyMake(draw->layer, X_RENDER_PASS_DRAW, draw->shader, draw->material, draw->depth, back_to_front);
+    xRenderCommand* cmd = xRenderCommandBufferPush(renderer->commands, key);
+    if (cmd == NULL) { return; }
+
+    cmd->type = X_RENDER_CMD_DRAW;
+    cmd->draw = *draw;
+}
+
+void xRendererDrawVisible(xRenderer* renderer, const xRenderDraw* draws, const u32* visible, u32 count) {
+    for (u32 i = 0; i < count; ++i) {
+        xRendererDraw(renderer, &draws[visible[i]]);
+    }
+}
+
+u32 xRendererDrawCulled(xRenderer* renderer,
+                        xCuller* culler,
+                        const xCullBounds* bounds,
+                        const xMat4* view_projection,
+                        const xRenderDraw* draws,
+                        const xAabb* occluders,
+                        u32 occluder_count) {
+    X_PROFILE_FUNCTION();
+    X_ASSERT_MSG(renderer->packet != NULL, "Draws must be recorded between FrameBegin and FrameEnd");
+    const u32 visible = xCullerRun(culler, bounds, view_projection, occluders, occluder_count);
+    xRendererDrawVisible(renderer, draws, xCullerVisible(culler), visible);
+    return visible;
+}
+
+static xTextureHandle acquireTexture(xRenderer* renderer, const xTextureDesc* desc) {
+    X_ASSERT_MSG(desc != NULL, "desc is NULL");
+    X_ASSERT_MSG(desc->width > 0 && desc->height > 0, "Texture dimensions must be non-zero");
+
+    const xTextureHandle handle = xPoolAcquire(&renderer->textures);
+    if (handle == X_HANDLE_INVALID) {
+        X_PRINT_ERROR("Texture pool exhausted (%u textures)", renderer->textures.capacity);
+        return X_HANDLE_INVALID;
+    }
+
+    if (desc->mip_count > X_TEXTURE_MAX_MIPS) {
+        X_PRINT_ERROR("Texture has %u mip levels, keeping the first %d", desc->mip_count, X_TEXTURE_MAX_MIPS);
+    }
+
+    xTexture* texture       = xRendererGetTexture(renderer, handle);
+    texture->desc           = *desc;
+    texture->desc.layers    = X_MAX(desc->layers, 1u);
+    texture->desc.mip_count = X_CLAMP(desc->mip_count, 1u, (u32)X_TEXTURE_MAX_MIPS);
+    return handle;
+}
+
+xTextureHandle xRendererCreateTexture(xRenderer* renderer, const xTextureDesc* desc) {
+    const xTextureHandle handle = acquireTexture(renderer, desc);
+    if (X_UNLIKELY(renderer->capture != NULL) && handle != X_HANDLE_INVALID) {
+        captureTexture(renderer->capture, handle, desc, NULL);
+    }
+    return handle;
+}
+
+xTextureHandle xRendererCreateTextureFromData(xRenderer* renderer, const xTextureData* data) {
+    const xTextureHandle handle = acquireTexture(renderer, &data->desc);
+    if (handle == X_HANDLE_INVALID) { return X_HANDLE_INVALID; }
+    if (X_UNLIKELY(renderer->capture != NULL)) { captureTexture(renderer->capture, handle, &data->desc, data); }
+
+    // Backends index mips[] and mip_sizes[] by mip_count, so it never exceeds what they hold
+    xTextureData clamped   = *data;
+    clamped.desc.mip_count = X_MIN(data->desc.mip_count, (u32)X_TEXTURE_MAX_MIPS);
+
+    if (!renderer->threaded) {
+        const xRenderBackend* backend = renderer->backend;
+        if (backend->upload_texture != NULL) {
+            xRendererGetTexture(renderer, handle)->gpu_id = backend->upload_texture(backend->user, &clamped);
+        }
+        return handle;
+    }
+
+    // The caller's buffers may be gone by the time the render thread gets to them
+    const u32 mip_count = clamped.desc.mip_count;
+    size_t total        = 0;
+    for (u32 i = 0; i < mip_count; ++i) {
+        total += X_ALIGN_UP(data->mip_sizes[i], 16);
+    }
+
+    xRenderUpload upload = {.texture = handle, .data = clamped, .storage = X_MEM_ALLOC(X_MAX(total, (size_t)1))};
+    if (upload.storage == NULL) {
+        X_PRINT_ERROR("Failed to copy texture data for upload (%zu bytes)", total);
+        xPoolRelease(&renderer->textures, handle);
+        return X_HANDLE_INVALID;
+    }
+
+    u8* cursor = (u8*)upload.storage;
+    for (u32 i = 0; i < mip_count; ++i) {
+        memcpy(cursor, data->mips[i], data->mip_sizes[i]);
+        upload.data.mips[i] = cursor;
+        cursor += X_ALIGN_UP(data->mip_sizes[i], 16);
+    }
+
+    if (!X_ARRAY_PUSH(&renderer->uploads, upload)) {
+        X_PRINT_ERROR("Failed to queue texture upload");
+        X_MEM_FREE(upload.storage);
+        xPoolRelease(&renderer->textures, handle);
+        return X_HANDLE_INVALID;
+    }
+    return handle;
+}
+
+/*
+ * Packets up to and including the one being recorded may still name `handle`.
+ * Without the render thread that is only the recording packet, so the slot is
+ * freed at once between frames and once FrameEnd has submitted otherwise.
+ */
+static void deferRelease(xRenderer* renderer, xPool* pool, xHandle handle) {
+    if (!renderer->threaded && renderer->packet == NULL) {
+        xPoolRelease(pool, handle);
+        return;
+    }
+
+    const xRenderRelease release = {pool, handle, atomic_load(&renderer->published) + 1};
+    if (!X_ARRAY_PUSH(&renderer->releases, release)) {
+        // Leaking the slot is safer than recycling it while a packet still uses it
+        X_PRINT_ERROR("Failed to queue resource release, leaking handle");
+    }
+}
+
+void xRendererDestroyTexture(xRenderer* renderer, xTextureHandle texture) {
+    if (X_UNLIKELY(renderer->capture != NULL)) {
+        captureDestroy(renderer->capture, X_CAPTURE_CMD_DESTROY_TEXTURE, texture);
+    }
+    deferRelease(renderer, &renderer->textures, texture);
+}
+
+xMeshHandle xRendererCreateMesh(xRenderer* renderer, const xMeshDesc* desc) {
+    X_ASSERT_MSG(desc != NULL, "desc is NULL");
+
+    const xMeshHandle handle = xPoolAcquire(&renderer->meshes);
+    if (handle == X_HANDLE_INVALID) {
+        X_PRINT_ERROR("Mesh pool exhausted (%u meshes)", renderer->meshes.capacity);
+        return X_HANDLE_INVALID;
+    }
+
+    xMesh* mesh = xRendererGetMesh(renderer, handle);
+    mesh->desc  = *desc;
+    if (X_UNLIKELY(renderer->capture != NULL)) { captureMesh(renderer->capture, handle, desc); }
+    return handle;
+}
+
+void xRendererDestroyMesh(xRenderer* renderer, xMeshHandle mesh) {
+    if (X_UNLIKELY(renderer->capture != NULL)) { captureDestroy(renderer->capture, X_CAPTURE_CMD_DESTROY_MESH, mesh); }
+    deferRelease(renderer, &renderer->meshes, mesh);
+}
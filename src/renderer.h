@@ -5,10 +5,157 @@
 #pragma once
 
 #include "common.h"
+#include "arena.h"
+#include "pool.h"
+#include "commands.h"
+#include "backend.h"
+#include "stream.h"
+#include "texture.h"
+#include "containers.h"
+#include "cull.h"
 
+#include <stdatomic.h>
+#include <threads.h>
+
+/* Size of each of the renderer's per-frame scratch arenas */
+#define X_RENDERER_FRAME_ARENA_SIZE (4 * 1024 * 1024)
+
+/* Resource pool capacities */
+#define X_RENDERER_MAX_TEXTURES 4096
+#define X_RENDERER_MAX_MESHES 4096
+
+/* Maximum number of clear/state/draw commands recorded per frame */
+#define X_RENDERER_MAX_COMMANDS 65536
+
+/* Default time FrameBegin spends publishing streamed asset completions */
+#define X_RENDERER_STREAM_BUDGET_SECONDS 0.002
+
+/*
+ * Frame packets in flight: one being recorded while the other is submitted.
+ * FrameBegin waits for the packet recorded two frames ago to retire before
+ * resetting the frame arena it may still reference.
+ */
+#define X_RENDERER_FRAME_PACKETS 2
+
+X_STATIC_ASSERT(X_RENDERER_FRAME_PACKETS <= X_FRAME_ARENA_COUNT, "Frame arena would be reset while still in flight");
+
+typedef xHandle xTextureHandle;
+typedef xHandle xMeshHandle;
+
+/* Frame capture file being written; see capture.h */
+typedef struct xCaptureWriter xCaptureWriter;
+
+typedef struct {
+    xTextureDesc desc;
+    u32 gpu_id;
+} xTexture;
+
+/* CPU-side vertex layout. Positions are in normalized device coordinates. */
+typedef struct {
+    f32 x;
+    f32 y;
+    f32 z;
+    u32 color;
+} xVertex;
+
+/*
+ * Vertex and index data are borrowed, not copied, and must outlive the mesh.
+ * They may be NULL for GPU-only meshes; CPU backends require them. A NULL
+ * index pointer means vertices are drawn in order.
+ */
 typedef struct {
+    u32 vertex_count;
+    u32 index_count;
+    u32 vertex_stride;
+    const xVertex* vertices;
+    const u32* indices;
+} xMeshDesc;
+
+typedef struct {
+    xMeshDesc desc;
+    u32 gpu_id;
+} xMesh;
+
+/* A texture upload deferred to the render thread. `storage` owns copies of the mip levels. */
+typedef struct {
+    xTextureHandle texture;
+    xTextureData data;
+    void* storage;
+} xRenderUpload;
+
+typedef X_ARRAY(xRenderUpload) xRenderUploadArray;
+
+/* A resource handle released once every packet that could still reference it has retired */
+typedef struct {
+    xPool* pool;
+    xHandle handle;
+    u64 retire_at;
+} xRenderRelease;
+
+typedef X_ARRAY(xRenderRelease) xRenderReleaseArray;
+
+/*
+ * Everything the back end needs to submit one frame. The main thread fills a
+ * packet between FrameBegin and FrameEnd and never touches it again until it
+ * has retired; the render thread only reads it (and writes `stats`).
+ */
+typedef struct {
+    u64 frame_index;
     u32 width;
     u32 height;
+    const xRenderBackend* backend;
+    xRenderCommandBuffer commands;
+    xRenderSortItem* sort_scratch;
+    xRenderUploadArray uploads;
+    xRenderStats stats;
+} xRenderFramePacket;
+
+/*
+ * Hooks run on the render thread. `attach` runs once before the first packet
+ * (make the GL context current here), `present` after every packet (swap
+ * buffers) and `detach` once after the last. Any of them may be NULL.
+ */
+typedef struct {
+    void* user;
+    void (*attach)(void* user);
+    void (*present)(void* user);
+    void (*detach)(void* user);
+} xRenderThreadDesc;
+
+typedef struct {
+    u32 width;
+    u32 height;
+    u64 frame_index;
+    xFrameArena frame_arena;
+    xPool textures;
+    xPool meshes;
+    xRenderFramePacket packets[X_RENDERER_FRAME_PACKETS];
+    xRenderFramePacket* packet;      // being recorded; NULL outside FrameBegin/FrameEnd
+    xRenderCommandBuffer* commands;  // the recording packet's command buffer
+    xRenderUploadArray uploads;      // handed to the next published packet
+    xRenderReleaseArray releases;
+    const xRenderBackend* backend;
+    xNullBackend null_backend;
+    xRenderStats stats;  // of the most recently retired packet
+    xStreamer* streamer;
+    f64 stream_budget;
+
+    // Packet handoff. Packet `n` lives in packets[n % X_RENDERER_FRAME_PACKETS]; the main thread
+    // bumps `published` and the back end bumps `retired`, so each counter has a single writer.
+    atomic_uint_fast64_t published;
+    atomic_uint_fast64_t retired;
+    atomic_bool main_waiting;
+    atomic_bool render_waiting;
+    atomic_bool stop;
+    mtx_t lock;
+    cnd_t work;
+    cnd_t space;
+    thrd_t thread;
+    bool threaded;
+    xRenderThreadDesc thread_desc;
+
+    xCaptureWriter* capture;  // NULL unless capturing
+    u32 capture_frames;       // frames to capture, 0 until xRendererCaptureEnd
 } xRenderer;
 
 xRenderer* xRendererCreate();
@@ -18,6 +165,116 @@ void xRendererInitialize(xRenderer* renderer, u32 width, u32 height);
 void xRendererShutdown(xRenderer* renderer);
 void xRendererResize(xRenderer* renderer, u32 width, u32 height);
 
-// TODO: Figure out what this is actually going to do
-inline void xRendererFrameBegin(xRenderer* renderer) {}
-inline void xRendererFrameEnd(xRenderer* renderer) {}
+/* Route submission to `backend`; NULL restores the built-in null backend */
+void xRendererSetBackend(xRenderer* renderer, const xRenderBackend* backend);
+
+/*
+ * Drain `streamer` completions at the start of every frame, spending at most
+ * `budget_seconds` (0 picks the default) so a large level load is spread over
+ * several frames instead of hitching one. NULL detaches it.
+ */
+void xRendererSetStreamer(xRenderer* renderer, xStreamer* streamer, f64 budget_seconds);
+
+/*
+ * Move submission onto a dedicated render thread. Until this is called the
+ * renderer submits synchronously inside FrameEnd. The calling thread must have
+ * released the GL context so `desc->attach` can take it.
+ */
+bool xRendererStartThread(xRenderer* renderer, const xRenderThreadDesc* desc);
+
+/* Submit every published packet, join the render thread and return to synchronous submission */
+void xRendererStopThread(xRenderer* renderer);
+
+/* Block until the back end has retired every published packet */
+void xRendererWaitIdle(xRenderer* renderer);
+
+/*
+ * Record every renderer call into `path` (see capture.h) for the next `frames`
+ * frames, or until xRendererCaptureEnd when it is 0, for offline replay with
+ * xenc_replay. Live resources are written first. Fails between FrameBegin and
+ * FrameEnd.
+ */
+bool xRendererCaptureBegin(xRenderer* renderer, const char* path, u32 frames);
+void xRendererCaptureEnd(xRenderer* renderer);
+
+X_FORCE_INLINE static bool xRendererIsCapturing(const xRenderer* renderer) {
+    return renderer->capture != NULL;
+}
+
+/*
+ * FrameBegin claims a free frame packet and resets the frame arena. Between
+ * the two calls commands are only recorded; FrameEnd publishes the packet,
+ * which is sorted by key and submitted to the backend in one pass, either
+ * inline or on the render thread while the next frame is simulated.
+ *
+ * The packet captures the size given to xRendererResize and the current
+ * backend when it is published, so a resize takes effect on exactly the frame
+ * it was issued before.
+ */
+void xRendererFrameBegin(xRenderer* renderer);
+void xRendererFrameEnd(xRenderer* renderer);
+
+void xRendererClear(xRenderer* renderer, u8 layer, u32 color, f32 depth);
+void xRendererSetViewport(xRenderer* renderer, u8 layer, s32 x, s32 y, u32 width, u32 height);
+void xRendererDraw(xRenderer* renderer, const xRenderDraw* draw);
+
+/* Record draws[visible[i]] for each entry of a culled index list, e.g. xCullerVisible() */
+void xRendererDrawVisible(xRenderer* renderer, const xRenderDraw* draws, const u32* visible, u32 count);
+
+/*
+ * Visibility stage for the frame being recorded: cull `bounds` (entry i bounds
+ * draws[i]) against `view_projection`, with the occlusion pass when `culler` has
+ * a depth buffer and occluders are given, then record the visible draws in
+ * index order. Returns the visible count; per-stage counts and times are in
+ * xCullerStats(culler).
+ */
+u32 xRendererDrawCulled(xRenderer* renderer,
+                        xCuller* culler,
+                        const xCullBounds* bounds,
+                        const xMat4* view_projection,
+                        const xRenderDraw* draws,
+                        const xAabb* occluders,
+                        u32 occluder_count);
+
+xTextureHandle xRendererCreateTexture(xRenderer* renderer, const xTextureDesc* desc);
+
+/*
+ * Create a texture from cooked data (see xTextureBlobParse) and hand the mip
+ * levels to the backend as they are. Block-compressed data is never decoded.
+ * With the render thread running the levels are copied and uploaded before
+ * the next published packet is submitted.
+ */
+xTextureHandle xRendererCreateTextureFromData(xRenderer* renderer, const xTextureData* data);
+xMeshHandle xRendererCreateMesh(xRenderer* renderer, const xMeshDesc* desc);
+
+/* Handles are recycled only after the packets that may draw them, including the one being recorded, have retired */
+void xRendererDestroyTexture(xRenderer* renderer, xTextureHandle texture);
+void xRendererDestroyMesh(xRenderer* renderer, xMeshHandle mesh);
+
+/* Handle lookups for the thread that records frames; stale handles are caught by X_ASSERT in debug builds */
+X_FORCE_INLINE static xTexture* xRendererGetTexture(const xRenderer* renderer, xTextureHandle texture) {
+    return (xTexture*)xPoolGet(&renderer->textures, texture);
+}
+
+X_FORCE_INLINE static xMesh* xRendererGetMesh(const xRenderer* renderer, xMeshHandle mesh) {
+    return (xMesh*)xPoolGet(&renderer->meshes, mesh);
+}
+
+/*
+ * Lookups for backends and anything else running at submission, possibly on the
+ * render thread. They skip the liveness check, whose bitmap the recording thread
+ * rewrites on every acquire; handles are checked when the draw or upload is
+ * recorded instead, and a slot is not recycled until the packets using it retire.
+ */
+X_FORCE_INLINE static xTexture* xRendererTextureAt(const xRenderer* renderer, xTextureHandle texture) {
+    return (xTexture*)xPoolAt(&renderer->textures, X_HANDLE_INDEX(texture));
+}
+
+X_FORCE_INLINE static xMesh* xRendererMeshAt(const xRenderer* renderer, xMeshHandle mesh) {
+    return (xMesh*)xPoolAt(&renderer->meshes, X_HANDLE_INDEX(mesh));
+}
+
+/* Scratch memory for the current frame. Released automatically two frames later. */
+X_FORCE_INLINE static xArena* xRendererFrameArena(xRenderer* renderer) {
+    return xFrameArenaCurrent(&renderer->frame_arena);
+}
@@ -0,0 +1,837 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_SPATIAL
+
+#include "spatial.h"
+#include "hash.h"
+
+#include <math.h>
+
+/* Traversal stack kept on the C stack; deeper (badly unbalanced) trees spill to the heap */
+#define X_SPATIAL_STACK_SIZE 256
+
+/* Fat bounds are stretched this many frames ahead of the reported displacement */
+#define X_AABB_TREE_DISPLACEMENT_MULTIPLIER 4.0f
+
+/* Moved proxies per job in xAabbTreeQueryPairs, buckets per job in xSpatialHashQueryPairs */
+#define X_AABB_TREE_PAIR_GRAIN 256
+#define X_SPATIAL_HASH_PAIR_GRAIN 4096
+
+/* Cell coordinates are packed into 21 bits per axis */
+#define X_SPATIAL_HASH_CELL_BITS 21
+#define X_SPATIAL_HASH_CELL_LIMIT (1 << (X_SPATIAL_HASH_CELL_BITS - 1))
+
+/* ============================================================================
+ * SHARED
+ * ============================================================================ */
+
+typedef struct {
+    u32* items;
+    u32 count;
+    u32 capacity;
+    u32 local[X_SPATIAL_STACK_SIZE];
+} xNodeStack;
+
+static void stackInit(xNodeStack* stack) {
+    stack->items    = stack->local;
+    stack->count    = 0;
+    stack->capacity = X_SPATIAL_STACK_SIZE;
+}
+
+static void stackPush(xNodeStack* stack, u32 value) {
+    if (stack->count == stack->capacity) {
+        stack->capacity *= 2;
+        if (stack->items == stack->local) {
+            stack->items = X_MALLOC(u32, stack->capacity);
+            X_CHECK_ALLOC(stack->items);
+            memcpy(stack->items, stack->local, sizeof(stack->local));
+        } else {
+            stack->items = X_REALLOC(stack->items, u32, stack->capacity);
+            X_CHECK_ALLOC(stack->items);
+        }
+    }
+    stack->items[stack->count++] = value;
+}
+
+static void stackFree(xNodeStack* stack) {
+    if (stack->items != stack->local) { X_FREE(stack->items); }
+}
+
+static void pushPair(xSpatialPairList* list, u32 a, u32 b) {
+    if (list->count == list->capacity) {
+        list->capacity = X_MAX(list->capacity * 2, 256u);
+        list->pairs    = X_REALLOC(list->pairs, xSpatialPair, list->capacity);
+        X_CHECK_ALLOC(list->pairs);
+    }
+    list->pairs[list->count].a = X_MIN(a, b);
+    list->pairs[list->count].b = X_MAX(a, b);
+    list->count++;
+}
+
+void xSpatialPairListFree(xSpatialPairList* list) {
+    X_FREE(list->pairs);
+    list->count    = 0;
+    list->capacity = 0;
+}
+
+/*
+ * Pair queries write into one list per job thread and merge at the end, so
+ * workers never contend. Slot `thread_count` catches a caller that does not
+ * belong to the job system.
+ */
+static void scratchPrepare(xSpatialPairList** scratch, u32* scratch_count, const xJobSystem* jobs) {
+    const u32 needed = (jobs != NULL ? jobs->thread_count : 0) + 1;
+    if (*scratch_count < needed) {
+        *scratch = X_REALLOC(*scratch, xSpatialPairList, needed);
+        X_CHECK_ALLOC(*scratch);
+        memset(*scratch + *scratch_count, 0, sizeof(xSpatialPairList) * (needed - *scratch_count));
+        *scratch_count = needed;
+    }
+    for (u32 i = 0; i < *scratch_count; ++i) {
+        (*scratch)[i].count = 0;
+    }
+}
+
+static xSpatialPairList* scratchForThread(xSpatialPairList* scratch, u32 scratch_count, const xJobSystem* jobs) {
+    const u32 index = jobs != NULL ? xJobsThreadIndex(jobs) : 0;
+    return &scratch[X_MIN(index, scratch_count - 1)];
+}
+
+static void scratchMerge(const xSpatialPairList* scratch, u32 scratch_count, xSpatialPairList* out) {
+    u32 total = 0;
+    for (u32 i = 0; i < scratch_count; ++i) {
+        total += scratch[i].count;
+    }
+    if (out->capacity < total) {
+        out->capacity = total;
+        out->pairs    = X_REALLOC(out->pairs, xSpatialPair, out->capacity);
+        X_CHECK_ALLOC(out->pairs);
+    }
+    out->count = 0;
+    for (u32 i = 0; i < scratch_count; ++i) {
+        if (scratch[i].count == 0) { continue; }
+        memcpy(out->pairs + out->count, scratch[i].pairs, sizeof(xSpatialPair) * scratch[i].count);
+        out->count += scratch[i].count;
+    }
+}
+
+static void scratchFree(xSpatialPairList** scratch, u32* scratch_count) {
+    for (u32 i = 0; i < *scratch_count; ++i) {
+        xSpatialPairListFree(&(*scratch)[i]);
+    }
+    X_FREE(*scratch);
+    *scratch_count = 0;
+}
+
+X_FORCE_INLINE static xVec4 rayInverse(xVec4 direction) {
+    return xVec4Make(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z, 0.0f);
+}
+
+/* ============================================================================
+ * DYNAMIC AABB TREE
+ * ============================================================================ */
+
+X_FORCE_INLINE static bool isLeaf(const xAabbTreeNode* node) {
+    return node->left == X_AABB_TREE_NULL;
+}
+
+static void linkFreeNodes(xAabbTree* tree, u32 first) {
+    for (u32 i = first; i < tree->capacity; ++i) {
+        tree->nodes[i].parent = i + 1 < tree->capacity ? i + 1 : X_AABB_TREE_NULL;
+        tree->nodes[i].height = -1;
+        tree->nodes[i].moved  = false;
+    }
+    tree->free_head = first;
+}
+
+static u32 allocateNode(xAabbTree* tree) {
+    if (tree->free_head == X_AABB_TREE_NULL) {
+        const u32 old_capacity = tree->capacity;
+        if (old_capacity >= X_AABB_TREE_NULL / 2) { return X_AABB_TREE_NULL; }
+        xAabbTreeNode* nodes = X_REALLOC(tree->nodes, xAabbTreeNode, (size_t)old_capacity * 2);
+        if (nodes == NULL) { return X_AABB_TREE_NULL; }
+        tree->nodes    = nodes;
+        tree->capacity = old_capacity * 2;
+        linkFreeNodes(tree, old_capacity);
+    }
+
+    const u32 id        = tree->free_head;
+    xAabbTreeNode* node = &tree->nodes[id];
+    tree->free_head     = node->parent;
+    node->parent        = X_AABB_TREE_NULL;
+    node->left          = X_AABB_TREE_NULL;
+    node->right         = X_AABB_TREE_NULL;
+    node->height        = 0;
+    node->user          = 0;
+    tree->node_count++;
+    // `moved` is left alone: a recycled node may still be listed in tree->moved
+    return id;
+}
+
+static void freeNode(xAabbTree* tree, u32 id) {
+    tree->nodes[id].parent = tree->free_head;
+    tree->nodes[id].height = -1;
+    tree->free_head        = id;
+    tree->node_count--;
+}
+
+static void refitNode(xAabbTree* tree, u32 id) {
+    xAabbTreeNode* node        = &tree->nodes[id];
+    const xAabbTreeNode* left  = &tree->nodes[node->left];
+    const xAabbTreeNode* right = &tree->nodes[node->right];
+    node->height               = 1 + X_MAX(left->height, right->height);
+    node->bounds               = xAabbUnion(&left->bounds, &right->bounds);
+}
+
+static void replaceChild(xAabbTree* tree, u32 parent, u32 old_child, u32 new_child) {
+    if (parent == X_AABB_TREE_NULL) {
+        tree->root = new_child;
+    } else if (tree->nodes[parent].left == old_child) {
+        tree->nodes[parent].left = new_child;
+    } else {
+        tree->nodes[parent].right = new_child;
+    }
+}
+
+/*
+ * Rotate child `up` into the place of `a` when the subtree at `a` is out of
+ * balance by more than one level. Returns the subtree's new root.
+ */
+static u32 rotate(xAabbTree* tree, u32 a, u32 up, bool up_is_right) {
+    xAabbTreeNode* nodes = tree->nodes;
+    xAabbTreeNode* node  = &nodes[a];
+    xAabbTreeNode* pivot = &nodes[up];
+    const u32 other      = up_is_right ? node->left : node->right;
+    const u32 f          = pivot->left;
+    const u32 g          = pivot->right;
+
+    pivot->left   = a;
+    pivot->parent = node->parent;
+    node->parent  = up;
+    replaceChild(tree, pivot->parent, a, up);
+
+    // The taller of the pivot's children stays with the pivot, the other moves under `a`
+    const u32 keep = nodes[f].height > nodes[g].height ? f : g;
+    const u32 give = keep == f ? g : f;
+    pivot->right   = keep;
+    if (up_is_right) {
+        node->right = give;
+    } else {
+        node->left = give;
+    }
+    nodes[give].parent = a;
+
+    node->bounds  = xAabbUnion(&nodes[other].bounds, &nodes[give].bounds);
+    node->height  = 1 + X_MAX(nodes[other].height, nodes[give].height);
+    pivot->bounds = xAabbUnion(&node->bounds, &nodes[keep].bounds);
+    pivot->height = 1 + X_MAX(node->height, nodes[keep].height);
+    return up;
+}
+
+static u32 balance(xAabbTree* tree, u32 a) {
+    const xAabbTreeNode* node = &tree->nodes[a];
+    if (isLeaf(node) || node->height < 2) { return a; }
+
+    const s32 skew = tree->nodes[node->right].height - tree->nodes[node->left].height;
+    if (skew > 1) { return rotate(tree, a, node->right, true); }
+    if (skew < -1) { return rotate(tree, a, node->left, false); }
+    return a;
+}
+
+/* Rebalance and refit every ancestor of `id` up to the root */
+static void refitAncestors(xAabbTree* tree, u32 id) {
+    while (id != X_AABB_TREE_NULL) {
+        id = balance(tree, id);
+        refitNode(tree, id);
+        id = tree->nodes[id].parent;
+    }
+}
+
+typedef struct {
+    u32 node;
+    f32 inherited;
+} xInsertCandidate;
+
+/* Min-heap of candidates ordered by inherited cost, spilling to the heap like xNodeStack */
+typedef struct {
+    xInsertCandidate* items;
+    u32 count;
+    u32 capacity;
+    xInsertCandidate local[X_SPATIAL_STACK_SIZE];
+} xCandidateHeap;
+
+static void candidatePush(xCandidateHeap* heap, u32 node, f32 inherited) {
+    if (heap->count == heap->capacity) {
+        heap->capacity *= 2;
+        if (heap->items == heap->local) {
+            heap->items = X_MALLOC(xInsertCandidate, heap->capacity);
+            X_CHECK_ALLOC(heap->items);
+            memcpy(heap->items, heap->local, sizeof(heap->local));
+        } else {
+            heap->items = X_REALLOC(heap->items, xInsertCandidate, heap->capacity);
+            X_CHECK_ALLOC(heap->items);
+        }
+    }
+
+    u32 i = heap->count++;
+    while (i > 0 && heap->items[(i - 1) / 2].inherited > inherited) {
+        heap->items[i] = heap->items[(i - 1) / 2];
+        i              = (i - 1) / 2;
+    }
+    heap->items[i] = (xInsertCandidate) {node, inherited};
+}
+
+static xInsertCandidate candidatePop(xCandidateHeap* heap) {
+    const xInsertCandidate top  = heap->items[0];
+    const xInsertCandidate last = heap->items[--heap->count];
+    u32 i                       = 0;
+    for (;;) {
+        u32 child = i * 2 + 1;
+        if (child >= heap->count) { break; }
+        if (child + 1 < heap->count && heap->items[child + 1].inherited < heap->items[child].inherited) { child++; }
+        if (heap->items[child].inherited >= last.inherited) { break; }
+        heap->items[i] = heap->items[child];
+        i              = child;
+    }
+    heap->items[i] = last;
+    return top;
+}
+
+/*
+ * Branch-and-bound search for the sibling that minimizes the surface area
+ * heuristic. Pairing with node N costs the area of N's new parent plus the growth
+ * of every ancestor of N. Candidates are expanded cheapest-first, and a subtree is
+ * skipped once even a perfect fit (the leaf's own area) cannot beat the best so far.
+ */
+static u32 findBestSibling(const xAabbTree* tree, const xAabb* bounds) {
+    const f32 leaf_area = xAabbArea(bounds);
+    u32 best            = tree->root;
+    f32 best_cost       = INFINITY;
+
+    xCandidateHeap heap;
+    heap.items    = heap.local;
+    heap.count    = 0;
+    heap.capacity = X_SPATIAL_STACK_SIZE;
+    candidatePush(&heap, tree->root, 0.0f);
+
+    while (heap.count > 0) {
+        const xInsertCandidate candidate = candidatePop(&heap);
+        if (candidate.inherited + leaf_area >= best_cost) { break; }
+
+        const xAabbTreeNode* node = &tree->nodes[candidate.node];
+        const xAabb combined      = xAabbUnion(&node->bounds, bounds);
+        const f32 combined_area   = xAabbArea(&combined);
+        const f32 cost            = combined_area + candidate.inherited;
+        if (cost < best_cost) {
+            best      = candidate.node;
+            best_cost = cost;
+        }
+
+        if (isLeaf(node)) { continue; }
+        const f32 inherited = candidate.inherited + combined_area - xAabbArea(&node->bounds);
+        if (inherited + leaf_area < best_cost) {
+            candidatePush(&heap, node->left, inherited);
+            candidatePush(&heap, node->right, inherited);
+        }
+    }
+
+    if (heap.items != heap.local) { X_FREE(heap.items); }
+    return best;
+}
+
+static bool insertLeaf(xAabbTree* tree, u32 leaf) {
+    if (tree->root == X_AABB_TREE_NULL) {
+        tree->root               = leaf;
+        tree->nodes[leaf].parent = X_AABB_TREE_NULL;
+        return true;
+    }
+
+    const u32 sibling = findBestSibling(tree, &tree->nodes[leaf].bounds);
+    const u32 parent  = allocateNode(tree);
+    if (parent == X_AABB_TREE_NULL) { return false; }
+
+    xAabbTreeNode* nodes  = tree->nodes;  // may have moved
+    const u32 old_parent  = nodes[sibling].parent;
+    nodes[parent].parent  = old_parent;
+    nodes[parent].left    = sibling;
+    nodes[parent].right   = leaf;
+    nodes[parent].bounds  = xAabbUnion(&nodes[leaf].bounds, &nodes[sibling].bounds);
+    nodes[parent].height  = nodes[sibling].height + 1;
+    nodes[sibling].parent = parent;
+    nodes[leaf].parent    = parent;
+    replaceChild(tree, old_parent, sibling, parent);
+
+    refitAncestors(tree, parent);
+    return true;
+}
+
+static void removeLeaf(xAabbTree* tree, u32 leaf) {
+    if (leaf == tree->root) {
+        tree->root = X_AABB_TREE_NULL;
+        return;
+    }
+
+    xAabbTreeNode* nodes  = tree->nodes;
+    const u32 parent      = nodes[leaf].parent;
+    const u32 grandparent = nodes[parent].parent;
+    const u32 sibling     = nodes[parent].left == leaf ? nodes[parent].right : nodes[parent].left;
+    nodes[sibling].parent = grandparent;
+    replaceChild(tree, grandparent, parent, sibling);
+    freeNode(tree, parent);
+
+    refitAncestors(tree, grandparent);
+}
+
+static void markMoved(xAabbTree* tree, u32 proxy) {
+    if (tree->nodes[proxy].moved) { return; }
+    if (tree->moved_count == tree->moved_capacity) {
+        tree->moved_capacity = X_MAX(tree->moved_capacity * 2, 256u);
+        tree->moved          = X_REALLOC(tree->moved, u32, tree->moved_capacity);
+        X_CHECK_ALLOC(tree->moved);
+    }
+    tree->nodes[proxy].moved         = true;
+    tree->moved[tree->moved_count++] = proxy;
+}
+
+X_FORCE_INLINE static xAabb fatten(const xAabb* bounds, f32 margin) {
+    const xVec4 grow = xVec4Make(margin, margin, margin, 0.0f);
+    return xAabbMake(xVec4Sub(bounds->min, grow), xVec4Add(bounds->max, grow));
+}
+
+bool xAabbTreeInit(xAabbTree* tree, u32 capacity, f32 margin) {
+    X_ZERO_STRUCT(tree);
+    tree->capacity = X_MAX(capacity, 16u);
+    tree->nodes    = X_MALLOC(xAabbTreeNode, tree->capacity);
+    if (tree->nodes == NULL) {
+        X_PRINT_ERROR("Failed to allocate %u AABB tree nodes", tree->capacity);
+        return false;
+    }
+    X_ASSERT_MSG(X_IS_ALIGNED(tree->nodes, 16), "AABB tree nodes are under-aligned");
+    tree->root   = X_AABB_TREE_NULL;
+    tree->margin = margin;
+    linkFreeNodes(tree, 0);
+    return true;
+}
+
+void xAabbTreeShutdown(xAabbTree* tree) {
+    X_FREE(tree->nodes);
+    X_FREE(tree->moved);
+    scratchFree(&tree->scratch, &tree->scratch_count);
+    X_ZERO_STRUCT(tree);
+}
+
+u32 xAabbTreeInsert(xAabbTree* tree, const xAabb* bounds, u64 user) {
+    const u32 proxy = allocateNode(tree);
+    if (proxy == X_AABB_TREE_NULL) { return X_AABB_TREE_NULL; }
+
+    tree->nodes[proxy].bounds = fatten(bounds, tree->margin);
+    tree->nodes[proxy].user   = user;
+    if (!insertLeaf(tree, proxy)) {
+        freeNode(tree, proxy);
+        return X_AABB_TREE_NULL;
+    }
+    markMoved(tree, proxy);
+    return proxy;
+}
+
+void xAabbTreeRemove(xAabbTree* tree, u32 proxy) {
+    X_ASSERT_MSG(proxy < tree->capacity && tree->nodes[proxy].height == 0, "Invalid AABB tree proxy");
+    removeLeaf(tree, proxy);
+    freeNode(tree, proxy);
+}
+
+bool xAabbTreeMove(xAabbTree* tree, u32 proxy, const xAabb* bounds, xVec4 displacement) {
+    X_ASSERT_MSG(proxy < tree->capacity && tree->nodes[proxy].height == 0, "Invalid AABB tree proxy");
+
+    // Predict where the object is heading so steady motion re-inserts every few frames, not every frame
+    xAabb fat       = fatten(bounds, tree->margin);
+    const xVec4 d   = xVec4Scale(displacement, X_AABB_TREE_DISPLACEMENT_MULTIPLIER);
+    const xVec4 off = xVec4Splat(0.0f);
+    fat.min         = xVec4Add(fat.min, xVec4Min(d, off));
+    fat.max         = xVec4Add(fat.max, xVec4Max(d, off));
+
+    const xAabb* current = &tree->nodes[proxy].bounds;
+    if (xAabbContains(current, bounds)) {
+        // Still inside; only re-insert if the old fat bounds have become much too large
+        const xAabb loose = fatten(&fat, 4.0f * tree->margin);
+        if (xAabbContains(&loose, current)) { return false; }
+    }
+
+    removeLeaf(tree, proxy);
+    tree->nodes[proxy].bounds = fat;
+    // Removing freed the old parent, so re-inserting reuses it and cannot fail
+    insertLeaf(tree, proxy);
+    markMoved(tree, proxy);
+    return true;
+}
+
+u32 xAabbTreeHeight(const xAabbTree* tree) {
+    return tree->root == X_AABB_TREE_NULL ? 0 : (u32)tree->nodes[tree->root].height;
+}
+
+void xAabbTreeQuery(const xAabbTree* tree, const xAabb* region, xSpatialQueryFn fn, void* user) {
+    if (tree->root == X_AABB_TREE_NULL) { return; }
+
+    xNodeStack stack;
+    stackInit(&stack);
+    stackPush(&stack, tree->root);
+    while (stack.count > 0) {
+        const u32 id              = stack.items[--stack.count];
+        const xAabbTreeNode* node = &tree->nodes[id];
+        if (!xAabbOverlaps(&node->bounds, region)) { continue; }
+        if (isLeaf(node)) {
+            if (!fn(user, id)) { break; }
+        } else {
+            stackPush(&stack, node->left);
+            stackPush(&stack, node->right);
+        }
+    }
+    stackFree(&stack);
+}
+
+void xAabbTreeRayCast(const xAabbTree* tree, const xRay* ray, xSpatialRayFn fn, void* user) {
+    if (tree->root == X_AABB_TREE_NULL) { return; }
+
+    const xVec4 inverse = rayInverse(ray->direction);
+    f32 max_t           = ray->max_t;
+
+    xNodeStack stack;
+    stackInit(&stack);
+    stackPush(&stack, tree->root);
+    while (stack.count > 0) {
+        const u32 id              = stack.items[--stack.count];
+        const xAabbTreeNode* node = &tree->nodes[id];
+        const f32 t               = xAabbRayEntry(&node->bounds, ray->origin, inverse, max_t);
+        if (t < 0.0f) { continue; }
+        if (isLeaf(node)) {
+            max_t = X_MIN(max_t, fn(user, id, t));
+            if (max_t <= 0.0f) { break; }
+        } else {
+            stackPush(&stack, node->left);
+            stackPush(&stack, node->right);
+        }
+    }
+    stackFree(&stack);
+}
+
+typedef struct {
+    const xAabbTree* tree;
+    xSpatialPairList* scratch;
+    u32 scratch_count;
+    const xJobSystem* jobs;
+} xTreePairJob;
+
+/*
+ * Query each moved proxy against the whole tree. A pair of two moved proxies is
+ * found from both sides, so only the query from the lower id reports it.
+ */
+static void treePairRange(void* data, u32 begin, u32 end) {
+    const xTreePairJob* job    = (const xTreePairJob*)data;
+    const xAabbTreeNode* nodes = job->tree->nodes;
+    xSpatialPairList* out      = scratchForThread(job->scratch, job->scratch_count, job->jobs);
+
+    xNodeStack stack;
+    stackInit(&stack);
+    for (u32 i = begin; i < end; ++i) {
+        const u32 query     = job->tree->moved[i];
+        const xAabb* region = &nodes[query].bounds;
+
+        stack.count = 0;
+        stackPush(&stack, job->tree->root);
+        while (stack.count > 0) {
+            const u32 id              = stack.items[--stack.count];
+            const xAabbTreeNode* node = &nodes[id];
+            if (!xAabbOverlaps(&node->bounds, region)) { continue; }
+            if (!isLeaf(node)) {
+                stackPush(&stack, node->left);
+                stackPush(&stack, node->right);
+            } else if (id != query && (!node->moved || id > query)) {
+                pushPair(out, query, id);
+            }
+        }
+    }
+    stackFree(&stack);
+}
+
+void xAabbTreeQueryPairs(xAabbTree* tree, xJobSystem* jobs, xSpatialPairList* out) {
+    // Drop ids that were removed (or recycled as internal nodes) since they were marked
+    u32 live = 0;
+    for (u32 i = 0; i < tree->moved_count; ++i) {
+        const u32 id = tree->moved[i];
+        if (tree->nodes[id].height == 0) {
+            tree->moved[live++] = id;
+        } else {
+            tree->nodes[id].moved = false;
+        }
+    }
+    tree->moved_count = live;
+
+    scratchPrepare(&tree->scratch, &tree->scratch_count, jobs);
+    xTreePairJob job = {tree, tree->scratch, tree->scratch_count, jobs};
+    xJobsParallelFor(jobs, tree->moved_count, X_AABB_TREE_PAIR_GRAIN, treePairRange, &job);
+    scratchMerge(tree->scratch, tree->scratch_count, out);
+
+    for (u32 i = 0; i < tree->moved_count; ++i) {
+        tree->nodes[tree->moved[i]].moved = false;
+    }
+    tree->moved_count = 0;
+}
+
+/* ============================================================================
+ * SPATIAL HASH
+ * ============================================================================ */
+
+typedef struct {
+    s32 v[3];
+} xCell;
+
+X_FORCE_INLINE static s32 cellCoord(const xSpatialHash* hash, f32 value) {
+    const f32 cell = floorf(value * hash->inverse_cell_size);
+    return (s32)X_CLAMP(cell, (f32)-X_SPATIAL_HASH_CELL_LIMIT, (f32)(X_SPATIAL_HASH_CELL_LIMIT - 1));
+}
+
+X_FORCE_INLINE static xCell cellOf(const xSpatialHash* hash, xVec4 point) {
+    xCell cell = {{cellCoord(hash, point.x), cellCoord(hash, point.y), cellCoord(hash, point.z)}};
+    return cell;
+}
+
+X_FORCE_INLINE static u64 cellKey(s32 x, s32 y, s32 z) {
+    const u64 bias = X_SPATIAL_HASH_CELL_LIMIT;
+    return (((u64)x + bias) << (X_SPATIAL_HASH_CELL_BITS * 2)) | (((u64)y + bias) << X_SPATIAL_HASH_CELL_BITS) |
+           ((u64)z + bias);
+}
+
+X_FORCE_INLINE static u32 bucketOf(const xSpatialHash* hash, u64 key) {
+    return (u32)xHashMix64(key) & (hash->bucket_count - 1);
+}
+
+X_FORCE_INLINE static bool cellInRange(const xCell* cell, const xCell* lo, const xCell* hi) {
+    return cell->v[0] >= lo->v[0] && cell->v[0] <= hi->v[0] && cell->v[1] >= lo->v[1] && cell->v[1] <= hi->v[1] &&
+           cell->v[2] >= lo->v[2] && cell->v[2] <= hi->v[2];
+}
+
+#define X_CELL_FOREACH(lo, hi, x, y, z)                                                                                \
+    for (s32 z = (lo).v[2]; z <= (hi).v[2]; ++z)                                                                       \
+        for (s32 y = (lo).v[1]; y <= (hi).v[1]; ++y)                                                                   \
+            for (s32 x = (lo).v[0]; x <= (hi).v[0]; ++x)
+
+bool xSpatialHashInit(xSpatialHash* hash, f32 cell_size) {
+    X_ZERO_STRUCT(hash);
+    X_CHECK_MSG(cell_size > 0.0f, "Spatial hash cell size must be positive");
+    hash->cell_size         = cell_size;
+    hash->inverse_cell_size = 1.0f / cell_size;
+    return true;
+}
+
+void xSpatialHashShutdown(xSpatialHash* hash) {
+    X_FREE(hash->bounds);
+    X_FREE(hash->bucket_start);
+    X_FREE(hash->cursor);
+    X_FREE(hash->keys);
+    X_FREE(hash->objects);
+    scratchFree(&hash->scratch, &hash->scratch_count);
+    X_ZERO_STRUCT(hash);
+}
+
+bool xSpatialHashBuild(xSpatialHash* hash, const xAabb* bounds, u32 count) {
+    if (count > hash->object_capacity) {
+        X_FREE(hash->bounds);
+        hash->bounds          = X_MALLOC(xAabb, count);
+        hash->object_capacity = hash->bounds != NULL ? count : 0;
+        if (hash->bounds == NULL) { return false; }
+    }
+    memcpy(hash->bounds, bounds, sizeof(xAabb) * count);
+    hash->object_count = count;
+
+    // Two buckets per object keeps chains short for the common one-cell-per-object case
+    u32 buckets = 64;
+    while (buckets < count * 2 && buckets < (1u << 30)) {
+        buckets <<= 1;
+    }
+    if (buckets != hash->bucket_count) {
+        X_FREE(hash->bucket_start);
+        X_FREE(hash->cursor);
+        hash->bucket_start = X_MALLOC(u32, buckets + 1);
+        hash->cursor       = X_MALLOC(u32, buckets);
+        hash->bucket_count = buckets;
+        if (hash->bucket_start == NULL || hash->cursor == NULL) {
+            hash->bucket_count = 0;
+            return false;
+        }
+    }
+
+    // Counting sort by bucket: count, prefix sum, scatter
+    memset(hash->bucket_start, 0, sizeof(u32) * (buckets + 1));
+    u64 entries = 0;
+    for (u32 i = 0; i < count; ++i) {
+        const xCell lo = cellOf(hash, bounds[i].min);
+        const xCell hi = cellOf(hash, bounds[i].max);
+        X_CELL_FOREACH(lo, hi, x, y, z) {
+            hash->bucket_start[bucketOf(hash, cellKey(x, y, z)) + 1]++;
+            entries++;
+        }
+    }
+    if (entries > UINT32_MAX) {
+        X_PRINT_ERROR("Spatial hash cell size %.3f is far too small for these objects", hash->cell_size);
+        return false;
+    }
+    if (entries > hash->entry_capacity) {
+        X_FREE(hash->keys);
+        X_FREE(hash->objects);
+        hash->keys           = X_MALLOC(u64, entries);
+        hash->objects        = X_MALLOC(u32, entries);
+        hash->entry_capacity = (u32)entries;
+        if (hash->keys == NULL || hash->objects == NULL) {
+            hash->entry_capacity = 0;
+            return false;
+        }
+    }
+    hash->entry_count = (u32)entries;
+
+    for (u32 b = 0; b < buckets; ++b) {
+        hash->bucket_start[b + 1] += hash->bucket_start[b];
+    }
+    memcpy(hash->cursor, hash->bucket_start, sizeof(u32) * buckets);
+    for (u32 i = 0; i < count; ++i) {
+        const xCell lo = cellOf(hash, bounds[i].min);
+        const xCell hi = cellOf(hash, bounds[i].max);
+        X_CELL_FOREACH(lo, hi, x, y, z) {
+            const u64 key       = cellKey(x, y, z);
+            const u32 slot      = hash->cursor[bucketOf(hash, key)]++;
+            hash->keys[slot]    = key;
+            hash->objects[slot] = i;
+        }
+    }
+    return true;
+}
+
+void xSpatialHashQuery(const xSpatialHash* hash, const xAabb* region, xSpatialQueryFn fn, void* user) {
+    if (hash->object_count == 0) { return; }
+    const xCell lo = cellOf(hash, region->min);
+    const xCell hi = cellOf(hash, region->max);
+
+    // A region covering more cells than there are objects is cheaper to answer by brute force
+    const u64 cells = (u64)(hi.v[0] - lo.v[0] + 1) * (u64)(hi.v[1] - lo.v[1] + 1) * (u64)(hi.v[2] - lo.v[2] + 1);
+    if (cells > hash->object_count) {
+        for (u32 i = 0; i < hash->object_count; ++i) {
+            if (xAabbOverlaps(&hash->bounds[i], region) && !fn(user, i)) { return; }
+        }
+        return;
+    }
+
+    X_CELL_FOREACH(lo, hi, x, y, z) {
+        const u64 key    = cellKey(x, y, z);
+        const u32 bucket = bucketOf(hash, key);
+        for (u32 e = hash->bucket_start[bucket]; e < hash->bucket_start[bucket + 1]; ++e) {
+            if (hash->keys[e] != key) { continue; }
+            // Report an object only from the first cell it shares with the region
+            const u32 id      = hash->objects[e];
+            const xCell first = cellOf(hash, hash->bounds[id].min);
+            if (x != X_MAX(first.v[0], lo.v[0]) || y != X_MAX(first.v[1], lo.v[1]) ||
+                z != X_MAX(first.v[2], lo.v[2])) {
+                continue;
+            }
+            if (xAabbOverlaps(&hash->bounds[id], region) && !fn(user, id)) { return; }
+        }
+    }
+}
+
+/*
+ * 3D DDA over the cells the ray crosses. The walk is monotonic on every axis, so
+ * it passes through each object's block of cells in one contiguous run; an object
+ * is tested only in the first cell of that run.
+ */
+void xSpatialHashRayCast(const xSpatialHash* hash, const xRay* ray, xSpatialRayFn fn, void* user) {
+    if (hash->object_count == 0) { return; }
+
+    const xVec4 inverse = rayInverse(ray->direction);
+    f32 max_t           = ray->max_t;
+    xCell cell          = cellOf(hash, ray->origin);
+    xCell previous      = cell;
+    bool has_previous   = false;
+
+    s32 step[3];
+    f32 t_next[3], t_delta[3];
+    for (u32 axis = 0; axis < 3; ++axis) {
+        const f32 d   = ray->direction.v[axis];
+        step[axis]    = d > 0.0f ? 1 : (d < 0.0f ? -1 : 0);
+        t_delta[axis] = step[axis] != 0 ? hash->cell_size * fabsf(inverse.v[axis]) : INFINITY;
+        if (step[axis] == 0) {
+            t_next[axis] = INFINITY;
+        } else {
+            const f32 boundary = (f32)(cell.v[axis] + (step[axis] > 0 ? 1 : 0)) * hash->cell_size;
+            t_next[axis]       = (boundary - ray->origin.v[axis]) * inverse.v[axis];
+        }
+    }
+
+    f32 t_cell = 0.0f;
+    while (t_cell <= max_t) {
+        const u64 key    = cellKey(cell.v[0], cell.v[1], cell.v[2]);
+        const u32 bucket = bucketOf(hash, key);
+        for (u32 e = hash->bucket_start[bucket]; e < hash->bucket_start[bucket + 1]; ++e) {
+            if (hash->keys[e] != key) { continue; }
+            const u32 id        = hash->objects[e];
+            const xAabb* bounds = &hash->bounds[id];
+            if (has_previous) {
+                const xCell lo = cellOf(hash, bounds->min);
+                const xCell hi = cellOf(hash, bounds->max);
+                if (cellInRange(&previous, &lo, &hi)) { continue; }
+            }
+            const f32 t = xAabbRayEntry(bounds, ray->origin, inverse, max_t);
+            if (t < 0.0f) { continue; }
+            max_t = X_MIN(max_t, fn(user, id, t));
+            if (max_t <= 0.0f) { return; }
+        }
+
+        const u32 axis = t_next[0] < t_next[1] ? (t_next[0] < t_next[2] ? 0 : 2) : (t_next[1] < t_next[2] ? 1 : 2);
+        if (t_next[axis] == INFINITY) { return; }
+        previous     = cell;
+        has_previous = true;
+        t_cell       = t_next[axis];
+        cell.v[axis] += step[axis];
+        t_next[axis] += t_delta[axis];
+        if (cell.v[axis] < -X_SPATIAL_HASH_CELL_LIMIT || cell.v[axis] >= X_SPATIAL_HASH_CELL_LIMIT) { return; }
+    }
+}
+
+typedef struct {
+    const xSpatialHash* hash;
+    xSpatialPairList* scratch;
+    u32 scratch_count;
+    const xJobSystem* jobs;
+} xHashPairJob;
+
+/* Two objects can share several cells; the pair is reported from the first one only */
+static void hashPairRange(void* data, u32 begin, u32 end) {
+    const xHashPairJob* job  = (const xHashPairJob*)data;
+    const xSpatialHash* hash = job->hash;
+    xSpatialPairList* out    = scratchForThread(job->scratch, job->scratch_count, job->jobs);
+
+    for (u32 bucket = begin; bucket < end; ++bucket) {
+        const u32 first = hash->bucket_start[bucket];
+        const u32 last  = hash->bucket_start[bucket + 1];
+        for (u32 i = first; i < last; ++i) {
+            const u32 a      = hash->objects[i];
+            const xCell lo_a = cellOf(hash, hash->bounds[a].min);
+            for (u32 j = i + 1; j < last; ++j) {
+                if (hash->keys[j] != hash->keys[i]) { continue; }
+                const u32 b      = hash->objects[j];
+                const xCell lo_b = cellOf(hash, hash->bounds[b].min);
+                const u64 shared = cellKey(
+                  X_MAX(lo_a.v[0], lo_b.v[0]), X_MAX(lo_a.v[1], lo_b.v[1]), X_MAX(lo_a.v[2], lo_b.v[2]));
+                if (shared == hash->keys[i] && xAabbOverlaps(&hash->bounds[a], &hash->bounds[b])) {
+                    pushPair(out, a, b);
+                }
+            }
+        }
+    }
+}
+
+void xSpatialHashQueryPairs(xSpatialHash* hash, xJobSystem* jobs, xSpatialPairList* out) {
+    scratchPrepare(&hash->scratch, &hash->scratch_count, jobs);
+    xHashPairJob job = {hash, hash->scratch, hash->scratch_count, jobs};
+    xJobsParallelFor(jobs, hash->bucket_count, X_SPATIAL_HASH_PAIR_GRAIN, hashPairRange, &job);
+    scratchMerge(hash->scratch, hash->scratch_count, out);
+}
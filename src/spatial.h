@@ -0,0 +1,217 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "jobs.h"
+#include "vecmath.h"
+
+/* ============================================================================
+ * SHARED TYPES
+ * ============================================================================ */
+
+/* Axis-aligned box; w is ignored so min/max can be combined with xVec4 ops */
+typedef struct {
+    xVec4 min;
+    xVec4 max;
+} xAabb;
+
+/* Ray from `origin` along `direction` (not necessarily unit length); hits are reported in units of t */
+typedef struct {
+    xVec4 origin;
+    xVec4 direction;
+    f32 max_t;
+} xRay;
+
+/* Two overlapping objects, a < b */
+typedef struct {
+    u32 a;
+    u32 b;
+} xSpatialPair;
+
+typedef struct {
+    xSpatialPair* pairs;
+    u32 count;
+    u32 capacity;
+} xSpatialPairList;
+
+/* Return false to stop the query early */
+typedef bool (*xSpatialQueryFn)(void* user, u32 id);
+
+/*
+ * Called for every candidate whose bounds the ray enters at `t`. The return value
+ * clips the ray: `t` for closest-hit queries, 0 to stop, or any value past the
+ * ray's max_t (e.g. INFINITY) to keep going unchanged.
+ */
+typedef f32 (*xSpatialRayFn)(void* user, u32 id, f32 t);
+
+X_FORCE_INLINE static xAabb xAabbMake(xVec4 min, xVec4 max) {
+    xAabb box = {min, max};
+    return box;
+}
+
+X_FORCE_INLINE static xAabb xAabbUnion(const xAabb* a, const xAabb* b) {
+    return xAabbMake(xVec4Min(a->min, b->min), xVec4Max(a->max, b->max));
+}
+
+X_FORCE_INLINE static bool xAabbOverlaps(const xAabb* a, const xAabb* b) {
+    return a->min.x <= b->max.x && a->max.x >= b->min.x && a->min.y <= b->max.y && a->max.y >= b->min.y &&
+           a->min.z <= b->max.z && a->max.z >= b->min.z;
+}
+
+X_FORCE_INLINE static bool xAabbContains(const xAabb* outer, const xAabb* inner) {
+    return outer->min.x <= inner->min.x && outer->min.y <= inner->min.y && outer->min.z <= inner->min.z &&
+           outer->max.x >= inner->max.x && outer->max.y >= inner->max.y && outer->max.z >= inner->max.z;
+}
+
+/* Half the surface area; only ever compared, so the factor of two is dropped */
+X_FORCE_INLINE static f32 xAabbArea(const xAabb* box) {
+    const xVec4 d = xVec4Sub(box->max, box->min);
+    return d.x * d.y + d.y * d.z + d.z * d.x;
+}
+
+/* Entry distance along the ray, or a negative value on a miss. `inverse` is 1 / direction. */
+X_FORCE_INLINE static f32 xAabbRayEntry(const xAabb* box, xVec4 origin, xVec4 inverse, f32 max_t) {
+    const xVec4 t0  = xVec4Mul(xVec4Sub(box->min, origin), inverse);
+    const xVec4 t1  = xVec4Mul(xVec4Sub(box->max, origin), inverse);
+    const xVec4 lo  = xVec4Min(t0, t1);
+    const xVec4 hi  = xVec4Max(t0, t1);
+    const f32 t_in  = X_MAX(X_MAX(lo.x, lo.y), X_MAX(lo.z, 0.0f));
+    const f32 t_out = X_MIN(X_MIN(hi.x, hi.y), X_MIN(hi.z, max_t));
+    return t_in <= t_out ? t_in : -1.0f;
+}
+
+void xSpatialPairListFree(xSpatialPairList* list);
+
+/* ============================================================================
+ * DYNAMIC AABB TREE
+ * ============================================================================ */
+
+#define X_AABB_TREE_NULL UINT32_MAX
+
+/*
+ * Leaves store a "fat" copy of the object's bounds, grown by a margin and in the
+ * direction of travel, so small movements do not touch the tree at all. Internal
+ * nodes are kept balanced with AVL-style rotations.
+ */
+typedef struct {
+    xAabb bounds;
+    u64 user;
+    u32 parent;  // next free node while on the free list
+    u32 left;
+    u32 right;
+    s32 height;  // 0 for leaves, -1 for free nodes
+    bool moved;
+} xAabbTreeNode;
+
+/*
+ * All nodes live in one contiguous array that doubles when full; freed nodes go
+ * on an index free list. Proxy ids are leaf node indices and stay stable until
+ * the proxy is removed.
+ */
+typedef struct {
+    xAabbTreeNode* nodes;
+    u32 capacity;
+    u32 node_count;
+    u32 free_head;
+    u32 root;
+    f32 margin;
+
+    // Proxies inserted or re-inserted since the last xAabbTreeQueryPairs
+    u32* moved;
+    u32 moved_count;
+    u32 moved_capacity;
+
+    // Per-thread pair lists, merged at the end of xAabbTreeQueryPairs
+    xSpatialPairList* scratch;
+    u32 scratch_count;
+} xAabbTree;
+
+bool xAabbTreeInit(xAabbTree* tree, u32 capacity, f32 margin);
+void xAabbTreeShutdown(xAabbTree* tree);
+
+/* Returns the proxy id, or X_AABB_TREE_NULL when the node array cannot grow */
+u32 xAabbTreeInsert(xAabbTree* tree, const xAabb* bounds, u64 user);
+void xAabbTreeRemove(xAabbTree* tree, u32 proxy);
+
+/*
+ * Update a proxy's bounds. `displacement` is the expected movement for the next
+ * frame and stretches the fat bounds ahead of the object. Returns true when the
+ * proxy had to be re-inserted.
+ */
+bool xAabbTreeMove(xAabbTree* tree, u32 proxy, const xAabb* bounds, xVec4 displacement);
+
+X_FORCE_INLINE static u64 xAabbTreeUser(const xAabbTree* tree, u32 proxy) {
+    return tree->nodes[proxy].user;
+}
+
+X_FORCE_INLINE static const xAabb* xAabbTreeFatBounds(const xAabbTree* tree, u32 proxy) {
+    return &tree->nodes[proxy].bounds;
+}
+
+/* Height of the root, 0 for an empty tree */
+u32 xAabbTreeHeight(const xAabbTree* tree);
+
+/*
+ * Queries only read the tree, so any number may run concurrently (e.g. a batch
+ * spread over xJobsParallelFor) as long as nothing modifies it meanwhile.
+ * Results are proxies whose fat bounds match; callers test exact shapes.
+ */
+void xAabbTreeQuery(const xAabbTree* tree, const xAabb* region, xSpatialQueryFn fn, void* user);
+void xAabbTreeRayCast(const xAabbTree* tree, const xRay* ray, xSpatialRayFn fn, void* user);
+
+/*
+ * Overlapping fat-bound pairs that involve at least one proxy moved since the
+ * previous call, each pair reported once. Clears the moved set. Queries for the
+ * moved proxies are spread over `jobs` (may be NULL).
+ */
+void xAabbTreeQueryPairs(xAabbTree* tree, xJobSystem* jobs, xSpatialPairList* out);
+
+/* ============================================================================
+ * SPATIAL HASH
+ * ============================================================================ */
+
+/*
+ * Uniform grid over unbounded space: each cell hashes into a bucket table and
+ * objects are registered in every cell they touch. Rebuilt from scratch each
+ * frame with a counting sort, which beats incremental updates when most objects
+ * move and are about the size of a cell.
+ *
+ * Entries are sorted by bucket; `keys` holds the exact packed cell coordinates so
+ * two cells that share a bucket are never confused.
+ */
+typedef struct {
+    f32 cell_size;
+    f32 inverse_cell_size;
+
+    xAabb* bounds;
+    u32 object_count;
+    u32 object_capacity;
+
+    u32* bucket_start;  // bucket_count + 1 offsets into keys/objects
+    u32 bucket_count;
+
+    u64* keys;
+    u32* objects;
+    u32 entry_count;
+    u32 entry_capacity;
+
+    u32* cursor;  // build scratch
+    xSpatialPairList* scratch;
+    u32 scratch_count;
+} xSpatialHash;
+
+bool xSpatialHashInit(xSpatialHash* hash, f32 cell_size);
+void xSpatialHashShutdown(xSpatialHash* hash);
+
+/* Replace the contents with `count` objects; ids are indices into `bounds`, which is copied */
+bool xSpatialHashBuild(xSpatialHash* hash, const xAabb* bounds, u32 count);
+
+/* Read-only like the tree queries; each object is reported at most once */
+void xSpatialHashQuery(const xSpatialHash* hash, const xAabb* region, xSpatialQueryFn fn, void* user);
+void xSpatialHashRayCast(const xSpatialHash* hash, const xRay* ray, xSpatialRayFn fn, void* user);
+
+/* Every overlapping pair, each reported once. Buckets are spread over `jobs` (may be NULL). */
+void xSpatialHashQueryPairs(xSpatialHash* hash, xJobSystem* jobs, xSpatialPairList* out);
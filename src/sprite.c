@@ -0,0 +1,284 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_RENDERER
+
+#include "sprite.h"
+#include "platform.h"
+#include "profiler.h"
+
+#include <math.h>
+
+/* ============================================================================
+ * VERTEX GENERATION
+ * ============================================================================ */
+
+/* Round half away from zero with a plain truncating convert; floorf is a libm call on baseline x86-64 */
+static s16 quantizePosition(f32 pixels) {
+    const f32 fixed = X_CLAMP(pixels * (f32)(1 << X_SPRITE_SUBPIXEL_BITS), -32768.0f, 32767.0f);
+    return (s16)(s32)(fixed + (fixed >= 0.0f ? 0.5f : -0.5f));
+}
+
+static u16 quantizeUnorm(f32 value) {
+    return (u16)(X_CLAMP(value, 0.0f, 1.0f) * 65535.0f + 0.5f);
+}
+
+void xSpriteGenerateQuads(const xSprite* sprites, u32 count, xSpriteVertex* out) {
+    for (u32 i = 0; i < count; ++i) {
+        const xSprite* sprite = &sprites[i];
+        const f32 half_w      = sprite->width * 0.5f;
+        const f32 half_h      = sprite->height * 0.5f;
+
+        // Half extents along the sprite's own x and y axes
+        f32 ax = half_w;
+        f32 ay = 0.0f;
+        f32 bx = 0.0f;
+        f32 by = half_h;
+        if (sprite->rotation != 0.0f) {
+            const f32 c = cosf(sprite->rotation);
+            const f32 s = sinf(sprite->rotation);
+            ax          = c * half_w;
+            ay          = s * half_w;
+            bx          = -s * half_h;
+            by          = c * half_h;
+        }
+
+        const u16 u0    = quantizeUnorm(sprite->u0);
+        const u16 v0    = quantizeUnorm(sprite->v0);
+        const u16 u1    = quantizeUnorm(sprite->u1);
+        const u16 v1    = quantizeUnorm(sprite->v1);
+        const u16 layer = (u16)X_MIN(sprite->layer, 0xFFFFu);
+        const u32 color = sprite->color;
+
+        // Whole-vertex stores in order; the destination may be write-combined and must never be read
+        xSpriteVertex* quad = out + (size_t)i * 4;
+
+        quad[0] = (xSpriteVertex) {quantizePosition(sprite->x - ax - bx),
+                                   quantizePosition(sprite->y - ay - by),
+                                   u0,
+                                   v0,
+                                   color,
+                                   layer,
+                                   0};
+        quad[1] = (xSpriteVertex) {quantizePosition(sprite->x + ax - bx),
+                                   quantizePosition(sprite->y + ay - by),
+                                   u1,
+                                   v0,
+                                   color,
+                                   layer,
+                                   0};
+        quad[2] = (xSpriteVertex) {quantizePosition(sprite->x + ax + bx),
+                                   quantizePosition(sprite->y + ay + by),
+                                   u1,
+                                   v1,
+                                   color,
+                                   layer,
+                                   0};
+        quad[3] = (xSpriteVertex) {quantizePosition(sprite->x - ax + bx),
+                                   quantizePosition(sprite->y - ay + by),
+                                   u0,
+                                   v1,
+                                   color,
+                                   layer,
+                                   0};
+    }
+}
+
+void xSpriteGenerateIndices(u32 quad_count, u32* out) {
+    for (u32 i = 0; i < quad_count; ++i) {
+        const u32 base = i * 4;
+        u32* indices   = out + (size_t)i * 6;
+        indices[0]     = base + 0;
+        indices[1]     = base + 1;
+        indices[2]     = base + 2;
+        indices[3]     = base + 2;
+        indices[4]     = base + 3;
+        indices[5]     = base + 0;
+    }
+}
+
+typedef struct {
+    const xSprite* sprites;
+    xSpriteVertex* vertices;
+} xSpriteGenerateJob;
+
+static void generateJob(void* data, u32 begin, u32 end) {
+    const xSpriteGenerateJob* job = (const xSpriteGenerateJob*)data;
+    xSpriteGenerateQuads(job->sprites + begin, end - begin, job->vertices + (size_t)begin * 4);
+}
+
+/* ============================================================================
+ * BATCHER
+ * ============================================================================ */
+
+bool xSpriteBatcherInit(xSpriteBatcher* batcher, const xSpriteBackend* backend, xJobSystem* jobs) {
+    X_ASSERT_MSG(backend != NULL && backend->vertices != NULL, "Sprite backend has no vertex memory");
+    X_ASSERT_MSG(backend->partition_quads > 0, "Sprite backend has an empty ring");
+
+    X_ZERO_STRUCT(batcher);
+    batcher->backend = backend;
+    batcher->jobs    = jobs;
+
+    // Sized up front so queuing a sprite never reallocates mid-frame
+    if (!X_ARRAY_RESERVE(&batcher->sprites, backend->partition_quads)) {
+        X_PRINT_ERROR("Failed to allocate sprite queue (%u sprites)", backend->partition_quads);
+        return false;
+    }
+    return true;
+}
+
+void xSpriteBatcherShutdown(xSpriteBatcher* batcher) {
+    X_ARRAY_FREE(&batcher->batches);
+    X_ARRAY_FREE(&batcher->sprites);
+}
+
+void xSpriteBatcherBegin(xSpriteBatcher* batcher, u32 width, u32 height) {
+    batcher->width  = width;
+    batcher->height = height;
+    X_ARRAY_CLEAR(&batcher->sprites);
+    X_ARRAY_CLEAR(&batcher->batches);
+    batcher->dropped = 0;
+}
+
+void xSpriteBatcherSetShader(xSpriteBatcher* batcher, u32 shader) {
+    batcher->shader = shader;
+}
+
+void xSpriteBatcherSetTexture(xSpriteBatcher* batcher, u32 texture) {
+    batcher->texture = texture;
+}
+
+void xSpriteBatcherDraw(xSpriteBatcher* batcher, const xSprite* sprite) {
+    xSpriteBatcherDrawN(batcher, sprite, 1);
+}
+
+void xSpriteBatcherDrawN(xSpriteBatcher* batcher, const xSprite* sprites, u32 count) {
+    const u32 room = batcher->backend->partition_quads - batcher->sprites.count;
+    if (X_UNLIKELY(count > room)) {
+        if (batcher->dropped == 0) {
+            X_PRINT_ERROR("Sprite partition full (%u quads), dropping sprites", batcher->backend->partition_quads);
+        }
+        batcher->dropped += count - room;
+        count = room;
+    }
+    if (count == 0) { return; }
+
+    xSpriteBatch* last = batcher->batches.count > 0 ? &X_ARRAY_LAST(&batcher->batches) : NULL;
+    if (last == NULL || last->shader != batcher->shader || last->texture != batcher->texture) {
+        const xSpriteBatch batch = {batcher->shader, batcher->texture, batcher->sprites.count, 0};
+        if (!X_ARRAY_PUSH(&batcher->batches, batch)) {
+            X_PRINT_ERROR("Failed to grow sprite batch list");
+            batcher->dropped += count;
+            return;
+        }
+        last = &X_ARRAY_LAST(&batcher->batches);
+    }
+
+    // Capacity was reserved at init, so this is a plain copy
+    X_ARRAY_PUSH_N(&batcher->sprites, sprites, count);
+    last->quad_count += count;
+}
+
+void xSpriteBatcherEnd(xSpriteBatcher* batcher) {
+    X_PROFILE_FUNCTION();
+    const xSpriteBackend* backend = batcher->backend;
+    const u32 count               = batcher->sprites.count;
+
+    X_ZERO_STRUCT(&batcher->stats);
+    batcher->stats.sprites = count;
+    batcher->stats.batches = batcher->batches.count;
+    batcher->stats.dropped = batcher->dropped;
+    if (count == 0) { return; }
+
+    const u32 partition  = (u32)(batcher->frame_index % X_SPRITE_RING_PARTITIONS);
+    const u32 first_quad = partition * backend->partition_quads;
+    if (backend->wait_partition != NULL) {
+        X_PROFILE_SCOPE("xSpriteWaitPartition");
+        backend->wait_partition(backend->user, partition);
+    }
+
+    {
+        X_PROFILE_SCOPE("xSpriteGenerateQuads");
+        const f64 start         = xPlatformTime();
+        xSpriteVertex* vertices = backend->vertices + (size_t)first_quad * 4;
+        xSpriteGenerateJob job  = {batcher->sprites.items, vertices};
+        const bool parallel     = batcher->jobs != NULL && count >= X_SPRITE_PARALLEL_THRESHOLD;
+        if (parallel) {
+            xJobsParallelFor(batcher->jobs, count, X_SPRITE_JOB_GRAIN, generateJob, &job);
+        } else {
+            xSpriteGenerateQuads(batcher->sprites.items, count, vertices);
+        }
+        batcher->stats.generate_seconds = xPlatformTime() - start;
+    }
+
+    backend->begin(backend->user, batcher->width, batcher->height);
+    X_ARRAY_FOREACH(xSpriteBatch, batch, &batcher->batches) {
+        batch->first_quad += first_quad;
+        backend->draw(backend->user, batch);
+    }
+    if (backend->fence_partition != NULL) { backend->fence_partition(backend->user, partition); }
+
+    batcher->frame_index++;
+}
+
+/* ============================================================================
+ * NULL BACKEND
+ * ============================================================================ */
+
+static void nullWaitPartition(void* user, u32 partition) {
+    X_UNUSED(partition);
+    ((xSpriteNullBackend*)user)->waits++;
+}
+
+static void nullFencePartition(void* user, u32 partition) {
+    X_UNUSED(partition);
+    ((xSpriteNullBackend*)user)->fences++;
+}
+
+static void nullBegin(void* user, u32 width, u32 height) {
+    X_UNUSED(width);
+    X_UNUSED(height);
+    ((xSpriteNullBackend*)user)->frames++;
+}
+
+static void nullDraw(void* user, const xSpriteBatch* batch) {
+    xSpriteNullBackend* nb = (xSpriteNullBackend*)user;
+    X_ASSERT_MSG(batch->first_quad + batch->quad_count <= X_SPRITE_RING_PARTITIONS * nb->backend.partition_quads,
+                 "Sprite batch runs past the ring");
+
+    nb->draws++;
+    nb->quads += batch->quad_count;
+    if (batch->shader != nb->current_shader) {
+        nb->current_shader = batch->shader;
+        nb->shader_changes++;
+    }
+    if (batch->texture != nb->current_texture) {
+        nb->current_texture = batch->texture;
+        nb->texture_changes++;
+    }
+}
+
+bool xSpriteNullBackendInit(xSpriteNullBackend* null_backend, u32 partition_quads) {
+    X_ZERO_STRUCT(null_backend);
+    if (partition_quads == 0) { partition_quads = X_SPRITE_DEFAULT_PARTITION_QUADS; }
+
+    xSpriteBackend* backend  = &null_backend->backend;
+    backend->vertices        = X_MALLOC(xSpriteVertex, (size_t)X_SPRITE_RING_PARTITIONS * partition_quads * 4);
+    backend->partition_quads = partition_quads;
+    if (backend->vertices == NULL) {
+        X_PRINT_ERROR("Failed to allocate sprite ring (%u quads per partition)", partition_quads);
+        return false;
+    }
+
+    backend->user            = null_backend;
+    backend->wait_partition  = nullWaitPartition;
+    backend->fence_partition = nullFencePartition;
+    backend->begin           = nullBegin;
+    backend->draw            = nullDraw;
+    return true;
+}
+
+void xSpriteNullBackendShutdown(xSpriteNullBackend* null_backend) {
+    X_DELETE(null_backend->backend.vertices);
+}
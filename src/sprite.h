@@ -0,0 +1,192 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "containers.h"
+#include "jobs.h"
+
+/*
+ * Batched 2D quads. Sprites are queued on the CPU, expanded into compact
+ * quantized vertices at End and streamed straight into backend memory: for the
+ * GL backend a persistently mapped buffer split into X_SPRITE_RING_PARTITIONS
+ * partitions, each guarded by a fence so the CPU never writes what the GPU is
+ * still reading. Consecutive sprites share a draw until the shader or texture
+ * array changes; the array slice travels per vertex and never breaks a batch.
+ *
+ * The batcher is not part of xRenderer's command stream: xSpriteBatcherEnd
+ * calls the backend directly on the calling thread. With the GL backend that
+ * thread must own the GL context, so it only works alongside a renderer that
+ * submits on the context thread, i.e. one that never started a render thread
+ * (xRendererStartThread hands the context to that thread). The GL backend
+ * asserts this in debug builds.
+ */
+
+/* Partitions in the streaming ring: the CPU fills one while the GPU reads the others */
+#define X_SPRITE_RING_PARTITIONS 3
+
+/* Default quads per partition (64 bytes each) */
+#define X_SPRITE_DEFAULT_PARTITION_QUADS 65536
+
+/* Position precision: vertex coordinates are pixels in 13.3 fixed point, so [-4096, 4096) px on screen */
+#define X_SPRITE_SUBPIXEL_BITS 3
+
+/* Frames with at least this many sprites generate vertices on the job system */
+#define X_SPRITE_PARALLEL_THRESHOLD 8192
+
+/* Sprites per vertex generation job */
+#define X_SPRITE_JOB_GRAIN 2048
+
+/* 16 bytes: quantized position, unorm16 texcoords, X_COLOR_RGBA color and texture array slice */
+typedef struct {
+    s16 x;
+    s16 y;
+    u16 u;
+    u16 v;
+    u32 color;
+    u16 layer;
+    u16 reserved;
+} xSpriteVertex;
+
+X_STATIC_ASSERT(sizeof(xSpriteVertex) == 16, "xSpriteVertex is uploaded as-is");
+
+/* Screen-space sprite. Pixels with a top-left origin; rotation is in radians about the center. */
+typedef struct {
+    f32 x;
+    f32 y;
+    f32 width;
+    f32 height;
+    f32 rotation;
+    f32 u0;
+    f32 v0;
+    f32 u1;
+    f32 v1;
+    u32 color;
+    u32 layer;
+} xSprite;
+
+/* One draw: `quad_count` quads starting at `first_quad` in the backend's vertex memory */
+typedef struct {
+    u32 shader;
+    u32 texture;
+    u32 first_quad;
+    u32 quad_count;
+} xSpriteBatch;
+
+/*
+ * `vertices` is the whole ring, X_SPRITE_RING_PARTITIONS * partition_quads * 4
+ * vertices, and stays mapped for the backend's lifetime. The batcher only
+ * writes it sequentially, which suits write-combined GPU memory.
+ */
+typedef struct {
+    void* user;
+    xSpriteVertex* vertices;
+    u32 partition_quads;
+    // Block until the GPU has finished reading `partition`
+    void (*wait_partition)(void* user, u32 partition);
+    // Called after the last draw that reads `partition`
+    void (*fence_partition)(void* user, u32 partition);
+    void (*begin)(void* user, u32 width, u32 height);
+    void (*draw)(void* user, const xSpriteBatch* batch);
+} xSpriteBackend;
+
+typedef struct {
+    u32 sprites;
+    u32 batches;
+    u32 dropped;
+    f64 generate_seconds;
+} xSpriteStats;
+
+typedef X_ARRAY(xSprite) xSpriteArray;
+typedef X_ARRAY(xSpriteBatch) xSpriteBatchArray;
+
+typedef struct {
+    const xSpriteBackend* backend;
+    xJobSystem* jobs;
+    xSpriteArray sprites;
+    xSpriteBatchArray batches;
+    u32 shader;
+    u32 texture;
+    u32 width;
+    u32 height;
+    u32 dropped;
+    u64 frame_index;
+    xSpriteStats stats;  // of the last frame closed by End
+} xSpriteBatcher;
+
+/* Vertices are generated on `jobs` for large frames; NULL keeps everything on the calling thread */
+bool xSpriteBatcherInit(xSpriteBatcher* batcher, const xSpriteBackend* backend, xJobSystem* jobs);
+void xSpriteBatcherShutdown(xSpriteBatcher* batcher);
+
+/* Open a frame for a `width` x `height` pixel target. State carries over from the previous frame. */
+void xSpriteBatcherBegin(xSpriteBatcher* batcher, u32 width, u32 height);
+
+/* Generate vertices into the next ring partition and issue one backend draw per batch */
+void xSpriteBatcherEnd(xSpriteBatcher* batcher);
+
+void xSpriteBatcherSetShader(xSpriteBatcher* batcher, u32 shader);
+void xSpriteBatcherSetTexture(xSpriteBatcher* batcher, u32 texture);
+
+/* Sprites past a partition's capacity are dropped and counted in the stats */
+void xSpriteBatcherDraw(xSpriteBatcher* batcher, const xSprite* sprite);
+void xSpriteBatcherDrawN(xSpriteBatcher* batcher, const xSprite* sprites, u32 count);
+
+/* Expand `count` sprites into 4 vertices each (top-left, top-right, bottom-right, bottom-left) */
+void xSpriteGenerateQuads(const xSprite* sprites, u32 count, xSpriteVertex* out);
+
+/* Quad index pattern (0 1 2, 2 3 0) for `quad_count` quads into `out`, which holds quad_count * 6 entries */
+void xSpriteGenerateIndices(u32 quad_count, u32* out);
+
+/* ============================================================================
+ * NULL BACKEND
+ * ============================================================================ */
+
+/* Heap-backed ring with no GPU behind it, for tests and benchmarks. Keeps running totals. */
+typedef struct {
+    xSpriteBackend backend;
+    u64 frames;
+    u64 draws;
+    u64 quads;
+    u64 waits;
+    u64 fences;
+    u64 texture_changes;
+    u64 shader_changes;
+    u32 current_shader;
+    u32 current_texture;
+} xSpriteNullBackend;
+
+bool xSpriteNullBackendInit(xSpriteNullBackend* null_backend, u32 partition_quads);
+void xSpriteNullBackendShutdown(xSpriteNullBackend* null_backend);
+
+/* ============================================================================
+ * OPENGL BACKEND
+ * ============================================================================ */
+
+/*
+ * GL 4.6 backend. The vertex ring is one immutable buffer mapped persistent
+ * and coherent at init; each partition is protected by a fence sync. Shader 0
+ * selects the built-in program; any other value is used as a GL program name
+ * with the same attribute layout. Textures are GL_TEXTURE_2D_ARRAY names.
+ * Every call, including Init and Shutdown, must come from the thread that owns
+ * the GL context; Init records it as the only thread allowed to drive the
+ * backend.
+ */
+typedef struct {
+    xSpriteBackend backend;
+    u32 vertex_buffer;
+    u32 index_buffer;
+    u32 vertex_array;
+    u32 program;
+    u32 white_texture;  // bound for texture 0, so untextured sprites are just their color
+    f32 transform[4];   // 13.3 fixed-point pixels to clip space: scale x, scale y, offset x, offset y
+    void* fences[X_SPRITE_RING_PARTITIONS];
+    u32 bound_shader;
+    u32 bound_texture;
+    thrd_t context_thread;
+} xSpriteGLBackend;
+
+/* 0 picks X_SPRITE_DEFAULT_PARTITION_QUADS */
+bool xSpriteGLBackendInit(xSpriteGLBackend* gl_backend, u32 partition_quads);
+void xSpriteGLBackendShutdown(xSpriteGLBackend* gl_backend);
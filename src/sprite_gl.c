@@ -0,0 +1,243 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_RENDERER
+
+#include <glad.h>
+
+#include "sprite.h"
+#include "profiler.h"
+
+#include <stddef.h>
+
+/* Nanoseconds each glClientWaitSync blocks before checking again */
+#define X_SPRITE_GL_WAIT_SLICE_NS 1000000
+
+static const char* kSpriteVertexShader = "#version 460 core\n"
+                                         "layout(location = 0) in vec2 a_position;\n"
+                                         "layout(location = 1) in vec2 a_texcoord;\n"
+                                         "layout(location = 2) in vec4 a_color;\n"
+                                         "layout(location = 3) in uint a_layer;\n"
+                                         "uniform vec4 u_transform;\n"
+                                         "out vec3 v_texcoord;\n"
+                                         "out vec4 v_color;\n"
+                                         "void main() {\n"
+                                         "    gl_Position = vec4(a_position * u_transform.xy + u_transform.zw, 0, 1);\n"
+                                         "    v_texcoord  = vec3(a_texcoord, float(a_layer));\n"
+                                         "    v_color     = a_color;\n"
+                                         "}\n";
+
+static const char* kSpriteFragmentShader = "#version 460 core\n"
+                                           "layout(binding = 0) uniform sampler2DArray u_texture;\n"
+                                           "in vec3 v_texcoord;\n"
+                                           "in vec4 v_color;\n"
+                                           "out vec4 o_color;\n"
+                                           "void main() {\n"
+                                           "    o_color = texture(u_texture, v_texcoord) * v_color;\n"
+                                           "}\n";
+
+static GLuint compileShader(GLenum type, const char* source) {
+    const GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+
+    GLint ok = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        X_PRINT_ERROR("Sprite shader failed to compile: %s", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+static GLuint linkProgram(void) {
+    const GLuint vertex   = compileShader(GL_VERTEX_SHADER, kSpriteVertexShader);
+    const GLuint fragment = compileShader(GL_FRAGMENT_SHADER, kSpriteFragmentShader);
+    if (vertex == 0 || fragment == 0) {
+        glDeleteShader(vertex);
+        glDeleteShader(fragment);
+        return 0;
+    }
+
+    const GLuint program = glCreateProgram();
+    glAttachShader(program, vertex);
+    glAttachShader(program, fragment);
+    glLinkProgram(program);
+    glDeleteShader(vertex);
+    glDeleteShader(fragment);
+
+    GLint ok = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok) {
+        char log[1024];
+        glGetProgramInfoLog(program, sizeof(log), NULL, log);
+        X_PRINT_ERROR("Sprite program failed to link: %s", log);
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+/* GL calls from any other thread would land on whatever context it has current, or none */
+static void assertContextThread(const xSpriteGLBackend* gb) {
+    X_ASSERT_MSG(thrd_equal(thrd_current(), gb->context_thread),
+                 "Sprite GL backend driven off its GL context thread; is a render thread running?");
+    X_UNUSED(gb);
+}
+
+static void waitPartition(void* user, u32 partition) {
+    xSpriteGLBackend* gb = (xSpriteGLBackend*)user;
+    assertContextThread(gb);
+    const GLsync fence   = (GLsync)gb->fences[partition];
+    if (fence == NULL) { return; }
+
+    // Normally already signaled: the GPU finished this partition two frames ago
+    GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+    for (;;) {
+        const GLenum result = glClientWaitSync(fence, flags, X_SPRITE_GL_WAIT_SLICE_NS);
+        if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) { break; }
+        if (result == GL_WAIT_FAILED) {
+            X_PRINT_ERROR("glClientWaitSync failed on sprite partition %u", partition);
+            break;
+        }
+        flags = 0;
+    }
+    glDeleteSync(fence);
+    gb->fences[partition] = NULL;
+}
+
+static void fencePartition(void* user, u32 partition) {
+    xSpriteGLBackend* gb = (xSpriteGLBackend*)user;
+    assertContextThread(gb);
+    gb->fences[partition] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+static void beginFrame(void* user, u32 width, u32 height) {
+    xSpriteGLBackend* gb = (xSpriteGLBackend*)user;
+    const f32 subpixel   = (f32)(1 << X_SPRITE_SUBPIXEL_BITS);
+    assertContextThread(gb);
+
+    // Top-left origin, y down
+    gb->transform[0] = 2.0f / ((f32)X_MAX(width, 1u) * subpixel);
+    gb->transform[1] = -2.0f / ((f32)X_MAX(height, 1u) * subpixel);
+    gb->transform[2] = -1.0f;
+    gb->transform[3] = 1.0f;
+
+    glViewport(0, 0, (GLsizei)width, (GLsizei)height);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glBindVertexArray(gb->vertex_array);
+
+    // Anything else may have touched GL state since the last frame
+    gb->bound_shader  = 0;
+    gb->bound_texture = 0;
+}
+
+static void drawBatch(void* user, const xSpriteBatch* batch) {
+    xSpriteGLBackend* gb = (xSpriteGLBackend*)user;
+    assertContextThread(gb);
+
+    const GLuint program = batch->shader != 0 ? batch->shader : gb->program;
+    if (program != gb->bound_shader) {
+        glUseProgram(program);
+        glProgramUniform4fv(program, glGetUniformLocation(program, "u_transform"), 1, gb->transform);
+        gb->bound_shader = program;
+    }
+
+    const GLuint texture = batch->texture != 0 ? batch->texture : gb->white_texture;
+    if (texture != gb->bound_texture) {
+        glBindTextureUnit(0, texture);
+        gb->bound_texture = texture;
+    }
+
+    glDrawElementsBaseVertex(GL_TRIANGLES,
+                             (GLsizei)(batch->quad_count * 6),
+                             GL_UNSIGNED_INT,
+                             NULL,
+                             (GLint)(batch->first_quad * 4));
+}
+
+bool xSpriteGLBackendInit(xSpriteGLBackend* gl_backend, u32 partition_quads) {
+    X_PROFILE_FUNCTION();
+    X_ZERO_STRUCT(gl_backend);
+    gl_backend->context_thread = thrd_current();
+    if (partition_quads == 0) { partition_quads = X_SPRITE_DEFAULT_PARTITION_QUADS; }
+    X_ASSERT_MSG((u64)partition_quads * X_SPRITE_RING_PARTITIONS * 4 <= INT32_MAX, "Sprite ring too large");
+
+    const GLsizeiptr ring_bytes = (GLsizeiptr)sizeof(xSpriteVertex) * 4 * partition_quads * X_SPRITE_RING_PARTITIONS;
+    const GLbitfield map_flags  = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    glCreateBuffers(1, &gl_backend->vertex_buffer);
+    glNamedBufferStorage(gl_backend->vertex_buffer, ring_bytes, NULL, map_flags);
+    void* mapped = glMapNamedBufferRange(gl_backend->vertex_buffer, 0, ring_bytes, map_flags);
+    if (mapped == NULL) {
+        X_PRINT_ERROR("Failed to map sprite ring (%lld bytes)", (long long)ring_bytes);
+        xSpriteGLBackendShutdown(gl_backend);
+        return false;
+    }
+
+    // Every partition starts its quads at index 0 and offsets with the base vertex, so one pattern serves all
+    u32* indices = X_MALLOC(u32, (size_t)partition_quads * 6);
+    if (indices == NULL) {
+        X_PRINT_ERROR("Failed to allocate sprite indices (%u quads)", partition_quads);
+        xSpriteGLBackendShutdown(gl_backend);
+        return false;
+    }
+    xSpriteGenerateIndices(partition_quads, indices);
+    glCreateBuffers(1, &gl_backend->index_buffer);
+    glNamedBufferStorage(gl_backend->index_buffer, (GLsizeiptr)sizeof(u32) * partition_quads * 6, indices, 0);
+    X_FREE(indices);
+
+    glCreateVertexArrays(1, &gl_backend->vertex_array);
+    const GLuint va = gl_backend->vertex_array;
+    glVertexArrayVertexBuffer(va, 0, gl_backend->vertex_buffer, 0, sizeof(xSpriteVertex));
+    glVertexArrayElementBuffer(va, gl_backend->index_buffer);
+    glVertexArrayAttribFormat(va, 0, 2, GL_SHORT, GL_FALSE, offsetof(xSpriteVertex, x));
+    glVertexArrayAttribFormat(va, 1, 2, GL_UNSIGNED_SHORT, GL_TRUE, offsetof(xSpriteVertex, u));
+    glVertexArrayAttribFormat(va, 2, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(xSpriteVertex, color));
+    glVertexArrayAttribIFormat(va, 3, 1, GL_UNSIGNED_SHORT, offsetof(xSpriteVertex, layer));
+    for (GLuint attrib = 0; attrib < 4; ++attrib) {
+        glEnableVertexArrayAttrib(va, attrib);
+        glVertexArrayAttribBinding(va, attrib, 0);
+    }
+
+    gl_backend->program = linkProgram();
+    if (gl_backend->program == 0) {
+        xSpriteGLBackendShutdown(gl_backend);
+        return false;
+    }
+
+    const u32 white = X_COLOR_RGBA(255, 255, 255, 255);
+    glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &gl_backend->white_texture);
+    glTextureStorage3D(gl_backend->white_texture, 1, GL_RGBA8, 1, 1, 1);
+    glTextureSubImage3D(gl_backend->white_texture, 0, 0, 0, 0, 1, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &white);
+
+    xSpriteBackend* backend  = &gl_backend->backend;
+    backend->user            = gl_backend;
+    backend->vertices        = (xSpriteVertex*)mapped;
+    backend->partition_quads = partition_quads;
+    backend->wait_partition  = waitPartition;
+    backend->fence_partition = fencePartition;
+    backend->begin           = beginFrame;
+    backend->draw            = drawBatch;
+    return true;
+}
+
+void xSpriteGLBackendShutdown(xSpriteGLBackend* gl_backend) {
+    for (u32 i = 0; i < X_SPRITE_RING_PARTITIONS; ++i) {
+        waitPartition(gl_backend, i);
+    }
+
+    if (gl_backend->backend.vertices != NULL) { glUnmapNamedBuffer(gl_backend->vertex_buffer); }
+    glDeleteTextures(1, &gl_backend->white_texture);
+    glDeleteProgram(gl_backend->program);
+    glDeleteVertexArrays(1, &gl_backend->vertex_array);
+    glDeleteBuffers(1, &gl_backend->index_buffer);
+    glDeleteBuffers(1, &gl_backend->vertex_buffer);
+    X_ZERO_STRUCT(gl_backend);
+}
@@ -0,0 +1,724 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_ASSETS
+
+#include "stream.h"
+#include "profiler.h"
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <threads.h>
+
+#if defined(__linux__)
+    #include <errno.h>
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <sys/uio.h>
+    #include <unistd.h>
+    #if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+        #define X_STREAM_HAS_IO_URING 1
+    #endif
+#endif
+
+#ifndef X_STREAM_HAS_IO_URING
+    #define X_STREAM_HAS_IO_URING 0
+#endif
+
+#define X_STREAM_NONE UINT32_MAX
+
+/* Where a request is on the I/O side. Guarded by the streamer lock. */
+typedef enum {
+    X_STREAM_PHASE_IDLE = 0,  // not owned by the I/O side (never queued, cancelled or drained)
+    X_STREAM_PHASE_QUEUED,
+    X_STREAM_PHASE_ACTIVE,
+    X_STREAM_PHASE_COMPLETE,  // finished, waiting for xStreamerUpdate
+} xStreamPhase;
+
+typedef struct {
+    char path[X_STREAM_MAX_PATH];
+    u64 offset;
+    u64 size;
+    u64 done;
+    u64 charged;  // bytes counted against the in-flight cap
+    u64 sequence;
+    u8* data;
+    xStreamCallback callback;
+    void* user;
+    xPlatformFile file;
+#if X_STREAM_HAS_IO_URING
+    struct iovec iov;
+#endif
+    s32 priority;
+    u32 heap_index;
+    u32 next;
+    u8 phase;
+    u8 status;  // main thread only
+    bool owns_data;
+    bool failed;
+    bool cancelled;
+    bool released;  // main thread only
+} xStreamSlot;
+
+#if X_STREAM_HAS_IO_URING
+typedef struct {
+    int fd;
+    u32 depth;
+    _Atomic u32* sq_head;
+    _Atomic u32* sq_tail;
+    u32 sq_mask;
+    u32* sq_array;
+    _Atomic u32* cq_head;
+    _Atomic u32* cq_tail;
+    u32 cq_mask;
+    struct io_uring_sqe* sqes;
+    struct io_uring_cqe* cqes;
+    void* sq_ring;
+    void* cq_ring;
+    size_t sq_ring_size;
+    size_t cq_ring_size;
+    size_t sqes_size;
+} xUring;
+#endif
+
+struct xStreamer {
+    xPool slots;
+    u32* heap;
+    u32 heap_count;
+    u32 complete_head;
+    u32 complete_tail;
+    u64 sequence;
+    u64 max_bytes_in_flight;
+    atomic_ullong bytes_in_flight;
+    atomic_uint pending;
+    bool quit;
+    mtx_t lock;
+    cnd_t wake;
+    cnd_t space;
+    xStreamBackend backend;
+    u32 thread_count;
+    thrd_t threads[X_STREAM_MAX_THREADS];
+#if X_STREAM_HAS_IO_URING
+    xUring ring;
+#endif
+};
+
+X_FORCE_INLINE static xStreamSlot* slotAt(const xStreamer* streamer, u32 index) {
+    return (xStreamSlot*)xPoolAt(&streamer->slots, index);
+}
+
+/* ============================================================================
+ * PRIORITY QUEUE
+ * ============================================================================ */
+
+/* Higher priority first, then submission order */
+X_FORCE_INLINE static bool heapBefore(const xStreamSlot* a, const xStreamSlot* b) {
+    return a->priority != b->priority ? a->priority > b->priority : a->sequence < b->sequence;
+}
+
+static void heapPlace(xStreamer* streamer, u32 position, u32 index) {
+    streamer->heap[position]            = index;
+    slotAt(streamer, index)->heap_index = position;
+}
+
+static void heapSiftUp(xStreamer* streamer, u32 position) {
+    const u32 index         = streamer->heap[position];
+    const xStreamSlot* slot = slotAt(streamer, index);
+    while (position > 0) {
+        const u32 parent = (position - 1) / 2;
+        if (!heapBefore(slot, slotAt(streamer, streamer->heap[parent]))) { break; }
+        heapPlace(streamer, position, streamer->heap[parent]);
+        position = parent;
+    }
+    heapPlace(streamer, position, index);
+}
+
+static void heapSiftDown(xStreamer* streamer, u32 position) {
+    const u32 index         = streamer->heap[position];
+    const xStreamSlot* slot = slotAt(streamer, index);
+    for (;;) {
+        const u32 left = position * 2 + 1;
+        if (left >= streamer->heap_count) { break; }
+        const u32 right = left + 1;
+        u32 child       = left;
+        if (right < streamer->heap_count &&
+            heapBefore(slotAt(streamer, streamer->heap[right]), slotAt(streamer, streamer->heap[left]))) {
+            child = right;
+        }
+        if (!heapBefore(slotAt(streamer, streamer->heap[child]), slot)) { break; }
+        heapPlace(streamer, position, streamer->heap[child]);
+        position = child;
+    }
+    heapPlace(streamer, position, index);
+}
+
+static void heapPush(xStreamer* streamer, u32 index) {
+    streamer->heap[streamer->heap_count] = index;
+    heapSiftUp(streamer, streamer->heap_count++);
+}
+
+static void heapRemoveAt(xStreamer* streamer, u32 position) {
+    const u32 last = --streamer->heap_count;
+    if (position == last) { return; }
+
+    // Move the last entry into the hole; it may need to go either way
+    const u32 moved = streamer->heap[last];
+    heapPlace(streamer, position, moved);
+    heapSiftUp(streamer, position);
+    heapSiftDown(streamer, slotAt(streamer, moved)->heap_index);
+}
+
+/* Lock held. Pops the most urgent request and marks it active. */
+static u32 heapPop(xStreamer* streamer) {
+    const u32 index = streamer->heap[0];
+    heapRemoveAt(streamer, 0);
+    slotAt(streamer, index)->phase = X_STREAM_PHASE_ACTIVE;
+    return index;
+}
+
+/* ============================================================================
+ * I/O SIDE
+ * ============================================================================ */
+
+/* No lock. Opens the file and resolves the byte range to read. */
+static bool openSlot(xStreamSlot* slot) {
+    u64 file_size = 0;
+    if (!xPlatformFileOpen(slot->path, &slot->file, &file_size)) { return false; }
+    if (slot->offset > file_size) { return false; }
+
+    const u64 available = file_size - slot->offset;
+    if (slot->data != NULL) { return slot->size <= available; }
+    if (slot->size == 0 || slot->size > available) { slot->size = available; }
+    return true;
+}
+
+/* No lock. Caller buffers are used as is; otherwise allocate once the bytes are reserved. */
+static bool allocateSlot(xStreamSlot* slot) {
+    if (slot->data != NULL) { return true; }
+    slot->data      = X_MALLOC(u8, (size_t)X_MAX(slot->size, 1ull));
+    slot->owns_data = slot->data != NULL;
+    return slot->data != NULL;
+}
+
+typedef enum {
+    X_STREAM_RESERVE_OK = 0,
+    X_STREAM_RESERVE_FULL,
+    X_STREAM_RESERVE_CANCELLED,
+} xStreamReserve;
+
+/*
+ * Lock held. Charge the slot against the in-flight cap. A request larger than
+ * the whole cap is let through on its own so it cannot starve.
+ */
+static xStreamReserve reserveSlot(xStreamer* streamer, xStreamSlot* slot) {
+    if (slot->cancelled || streamer->quit) { return X_STREAM_RESERVE_CANCELLED; }
+
+    const u64 in_flight = atomic_load_explicit(&streamer->bytes_in_flight, memory_order_relaxed);
+    if (in_flight > 0 && in_flight + slot->size > streamer->max_bytes_in_flight) { return X_STREAM_RESERVE_FULL; }
+
+    slot->charged = slot->size;
+    atomic_fetch_add_explicit(&streamer->bytes_in_flight, slot->size, memory_order_relaxed);
+    return X_STREAM_RESERVE_OK;
+}
+
+/* Lock held. Hand a finished request over to the main thread. */
+static void completeSlot(xStreamer* streamer, u32 index, bool ok) {
+    xStreamSlot* slot = slotAt(streamer, index);
+    xPlatformFileClose(slot->file);
+    slot->file   = X_PLATFORM_FILE_INVALID;
+    slot->failed = !ok;
+    slot->phase  = X_STREAM_PHASE_COMPLETE;
+    slot->next   = X_STREAM_NONE;
+
+    if (streamer->complete_tail == X_STREAM_NONE) {
+        streamer->complete_head = index;
+    } else {
+        slotAt(streamer, streamer->complete_tail)->next = index;
+    }
+    streamer->complete_tail = index;
+}
+
+static int preadWorker(void* arg) {
+    xStreamer* streamer = (xStreamer*)arg;
+
+    mtx_lock(&streamer->lock);
+    for (;;) {
+        while (streamer->heap_count == 0 && !streamer->quit) {
+            cnd_wait(&streamer->wake, &streamer->lock);
+        }
+        if (streamer->quit) { break; }
+
+        const u32 index   = heapPop(streamer);
+        xStreamSlot* slot = slotAt(streamer, index);
+        mtx_unlock(&streamer->lock);
+
+        bool ok = openSlot(slot);
+
+        mtx_lock(&streamer->lock);
+        xStreamReserve reserve = ok ? reserveSlot(streamer, slot) : X_STREAM_RESERVE_CANCELLED;
+        while (reserve == X_STREAM_RESERVE_FULL) {
+            cnd_wait(&streamer->space, &streamer->lock);
+            reserve = reserveSlot(streamer, slot);
+        }
+        mtx_unlock(&streamer->lock);
+
+        if (ok && reserve == X_STREAM_RESERVE_OK) {
+            ok = allocateSlot(slot) &&
+                 xPlatformFileRead(slot->file, slot->data, slot->size, slot->offset) == (s64)slot->size;
+        }
+
+        mtx_lock(&streamer->lock);
+        completeSlot(streamer, index, ok);
+    }
+    mtx_unlock(&streamer->lock);
+    return 0;
+}
+
+#if X_STREAM_HAS_IO_URING
+
+/* ============================================================================
+ * IO_URING
+ * ============================================================================ */
+
+static bool uringInit(xUring* ring, u32 depth) {
+    X_ZERO_STRUCT(ring);
+    struct io_uring_params params = {0};
+    ring->fd                      = (int)syscall(__NR_io_uring_setup, depth, &params);
+    // Commonly ENOSYS on old kernels and EPERM under container seccomp profiles
+    if (ring->fd < 0) { return false; }
+
+    ring->depth        = params.sq_entries;
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(u32);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->sqes_size    = params.sq_entries * sizeof(struct io_uring_sqe);
+
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) { ring->sq_ring_size = ring->cq_ring_size = X_MAX(ring->sq_ring_size, ring->cq_ring_size); }
+
+    ring->sq_ring = mmap(
+      NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    ring->cq_ring = single_mmap ? ring->sq_ring
+                                : mmap(NULL,
+                                       ring->cq_ring_size,
+                                       PROT_READ | PROT_WRITE,
+                                       MAP_SHARED | MAP_POPULATE,
+                                       ring->fd,
+                                       IORING_OFF_CQ_RING);
+    ring->sqes = (struct io_uring_sqe*)mmap(
+      NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sq_ring == MAP_FAILED || ring->cq_ring == MAP_FAILED || ring->sqes == MAP_FAILED) {
+        if (ring->sq_ring != MAP_FAILED) { munmap(ring->sq_ring, ring->sq_ring_size); }
+        if (!single_mmap && ring->cq_ring != MAP_FAILED) { munmap(ring->cq_ring, ring->cq_ring_size); }
+        if (ring->sqes != MAP_FAILED) { munmap(ring->sqes, ring->sqes_size); }
+        close(ring->fd);
+        return false;
+    }
+
+    u8* sq         = (u8*)ring->sq_ring;
+    u8* cq         = (u8*)ring->cq_ring;
+    ring->sq_head  = (_Atomic u32*)(sq + params.sq_off.head);
+    ring->sq_tail  = (_Atomic u32*)(sq + params.sq_off.tail);
+    ring->sq_mask  = *(u32*)(sq + params.sq_off.ring_mask);
+    ring->sq_array = (u32*)(sq + params.sq_off.array);
+    ring->cq_head  = (_Atomic u32*)(cq + params.cq_off.head);
+    ring->cq_tail  = (_Atomic u32*)(cq + params.cq_off.tail);
+    ring->cq_mask  = *(u32*)(cq + params.cq_off.ring_mask);
+    ring->cqes     = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+    return true;
+}
+
+static void uringShutdown(xUring* ring) {
+    munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ring != ring->sq_ring) { munmap(ring->cq_ring, ring->cq_ring_size); }
+    munmap(ring->sq_ring, ring->sq_ring_size);
+    close(ring->fd);
+}
+
+/* Queue a read of the slot's remaining bytes. READV rather than READ keeps 5.1 kernels working. */
+static void uringPushRead(xUring* ring, xStreamSlot* slot, u32 index) {
+    const u32 tail           = atomic_load_explicit(ring->sq_tail, memory_order_relaxed);
+    const u32 position       = tail & ring->sq_mask;
+    struct io_uring_sqe* sqe = &ring->sqes[position];
+    memset(sqe, 0, sizeof(*sqe));
+
+    slot->iov.iov_base = slot->data + slot->done;
+    slot->iov.iov_len  = (size_t)X_MIN(slot->size - slot->done, (u64)(1u << 30));
+    sqe->opcode        = IORING_OP_READV;
+    sqe->fd            = (s32)slot->file;
+    sqe->addr          = (u64)(uptr)&slot->iov;
+    sqe->len           = 1;
+    sqe->off           = slot->offset + slot->done;
+    sqe->user_data     = index;
+
+    ring->sq_array[position] = position;
+    atomic_store_explicit(ring->sq_tail, tail + 1, memory_order_release);
+}
+
+static void uringEnter(xUring* ring, u32 submit, u32 wait) {
+    while (syscall(__NR_io_uring_enter, ring->fd, submit, wait, wait > 0 ? IORING_ENTER_GETEVENTS : 0, NULL, 0) < 0) {
+        if (errno != EINTR) {
+            X_PRINT_ERROR("io_uring_enter failed (errno %d)", errno);
+            return;
+        }
+        // Anything consumed before the signal is already in flight
+        submit = 0;
+    }
+}
+
+/*
+ * One thread owns the ring: it keeps up to `depth` reads in the kernel, blocks
+ * in io_uring_enter until at least one finishes, and refills from the queue.
+ */
+static int uringWorker(void* arg) {
+    xStreamer* streamer = (xStreamer*)arg;
+    xUring* ring        = &streamer->ring;
+    u32 outstanding     = 0;  // reads pushed and not yet reaped
+    u32 unsubmitted     = 0;  // reads pushed but not yet handed to the kernel
+    u32 held            = X_STREAM_NONE;  // opened request waiting for room under the byte cap
+
+    for (;;) {
+        mtx_lock(&streamer->lock);
+        while (!streamer->quit && outstanding == 0 && held == X_STREAM_NONE && streamer->heap_count == 0) {
+            cnd_wait(&streamer->wake, &streamer->lock);
+        }
+        const bool quit = streamer->quit;
+        if (quit && held != X_STREAM_NONE) {
+            completeSlot(streamer, held, false);
+            held = X_STREAM_NONE;
+        }
+        mtx_unlock(&streamer->lock);
+        if (quit && outstanding == 0) { break; }
+
+        while (!quit && outstanding < ring->depth) {
+            if (held == X_STREAM_NONE) {
+                mtx_lock(&streamer->lock);
+                const u32 next = streamer->heap_count > 0 ? heapPop(streamer) : X_STREAM_NONE;
+                mtx_unlock(&streamer->lock);
+                if (next == X_STREAM_NONE) { break; }
+
+                if (!openSlot(slotAt(streamer, next))) {
+                    mtx_lock(&streamer->lock);
+                    completeSlot(streamer, next, false);
+                    mtx_unlock(&streamer->lock);
+                    continue;
+                }
+                held = next;
+            }
+
+            xStreamSlot* slot = slotAt(streamer, held);
+            mtx_lock(&streamer->lock);
+            xStreamReserve reserve = reserveSlot(streamer, slot);
+            // Nothing of ours left in the kernel: room can only come from the main thread draining
+            while (reserve == X_STREAM_RESERVE_FULL && outstanding == 0) {
+                cnd_wait(&streamer->space, &streamer->lock);
+                reserve = reserveSlot(streamer, slot);
+            }
+            if (reserve == X_STREAM_RESERVE_CANCELLED) {
+                completeSlot(streamer, held, false);
+                held = X_STREAM_NONE;
+            }
+            mtx_unlock(&streamer->lock);
+            if (reserve == X_STREAM_RESERVE_FULL) { break; }
+            if (reserve == X_STREAM_RESERVE_CANCELLED) { continue; }
+
+            if (!allocateSlot(slot) || slot->size == 0) {
+                mtx_lock(&streamer->lock);
+                completeSlot(streamer, held, slot->data != NULL);
+                mtx_unlock(&streamer->lock);
+            } else {
+                uringPushRead(ring, slot, held);
+                outstanding++;
+                unsubmitted++;
+            }
+            held = X_STREAM_NONE;
+        }
+
+        if (outstanding == 0) { continue; }
+        uringEnter(ring, unsubmitted, 1);
+        unsubmitted = 0;
+
+        // Reap everything that is ready
+        u32 head       = atomic_load_explicit(ring->cq_head, memory_order_relaxed);
+        const u32 tail = atomic_load_explicit(ring->cq_tail, memory_order_acquire);
+        for (; head != tail; ++head) {
+            const struct io_uring_cqe* cqe = &ring->cqes[head & ring->cq_mask];
+            const u32 index                = (u32)cqe->user_data;
+            const s32 result               = cqe->res;
+            xStreamSlot* slot              = slotAt(streamer, index);
+            outstanding--;
+
+            if (result > 0) { slot->done += (u64)result; }
+            if (result > 0 && slot->done < slot->size) {
+                // Short read: ask for the rest
+                uringPushRead(ring, slot, index);
+                outstanding++;
+                unsubmitted++;
+                continue;
+            }
+
+            mtx_lock(&streamer->lock);
+            completeSlot(streamer, index, result >= 0 && slot->done == slot->size);
+            mtx_unlock(&streamer->lock);
+        }
+        atomic_store_explicit(ring->cq_head, head, memory_order_release);
+    }
+    return 0;
+}
+
+#endif
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+xStreamer* xStreamerCreate(const xStreamerDesc* desc) {
+    xStreamer* streamer = X_NEW(xStreamer);
+    if (streamer == NULL) {
+        X_PRINT_ERROR("Failed to allocate streamer");
+        return NULL;
+    }
+
+    const u32 max_requests = desc->max_requests > 0 ? desc->max_requests : X_STREAM_DEFAULT_MAX_REQUESTS;
+    streamer->max_bytes_in_flight =
+      desc->max_bytes_in_flight > 0 ? desc->max_bytes_in_flight : X_STREAM_DEFAULT_MAX_BYTES_IN_FLIGHT;
+    streamer->complete_head = X_STREAM_NONE;
+    streamer->complete_tail = X_STREAM_NONE;
+    atomic_init(&streamer->bytes_in_flight, 0);
+    atomic_init(&streamer->pending, 0);
+
+    streamer->heap = X_MALLOC(u32, max_requests);
+    if (streamer->heap == NULL || !xPoolInit(&streamer->slots, sizeof(xStreamSlot), max_requests)) {
+        X_PRINT_ERROR("Failed to allocate streamer request table (%u requests)", max_requests);
+        X_FREE(streamer->heap);
+        X_FREE(streamer);
+        return NULL;
+    }
+
+    mtx_init(&streamer->lock, mtx_plain);
+    cnd_init(&streamer->wake);
+    cnd_init(&streamer->space);
+
+    streamer->backend = X_STREAM_BACKEND_PREAD;
+#if X_STREAM_HAS_IO_URING
+    if (desc->backend != X_STREAM_BACKEND_PREAD) {
+        const u32 depth = desc->queue_depth > 0 ? desc->queue_depth : X_STREAM_DEFAULT_QUEUE_DEPTH;
+        if (uringInit(&streamer->ring, depth)) { streamer->backend = X_STREAM_BACKEND_IO_URING; }
+    }
+#endif
+    if (desc->backend == X_STREAM_BACKEND_IO_URING && streamer->backend != X_STREAM_BACKEND_IO_URING) {
+        X_PRINT_ERROR("io_uring is not available; streamer falls back to pread threads");
+    }
+
+    const bool uring   = streamer->backend == X_STREAM_BACKEND_IO_URING;
+    const u32 want     = desc->thread_count > 0 ? desc->thread_count : X_STREAM_DEFAULT_THREAD_COUNT;
+    const u32 threads  = uring ? 1 : X_MIN(want, (u32)X_STREAM_MAX_THREADS);
+    thrd_start_t entry = preadWorker;
+#if X_STREAM_HAS_IO_URING
+    if (uring) { entry = uringWorker; }
+#endif
+    for (u32 i = 0; i < threads; ++i) {
+        if (thrd_create(&streamer->threads[i], entry, streamer) != thrd_success) {
+            X_PRINT_ERROR("Failed to start streaming I/O thread %u", i);
+            break;
+        }
+        streamer->thread_count++;
+    }
+    if (streamer->thread_count == 0) {
+        xStreamerDestroy(streamer);
+        return NULL;
+    }
+    return streamer;
+}
+
+static void freeSlotData(xStreamSlot* slot) {
+    if (slot->owns_data) { X_FREE(slot->data); }
+    slot->owns_data = false;
+}
+
+void xStreamerDestroy(xStreamer* streamer) {
+    if (streamer == NULL) { return; }
+
+    mtx_lock(&streamer->lock);
+    streamer->quit = true;
+    cnd_broadcast(&streamer->wake);
+    cnd_broadcast(&streamer->space);
+    mtx_unlock(&streamer->lock);
+    for (u32 i = 0; i < streamer->thread_count; ++i) {
+        thrd_join(streamer->threads[i], NULL);
+    }
+
+#if X_STREAM_HAS_IO_URING
+    if (streamer->backend == X_STREAM_BACKEND_IO_URING) { uringShutdown(&streamer->ring); }
+#endif
+
+    X_POOL_FOREACH(&streamer->slots, xStreamSlot, slot) {
+        xPlatformFileClose(slot->file);
+        freeSlotData(slot);
+    }
+    cnd_destroy(&streamer->space);
+    cnd_destroy(&streamer->wake);
+    mtx_destroy(&streamer->lock);
+    xPoolShutdown(&streamer->slots);
+    X_FREE(streamer->heap);
+    X_FREE(streamer);
+}
+
+xStreamBackend xStreamerBackend(const xStreamer* streamer) {
+    return streamer->backend;
+}
+
+xStreamHandle xStreamLoad(xStreamer* streamer, const xStreamRequest* request) {
+    const size_t length = strlen(request->path);
+    if (length >= X_STREAM_MAX_PATH) {
+        X_PRINT_ERROR("Stream path too long: '%s'", request->path);
+        return X_HANDLE_INVALID;
+    }
+
+    const xStreamHandle handle = xPoolAcquire(&streamer->slots);
+    if (handle == X_HANDLE_INVALID) {
+        X_PRINT_ERROR("Stream request table is full (%u requests)", streamer->slots.capacity);
+        return X_HANDLE_INVALID;
+    }
+
+    const u32 index   = X_HANDLE_INDEX(handle);
+    xStreamSlot* slot = slotAt(streamer, index);
+    memcpy(slot->path, request->path, length + 1);
+    slot->offset   = request->offset;
+    slot->size     = request->size;
+    slot->data     = (u8*)request->dst;
+    slot->callback = request->callback;
+    slot->user     = request->user;
+    slot->priority = request->priority;
+    slot->file     = X_PLATFORM_FILE_INVALID;
+    slot->status   = X_STREAM_PENDING;
+
+    mtx_lock(&streamer->lock);
+    slot->sequence = streamer->sequence++;
+    slot->phase    = X_STREAM_PHASE_QUEUED;
+    heapPush(streamer, index);
+    atomic_fetch_add_explicit(&streamer->pending, 1, memory_order_relaxed);
+    cnd_signal(&streamer->wake);
+    mtx_unlock(&streamer->lock);
+    return handle;
+}
+
+bool xStreamCancel(xStreamer* streamer, xStreamHandle handle) {
+    if (!xPoolIsValid(&streamer->slots, handle)) { return false; }
+    xStreamSlot* slot = slotAt(streamer, X_HANDLE_INDEX(handle));
+    if (slot->status != X_STREAM_PENDING || slot->cancelled) { return false; }
+
+    mtx_lock(&streamer->lock);
+    const bool queued = slot->phase == X_STREAM_PHASE_QUEUED;
+    if (queued) {
+        heapRemoveAt(streamer, slot->heap_index);
+        slot->phase = X_STREAM_PHASE_IDLE;
+        atomic_fetch_sub_explicit(&streamer->pending, 1, memory_order_relaxed);
+    }
+    slot->cancelled = true;
+    // Wake an I/O thread that may be holding this request while it waits for room
+    cnd_broadcast(&streamer->space);
+    mtx_unlock(&streamer->lock);
+
+    if (queued) { slot->status = X_STREAM_CANCELLED; }
+    return true;
+}
+
+xStreamStatus xStreamPoll(const xStreamer* streamer, xStreamHandle handle, const void** data, u64* size) {
+    if (!xPoolIsValid(&streamer->slots, handle)) { return X_STREAM_FAILED; }
+    const xStreamSlot* slot = slotAt(streamer, X_HANDLE_INDEX(handle));
+    if (slot->status == X_STREAM_DONE) {
+        if (data != NULL) { *data = slot->data; }
+        if (size != NULL) { *size = slot->size; }
+    }
+    return (xStreamStatus)slot->status;
+}
+
+void xStreamRelease(xStreamer* streamer, xStreamHandle handle) {
+    if (!xPoolIsValid(&streamer->slots, handle)) { return; }
+    xStreamSlot* slot = slotAt(streamer, X_HANDLE_INDEX(handle));
+
+    if (slot->status == X_STREAM_PENDING) {
+        xStreamCancel(streamer, handle);
+        if (slot->status == X_STREAM_PENDING) {
+            // Still owned by the I/O side; the slot is reclaimed when it drains
+            slot->released = true;
+            return;
+        }
+    }
+    freeSlotData(slot);
+    xPoolRelease(&streamer->slots, handle);
+}
+
+/* Main thread, no lock. Publish one drained completion. */
+static void publishSlot(xStreamer* streamer, u32 index) {
+    xStreamSlot* slot          = slotAt(streamer, index);
+    const xStreamHandle handle = xPoolHandleAt(&streamer->slots, index);
+
+    if (slot->released) {
+        freeSlotData(slot);
+        xPoolRelease(&streamer->slots, handle);
+        return;
+    }
+    if (slot->cancelled) {
+        freeSlotData(slot);
+        slot->status = X_STREAM_CANCELLED;
+        return;
+    }
+    if (slot->failed) {
+        X_PRINT_ERROR("Failed to stream '%s'", slot->path);
+        freeSlotData(slot);
+        slot->status = X_STREAM_FAILED;
+    } else {
+        slot->status = X_STREAM_DONE;
+    }
+
+    // Last touch of the slot: the callback may release the handle or queue more loads
+    if (slot->callback != NULL) {
+        const bool done = slot->status == X_STREAM_DONE;
+        slot->callback(slot->user, handle, (xStreamStatus)slot->status, done ? slot->data : NULL, slot->size);
+    }
+}
+
+u32 xStreamerUpdate(xStreamer* streamer, f64 budget_seconds) {
+    X_PROFILE_FUNCTION();
+    const f64 start = xPlatformTime();
+    u32 handled     = 0;
+
+    for (;;) {
+        if (handled > 0 && xPlatformTime() - start >= budget_seconds) { break; }
+
+        mtx_lock(&streamer->lock);
+        const u32 index = streamer->complete_head;
+        if (index == X_STREAM_NONE) {
+            mtx_unlock(&streamer->lock);
+            break;
+        }
+
+        xStreamSlot* slot       = slotAt(streamer, index);
+        streamer->complete_head = slot->next;
+        if (streamer->complete_head == X_STREAM_NONE) { streamer->complete_tail = X_STREAM_NONE; }
+        slot->phase = X_STREAM_PHASE_IDLE;
+
+        // Bytes stay charged until the main thread has taken them, which also bounds undrained memory
+        atomic_fetch_sub_explicit(&streamer->bytes_in_flight, slot->charged, memory_order_relaxed);
+        atomic_fetch_sub_explicit(&streamer->pending, 1, memory_order_relaxed);
+        slot->charged = 0;
+        cnd_broadcast(&streamer->space);
+        mtx_unlock(&streamer->lock);
+
+        publishSlot(streamer, index);
+        handled++;
+    }
+    return handled;
+}
+
+u32 xStreamerPendingCount(const xStreamer* streamer) {
+    return atomic_load_explicit(&streamer->pending, memory_order_relaxed);
+}
+
+u64 xStreamerBytesInFlight(const xStreamer* streamer) {
+    return atomic_load_explicit(&streamer->bytes_in_flight, memory_order_relaxed);
+}
@@ -0,0 +1,98 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "pool.h"
+#include "platform.h"
+
+#define X_STREAM_MAX_PATH 256
+
+/* Defaults for zeroed xStreamerDesc fields */
+#define X_STREAM_DEFAULT_MAX_REQUESTS 4096
+#define X_STREAM_DEFAULT_MAX_BYTES_IN_FLIGHT (64ull * 1024 * 1024)
+#define X_STREAM_DEFAULT_QUEUE_DEPTH 64
+#define X_STREAM_DEFAULT_THREAD_COUNT 4
+
+/* Upper bound on pread fallback threads */
+#define X_STREAM_MAX_THREADS 16
+
+typedef xHandle xStreamHandle;
+
+typedef enum {
+    X_STREAM_BACKEND_AUTO = 0,  // io_uring when the kernel allows it, pread threads otherwise
+    X_STREAM_BACKEND_IO_URING,
+    X_STREAM_BACKEND_PREAD,
+} xStreamBackend;
+
+/* Status as seen from the main thread. Only xStreamerUpdate moves a request out of PENDING. */
+typedef enum {
+    X_STREAM_PENDING = 0,
+    X_STREAM_DONE,
+    X_STREAM_FAILED,
+    X_STREAM_CANCELLED,
+} xStreamStatus;
+
+/* Runs on the main thread inside xStreamerUpdate. Data stays valid until xStreamRelease. */
+typedef void (*xStreamCallback)(void* user, xStreamHandle handle, xStreamStatus status, const void* data, u64 size);
+
+typedef struct {
+    const char* path;  // copied; at most X_STREAM_MAX_PATH - 1 characters
+    u64 offset;
+    u64 size;  // 0 reads to the end of the file
+    void* dst;  // optional caller buffer of `size` bytes; otherwise the streamer allocates one
+    s32 priority;  // higher is serviced first, FIFO within a priority
+    xStreamCallback callback;  // optional
+    void* user;
+} xStreamRequest;
+
+typedef struct {
+    u32 max_requests;
+    u64 max_bytes_in_flight;
+    u32 queue_depth;  // io_uring submission queue size
+    u32 thread_count;  // pread fallback threads
+    xStreamBackend backend;
+} xStreamerDesc;
+
+typedef struct xStreamer xStreamer;
+
+xStreamer* xStreamerCreate(const xStreamerDesc* desc);
+
+/* Waits for reads already issued to the OS; queued requests are dropped */
+void xStreamerDestroy(xStreamer* streamer);
+
+/* The backend actually in use (never AUTO) */
+xStreamBackend xStreamerBackend(const xStreamer* streamer);
+
+/*
+ * Queue a read. Returns X_HANDLE_INVALID when the request table is full. The
+ * handle stays valid until xStreamRelease, whatever the outcome.
+ */
+xStreamHandle xStreamLoad(xStreamer* streamer, const xStreamRequest* request);
+
+/*
+ * Queued requests are dropped immediately. Reads already issued finish in the
+ * background and are discarded; their status turns CANCELLED on the next
+ * update. Callbacks never run for cancelled requests. Returns false if the
+ * request had already completed.
+ */
+bool xStreamCancel(xStreamer* streamer, xStreamHandle handle);
+
+/* Current status; `data` and `size` are filled once it is X_STREAM_DONE */
+xStreamStatus xStreamPoll(const xStreamer* streamer, xStreamHandle handle, const void** data, u64* size);
+
+/* Free the handle and any buffer the streamer allocated. Cancels the request if it is still pending. */
+void xStreamRelease(xStreamer* streamer, xStreamHandle handle);
+
+/*
+ * Main thread: publish finished reads and run their callbacks until
+ * `budget_seconds` is spent. At least one completion is handled per call so
+ * progress is guaranteed. Returns the number of completions handled.
+ */
+u32 xStreamerUpdate(xStreamer* streamer, f64 budget_seconds);
+
+/* Requests queued or in flight, and bytes currently counted against the in-flight cap */
+u32 xStreamerPendingCount(const xStreamer* streamer);
+u64 xStreamerBytesInFlight(const xStreamer* streamer);
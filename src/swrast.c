@@ -0,0 +1,569 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_RENDERER
+
+#include "swrast.h"
+
+#include <math.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__)
+    #define X_SW_X86 1
+    #include <immintrin.h>
+#endif
+
+/* ============================================================================
+ * RASTER KERNELS
+ * ============================================================================ */
+
+static void rasterScalar(const xSwTriangle* tri, u32* color, f32* depth, u32 stride, s32 x0, s32 y0, s32 x1,
+                         s32 y1) {
+    const bool depth_test  = (tri->state & X_RENDER_STATE_DEPTH_TEST) != 0;
+    const bool depth_write = (tri->state & X_RENDER_STATE_DEPTH_WRITE) != 0;
+
+    for (s32 y = y0; y < y1; ++y) {
+        const f32 py   = (f32)y + 0.5f;
+        u32* color_row = color + (size_t)y * stride;
+        f32* depth_row = depth + (size_t)y * stride;
+
+        for (s32 x = x0; x < x1; ++x) {
+            const f32 px = (f32)x + 0.5f;
+            bool inside  = true;
+            for (u32 e = 0; e < 3; ++e) {
+                const f32 w = tri->edge_a[e] * px + tri->edge_b[e] * py + tri->edge_c[e];
+                inside &= w > 0.0f || (w == 0.0f && X_BIT_CHECK(tri->top_left, e));
+            }
+            if (!inside) { continue; }
+
+            const f32 z = tri->z_a * px + tri->z_b * py + tri->z_c;
+            if (depth_test && !(z < depth_row[x])) { continue; }
+            if (depth_write) { depth_row[x] = z; }
+            color_row[x] = tri->color;
+        }
+    }
+}
+
+#if defined(X_SW_X86)
+
+static void rasterSse2(const xSwTriangle* tri, u32* color, f32* depth, u32 stride, s32 x0, s32 y0, s32 x1, s32 y1) {
+    const bool depth_test  = (tri->state & X_RENDER_STATE_DEPTH_TEST) != 0;
+    const bool depth_write = (tri->state & X_RENDER_STATE_DEPTH_WRITE) != 0;
+
+    const __m128 lane_offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const __m128 zero         = _mm_setzero_ps();
+    const __m128i fill        = _mm_set1_epi32((int)tri->color);
+
+    __m128 a[3];
+    __m128 top_left[3];
+    for (u32 e = 0; e < 3; ++e) {
+        a[e]        = _mm_set1_ps(tri->edge_a[e]);
+        top_left[e] = _mm_castsi128_ps(_mm_set1_epi32(X_BIT_CHECK(tri->top_left, e) ? -1 : 0));
+    }
+    const __m128 z_a = _mm_set1_ps(tri->z_a);
+
+    x0 = X_ALIGN_DOWN(x0, 4);
+    for (s32 y = y0; y < y1; ++y) {
+        const f32 py = (f32)y + 0.5f;
+        __m128 row[3];
+        for (u32 e = 0; e < 3; ++e) {
+            row[e] = _mm_set1_ps(tri->edge_b[e] * py + tri->edge_c[e]);
+        }
+        const __m128 z_row = _mm_set1_ps(tri->z_b * py + tri->z_c);
+        u32* color_row     = color + (size_t)y * stride;
+        f32* depth_row     = depth + (size_t)y * stride;
+
+        for (s32 x = x0; x < x1; x += 4) {
+            const __m128 px = _mm_add_ps(_mm_set1_ps((f32)x), lane_offsets);
+
+            __m128 mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (u32 e = 0; e < 3; ++e) {
+                const __m128 w = _mm_add_ps(_mm_mul_ps(a[e], px), row[e]);
+                const __m128 edge_in =
+                  _mm_or_ps(_mm_cmpgt_ps(w, zero), _mm_and_ps(_mm_cmpeq_ps(w, zero), top_left[e]));
+                mask = _mm_and_ps(mask, edge_in);
+            }
+            if (_mm_movemask_ps(mask) == 0) { continue; }
+
+            const __m128 z = _mm_add_ps(_mm_mul_ps(z_a, px), z_row);
+            const __m128 d = _mm_loadu_ps(depth_row + x);
+            if (depth_test) {
+                mask = _mm_and_ps(mask, _mm_cmplt_ps(z, d));
+                if (_mm_movemask_ps(mask) == 0) { continue; }
+            }
+            if (depth_write) { _mm_storeu_ps(depth_row + x, _mm_or_ps(_mm_and_ps(mask, z), _mm_andnot_ps(mask, d))); }
+
+            const __m128i imask   = _mm_castps_si128(mask);
+            const __m128i c       = _mm_loadu_si128((const __m128i*)(color_row + x));
+            const __m128i blended = _mm_or_si128(_mm_and_si128(imask, fill), _mm_andnot_si128(imask, c));
+            _mm_storeu_si128((__m128i*)(color_row + x), blended);
+        }
+    }
+}
+
+    #if defined(__GNUC__) || defined(__clang__)
+        #define X_SW_HAS_AVX2 1
+
+__attribute__((target("avx2"))) static void
+rasterAvx2(const xSwTriangle* tri, u32* color, f32* depth, u32 stride, s32 x0, s32 y0, s32 x1, s32 y1) {
+    const bool depth_test  = (tri->state & X_RENDER_STATE_DEPTH_TEST) != 0;
+    const bool depth_write = (tri->state & X_RENDER_STATE_DEPTH_WRITE) != 0;
+
+    const __m256 lane_offsets = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+    const __m256 zero         = _mm256_setzero_ps();
+    const __m256 fill         = _mm256_castsi256_ps(_mm256_set1_epi32((int)tri->color));
+
+    __m256 a[3];
+    __m256 top_left[3];
+    for (u32 e = 0; e < 3; ++e) {
+        a[e]        = _mm256_set1_ps(tri->edge_a[e]);
+        top_left[e] = _mm256_castsi256_ps(_mm256_set1_epi32(X_BIT_CHECK(tri->top_left, e) ? -1 : 0));
+    }
+    const __m256 z_a = _mm256_set1_ps(tri->z_a);
+
+    x0 = X_ALIGN_DOWN(x0, 8);
+    for (s32 y = y0; y < y1; ++y) {
+        const f32 py = (f32)y + 0.5f;
+        __m256 row[3];
+        for (u32 e = 0; e < 3; ++e) {
+            row[e] = _mm256_set1_ps(tri->edge_b[e] * py + tri->edge_c[e]);
+        }
+        const __m256 z_row = _mm256_set1_ps(tri->z_b * py + tri->z_c);
+        u32* color_row     = color + (size_t)y * stride;
+        f32* depth_row     = depth + (size_t)y * stride;
+
+        for (s32 x = x0; x < x1; x += 8) {
+            const __m256 px = _mm256_add_ps(_mm256_set1_ps((f32)x), lane_offsets);
+
+            __m256 mask = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (u32 e = 0; e < 3; ++e) {
+                const __m256 w       = _mm256_add_ps(_mm256_mul_ps(a[e], px), row[e]);
+                const __m256 edge_in = _mm256_or_ps(_mm256_cmp_ps(w, zero, _CMP_GT_OQ),
+                                                    _mm256_and_ps(_mm256_cmp_ps(w, zero, _CMP_EQ_OQ), top_left[e]));
+                mask                 = _mm256_and_ps(mask, edge_in);
+            }
+            if (_mm256_movemask_ps(mask) == 0) { continue; }
+
+            const __m256 z = _mm256_add_ps(_mm256_mul_ps(z_a, px), z_row);
+            const __m256 d = _mm256_loadu_ps(depth_row + x);
+            if (depth_test) {
+                mask = _mm256_and_ps(mask, _mm256_cmp_ps(z, d, _CMP_LT_OQ));
+                if (_mm256_movemask_ps(mask) == 0) { continue; }
+            }
+            if (depth_write) { _mm256_storeu_ps(depth_row + x, _mm256_blendv_ps(d, z, mask)); }
+
+            const __m256 c = _mm256_loadu_ps((const f32*)(color_row + x));
+            _mm256_storeu_ps((f32*)(color_row + x), _mm256_blendv_ps(c, fill, mask));
+        }
+    }
+}
+    #endif
+#endif
+
+bool xSoftwareBackendSetKernel(xSoftwareBackend* sb, xSwKernel kernel) {
+    switch (kernel) {
+        case X_SW_KERNEL_SCALAR:
+            sb->raster      = rasterScalar;
+            sb->kernel_name = "scalar";
+            return true;
+#if defined(X_SW_X86)
+        case X_SW_KERNEL_SSE2:
+            sb->raster      = rasterSse2;
+            sb->kernel_name = "sse2";
+            return true;
+#endif
+#if defined(X_SW_HAS_AVX2)
+        case X_SW_KERNEL_AVX2:
+            if (!__builtin_cpu_supports("avx2")) { return false; }
+            sb->raster      = rasterAvx2;
+            sb->kernel_name = "avx2";
+            return true;
+#endif
+        case X_SW_KERNEL_BEST:
+            return xSoftwareBackendSetKernel(sb, X_SW_KERNEL_AVX2) || xSoftwareBackendSetKernel(sb, X_SW_KERNEL_SSE2) ||
+                   xSoftwareBackendSetKernel(sb, X_SW_KERNEL_SCALAR);
+        default:
+            return false;
+    }
+}
+
+/* ============================================================================
+ * BINNING
+ * ============================================================================ */
+
+static bool binPush(xSwBin* bin, u32 entry) {
+    if (X_UNLIKELY(bin->count == bin->capacity)) {
+        const u32 capacity = X_MAX(bin->capacity * 2, 64u);
+        u32* entries       = X_REALLOC(bin->entries, u32, capacity);
+        if (entries == NULL) { return false; }
+        bin->entries  = entries;
+        bin->capacity = capacity;
+    }
+    bin->entries[bin->count++] = entry;
+    return true;
+}
+
+static xSwTriangle* pushTriangle(xSoftwareBackend* sb) {
+    if (X_UNLIKELY(sb->triangle_count == sb->triangle_capacity)) {
+        const u32 capacity     = X_MAX(sb->triangle_capacity * 2, 1024u);
+        xSwTriangle* triangles = X_REALLOC(sb->triangles, xSwTriangle, capacity);
+        if (triangles == NULL) { return NULL; }
+        sb->triangles         = triangles;
+        sb->triangle_capacity = capacity;
+    }
+    return &sb->triangles[sb->triangle_count++];
+}
+
+/*
+ * All or nothing: if a bin can't grow, the tiles already given the triangle drop
+ * it again (it is the last entry of each), so no tile draws a partial triangle.
+ */
+static bool binTriangle(xSoftwareBackend* sb, u32 index) {
+    const xSwTriangle* tri = &sb->triangles[index];
+    const u32 tx0          = (u32)tri->min_x / X_SW_TILE_SIZE;
+    const u32 ty0          = (u32)tri->min_y / X_SW_TILE_SIZE;
+    const u32 tx1          = (u32)(tri->max_x - 1) / X_SW_TILE_SIZE;
+    const u32 ty1          = (u32)(tri->max_y - 1) / X_SW_TILE_SIZE;
+
+    for (u32 ty = ty0; ty <= ty1; ++ty) {
+        for (u32 tx = tx0; tx <= tx1; ++tx) {
+            if (binPush(&sb->bins[ty * sb->tiles_x + tx], index)) { continue; }
+            for (u32 uy = ty0; uy <= ty; ++uy) {
+                for (u32 ux = tx0; ux <= tx1 && (uy < ty || ux < tx); ++ux) {
+                    sb->bins[uy * sb->tiles_x + ux].count--;
+                }
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+typedef struct {
+    f32 x;
+    f32 y;
+    f32 z;
+} xSwScreenVertex;
+
+static xSwScreenVertex toScreen(const xSoftwareBackend* sb, const xVertex* v) {
+    const xRenderViewport* vp = &sb->viewport;
+    return (xSwScreenVertex) {
+      (f32)vp->x + (v->x * 0.5f + 0.5f) * (f32)vp->width,
+      (f32)vp->y + (0.5f - v->y * 0.5f) * (f32)vp->height,
+      v->z * 0.5f + 0.5f,
+    };
+}
+
+/* Returns false only when the triangle could not be stored or binned; culled triangles succeed */
+static bool setupTriangle(xSoftwareBackend* sb, const xVertex* v0, const xVertex* v1, const xVertex* v2) {
+    xSwScreenVertex p[3] = {toScreen(sb, v0), toScreen(sb, v1), toScreen(sb, v2)};
+
+    // Screen space is y-down, so triangles wound counter-clockwise in NDC have negative area here
+    f32 area = (p[1].x - p[0].x) * (p[2].y - p[0].y) - (p[1].y - p[0].y) * (p[2].x - p[0].x);
+    if (area == 0.0f) { return true; }
+    if (area > 0.0f && (sb->state & X_RENDER_STATE_CULL_BACK)) { return true; }
+    if (area < 0.0f) {
+        X_SWAP(p[1], p[2]);
+        area = -area;
+    }
+
+    const s32 min_x = X_MAX((s32)floorf(X_MIN(p[0].x, X_MIN(p[1].x, p[2].x))), 0);
+    const s32 min_y = X_MAX((s32)floorf(X_MIN(p[0].y, X_MIN(p[1].y, p[2].y))), 0);
+    const s32 max_x = X_MIN((s32)ceilf(X_MAX(p[0].x, X_MAX(p[1].x, p[2].x))), (s32)sb->width);
+    const s32 max_y = X_MIN((s32)ceilf(X_MAX(p[0].y, X_MAX(p[1].y, p[2].y))), (s32)sb->height);
+    if (min_x >= max_x || min_y >= max_y) { return true; }
+
+    xSwTriangle* tri = pushTriangle(sb);
+    if (tri == NULL) { return false; }
+
+    // Edge e is opposite vertex e, so its value is that vertex's (unnormalized) barycentric weight
+    const f32 inv_area = 1.0f / area;
+    tri->z_a           = 0.0f;
+    tri->z_b           = 0.0f;
+    tri->z_c           = 0.0f;
+    tri->top_left      = 0;
+    for (u32 e = 0; e < 3; ++e) {
+        const xSwScreenVertex* a = &p[(e + 1) % 3];
+        const xSwScreenVertex* b = &p[(e + 2) % 3];
+        const f32 ea             = a->y - b->y;
+        const f32 eb             = b->x - a->x;
+
+        tri->edge_a[e] = ea;
+        tri->edge_b[e] = eb;
+        tri->edge_c[e] = -(ea * a->x + eb * a->y);
+        if (ea > 0.0f || (ea == 0.0f && eb > 0.0f)) { X_BIT_SET(tri->top_left, e); }
+
+        tri->z_a += p[e].z * ea * inv_area;
+        tri->z_b += p[e].z * eb * inv_area;
+        tri->z_c += p[e].z * tri->edge_c[e] * inv_area;
+    }
+
+    tri->min_x = min_x;
+    tri->min_y = min_y;
+    tri->max_x = max_x;
+    tri->max_y = max_y;
+    tri->color = v0->color;
+    tri->state = sb->state;
+
+    if (binTriangle(sb, sb->triangle_count - 1)) { return true; }
+    sb->triangle_count--;
+    return false;
+}
+
+/* ============================================================================
+ * TILE RASTERIZATION
+ * ============================================================================ */
+
+static void rasterTile(xSoftwareBackend* sb, u32 tile) {
+    xSwBin* bin  = &sb->bins[tile];
+    const s32 tx = (s32)(tile % sb->tiles_x) * X_SW_TILE_SIZE;
+    const s32 ty = (s32)(tile / sb->tiles_x) * X_SW_TILE_SIZE;
+
+    for (u32 i = 0; i < bin->count; ++i) {
+        const u32 entry = bin->entries[i];
+
+        if (entry & X_SW_BIN_CLEAR_BIT) {
+            const xRenderClear* clear = &sb->clears[entry & ~X_SW_BIN_CLEAR_BIT];
+            for (s32 y = ty; y < ty + X_SW_TILE_SIZE; ++y) {
+                u32* color_row = sb->color + (size_t)y * sb->stride;
+                f32* depth_row = sb->depth + (size_t)y * sb->stride;
+                for (s32 x = tx; x < tx + X_SW_TILE_SIZE; ++x) {
+                    color_row[x] = clear->color;
+                    depth_row[x] = clear->depth;
+                }
+            }
+            continue;
+        }
+
+        const xSwTriangle* tri = &sb->triangles[entry];
+        const s32 x0           = X_MAX(tri->min_x, tx);
+        const s32 y0           = X_MAX(tri->min_y, ty);
+        const s32 x1           = X_MIN(tri->max_x, tx + X_SW_TILE_SIZE);
+        const s32 y1           = X_MIN(tri->max_y, ty + X_SW_TILE_SIZE);
+        sb->raster(tri, sb->color, sb->depth, sb->stride, x0, y0, x1, y1);
+    }
+
+    bin->count = 0;
+}
+
+static void rasterTileJob(void* data, u32 begin, u32 end) {
+    xSoftwareBackend* sb = (xSoftwareBackend*)data;
+    for (u32 tile = begin; tile < end; ++tile) {
+        rasterTile(sb, tile);
+    }
+}
+
+/* ============================================================================
+ * BACKEND CALLBACKS
+ * ============================================================================ */
+
+static void releaseTargets(xSoftwareBackend* sb) {
+    for (u32 i = 0; i < sb->tiles_x * sb->tiles_y; ++i) {
+        X_DELETE(sb->bins[i].entries);
+    }
+    X_DELETE(sb->bins);
+    X_DELETE(sb->color);
+    X_DELETE(sb->depth);
+    sb->tiles_x = 0;
+    sb->tiles_y = 0;
+}
+
+static bool resizeTargets(xSoftwareBackend* sb, u32 width, u32 height) {
+    releaseTargets(sb);
+
+    sb->width         = width;
+    sb->height        = height;
+    sb->stride        = X_ALIGN_UP(X_MAX(width, 1u), (u32)X_SW_TILE_SIZE);
+    sb->padded_height = X_ALIGN_UP(X_MAX(height, 1u), (u32)X_SW_TILE_SIZE);
+    sb->tiles_x       = sb->stride / X_SW_TILE_SIZE;
+    sb->tiles_y       = sb->padded_height / X_SW_TILE_SIZE;
+
+    const size_t pixels = (size_t)sb->stride * sb->padded_height;
+    sb->color           = X_CALLOC(u32, pixels);
+    sb->depth           = X_MALLOC(f32, pixels);
+    sb->bins            = X_CALLOC(xSwBin, (size_t)sb->tiles_x * sb->tiles_y);
+
+    if (sb->color == NULL || sb->depth == NULL || sb->bins == NULL) {
+        X_PRINT_ERROR("Failed to allocate %ux%u software framebuffer", width, height);
+        releaseTargets(sb);
+        return false;
+    }
+
+    for (size_t i = 0; i < pixels; ++i) {
+        sb->depth[i] = 1.0f;
+    }
+    return true;
+}
+
+static void swBeginFrame(void* user, u32 width, u32 height) {
+    xSoftwareBackend* sb = (xSoftwareBackend*)user;
+    if (width != sb->width || height != sb->height || sb->color == NULL) { resizeTargets(sb, width, height); }
+
+    sb->viewport          = (xRenderViewport) {0, 0, width, height};
+    sb->state             = X_RENDER_STATE_DEFAULT;
+    sb->triangle_count    = 0;
+    sb->clear_count       = 0;
+    sb->invalid_triangles = 0;
+    sb->dropped_triangles = 0;
+}
+
+static void swEndFrame(void* user) {
+    xSoftwareBackend* sb = (xSoftwareBackend*)user;
+    if (sb->color == NULL) { return; }
+
+    xJobsParallelFor(sb->jobs, sb->tiles_x * sb->tiles_y, 1, rasterTileJob, sb);
+    if (sb->invalid_triangles > 0) {
+        X_PRINT_ERROR("Frame %llu: skipped %u triangle(s) indexing past their mesh's vertices",
+                      (unsigned long long)sb->frame,
+                      sb->invalid_triangles);
+    }
+    if (sb->dropped_triangles > 0) {
+        X_PRINT_ERROR("Frame %llu: dropped %u triangle(s), out of memory while binning",
+                      (unsigned long long)sb->frame,
+                      sb->dropped_triangles);
+    }
+
+    if (sb->dump_directory != NULL) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/frame_%05llu.ppm", sb->dump_directory, (unsigned long long)sb->frame);
+        xSoftwareBackendWritePPM(sb, path);
+    }
+    sb->frame++;
+}
+
+static void swClear(void* user, const xRenderClear* clear) {
+    xSoftwareBackend* sb = (xSoftwareBackend*)user;
+    if (sb->color == NULL) { return; }
+
+    if (sb->clear_count == sb->clear_capacity) {
+        const u32 capacity   = X_MAX(sb->clear_capacity * 2, 8u);
+        xRenderClear* clears = X_REALLOC(sb->clears, xRenderClear, capacity);
+        if (clears == NULL) {
+            X_PRINT_ERROR("Out of memory storing a clear; it is skipped");
+            return;
+        }
+        sb->clears         = clears;
+        sb->clear_capacity = capacity;
+    }
+
+    // Like triangles, a clear reaches every tile or none
+    const u32 index   = sb->clear_count;
+    sb->clears[index] = *clear;
+    for (u32 tile = 0; tile < sb->tiles_x * sb->tiles_y; ++tile) {
+        if (binPush(&sb->bins[tile], index | X_SW_BIN_CLEAR_BIT)) { continue; }
+        for (u32 done = 0; done < tile; ++done) {
+            sb->bins[done].count--;
+        }
+        X_PRINT_ERROR("Out of memory binning a clear; it is skipped");
+        return;
+    }
+    sb->clear_count++;
+}
+
+static void swSetViewport(void* user, const xRenderViewport* viewport) {
+    xSoftwareBackend* sb = (xSoftwareBackend*)user;
+    sb->viewport         = *viewport;
+}
+
+static void swSetShader(void* user, u32 shader) {
+    // Shading is flat vertex color; there are no programs to bind
+    X_UNUSED(user);
+    X_UNUSED(shader);
+}
+
+static void swSetMaterial(void* user, u32 material) {
+    X_UNUSED(user);
+    X_UNUSED(material);
+}
+
+static void swSetState(void* user, u32 state) {
+    xSoftwareBackend* sb = (xSoftwareBackend*)user;
+    sb->state            = state;
+}
+
+static void swDraw(void* user, const xRenderDraw* draw) {
+    xSoftwareBackend* sb = (xSoftwareBackend*)user;
+    if (sb->color == NULL || draw->mesh == X_HANDLE_INVALID) { return; }
+
+    const xMesh* mesh = xRendererMeshAt(sb->renderer, draw->mesh);
+    if (mesh->desc.vertices == NULL) {
+        X_DEBUG_PRINT("Skipping draw of mesh without CPU vertex data");
+        return;
+    }
+
+    const xVertex* vertices = mesh->desc.vertices;
+    const u32* indices      = mesh->desc.indices;
+    const u32 vertex_count  = mesh->desc.vertex_count;
+    const u32 limit         = indices != NULL ? mesh->desc.index_count : vertex_count;
+    const u32 first         = X_MIN(draw->first_index, limit);
+    const u32 end           = first + X_MIN(draw->index_count, limit - first);
+
+    for (u32 i = first; i + 3 <= end; i += 3) {
+        const u32 i0 = indices != NULL ? indices[i] : i;
+        const u32 i1 = indices != NULL ? indices[i + 1] : i + 1;
+        const u32 i2 = indices != NULL ? indices[i + 2] : i + 2;
+        if (i0 >= vertex_count || i1 >= vertex_count || i2 >= vertex_count) {
+            sb->invalid_triangles++;
+            continue;
+        }
+        if (!setupTriangle(sb, &vertices[i0], &vertices[i1], &vertices[i2])) {
+            // Later triangles would need the same allocation; count the rest of the draw as lost
+            sb->dropped_triangles += (end - i) / 3;
+            return;
+        }
+    }
+}
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+bool xSoftwareBackendInit(xSoftwareBackend* sb, const xRenderer* renderer, xJobSystem* jobs) {
+    X_ZERO_STRUCT(sb);
+    sb->renderer = renderer;
+    sb->jobs     = jobs;
+    xSoftwareBackendSetKernel(sb, X_SW_KERNEL_BEST);
+
+    sb->backend.user         = sb;
+    sb->backend.begin_frame  = swBeginFrame;
+    sb->backend.end_frame    = swEndFrame;
+    sb->backend.clear        = swClear;
+    sb->backend.set_viewport = swSetViewport;
+    sb->backend.set_shader   = swSetShader;
+    sb->backend.set_material = swSetMaterial;
+    sb->backend.set_state    = swSetState;
+    sb->backend.draw         = swDraw;
+    return true;
+}
+
+void xSoftwareBackendShutdown(xSoftwareBackend* sb) {
+    releaseTargets(sb);
+    X_DELETE(sb->triangles);
+    X_DELETE(sb->clears);
+}
+
+bool xSoftwareBackendWritePPM(const xSoftwareBackend* sb, const char* path) {
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        X_PRINT_ERROR("Failed to open '%s' for writing", path);
+        return false;
+    }
+
+    fprintf(file, "P6\n%u %u\n255\n", sb->width, sb->height);
+    u8* row = X_MALLOC(u8, (size_t)sb->width * 3);
+    X_CHECK_ALLOC(row);
+
+    for (u32 y = 0; y < sb->height; ++y) {
+        for (u32 x = 0; x < sb->width; ++x) {
+            const u32 pixel = xSoftwareBackendPixel(sb, x, y);
+            row[x * 3 + 0]  = X_COLOR_GET_R(pixel);
+            row[x * 3 + 1]  = X_COLOR_GET_G(pixel);
+            row[x * 3 + 2]  = X_COLOR_GET_B(pixel);
+        }
+        fwrite(row, 3, sb->width, file);
+    }
+
+    X_FREE(row);
+    fclose(file);
+    return true;
+}
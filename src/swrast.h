@@ -0,0 +1,118 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "backend.h"
+#include "renderer.h"
+#include "jobs.h"
+
+/* Screen tile size in pixels. Must be a multiple of the widest SIMD kernel (8). */
+#define X_SW_TILE_SIZE 64
+
+/* Bin entries with this bit set refer to a clear rather than a triangle */
+#define X_SW_BIN_CLEAR_BIT 0x80000000u
+
+/* Screen-space triangle after setup: edge equations, depth plane and tile-space bounds */
+typedef struct {
+    f32 edge_a[3];
+    f32 edge_b[3];
+    f32 edge_c[3];
+    f32 z_a;
+    f32 z_b;
+    f32 z_c;
+    s32 min_x;
+    s32 min_y;
+    s32 max_x;
+    s32 max_y;
+    u32 color;
+    u32 state;
+    u32 top_left;
+} xSwTriangle;
+
+typedef enum {
+    X_SW_KERNEL_BEST = 0,
+    X_SW_KERNEL_SCALAR,
+    X_SW_KERNEL_SSE2,
+    X_SW_KERNEL_AVX2,
+} xSwKernel;
+
+typedef struct {
+    u32* entries;
+    u32 count;
+    u32 capacity;
+} xSwBin;
+
+/* Rasterizes every triangle in `tri` that overlaps the pixel span [x0, x1) x [y0, y1) */
+typedef void (*xSwRasterFn)(const xSwTriangle* tri, u32* color, f32* depth, u32 stride, s32 x0, s32 y0, s32 x1,
+                            s32 y1);
+
+/*
+ * CPU rendering backend. Draws are transformed and binned into screen tiles as
+ * they are submitted; at end of frame every tile is rasterized independently,
+ * in parallel, replaying its bin in submission order. The framebuffer is
+ * padded to whole tiles so kernels never need partial-span masks.
+ */
+typedef struct {
+    xRenderBackend backend;
+    const xRenderer* renderer;
+
+    u32 width;
+    u32 height;
+    u32 stride;
+    u32 padded_height;
+    u32* color;
+    f32* depth;
+
+    u32 tiles_x;
+    u32 tiles_y;
+    xSwBin* bins;
+
+    xSwTriangle* triangles;
+    u32 triangle_count;
+    u32 triangle_capacity;
+
+    xRenderClear* clears;
+    u32 clear_count;
+    u32 clear_capacity;
+
+    xRenderViewport viewport;
+    u32 state;
+    xSwRasterFn raster;
+    const char* kernel_name;
+
+    /* Optional: when set, every frame is written to "<dump_directory>/frame_<n>.ppm" */
+    const char* dump_directory;
+    u64 frame;
+
+    /*
+     * Triangles left out of the current frame, reported at its end: ones whose
+     * indices fall outside the mesh's vertices, and ones (plus the rest of their
+     * draw) that could not be stored or binned because an allocation failed.
+     */
+    u32 invalid_triangles;
+    u32 dropped_triangles;
+
+    xJobSystem* jobs;
+} xSoftwareBackend;
+
+/*
+ * Tiles are rasterized on `jobs`; NULL rasterizes everything on the submitting
+ * thread. The submitting thread need not belong to `jobs` (a render thread
+ * injects its tiles and waits for the workers), but then `jobs` needs at least
+ * two threads for the rasterization to leave it.
+ */
+bool xSoftwareBackendInit(xSoftwareBackend* sb, const xRenderer* renderer, xJobSystem* jobs);
+void xSoftwareBackendShutdown(xSoftwareBackend* sb);
+
+/* Select the edge-function kernel. Returns false if the CPU or build does not support it. */
+bool xSoftwareBackendSetKernel(xSoftwareBackend* sb, xSwKernel kernel);
+
+/* Write the visible part of the color buffer as a binary PPM */
+bool xSoftwareBackendWritePPM(const xSoftwareBackend* sb, const char* path);
+
+X_FORCE_INLINE static u32 xSoftwareBackendPixel(const xSoftwareBackend* sb, u32 x, u32 y) {
+    return sb->color[(size_t)y * sb->stride + x];
+}
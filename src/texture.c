@@ -0,0 +1,69 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "texture.h"
+
+u32 xTextureFormatUnitBytes(xTextureFormat format) {
+    switch (format) {
+        case X_TEXTURE_FORMAT_RGBA8:
+        case X_TEXTURE_FORMAT_DEPTH32F:
+            return 4;
+        case X_TEXTURE_FORMAT_R8:
+            return 1;
+        case X_TEXTURE_FORMAT_BC1:
+            return 8;
+        case X_TEXTURE_FORMAT_BC3:
+        case X_TEXTURE_FORMAT_BC7:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+u64 xTextureMipBytes(xTextureFormat format, u32 width, u32 height) {
+    const u64 unit = xTextureFormatUnitBytes(format);
+    if (xTextureFormatIsBlock(format)) { return unit * ((width + 3) / 4) * ((height + 3) / 4); }
+    return unit * width * height;
+}
+
+bool xTextureBlobParse(const void* data, u64 size, xTextureData* out) {
+    X_ZERO_STRUCT(out);
+    const xTextureBlobHeader* header = (const xTextureBlobHeader*)data;
+    if (size < sizeof(xTextureBlobHeader) || header->magic != X_TEXTURE_BLOB_MAGIC ||
+        header->version != X_TEXTURE_BLOB_VERSION) {
+        X_PRINT_ERROR("Not a cooked texture blob");
+        return false;
+    }
+    if (header->format >= X_TEXTURE_FORMAT_COUNT || header->width == 0 || header->height == 0 ||
+        header->mip_count == 0 || header->mip_count > X_TEXTURE_MAX_MIPS) {
+        X_PRINT_ERROR("Cooked texture blob has an invalid header");
+        return false;
+    }
+
+    const xTextureFormat format = (xTextureFormat)header->format;
+    for (u32 i = 0; i < header->mip_count; ++i) {
+        const xTextureBlobMip* mip = &header->mips[i];
+        const u32 expected_width   = X_MAX(header->width >> i, 1u);
+        const u32 expected_height  = X_MAX(header->height >> i, 1u);
+        // Mips sit after the header on X_TEXTURE_BLOB_ALIGN boundaries, wholly inside the blob
+        if (mip->width != expected_width || mip->height != expected_height ||
+            mip->size != xTextureMipBytes(format, mip->width, mip->height) ||
+            mip->offset % X_TEXTURE_BLOB_ALIGN != 0 || mip->offset < sizeof(xTextureBlobHeader) ||
+            mip->offset > size || mip->size > size - mip->offset) {
+            X_PRINT_ERROR("Cooked texture blob mip %u is malformed", i);
+            return false;
+        }
+        out->mips[i]      = (const u8*)data + mip->offset;
+        out->mip_sizes[i] = mip->size;
+    }
+
+    out->desc.width     = header->width;
+    out->desc.height    = header->height;
+    out->desc.layers    = 1;
+    out->desc.mip_count = header->mip_count;
+    out->desc.format    = format;
+    out->desc.srgb      = (header->flags & X_TEXTURE_BLOB_SRGB) != 0;
+    out->flags          = header->flags;
+    return true;
+}
@@ -0,0 +1,92 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+
+typedef enum {
+    X_TEXTURE_FORMAT_RGBA8 = 0,
+    X_TEXTURE_FORMAT_R8,
+    X_TEXTURE_FORMAT_DEPTH32F,
+    X_TEXTURE_FORMAT_BC1,  // RGB, 1-bit alpha; 8 bytes per 4x4 block
+    X_TEXTURE_FORMAT_BC3,  // RGBA with interpolated alpha; 16 bytes per 4x4 block
+    X_TEXTURE_FORMAT_BC7,  // high quality RGBA; 16 bytes per 4x4 block
+    X_TEXTURE_FORMAT_COUNT,
+} xTextureFormat;
+
+typedef struct {
+    u32 width;
+    u32 height;
+    u32 layers;
+    u32 mip_count;
+    xTextureFormat format;
+    bool srgb;
+} xTextureDesc;
+
+X_FORCE_INLINE static bool xTextureFormatIsBlock(xTextureFormat format) {
+    return format == X_TEXTURE_FORMAT_BC1 || format == X_TEXTURE_FORMAT_BC3 || format == X_TEXTURE_FORMAT_BC7;
+}
+
+/* Bytes per pixel, or per 4x4 block for block-compressed formats */
+u32 xTextureFormatUnitBytes(xTextureFormat format);
+
+/* Size of one mip level; block formats round the dimensions up to whole blocks */
+u64 xTextureMipBytes(xTextureFormat format, u32 width, u32 height);
+
+/* ============================================================================
+ * COOKED TEXTURE BLOBS
+ * ============================================================================ */
+
+#define X_TEXTURE_BLOB_MAGIC 0x58455458u  // "XTEX"
+#define X_TEXTURE_BLOB_VERSION 1
+#define X_TEXTURE_MAX_MIPS 16
+
+/* Mip payloads start on this boundary */
+#define X_TEXTURE_BLOB_ALIGN 16
+
+typedef enum {
+    X_TEXTURE_BLOB_PREMULTIPLIED = X_BIT(0),
+    X_TEXTURE_BLOB_SRGB          = X_BIT(1),
+} xTextureBlobFlags;
+
+typedef struct {
+    u32 offset;
+    u32 size;
+    u32 width;
+    u32 height;
+} xTextureBlobMip;
+
+/*
+ * .xtex layout (little endian): this header, then every mip level from the
+ * largest down, each already in its GPU format and aligned to X_TEXTURE_BLOB_ALIGN.
+ */
+typedef struct {
+    u32 magic;
+    u32 version;
+    u32 format;
+    u32 flags;
+    u32 width;
+    u32 height;
+    u32 mip_count;
+    u32 reserved;
+    xTextureBlobMip mips[X_TEXTURE_MAX_MIPS];
+} xTextureBlobHeader;
+
+X_STATIC_ASSERT(sizeof(xTextureBlobHeader) == 288, "xTextureBlobHeader layout is part of the file format");
+
+/* Texture contents ready for upload. Mip pointers alias the source buffer. */
+typedef struct {
+    xTextureDesc desc;
+    u32 flags;
+    const void* mips[X_TEXTURE_MAX_MIPS];
+    u32 mip_sizes[X_TEXTURE_MAX_MIPS];
+} xTextureData;
+
+/*
+ * Validate a cooked blob in place and point `out` at its mip levels. Nothing is
+ * decoded or copied, so `data` (typically an xpak mapping or a streamed buffer)
+ * must outlive `out`.
+ */
+bool xTextureBlobParse(const void* data, u64 size, xTextureData* out);
@@ -0,0 +1,366 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_TRANSFORM
+
+#include "transform.h"
+#include "profiler.h"
+
+/* Row flags */
+#define X_TRANSFORM_LOCAL_DIRTY 0x1    // local transform set since the last update
+#define X_TRANSFORM_WORLD_CHANGED 0x2  // world matrix recomputed by the current update
+
+static xTransformNode* nodeAt(const xTransformHierarchy* hierarchy, u32 slot) {
+    return (xTransformNode*)xPoolAt(&hierarchy->nodes, slot);
+}
+
+static void markDirty(xTransformHierarchy* hierarchy, u32 depth) {
+    if (hierarchy->dirty_min == X_TRANSFORM_NONE || depth < hierarchy->dirty_min) { hierarchy->dirty_min = depth; }
+    hierarchy->dirty_max = X_MAX(hierarchy->dirty_max, depth);
+}
+
+/* ============================================================================
+ * TREE LINKS
+ * ============================================================================ */
+
+static void linkChild(xTransformHierarchy* hierarchy, u32 slot, u32 parent_slot) {
+    xTransformNode* node = nodeAt(hierarchy, slot);
+    node->parent         = parent_slot;
+    node->prev_sibling   = X_TRANSFORM_NONE;
+    node->next_sibling   = X_TRANSFORM_NONE;
+    if (parent_slot == X_TRANSFORM_NONE) { return; }
+
+    xTransformNode* parent = nodeAt(hierarchy, parent_slot);
+    if (parent->first_child != X_TRANSFORM_NONE) { nodeAt(hierarchy, parent->first_child)->prev_sibling = slot; }
+    node->next_sibling  = parent->first_child;
+    parent->first_child = slot;
+}
+
+static void unlinkChild(xTransformHierarchy* hierarchy, u32 slot) {
+    xTransformNode* node = nodeAt(hierarchy, slot);
+    if (node->prev_sibling != X_TRANSFORM_NONE) {
+        nodeAt(hierarchy, node->prev_sibling)->next_sibling = node->next_sibling;
+    } else if (node->parent != X_TRANSFORM_NONE) {
+        nodeAt(hierarchy, node->parent)->first_child = node->next_sibling;
+    }
+    if (node->next_sibling != X_TRANSFORM_NONE) {
+        nodeAt(hierarchy, node->next_sibling)->prev_sibling = node->prev_sibling;
+    }
+    node->parent       = X_TRANSFORM_NONE;
+    node->prev_sibling = X_TRANSFORM_NONE;
+    node->next_sibling = X_TRANSFORM_NONE;
+}
+
+/* ============================================================================
+ * ROWS
+ * ============================================================================ */
+
+/* Bind `slot` to `row` and point its children's parent rows at it. Children between levels have no row. */
+static void placeRow(xTransformHierarchy* hierarchy, u32 slot, u32 row) {
+    xTransformNode* node = nodeAt(hierarchy, slot);
+    node->row            = row;
+    hierarchy->slot[row] = slot;
+    for (u32 child = node->first_child; child != X_TRANSFORM_NONE; child = nodeAt(hierarchy, child)->next_sibling) {
+        const u32 child_row = nodeAt(hierarchy, child)->row;
+        if (child_row != X_TRANSFORM_NONE) { hierarchy->parent[child_row] = row; }
+    }
+}
+
+static void moveRow(xTransformHierarchy* hierarchy, u32 from, u32 to) {
+    hierarchy->local[to]  = hierarchy->local[from];
+    hierarchy->world[to]  = hierarchy->world[from];
+    hierarchy->parent[to] = hierarchy->parent[from];
+    hierarchy->flags[to]  = hierarchy->flags[from];
+    placeRow(hierarchy, hierarchy->slot[from], to);
+}
+
+/*
+ * Open a row at the end of level `depth`. Order within a level is free, so
+ * each deeper level makes room by moving its first row to its end, starting
+ * from the free row past the last level.
+ */
+static u32 openRow(xTransformHierarchy* hierarchy, u32 depth) {
+    while (hierarchy->level_count <= depth) {
+        hierarchy->level_start[++hierarchy->level_count] = hierarchy->count;
+    }
+
+    u32 hole = hierarchy->count++;
+    hierarchy->level_start[hierarchy->level_count]++;
+    for (u32 level = hierarchy->level_count - 1; level > depth; --level) {
+        const u32 first = hierarchy->level_start[level];
+        if (first != hole) { moveRow(hierarchy, first, hole); }
+        hole = first;
+        hierarchy->level_start[level]++;
+    }
+    return hole;
+}
+
+/* Close `row` in level `depth`, the mirror of openRow: each level fills its hole from its own last row */
+static void closeRow(xTransformHierarchy* hierarchy, u32 row, u32 depth) {
+    u32 hole = row;
+    for (u32 level = depth; level < hierarchy->level_count; ++level) {
+        const u32 last = hierarchy->level_start[level + 1] - 1;
+        if (last != hole) { moveRow(hierarchy, last, hole); }
+        hole = last;
+        hierarchy->level_start[level + 1]--;
+    }
+    hierarchy->count--;
+
+    while (hierarchy->level_count > 0 &&
+           hierarchy->level_start[hierarchy->level_count - 1] == hierarchy->level_start[hierarchy->level_count]) {
+        hierarchy->level_count--;
+    }
+}
+
+static u32 parentRow(const xTransformHierarchy* hierarchy, u32 parent_slot) {
+    return parent_slot == X_TRANSFORM_NONE ? X_TRANSFORM_NONE : nodeAt(hierarchy, parent_slot)->row;
+}
+
+/* ============================================================================
+ * HIERARCHY
+ * ============================================================================ */
+
+bool xTransformHierarchyInit(xTransformHierarchy* hierarchy, u32 capacity) {
+    X_ASSERT_MSG(hierarchy != NULL, "hierarchy is NULL");
+    X_ZERO_STRUCT(hierarchy);
+
+    if (!xPoolInit(&hierarchy->nodes, sizeof(xTransformNode), capacity)) {
+        X_PRINT_ERROR("Failed to allocate transform nodes (%u nodes)", capacity);
+        return false;
+    }
+
+    hierarchy->local  = X_MALLOC(xTransformLocal, capacity);
+    hierarchy->world  = X_MALLOC(xMat4, capacity);
+    hierarchy->parent = X_MALLOC(u32, capacity);
+    hierarchy->slot   = X_MALLOC(u32, capacity);
+    hierarchy->flags  = X_MALLOC(u8, capacity);
+
+    // Reparenting walks whole subtrees; sized up front so it can never fail halfway
+    const bool scratch = X_ARRAY_RESERVE(&hierarchy->scratch, capacity);
+    if (hierarchy->local == NULL || hierarchy->world == NULL || hierarchy->parent == NULL || hierarchy->slot == NULL ||
+        hierarchy->flags == NULL || !scratch) {
+        X_PRINT_ERROR("Failed to allocate transform rows (%u nodes)", capacity);
+        xTransformHierarchyShutdown(hierarchy);
+        return false;
+    }
+
+    hierarchy->capacity  = capacity;
+    hierarchy->dirty_min = X_TRANSFORM_NONE;
+    return true;
+}
+
+void xTransformHierarchyShutdown(xTransformHierarchy* hierarchy) {
+    X_DELETE(hierarchy->local);
+    X_DELETE(hierarchy->world);
+    X_DELETE(hierarchy->parent);
+    X_DELETE(hierarchy->slot);
+    X_DELETE(hierarchy->flags);
+    X_ARRAY_FREE(&hierarchy->scratch);
+    xPoolShutdown(&hierarchy->nodes);
+    hierarchy->count    = 0;
+    hierarchy->capacity = 0;
+}
+
+xTransform xTransformCreate(xTransformHierarchy* hierarchy, xTransform parent, const xTransformLocal* local) {
+    u32 parent_slot = X_TRANSFORM_NONE;
+    u32 depth       = 0;
+    if (parent != X_HANDLE_INVALID) {
+        X_ASSERT_MSG(xTransformIsAlive(hierarchy, parent), "Stale or invalid parent transform");
+        parent_slot = X_HANDLE_INDEX(parent);
+        depth       = nodeAt(hierarchy, parent_slot)->depth + 1;
+        if (depth >= X_TRANSFORM_MAX_DEPTH) {
+            X_PRINT_ERROR("Transform hierarchy is limited to %d levels", X_TRANSFORM_MAX_DEPTH);
+            return X_HANDLE_INVALID;
+        }
+    }
+
+    const xTransform handle = xPoolAcquire(&hierarchy->nodes);
+    if (handle == X_HANDLE_INVALID) {
+        X_PRINT_ERROR("Transform hierarchy is full (%u nodes)", hierarchy->capacity);
+        return X_HANDLE_INVALID;
+    }
+
+    const u32 slot       = X_HANDLE_INDEX(handle);
+    xTransformNode* node = nodeAt(hierarchy, slot);
+    node->depth          = depth;
+    node->first_child    = X_TRANSFORM_NONE;
+    linkChild(hierarchy, slot, parent_slot);
+
+    const u32 row          = openRow(hierarchy, depth);
+    hierarchy->local[row]  = *local;
+    hierarchy->parent[row] = parentRow(hierarchy, parent_slot);
+    hierarchy->flags[row]  = X_TRANSFORM_LOCAL_DIRTY;
+    placeRow(hierarchy, slot, row);
+    markDirty(hierarchy, depth);
+    return handle;
+}
+
+static void destroySlot(xTransformHierarchy* hierarchy, u32 slot) {
+    xTransformNode* node = nodeAt(hierarchy, slot);
+    while (node->first_child != X_TRANSFORM_NONE) {
+        destroySlot(hierarchy, node->first_child);
+    }
+
+    unlinkChild(hierarchy, slot);
+    closeRow(hierarchy, node->row, node->depth);
+    xPoolRelease(&hierarchy->nodes, xPoolHandleAt(&hierarchy->nodes, slot));
+}
+
+void xTransformDestroy(xTransformHierarchy* hierarchy, xTransform node) {
+    X_ASSERT_MSG(xTransformIsAlive(hierarchy, node), "Stale or invalid transform");
+    destroySlot(hierarchy, X_HANDLE_INDEX(node));
+}
+
+bool xTransformSetParent(xTransformHierarchy* hierarchy, xTransform node, xTransform parent) {
+    X_ASSERT_MSG(xTransformIsAlive(hierarchy, node), "Stale or invalid transform");
+    const u32 slot        = X_HANDLE_INDEX(node);
+    xTransformNode* moved = nodeAt(hierarchy, slot);
+
+    u32 parent_slot = X_TRANSFORM_NONE;
+    u32 depth       = 0;
+    if (parent != X_HANDLE_INVALID) {
+        X_ASSERT_MSG(xTransformIsAlive(hierarchy, parent), "Stale or invalid parent transform");
+        parent_slot = X_HANDLE_INDEX(parent);
+        for (u32 ancestor = parent_slot; ancestor != X_TRANSFORM_NONE; ancestor = nodeAt(hierarchy, ancestor)->parent) {
+            if (ancestor == slot) {
+                X_PRINT_ERROR("Cannot parent a transform to itself or one of its descendants");
+                return false;
+            }
+        }
+        depth = nodeAt(hierarchy, parent_slot)->depth + 1;
+    }
+    if (parent_slot == moved->parent) { return true; }
+
+    // Gather the subtree breadth first, so every node is visited after its parent
+    xTransformSlotArray* subtree = &hierarchy->scratch;
+    X_ARRAY_CLEAR(subtree);
+    X_ARRAY_PUSH(subtree, slot);
+    u32 deepest = moved->depth;
+    for (u32 i = 0; i < subtree->count; ++i) {
+        const xTransformNode* visited = nodeAt(hierarchy, subtree->items[i]);
+        deepest                       = X_MAX(deepest, visited->depth);
+        u32 child                     = visited->first_child;
+        while (child != X_TRANSFORM_NONE) {
+            X_ARRAY_PUSH(subtree, child);
+            child = nodeAt(hierarchy, child)->next_sibling;
+        }
+    }
+    if (deepest - moved->depth + depth >= X_TRANSFORM_MAX_DEPTH) {
+        X_PRINT_ERROR("Transform hierarchy is limited to %d levels", X_TRANSFORM_MAX_DEPTH);
+        return false;
+    }
+
+    unlinkChild(hierarchy, slot);
+    linkChild(hierarchy, slot, parent_slot);
+
+    if (depth != moved->depth) {
+        // Each node leaves its old level and joins the new one; parents land first, so their rows are final
+        const s32 shift = (s32)depth - (s32)moved->depth;
+        X_ARRAY_FOREACH(u32, visit, subtree) {
+            xTransformNode* visited     = nodeAt(hierarchy, *visit);
+            const u32 old_row           = visited->row;
+            const xTransformLocal local = hierarchy->local[old_row];
+            const u8 flags              = hierarchy->flags[old_row];
+            visited->row                = X_TRANSFORM_NONE;
+            closeRow(hierarchy, old_row, visited->depth);
+
+            visited->depth         = (u32)((s32)visited->depth + shift);
+            const u32 row          = openRow(hierarchy, visited->depth);
+            hierarchy->local[row]  = local;
+            hierarchy->parent[row] = parentRow(hierarchy, visited->parent);
+            hierarchy->flags[row]  = flags;
+            placeRow(hierarchy, *visit, row);
+        }
+    } else {
+        hierarchy->parent[moved->row] = parentRow(hierarchy, parent_slot);
+    }
+
+    // World matrices are stale for the whole subtree, which propagation covers from its root
+    hierarchy->flags[moved->row] |= X_TRANSFORM_LOCAL_DIRTY;
+    markDirty(hierarchy, depth);
+    return true;
+}
+
+void xTransformSetLocal(xTransformHierarchy* hierarchy, xTransform node, const xTransformLocal* local) {
+    const xTransformNode* record  = (const xTransformNode*)xPoolGet(&hierarchy->nodes, node);
+    hierarchy->local[record->row] = *local;
+
+    hierarchy->flags[record->row] |= X_TRANSFORM_LOCAL_DIRTY;
+    markDirty(hierarchy, record->depth);
+}
+
+/* ============================================================================
+ * UPDATE
+ * ============================================================================ */
+
+/* Recompute rows of one level whose local or parent world changed. Returns how many were recomputed. */
+static u32 updateRows(xTransformHierarchy* hierarchy, u32 begin, u32 end, bool read_parent) {
+    const xTransformLocal* local = hierarchy->local;
+    const u32* parents           = hierarchy->parent;
+    xMat4* world                 = hierarchy->world;
+    u8* flags                    = hierarchy->flags;
+
+    u32 updated = 0;
+    for (u32 row = begin; row < end; ++row) {
+        const u32 parent = parents[row];
+        bool changed     = (flags[row] & X_TRANSFORM_LOCAL_DIRTY) != 0;
+        if (read_parent && parent != X_TRANSFORM_NONE) { changed |= (flags[parent] & X_TRANSFORM_WORLD_CHANGED) != 0; }
+        if (!changed) {
+            flags[row] = 0;
+            continue;
+        }
+
+        const xMat4 matrix = xMat4FromTRS(local[row].translation, local[row].rotation, local[row].scale);
+        world[row]         = parent == X_TRANSFORM_NONE ? matrix : xMat4Mul(&world[parent], &matrix);
+        flags[row]         = X_TRANSFORM_WORLD_CHANGED;
+        updated++;
+    }
+    return updated;
+}
+
+typedef struct {
+    xTransformHierarchy* hierarchy;
+    u32 first;
+    bool read_parent;
+    atomic_uint updated;
+} xTransformLevelJob;
+
+static void levelJob(void* data, u32 begin, u32 end) {
+    xTransformLevelJob* job = (xTransformLevelJob*)data;
+    const u32 updated       = updateRows(job->hierarchy, job->first + begin, job->first + end, job->read_parent);
+    atomic_fetch_add_explicit(&job->updated, updated, memory_order_relaxed);
+}
+
+void xTransformUpdate(xTransformHierarchy* hierarchy, xJobSystem* jobs) {
+    X_PROFILE_FUNCTION();
+    X_ZERO_STRUCT(&hierarchy->stats);
+    if (hierarchy->dirty_min == X_TRANSFORM_NONE) { return; }
+
+    for (u32 level = hierarchy->dirty_min; level < hierarchy->level_count; ++level) {
+        const u32 begin = hierarchy->level_start[level];
+        const u32 end   = hierarchy->level_start[level + 1];
+
+        // Levels above the first marked one were skipped, so their change flags are from an older update
+        const bool read_parent = level > hierarchy->dirty_min;
+
+        u32 updated = 0;
+        if (jobs != NULL && end - begin >= X_TRANSFORM_PARALLEL_THRESHOLD) {
+            xTransformLevelJob job = {.hierarchy = hierarchy, .first = begin, .read_parent = read_parent};
+            atomic_init(&job.updated, 0);
+            xJobsParallelFor(jobs, end - begin, X_TRANSFORM_JOB_GRAIN, levelJob, &job);
+            updated = atomic_load_explicit(&job.updated, memory_order_relaxed);
+        } else {
+            updated = updateRows(hierarchy, begin, end, read_parent);
+        }
+
+        hierarchy->stats.levels++;
+        hierarchy->stats.updated += updated;
+
+        // Past the deepest mark, an unchanged level means nothing below it can change either
+        if (updated == 0 && level >= hierarchy->dirty_max) { break; }
+    }
+
+    hierarchy->dirty_min = X_TRANSFORM_NONE;
+    hierarchy->dirty_max = 0;
+}
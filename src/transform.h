@@ -0,0 +1,134 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "containers.h"
+#include "jobs.h"
+#include "pool.h"
+#include "vecmath.h"
+
+/*
+ * Transform hierarchy kept as flat arrays ordered by depth: every level is one
+ * contiguous row range and a parent's row always precedes its children's, so
+ * local-to-world is a single front-to-back pass in which each row reads an
+ * already final parent matrix. Handles resolve to rows through a pool; rows
+ * move when nodes are added, removed or change depth, at a cost of one row
+ * move per level below the change rather than a re-sort.
+ *
+ * Changing a local transform marks its row. An update starts at the shallowest
+ * marked level, recomputes only rows whose own transform or parent's world
+ * matrix changed, and stops at the first level past the deepest mark where
+ * nothing changed. With nothing marked it returns immediately.
+ */
+
+/* Levels are a fixed table; creating or reparenting deeper than this fails */
+#define X_TRANSFORM_MAX_DEPTH 64
+
+/* Levels with at least this many rows are split across the job system */
+#define X_TRANSFORM_PARALLEL_THRESHOLD 8192
+
+/* Rows per job when a level is split */
+#define X_TRANSFORM_JOB_GRAIN 2048
+
+/* Row or slot that does not exist, e.g. the parent of a root */
+#define X_TRANSFORM_NONE UINT32_MAX
+
+typedef xHandle xTransform;
+
+typedef struct {
+    xVec4 translation;
+    xQuat rotation;
+    xVec4 scale;
+} xTransformLocal;
+
+/* Per-handle record, indexed by pool slot. Tree links are slots so they survive row moves. */
+typedef struct {
+    u32 row;
+    u32 depth;
+    u32 parent;
+    u32 first_child;
+    u32 next_sibling;
+    u32 prev_sibling;
+} xTransformNode;
+
+typedef struct {
+    u32 levels;   // levels walked
+    u32 updated;  // world matrices recomputed
+} xTransformStats;
+
+typedef X_ARRAY(u32) xTransformSlotArray;
+
+typedef struct {
+    xPool nodes;  // xTransformNode
+
+    /* Rows, `capacity` of each */
+    xTransformLocal* local;
+    xMat4* world;
+    u32* parent;  // parent row
+    u32* slot;    // owning pool slot
+    u8* flags;
+
+    u32 count;
+    u32 capacity;
+    u32 level_count;                             // one past the deepest non-empty level
+    u32 level_start[X_TRANSFORM_MAX_DEPTH + 1];  // level d is rows [level_start[d], level_start[d + 1])
+
+    u32 dirty_min;  // shallowest level with a marked row, X_TRANSFORM_NONE if clean
+    u32 dirty_max;
+
+    xTransformSlotArray scratch;
+    xTransformStats stats;  // of the last update
+} xTransformHierarchy;
+
+X_FORCE_INLINE static xTransformLocal xTransformLocalIdentity(void) {
+    const xTransformLocal local = {
+      xVec4Make(0.0f, 0.0f, 0.0f, 0.0f),
+      xQuatIdentity(),
+      xVec4Make(1.0f, 1.0f, 1.0f, 0.0f),
+    };
+    return local;
+}
+
+bool xTransformHierarchyInit(xTransformHierarchy* hierarchy, u32 capacity);
+void xTransformHierarchyShutdown(xTransformHierarchy* hierarchy);
+
+/* `parent` may be X_HANDLE_INVALID for a root. Returns X_HANDLE_INVALID when full or too deep. */
+xTransform xTransformCreate(xTransformHierarchy* hierarchy, xTransform parent, const xTransformLocal* local);
+
+/* Destroys the node and its whole subtree */
+void xTransformDestroy(xTransformHierarchy* hierarchy, xTransform node);
+
+/*
+ * Move `node` and its subtree under `parent` (X_HANDLE_INVALID makes it a
+ * root). Only the subtree's rows move, and only if its depth changes. Returns
+ * false, leaving the tree untouched, if `parent` is inside the subtree or the
+ * subtree would end up deeper than X_TRANSFORM_MAX_DEPTH.
+ */
+bool xTransformSetParent(xTransformHierarchy* hierarchy, xTransform node, xTransform parent);
+
+void xTransformSetLocal(xTransformHierarchy* hierarchy, xTransform node, const xTransformLocal* local);
+
+X_FORCE_INLINE static bool xTransformIsAlive(const xTransformHierarchy* hierarchy, xTransform node) {
+    return xPoolIsValid(&hierarchy->nodes, node);
+}
+
+X_FORCE_INLINE static u32 xTransformRow(const xTransformHierarchy* hierarchy, xTransform node) {
+    return ((const xTransformNode*)xPoolGet(&hierarchy->nodes, node))->row;
+}
+
+/* Pointers stay valid until the next create, destroy or reparent */
+X_FORCE_INLINE static const xTransformLocal* xTransformGetLocal(const xTransformHierarchy* hierarchy,
+                                                                 xTransform node) {
+    return &hierarchy->local[xTransformRow(hierarchy, node)];
+}
+
+/* As of the last xTransformUpdate */
+X_FORCE_INLINE static const xMat4* xTransformGetWorld(const xTransformHierarchy* hierarchy, xTransform node) {
+    return &hierarchy->world[xTransformRow(hierarchy, node)];
+}
+
+/* Bring world matrices up to date. Wide levels run on `jobs` when it is not NULL. */
+void xTransformUpdate(xTransformHierarchy* hierarchy, xJobSystem* jobs);
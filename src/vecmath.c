@@ -0,0 +1,431 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#include "vecmath.h"
+
+#include <threads.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #include <immintrin.h>
+    #define X_MATH_HAS_AVX2 1
+#endif
+
+/* ============================================================================
+ * MATRIX CONSTRUCTION
+ * ============================================================================ */
+
+xMat4 xMat4Perspective(f32 fov_y, f32 aspect, f32 z_near, f32 z_far) {
+    const f32 f = 1.0f / tanf(fov_y * 0.5f);
+    xMat4 m;
+    m.cols[0] = xVec4Make(f / aspect, 0.0f, 0.0f, 0.0f);
+    m.cols[1] = xVec4Make(0.0f, f, 0.0f, 0.0f);
+    m.cols[2] = xVec4Make(0.0f, 0.0f, (z_far + z_near) / (z_near - z_far), -1.0f);
+    m.cols[3] = xVec4Make(0.0f, 0.0f, (2.0f * z_far * z_near) / (z_near - z_far), 0.0f);
+    return m;
+}
+
+xMat4 xMat4Orthographic(f32 left, f32 right, f32 bottom, f32 top, f32 z_near, f32 z_far) {
+    xMat4 m   = xMat4Identity();
+    m.cols[0] = xVec4Make(2.0f / (right - left), 0.0f, 0.0f, 0.0f);
+    m.cols[1] = xVec4Make(0.0f, 2.0f / (top - bottom), 0.0f, 0.0f);
+    m.cols[2] = xVec4Make(0.0f, 0.0f, -2.0f / (z_far - z_near), 0.0f);
+    m.cols[3] = xVec4Make(-(right + left) / (right - left),
+                          -(top + bottom) / (top - bottom),
+                          -(z_far + z_near) / (z_far - z_near),
+                          1.0f);
+    return m;
+}
+
+xMat4 xMat4LookAt(xVec4 eye, xVec4 target, xVec4 up) {
+    const xVec4 f = xVec3Normalize(xVec4Sub(target, eye));
+    const xVec4 s = xVec3Normalize(xVec3Cross(f, up));
+    const xVec4 u = xVec3Cross(s, f);
+
+    xMat4 m;
+    m.cols[0] = xVec4Make(s.x, u.x, -f.x, 0.0f);
+    m.cols[1] = xVec4Make(s.y, u.y, -f.y, 0.0f);
+    m.cols[2] = xVec4Make(s.z, u.z, -f.z, 0.0f);
+    m.cols[3] = xVec4Make(-xVec3Dot(s, eye), -xVec3Dot(u, eye), xVec3Dot(f, eye), 1.0f);
+    return m;
+}
+
+bool xMat4Inverse(const xMat4* m, xMat4* out) {
+    // Cofactor expansion over the column-major element array
+    f32 inv[16];
+    const f32 a0 = m->cols[0].v[0], a1 = m->cols[0].v[1], a2 = m->cols[0].v[2], a3 = m->cols[0].v[3];
+    const f32 a4 = m->cols[1].v[0], a5 = m->cols[1].v[1], a6 = m->cols[1].v[2], a7 = m->cols[1].v[3];
+    const f32 a8 = m->cols[2].v[0], a9 = m->cols[2].v[1], a10 = m->cols[2].v[2], a11 = m->cols[2].v[3];
+    const f32 a12 = m->cols[3].v[0], a13 = m->cols[3].v[1], a14 = m->cols[3].v[2], a15 = m->cols[3].v[3];
+
+    inv[0]  = a5 * a10 * a15 - a5 * a11 * a14 - a9 * a6 * a15 + a9 * a7 * a14 + a13 * a6 * a11 - a13 * a7 * a10;
+    inv[4]  = -a4 * a10 * a15 + a4 * a11 * a14 + a8 * a6 * a15 - a8 * a7 * a14 - a12 * a6 * a11 + a12 * a7 * a10;
+    inv[8]  = a4 * a9 * a15 - a4 * a11 * a13 - a8 * a5 * a15 + a8 * a7 * a13 + a12 * a5 * a11 - a12 * a7 * a9;
+    inv[12] = -a4 * a9 * a14 + a4 * a10 * a13 + a8 * a5 * a14 - a8 * a6 * a13 - a12 * a5 * a10 + a12 * a6 * a9;
+    inv[1]  = -a1 * a10 * a15 + a1 * a11 * a14 + a9 * a2 * a15 - a9 * a3 * a14 - a13 * a2 * a11 + a13 * a3 * a10;
+    inv[5]  = a0 * a10 * a15 - a0 * a11 * a14 - a8 * a2 * a15 + a8 * a3 * a14 + a12 * a2 * a11 - a12 * a3 * a10;
+    inv[9]  = -a0 * a9 * a15 + a0 * a11 * a13 + a8 * a1 * a15 - a8 * a3 * a13 - a12 * a1 * a11 + a12 * a3 * a9;
+    inv[13] = a0 * a9 * a14 - a0 * a10 * a13 - a8 * a1 * a14 + a8 * a2 * a13 + a12 * a1 * a10 - a12 * a2 * a9;
+    inv[2]  = a1 * a6 * a15 - a1 * a7 * a14 - a5 * a2 * a15 + a5 * a3 * a14 + a13 * a2 * a7 - a13 * a3 * a6;
+    inv[6]  = -a0 * a6 * a15 + a0 * a7 * a14 + a4 * a2 * a15 - a4 * a3 * a14 - a12 * a2 * a7 + a12 * a3 * a6;
+    inv[10] = a0 * a5 * a15 - a0 * a7 * a13 - a4 * a1 * a15 + a4 * a3 * a13 + a12 * a1 * a7 - a12 * a3 * a5;
+    inv[14] = -a0 * a5 * a14 + a0 * a6 * a13 + a4 * a1 * a14 - a4 * a2 * a13 - a12 * a1 * a6 + a12 * a2 * a5;
+    inv[3]  = -a1 * a6 * a11 + a1 * a7 * a10 + a5 * a2 * a11 - a5 * a3 * a10 - a9 * a2 * a7 + a9 * a3 * a6;
+    inv[7]  = a0 * a6 * a11 - a0 * a7 * a10 - a4 * a2 * a11 + a4 * a3 * a10 + a8 * a2 * a7 - a8 * a3 * a6;
+    inv[11] = -a0 * a5 * a11 + a0 * a7 * a9 + a4 * a1 * a11 - a4 * a3 * a9 - a8 * a1 * a7 + a8 * a3 * a5;
+    inv[15] = a0 * a5 * a10 - a0 * a6 * a9 - a4 * a1 * a10 + a4 * a2 * a9 + a8 * a1 * a6 - a8 * a2 * a5;
+
+    // A zero, denormal or non-finite determinant has no finite reciprocal
+    const f32 det     = a0 * inv[0] + a1 * inv[4] + a2 * inv[8] + a3 * inv[12];
+    const f32 inv_det = 1.0f / det;
+    if (det == 0.0f || !isfinite(inv_det)) { return false; }
+
+    for (u32 c = 0; c < 4; ++c) {
+        out->cols[c] = xVec4Make(inv[c * 4 + 0] * inv_det,
+                                 inv[c * 4 + 1] * inv_det,
+                                 inv[c * 4 + 2] * inv_det,
+                                 inv[c * 4 + 3] * inv_det);
+    }
+    return true;
+}
+
+xMat4 xMat4FromQuat(xQuat q) {
+    const f32 xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    const f32 xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    const f32 wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+
+    xMat4 m;
+    m.cols[0] = xVec4Make(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f);
+    m.cols[1] = xVec4Make(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f);
+    m.cols[2] = xVec4Make(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f);
+    m.cols[3] = xVec4Make(0.0f, 0.0f, 0.0f, 1.0f);
+    return m;
+}
+
+xMat4 xMat4FromTRS(xVec4 translation, xQuat rotation, xVec4 scale) {
+    xMat4 m   = xMat4FromQuat(rotation);
+    m.cols[0] = xVec4Scale(m.cols[0], scale.x);
+    m.cols[1] = xVec4Scale(m.cols[1], scale.y);
+    m.cols[2] = xVec4Scale(m.cols[2], scale.z);
+    m.cols[3] = xVec4Make(translation.x, translation.y, translation.z, 1.0f);
+    return m;
+}
+
+xQuat xQuatSlerp(xQuat a, xQuat b, f32 t) {
+    f32 cos_theta = xVec4Dot(a, b);
+    if (cos_theta < 0.0f) {
+        b         = xVec4Scale(b, -1.0f);
+        cos_theta = -cos_theta;
+    }
+
+    // Nearly parallel: slerp degenerates, nlerp is accurate and cheaper
+    if (cos_theta > 0.9995f) { return xQuatNlerp(a, b, t); }
+
+    const f32 theta = acosf(cos_theta);
+    const f32 inv   = 1.0f / sinf(theta);
+    const f32 wa    = sinf((1.0f - t) * theta) * inv;
+    const f32 wb    = sinf(t * theta) * inv;
+    return xVec4Add(xVec4Scale(a, wa), xVec4Scale(b, wb));
+}
+
+/* ============================================================================
+ * BATCH KERNELS
+ * ============================================================================ */
+
+typedef void (*xTransformPointsFn)(const xMat4*, const f32*, const f32*, const f32*, f32*, f32*, f32*, u32);
+typedef void (*xMulMat4BatchFn)(const xMat4*, u32, const xMat4*, xMat4*, u32);
+
+static void transformPointsScalar(const xMat4* m,
+                                  const f32* xs,
+                                  const f32* ys,
+                                  const f32* zs,
+                                  f32* out_xs,
+                                  f32* out_ys,
+                                  f32* out_zs,
+                                  u32 count) {
+    const f32(*c)[4] = (const f32(*)[4])m->cols;
+    for (u32 i = 0; i < count; ++i) {
+        const f32 x = xs[i], y = ys[i], z = zs[i];
+        out_xs[i]   = c[0][0] * x + c[1][0] * y + c[2][0] * z + c[3][0];
+        out_ys[i]   = c[0][1] * x + c[1][1] * y + c[2][1] * z + c[3][1];
+        out_zs[i]   = c[0][2] * x + c[1][2] * y + c[2][2] * z + c[3][2];
+    }
+}
+
+/*
+ * `a_stride` is 1 when every product has its own left-hand matrix and 0 when a
+ * single parent matrix is broadcast across the batch.
+ */
+static void mulMat4Scalar(const xMat4* a, u32 a_stride, const xMat4* b, xMat4* out, u32 count) {
+    for (u32 i = 0; i < count; ++i) {
+        const xMat4* lhs = &a[i * a_stride];
+        xMat4 r;
+        for (u32 col = 0; col < 4; ++col) {
+            for (u32 row = 0; row < 4; ++row) {
+                r.cols[col].v[row] = lhs->cols[0].v[row] * b[i].cols[col].v[0] +
+                                     lhs->cols[1].v[row] * b[i].cols[col].v[1] +
+                                     lhs->cols[2].v[row] * b[i].cols[col].v[2] +
+                                     lhs->cols[3].v[row] * b[i].cols[col].v[3];
+            }
+        }
+        out[i] = r;
+    }
+}
+
+#if defined(X_MATH_SSE2)
+
+static void transformPointsSse2(const xMat4* m,
+                                const f32* xs,
+                                const f32* ys,
+                                const f32* zs,
+                                f32* out_xs,
+                                f32* out_ys,
+                                f32* out_zs,
+                                u32 count) {
+    __m128 c[4][3];
+    for (u32 col = 0; col < 4; ++col) {
+        for (u32 row = 0; row < 3; ++row) {
+            c[col][row] = _mm_set1_ps(m->cols[col].v[row]);
+        }
+    }
+
+    f32* outs[3] = {out_xs, out_ys, out_zs};
+    u32 i        = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 x = _mm_loadu_ps(xs + i);
+        const __m128 y = _mm_loadu_ps(ys + i);
+        const __m128 z = _mm_loadu_ps(zs + i);
+        for (u32 row = 0; row < 3; ++row) {
+            __m128 r = _mm_add_ps(_mm_mul_ps(c[0][row], x), c[3][row]);
+            r        = _mm_add_ps(r, _mm_mul_ps(c[1][row], y));
+            r        = _mm_add_ps(r, _mm_mul_ps(c[2][row], z));
+            _mm_storeu_ps(outs[row] + i, r);
+        }
+    }
+    transformPointsScalar(m, xs + i, ys + i, zs + i, out_xs + i, out_ys + i, out_zs + i, count - i);
+}
+
+static void mulMat4Sse2(const xMat4* a, u32 a_stride, const xMat4* b, xMat4* out, u32 count) {
+    for (u32 i = 0; i < count; ++i) {
+        out[i] = xMat4Mul(&a[i * a_stride], &b[i]);
+    }
+}
+
+#endif
+
+#if defined(X_MATH_NEON)
+
+static void transformPointsNeon(const xMat4* m,
+                                const f32* xs,
+                                const f32* ys,
+                                const f32* zs,
+                                f32* out_xs,
+                                f32* out_ys,
+                                f32* out_zs,
+                                u32 count) {
+    float32x4_t c[4][3];
+    for (u32 col = 0; col < 4; ++col) {
+        for (u32 row = 0; row < 3; ++row) {
+            c[col][row] = vdupq_n_f32(m->cols[col].v[row]);
+        }
+    }
+
+    f32* outs[3] = {out_xs, out_ys, out_zs};
+    u32 i        = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t x = vld1q_f32(xs + i);
+        const float32x4_t y = vld1q_f32(ys + i);
+        const float32x4_t z = vld1q_f32(zs + i);
+        for (u32 row = 0; row < 3; ++row) {
+            float32x4_t r = vmlaq_f32(c[3][row], c[0][row], x);
+            r             = vmlaq_f32(r, c[1][row], y);
+            r             = vmlaq_f32(r, c[2][row], z);
+            vst1q_f32(outs[row] + i, r);
+        }
+    }
+    transformPointsScalar(m, xs + i, ys + i, zs + i, out_xs + i, out_ys + i, out_zs + i, count - i);
+}
+
+static void mulMat4Neon(const xMat4* a, u32 a_stride, const xMat4* b, xMat4* out, u32 count) {
+    for (u32 i = 0; i < count; ++i) {
+        out[i] = xMat4Mul(&a[i * a_stride], &b[i]);
+    }
+}
+
+#endif
+
+#if defined(X_MATH_HAS_AVX2)
+
+__attribute__((target("avx2,fma"))) static void transformPointsAvx2(const xMat4* m,
+                                                                    const f32* xs,
+                                                                    const f32* ys,
+                                                                    const f32* zs,
+                                                                    f32* out_xs,
+                                                                    f32* out_ys,
+                                                                    f32* out_zs,
+                                                                    u32 count) {
+    __m256 c[4][3];
+    for (u32 col = 0; col < 4; ++col) {
+        for (u32 row = 0; row < 3; ++row) {
+            c[col][row] = _mm256_set1_ps(m->cols[col].v[row]);
+        }
+    }
+
+    u32 i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256 x = _mm256_loadu_ps(xs + i);
+        const __m256 y = _mm256_loadu_ps(ys + i);
+        const __m256 z = _mm256_loadu_ps(zs + i);
+
+        __m256 rx = _mm256_fmadd_ps(c[0][0], x, c[3][0]);
+        __m256 ry = _mm256_fmadd_ps(c[0][1], x, c[3][1]);
+        __m256 rz = _mm256_fmadd_ps(c[0][2], x, c[3][2]);
+        rx        = _mm256_fmadd_ps(c[1][0], y, rx);
+        ry        = _mm256_fmadd_ps(c[1][1], y, ry);
+        rz        = _mm256_fmadd_ps(c[1][2], y, rz);
+        rx        = _mm256_fmadd_ps(c[2][0], z, rx);
+        ry        = _mm256_fmadd_ps(c[2][1], z, ry);
+        rz        = _mm256_fmadd_ps(c[2][2], z, rz);
+
+        _mm256_storeu_ps(out_xs + i, rx);
+        _mm256_storeu_ps(out_ys + i, ry);
+        _mm256_storeu_ps(out_zs + i, rz);
+    }
+    transformPointsScalar(m, xs + i, ys + i, zs + i, out_xs + i, out_ys + i, out_zs + i, count - i);
+}
+
+/* Two result columns per 256-bit register: out[c, c+1] = sum_k lhs.col[k] (x2) * b.col[c, c+1][k] */
+__attribute__((target("avx2,fma"))) static void
+mulMat4Avx2(const xMat4* a, u32 a_stride, const xMat4* b, xMat4* out, u32 count) {
+    for (u32 i = 0; i < count; ++i) {
+        const f32* lhs = a[i * a_stride].cols[0].v;
+        const f32* rhs = b[i].cols[0].v;
+        f32* dst       = out[i].cols[0].v;
+
+        const __m256 l0 = _mm256_broadcast_ps((const __m128*)(lhs + 0));
+        const __m256 l1 = _mm256_broadcast_ps((const __m128*)(lhs + 4));
+        const __m256 l2 = _mm256_broadcast_ps((const __m128*)(lhs + 8));
+        const __m256 l3 = _mm256_broadcast_ps((const __m128*)(lhs + 12));
+
+        for (u32 half = 0; half < 2; ++half) {
+            const f32* r = rhs + half * 8;
+            __m256 acc   = _mm256_mul_ps(l0, _mm256_setr_ps(r[0], r[0], r[0], r[0], r[4], r[4], r[4], r[4]));
+            acc          = _mm256_fmadd_ps(l1, _mm256_setr_ps(r[1], r[1], r[1], r[1], r[5], r[5], r[5], r[5]), acc);
+            acc          = _mm256_fmadd_ps(l2, _mm256_setr_ps(r[2], r[2], r[2], r[2], r[6], r[6], r[6], r[6]), acc);
+            acc          = _mm256_fmadd_ps(l3, _mm256_setr_ps(r[3], r[3], r[3], r[3], r[7], r[7], r[7], r[7]), acc);
+            _mm256_storeu_ps(dst + half * 8, acc);
+        }
+    }
+}
+
+#endif
+
+/* ============================================================================
+ * DISPATCH
+ * ============================================================================ */
+
+static xTransformPointsFn sTransformPoints = transformPointsScalar;
+static xMulMat4BatchFn sMulMat4            = mulMat4Scalar;
+static xMathPath sActivePath               = X_MATH_PATH_SCALAR;
+static once_flag sInitOnce                 = ONCE_FLAG_INIT;
+
+static bool pathSupported(xMathPath path) {
+    switch (path) {
+        case X_MATH_PATH_SCALAR:
+            return true;
+#if defined(X_MATH_SSE2)
+        case X_MATH_PATH_SSE2:
+            return true;
+#endif
+#if defined(X_MATH_HAS_AVX2)
+        case X_MATH_PATH_AVX2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+#if defined(X_MATH_NEON)
+        case X_MATH_PATH_NEON:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+static bool applyPath(xMathPath path) {
+    if (!pathSupported(path)) { return false; }
+
+    switch (path) {
+#if defined(X_MATH_HAS_AVX2)
+        case X_MATH_PATH_AVX2:
+            sTransformPoints = transformPointsAvx2;
+            sMulMat4         = mulMat4Avx2;
+            break;
+#endif
+#if defined(X_MATH_SSE2)
+        case X_MATH_PATH_SSE2:
+            sTransformPoints = transformPointsSse2;
+            sMulMat4         = mulMat4Sse2;
+            break;
+#endif
+#if defined(X_MATH_NEON)
+        case X_MATH_PATH_NEON:
+            sTransformPoints = transformPointsNeon;
+            sMulMat4         = mulMat4Neon;
+            break;
+#endif
+        default:
+            sTransformPoints = transformPointsScalar;
+            sMulMat4         = mulMat4Scalar;
+            break;
+    }
+    sActivePath = path;
+    return true;
+}
+
+static void selectBestPath(void) {
+    const xMathPath preferred[] = {X_MATH_PATH_AVX2, X_MATH_PATH_SSE2, X_MATH_PATH_NEON, X_MATH_PATH_SCALAR};
+    X_FOREACH(const xMathPath, path, preferred) {
+        if (applyPath(*path)) { break; }
+    }
+}
+
+void xMathInit(void) {
+    call_once(&sInitOnce, selectBestPath);
+}
+
+bool xMathForcePath(xMathPath path) {
+    // Detect first so a later first use can't run detection and overwrite the forced path
+    xMathInit();
+    return applyPath(path);
+}
+
+xMathPath xMathActivePath(void) {
+    xMathInit();
+    return sActivePath;
+}
+
+const char* xMathPathName(xMathPath path) {
+    static const char* names[X_MATH_PATH_COUNT] = {"scalar", "sse2", "avx2", "neon"};
+    return path < X_MATH_PATH_COUNT ? names[path] : "unknown";
+}
+
+void xMathTransformPointsSoA(const xMat4* m,
+                             const f32* xs,
+                             const f32* ys,
+                             const f32* zs,
+                             f32* out_xs,
+                             f32* out_ys,
+                             f32* out_zs,
+                             u32 count) {
+    xMathInit();
+    sTransformPoints(m, xs, ys, zs, out_xs, out_ys, out_zs, count);
+}
+
+void xMathMulMat4Batch(const xMat4* a, const xMat4* b, xMat4* out, u32 count) {
+    xMathInit();
+    sMulMat4(a, 1, b, out, count);
+}
+
+void xMathMulMat4Broadcast(const xMat4* parent, const xMat4* locals, xMat4* out, u32 count) {
+    xMathInit();
+    sMulMat4(parent, 0, locals, out, count);
+}
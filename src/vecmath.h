@@ -0,0 +1,355 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+
+#include <math.h>
+
+/*
+ * vecmath.h - SIMD vector, matrix and quaternion math (C11)
+ *
+ * Single-value operations are inline and compiled for the best instruction set
+ * the build targets (SSE2, NEON or scalar). Batch kernels over SoA arrays live
+ * in vecmath.c and are selected at runtime by CPU feature detection.
+ */
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define X_MATH_SSE2 1
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define X_MATH_NEON 1
+    #include <arm_neon.h>
+#endif
+
+/* ============================================================================
+ * TYPES
+ * ============================================================================ */
+
+typedef union {
+    struct {
+        f32 x;
+        f32 y;
+        f32 z;
+        f32 w;
+    };
+    _Alignas(16) f32 v[4];
+#if defined(X_MATH_SSE2)
+    __m128 m;
+#elif defined(X_MATH_NEON)
+    float32x4_t m;
+#endif
+} xVec4;
+
+/* Quaternions share the vec4 layout: (x, y, z) is the vector part, w the scalar part */
+typedef xVec4 xQuat;
+
+/* Column-major 4x4 matrix: cols[c].v[r] is row r of column c, matching GL conventions */
+typedef struct {
+    _Alignas(16) xVec4 cols[4];
+} xMat4;
+
+/* Which batch kernel implementation is active */
+typedef enum {
+    X_MATH_PATH_SCALAR = 0,
+    X_MATH_PATH_SSE2,
+    X_MATH_PATH_AVX2,
+    X_MATH_PATH_NEON,
+    X_MATH_PATH_COUNT,
+} xMathPath;
+
+/* ============================================================================
+ * VEC4
+ * ============================================================================ */
+
+X_FORCE_INLINE static xVec4 xVec4Make(f32 x, f32 y, f32 z, f32 w) {
+    xVec4 r;
+#if defined(X_MATH_SSE2)
+    r.m = _mm_setr_ps(x, y, z, w);
+#else
+    r.x = x;
+    r.y = y;
+    r.z = z;
+    r.w = w;
+#endif
+    return r;
+}
+
+X_FORCE_INLINE static xVec4 xVec4Splat(f32 s) {
+    return xVec4Make(s, s, s, s);
+}
+
+X_FORCE_INLINE static xVec4 xVec4Add(xVec4 a, xVec4 b) {
+    xVec4 r;
+#if defined(X_MATH_SSE2)
+    r.m = _mm_add_ps(a.m, b.m);
+#elif defined(X_MATH_NEON)
+    r.m = vaddq_f32(a.m, b.m);
+#else
+    for (u32 i = 0; i < 4; ++i) r.v[i] = a.v[i] + b.v[i];
+#endif
+    return r;
+}
+
+X_FORCE_INLINE static xVec4 xVec4Sub(xVec4 a, xVec4 b) {
+    xVec4 r;
+#if defined(X_MATH_SSE2)
+    r.m = _mm_sub_ps(a.m, b.m);
+#elif defined(X_MATH_NEON)
+    r.m = vsubq_f32(a.m, b.m);
+#else
+    for (u32 i = 0; i < 4; ++i) r.v[i] = a.v[i] - b.v[i];
+#endif
+    return r;
+}
+
+X_FORCE_INLINE static xVec4 xVec4Mul(xVec4 a, xVec4 b) {
+    xVec4 r;
+#if defined(X_MATH_SSE2)
+    r.m = _mm_mul_ps(a.m, b.m);
+#elif defined(X_MATH_NEON)
+    r.m = vmulq_f32(a.m, b.m);
+#else
+    for (u32 i = 0; i < 4; ++i) r.v[i] = a.v[i] * b.v[i];
+#endif
+    return r;
+}
+
+X_FORCE_INLINE static xVec4 xVec4Scale(xVec4 a, f32 s) {
+    return xVec4Mul(a, xVec4Splat(s));
+}
+
+/* a + b * c */
+X_FORCE_INLINE static xVec4 xVec4MulAdd(xVec4 a, xVec4 b, xVec4 c) {
+#if defined(X_MATH_NEON)
+    xVec4 r;
+    r.m = vmlaq_f32(a.m, b.m, c.m);
+    return r;
+#else
+    return xVec4Add(a, xVec4Mul(b, c));
+#endif
+}
+
+X_FORCE_INLINE static xVec4 xVec4Min(xVec4 a, xVec4 b) {
+    xVec4 r;
+#if defined(X_MATH_SSE2)
+    r.m = _mm_min_ps(a.m, b.m);
+#elif defined(X_MATH_NEON)
+    r.m = vminq_f32(a.m, b.m);
+#else
+    for (u32 i = 0; i < 4; ++i) r.v[i] = X_MIN(a.v[i], b.v[i]);
+#endif
+    return r;
+}
+
+X_FORCE_INLINE static xVec4 xVec4Max(xVec4 a, xVec4 b) {
+    xVec4 r;
+#if defined(X_MATH_SSE2)
+    r.m = _mm_max_ps(a.m, b.m);
+#elif defined(X_MATH_NEON)
+    r.m = vmaxq_f32(a.m, b.m);
+#else
+    for (u32 i = 0; i < 4; ++i) r.v[i] = X_MAX(a.v[i], b.v[i]);
+#endif
+    return r;
+}
+
+X_FORCE_INLINE static xVec4 xVec4Lerp(xVec4 a, xVec4 b, f32 t) {
+    return xVec4MulAdd(a, xVec4Sub(b, a), xVec4Splat(t));
+}
+
+X_FORCE_INLINE static f32 xVec4Dot(xVec4 a, xVec4 b) {
+    const xVec4 p = xVec4Mul(a, b);
+    return (p.x + p.y) + (p.z + p.w);
+}
+
+X_FORCE_INLINE static f32 xVec3Dot(xVec4 a, xVec4 b) {
+    return X_VEC3_DOT(a, b);
+}
+
+X_FORCE_INLINE static xVec4 xVec3Cross(xVec4 a, xVec4 b) {
+#if defined(X_MATH_SSE2)
+    xVec4 r;
+    const __m128 a_yzx = _mm_shuffle_ps(a.m, a.m, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 b_yzx = _mm_shuffle_ps(b.m, b.m, _MM_SHUFFLE(3, 0, 2, 1));
+    const __m128 c     = _mm_sub_ps(_mm_mul_ps(a.m, b_yzx), _mm_mul_ps(a_yzx, b.m));
+    r.m                = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+    return r;
+#else
+    return xVec4Make(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x, 0.0f);
+#endif
+}
+
+X_FORCE_INLINE static f32 xVec3Length(xVec4 a) {
+    return sqrtf(X_VEC3_LENGTH_SQ(a));
+}
+
+X_FORCE_INLINE static xVec4 xVec3Normalize(xVec4 a) {
+    const f32 len_sq = X_VEC3_LENGTH_SQ(a);
+    if (len_sq <= X_EPSILON * X_EPSILON) { return xVec4Make(0.0f, 0.0f, 0.0f, a.w); }
+    const f32 inv = 1.0f / sqrtf(len_sq);
+    return xVec4Make(a.x * inv, a.y * inv, a.z * inv, a.w);
+}
+
+/* ============================================================================
+ * MAT4
+ * ============================================================================ */
+
+X_FORCE_INLINE static xMat4 xMat4Identity(void) {
+    xMat4 m;
+    m.cols[0] = xVec4Make(1.0f, 0.0f, 0.0f, 0.0f);
+    m.cols[1] = xVec4Make(0.0f, 1.0f, 0.0f, 0.0f);
+    m.cols[2] = xVec4Make(0.0f, 0.0f, 1.0f, 0.0f);
+    m.cols[3] = xVec4Make(0.0f, 0.0f, 0.0f, 1.0f);
+    return m;
+}
+
+X_FORCE_INLINE static xVec4 xMat4MulVec4(const xMat4* m, xVec4 v) {
+    xVec4 r = xVec4Mul(m->cols[0], xVec4Splat(v.x));
+    r       = xVec4MulAdd(r, m->cols[1], xVec4Splat(v.y));
+    r       = xVec4MulAdd(r, m->cols[2], xVec4Splat(v.z));
+    r       = xVec4MulAdd(r, m->cols[3], xVec4Splat(v.w));
+    return r;
+}
+
+/* a * b: applies b first, then a */
+X_FORCE_INLINE static xMat4 xMat4Mul(const xMat4* a, const xMat4* b) {
+    xMat4 r;
+    r.cols[0] = xMat4MulVec4(a, b->cols[0]);
+    r.cols[1] = xMat4MulVec4(a, b->cols[1]);
+    r.cols[2] = xMat4MulVec4(a, b->cols[2]);
+    r.cols[3] = xMat4MulVec4(a, b->cols[3]);
+    return r;
+}
+
+X_FORCE_INLINE static xMat4 xMat4Transpose(const xMat4* m) {
+    xMat4 r;
+#if defined(X_MATH_SSE2)
+    __m128 c0 = m->cols[0].m, c1 = m->cols[1].m, c2 = m->cols[2].m, c3 = m->cols[3].m;
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    r.cols[0].m = c0;
+    r.cols[1].m = c1;
+    r.cols[2].m = c2;
+    r.cols[3].m = c3;
+#else
+    for (u32 c = 0; c < 4; ++c) {
+        for (u32 row = 0; row < 4; ++row) {
+            r.cols[c].v[row] = m->cols[row].v[c];
+        }
+    }
+#endif
+    return r;
+}
+
+X_FORCE_INLINE static xMat4 xMat4Translation(f32 x, f32 y, f32 z) {
+    xMat4 m   = xMat4Identity();
+    m.cols[3] = xVec4Make(x, y, z, 1.0f);
+    return m;
+}
+
+X_FORCE_INLINE static xMat4 xMat4Scaling(f32 x, f32 y, f32 z) {
+    xMat4 m     = xMat4Identity();
+    m.cols[0].x = x;
+    m.cols[1].y = y;
+    m.cols[2].z = z;
+    return m;
+}
+
+/* Transform a point (w = 1) and drop w */
+X_FORCE_INLINE static xVec4 xMat4TransformPoint(const xMat4* m, xVec4 p) {
+    xVec4 r = xMat4MulVec4(m, xVec4Make(p.x, p.y, p.z, 1.0f));
+    r.w     = 0.0f;
+    return r;
+}
+
+/* Right-handed perspective projection with GL clip space (z in [-1, 1]) */
+xMat4 xMat4Perspective(f32 fov_y, f32 aspect, f32 z_near, f32 z_far);
+xMat4 xMat4Orthographic(f32 left, f32 right, f32 bottom, f32 top, f32 z_near, f32 z_far);
+xMat4 xMat4LookAt(xVec4 eye, xVec4 target, xVec4 up);
+
+/*
+ * Write the inverse of `m` to `out` and return true, or return false and leave
+ * `out` untouched when `m` is singular or its inverse does not fit in an f32.
+ * There is no epsilon: projections routinely have determinants around 1e-9.
+ */
+bool xMat4Inverse(const xMat4* m, xMat4* out);
+
+/* Compose translation * rotation * scale */
+xMat4 xMat4FromTRS(xVec4 translation, xQuat rotation, xVec4 scale);
+
+/* ============================================================================
+ * QUAT
+ * ============================================================================ */
+
+X_FORCE_INLINE static xQuat xQuatIdentity(void) {
+    return xVec4Make(0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+X_FORCE_INLINE static xQuat xQuatFromAxisAngle(xVec4 axis, f32 radians) {
+    const xVec4 n = xVec3Normalize(axis);
+    const f32 s   = sinf(radians * 0.5f);
+    return xVec4Make(n.x * s, n.y * s, n.z * s, cosf(radians * 0.5f));
+}
+
+/* a * b: rotates by b first, then a */
+X_FORCE_INLINE static xQuat xQuatMul(xQuat a, xQuat b) {
+    return xVec4Make(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                     a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                     a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+                     a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+}
+
+X_FORCE_INLINE static xQuat xQuatNormalize(xQuat q) {
+    const f32 len_sq = xVec4Dot(q, q);
+    if (len_sq <= X_EPSILON * X_EPSILON) { return xQuatIdentity(); }
+    return xVec4Scale(q, 1.0f / sqrtf(len_sq));
+}
+
+X_FORCE_INLINE static xQuat xQuatConjugate(xQuat q) {
+    return xVec4Make(-q.x, -q.y, -q.z, q.w);
+}
+
+/* Rotate a vector: v' = v + 2w(q x v) + 2q x (q x v) */
+X_FORCE_INLINE static xVec4 xQuatRotate(xQuat q, xVec4 v) {
+    const xVec4 t = xVec4Scale(xVec3Cross(q, v), 2.0f);
+    xVec4 r       = xVec4Add(xVec4Add(v, xVec4Scale(t, q.w)), xVec3Cross(q, t));
+    r.w           = v.w;
+    return r;
+}
+
+/* Normalized lerp along the shortest arc */
+X_FORCE_INLINE static xQuat xQuatNlerp(xQuat a, xQuat b, f32 t) {
+    if (xVec4Dot(a, b) < 0.0f) { b = xVec4Scale(b, -1.0f); }
+    return xQuatNormalize(xVec4Lerp(a, b, t));
+}
+
+xQuat xQuatSlerp(xQuat a, xQuat b, f32 t);
+xMat4 xMat4FromQuat(xQuat q);
+
+/* ============================================================================
+ * BATCH KERNELS (runtime dispatched)
+ * ============================================================================ */
+
+/* out = m * (x, y, z, 1) for `count` points held in SoA arrays. Output may alias input. */
+void xMathTransformPointsSoA(const xMat4* m,
+                             const f32* xs,
+                             const f32* ys,
+                             const f32* zs,
+                             f32* out_xs,
+                             f32* out_ys,
+                             f32* out_zs,
+                             u32 count);
+
+/* out[i] = a[i] * b[i] */
+void xMathMulMat4Batch(const xMat4* a, const xMat4* b, xMat4* out, u32 count);
+
+/* out[i] = parent * locals[i] */
+void xMathMulMat4Broadcast(const xMat4* parent, const xMat4* locals, xMat4* out, u32 count);
+
+/* Kernel selection. xMathInit runs automatically on first use; forcing is meant for benchmarks. */
+void xMathInit(void);
+xMathPath xMathActivePath(void);
+bool xMathForcePath(xMathPath path);
+const char* xMathPathName(xMathPath path);
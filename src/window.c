@@ -8,45 +8,140 @@
     #define _CRT_SECURE_NO_WARNINGS 1
 #endif
 
+#define X_MEM_TAG X_MEM_TAG_PLATFORM
+
 #include "window.h"
+#include "profiler.h"
 
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 #include <stdio.h>
 
-static void cleanup(xWindow* window) {
-    X_FREE(window->title);
-    X_FREE(window);
+/* ============================================================================
+ * EVENT CAPTURE
+ * ============================================================================ */
+
+X_STATIC_ASSERT(GLFW_RELEASE == X_INPUT_RELEASE && GLFW_PRESS == X_INPUT_PRESS && GLFW_REPEAT == X_INPUT_REPEAT,
+                "Input actions must match GLFW");
+X_STATIC_ASSERT(GLFW_KEY_LAST < X_INPUT_MAX_KEYS, "Key bitset too small for GLFW key codes");
+X_STATIC_ASSERT(GLFW_MOUSE_BUTTON_LAST < X_INPUT_MAX_MOUSE_BUTTONS, "Mouse bitset too small for GLFW buttons");
+
+static void pushEvent(GLFWwindow* handle, xInputEvent* event) {
+    xWindow* window = (xWindow*)glfwGetWindowUserPointer(handle);
+    event->time     = glfwGetTime();
+    xInputQueuePush(&window->input, event);
+}
+
+static void onKey(GLFWwindow* handle, int key, int scancode, int action, int mods) {
+    xInputEvent event  = {.type = X_INPUT_EVENT_KEY, .action = (u8)action, .mods = (u16)mods};
+    event.key.code     = key;
+    event.key.scancode = scancode;
+    pushEvent(handle, &event);
+}
+
+static void onChar(GLFWwindow* handle, unsigned int codepoint) {
+    xInputEvent event = {.type = X_INPUT_EVENT_CHAR, .codepoint = codepoint};
+    pushEvent(handle, &event);
+}
+
+static void onMouseButton(GLFWwindow* handle, int button, int action, int mods) {
+    xInputEvent event = {.type = X_INPUT_EVENT_MOUSE_BUTTON, .action = (u8)action, .mods = (u16)mods};
+    event.button      = button;
+    pushEvent(handle, &event);
+}
+
+static void onCursorPosition(GLFWwindow* handle, double x, double y) {
+    xInputEvent event = {.type = X_INPUT_EVENT_MOUSE_MOVE};
+    event.position.x  = (f32)x;
+    event.position.y  = (f32)y;
+    pushEvent(handle, &event);
+}
+
+static void onScroll(GLFWwindow* handle, double x, double y) {
+    xInputEvent event = {.type = X_INPUT_EVENT_MOUSE_SCROLL};
+    event.scroll.x    = (f32)x;
+    event.scroll.y    = (f32)y;
+    pushEvent(handle, &event);
+}
+
+static void onResize(GLFWwindow* handle, int width, int height) {
+    xWindow* window = (xWindow*)glfwGetWindowUserPointer(handle);
+    window->width   = (u32)width;
+    window->height  = (u32)height;
+
+    xInputEvent event = {.type = X_INPUT_EVENT_RESIZE};
+    event.size.width  = (u32)width;
+    event.size.height = (u32)height;
+    pushEvent(handle, &event);
+}
+
+static void onClose(GLFWwindow* handle) {
+    xInputEvent event = {.type = X_INPUT_EVENT_CLOSE};
+    pushEvent(handle, &event);
+}
+
+static int swapInterval(xPresentMode mode) {
+    switch (mode) {
+        case X_PRESENT_IMMEDIATE:
+            return 0;
+        case X_PRESENT_ADAPTIVE:
+            return -1;
+        case X_PRESENT_VSYNC:
+        default:
+            return 1;
+    }
+}
+
+/*
+ * Set the swap interval on the current context. A negative interval is only
+ * legal with EXT_swap_control_tear, so adaptive falls back to plain vsync
+ * without it. Returns false when the requested mode could not be honoured.
+ */
+static bool applyPresentMode(xWindow* window, xPresentMode mode) {
+    bool applied = true;
+    if (mode == X_PRESENT_ADAPTIVE && !glfwExtensionSupported("WGL_EXT_swap_control_tear") &&
+        !glfwExtensionSupported("GLX_EXT_swap_control_tear")) {
+        X_LOG_WARN("Adaptive vsync needs EXT_swap_control_tear; falling back to vsync");
+        mode    = X_PRESENT_VSYNC;
+        applied = false;
+    }
+    window->present_mode = mode;
+    glfwSwapInterval(swapInterval(mode));
+    return applied;
+}
+
+/* Copy `title` into the inline buffer; returns false when it had to be truncated */
+static bool copyTitle(xWindow* window, const char* title) {
+    size_t length = 0;
+    while (length < X_WINDOW_TITLE_CAPACITY - 1 && title[length] != '\0') {
+        ++length;
+    }
+    memcpy(window->title, title, length);
+    window->title[length] = '\0';
+    return title[length] == '\0';
 }
 
 xWindow* xWindowCreate(const xWindowInfo* info) {
+    X_PROFILE_FUNCTION();
     X_ASSERT_MSG(info != NULL, "info is NULL");
     X_ASSERT_MSG(info->width > 0, "width <= 0");
     X_ASSERT_MSG(info->height > 0, "height <= 0");
 
-    xWindow* window = X_MALLOC(xWindow, sizeof(xWindow));
+    xWindow* window = X_NEW(xWindow);
     if (window == NULL) {
         X_PRINT_ERROR("Failed to allocate window struct memory\n");
         return NULL;
     }
 
-    const size_t title_len = strlen(info->title);
-    window->title          = X_MALLOC(char, title_len + 1);
-    if (window->title == NULL) {
-        free(window);
-        X_PRINT_ERROR("Failed to allocate window title buffer\n");
-        return NULL;
-    }
-
-    X_STRCPY_SAFE((char*)window->title, title_len, (char*)info->title);
-
+    copyTitle(window, info->title);
     window->width  = info->width;
     window->height = info->height;
+    xInputQueueInit(&window->input);
 
     // Create GLFW window
     if (!glfwInit()) {
-        cleanup(window);
+        X_FREE(window);
         X_PRINT_ERROR("Failed to initialize GLFW3\n");
         return NULL;
     }
@@ -54,21 +149,38 @@ xWindow* xWindowCreate(const xWindowInfo* info) {
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_RESIZABLE, info->resizable ? GLFW_TRUE : GLFW_FALSE);
 #ifdef __APPLE__
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
 
-    window->handle = glfwCreateWindow(info->width, info->height, info->title, NULL, NULL);
+    window->handle = glfwCreateWindow(info->width, info->height, window->title, NULL, NULL);
     if (window->handle == NULL) {
         X_PRINT_ERROR("Failed to create GLFW window\n");
         glfwTerminate();
-        cleanup(window);
+        X_FREE(window);
         return NULL;
     }
 
     glfwMakeContextCurrent(window->handle);
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        X_PRINT_ERROR("Failed to load OpenGL functions\n");
+        glfwDestroyWindow(window->handle);
+        glfwTerminate();
+        X_FREE(window);
+        return NULL;
+    }
+
     glfwSetWindowUserPointer(window->handle, window);
-    glfwSwapInterval(1);  // V-Sync
+    glfwSetKeyCallback(window->handle, onKey);
+    glfwSetCharCallback(window->handle, onChar);
+    glfwSetMouseButtonCallback(window->handle, onMouseButton);
+    glfwSetCursorPosCallback(window->handle, onCursorPosition);
+    glfwSetScrollCallback(window->handle, onScroll);
+    glfwSetWindowSizeCallback(window->handle, onResize);
+    glfwSetWindowCloseCallback(window->handle, onClose);
+    atomic_init(&window->requested_present_mode, -1);
+    applyPresentMode(window, info->present_mode);
 
     return window;
 }
@@ -76,19 +188,18 @@ xWindow* xWindowCreate(const xWindowInfo* info) {
 void xWindowDestroy(xWindow* window) {
     glfwDestroyWindow(window->handle);
     glfwTerminate();
-    cleanup(window);
+    X_FREE(window);
 }
 
 bool xWindowSetTitle(xWindow* window, const char* title) {
-    glfwSetWindowTitle(window->handle, title);
-    X_FREE(window->title);
-    window->title = X_MALLOC(char, strlen(title) + 1);
-    if (window->title == NULL) {
-        X_PRINT_ERROR("Failed to allocate title buffer\n");
-        return false;
+    if (strncmp(window->title, title, X_WINDOW_TITLE_CAPACITY - 1) == 0) {
+        // Same visible title; only one that fills the buffer can have been truncated
+        const size_t length = strlen(window->title);
+        return length < X_WINDOW_TITLE_CAPACITY - 1 || title[length] == '\0';
     }
-    X_STRCPY_SAFE((char*)window->title, strlen(title), title);
-    return true;
+    const bool complete = copyTitle(window, title);
+    glfwSetWindowTitle(window->handle, window->title);
+    return complete;
 }
 
 bool xWindowSetWidth(xWindow* window, u32 width) {
@@ -110,27 +221,27 @@ bool xWindowSetDimensions(xWindow* window, u32 width, u32 height) {
     return true;
 }
 
-bool xWindowSetKeyCallback(const xWindow* window, xWindowKeyCallback callback) {
-    glfwSetKeyCallback(window->handle, callback);
-    return true;
+bool xWindowSetPresentMode(xWindow* window, xPresentMode mode) {
+    if (glfwGetCurrentContext() != window->handle) {
+        // The swap interval belongs to the context; let its owner pick this up at the next present
+        atomic_store(&window->requested_present_mode, (int)mode);
+        return true;
+    }
+    atomic_store(&window->requested_present_mode, -1);
+    return applyPresentMode(window, mode);
 }
 
-bool xWindowSetMouseCallback(const xWindow* window, xWindowMouseCallback callback) {
-    glfwSetMouseButtonCallback(window->handle, callback);
-    return true;
+void xWindowBindContext(xWindow* window) {
+    glfwMakeContextCurrent(window->handle);
 }
 
-bool xWindowSetMouseScrollCallback(const xWindow* window, xWindowMouseScrollCallback callback) {
-    glfwSetScrollCallback(window->handle, callback);
-    return true;
+void xWindowUnbindContext(void) {
+    glfwMakeContextCurrent(NULL);
 }
 
-bool xWindowSetResizeCallback(const xWindow* window, xWindowResizeCallback callback) {
-    glfwSetWindowSizeCallback(window->handle, callback);
-    return true;
+void xWindowPresent(xWindow* window) {
+    X_PROFILE_FUNCTION();
+    const int requested = atomic_exchange(&window->requested_present_mode, -1);
+    if (requested >= 0) { applyPresentMode(window, (xPresentMode)requested); }
+    glfwSwapBuffers(window->handle);
 }
-
-bool xWindowSetCursorPositionCallback(const xWindow* window, xWindowCursorPositionCallback callback) {
-    glfwSetCursorPosCallback(window->handle, callback);
-    return true;
-}
\ No newline at end of file
@@ -5,13 +5,37 @@
 #pragma once
 
 #include "common.h"
+#include "input.h"
+// glad must come first so GLFW does not pull in the system GL header
+#include <glad.h>
 #include <GLFW/glfw3.h>
+#include <stdatomic.h>
 
+/* Title bytes stored inline in xWindow, including the terminator */
+#define X_WINDOW_TITLE_CAPACITY 256
+
+typedef enum {
+    /* Wait for vertical blank (swap interval 1) */
+    X_PRESENT_VSYNC,
+    /* Present immediately, tearing allowed (swap interval 0) */
+    X_PRESENT_IMMEDIATE,
+    /* Vsync, but present late frames immediately where the driver supports it (swap interval -1) */
+    X_PRESENT_ADAPTIVE,
+} xPresentMode;
+
+/*
+ * GLFW callbacks never run user code: every event is pushed onto `input` and
+ * the game drains it once per frame with xInputDrain. `width` and `height` are
+ * updated as resize events arrive.
+ */
 typedef struct {
     u32 width;
     u32 height;
-    const char* title;
+    char title[X_WINDOW_TITLE_CAPACITY];
     GLFWwindow* handle;
+    xPresentMode present_mode;
+    atomic_int requested_present_mode;  // applied by the next xWindowPresent, -1 when none
+    xInputQueue input;
 } xWindow;
 
 typedef struct {
@@ -19,24 +43,37 @@ typedef struct {
     u32 height;
     const char* title;
     bool resizable;
+    xPresentMode present_mode;
 } xWindowInfo;
 
-typedef void (*xWindowKeyCallback)(GLFWwindow* window, int key, int scancode, int action, int mods);
-typedef void (*xWindowMouseCallback)(GLFWwindow* window, int button, int, int);
-typedef void (*xWindowMouseScrollCallback)(GLFWwindow* window, double xoffset, double yoffset);
-typedef void (*xWindowResizeCallback)(GLFWwindow* window, int width, int height);
-typedef void (*xWindowCursorPositionCallback)(GLFWwindow* window, double xpos, double ypos);
-
 xWindow* xWindowCreate(const xWindowInfo* info);
 void xWindowDestroy(xWindow* window);
 
+/*
+ * Copies into the inline title buffer without allocating and skips the OS call
+ * when the title is unchanged, so it is cheap to call every frame. Titles longer
+ * than X_WINDOW_TITLE_CAPACITY - 1 bytes are truncated and return false.
+ */
 bool xWindowSetTitle(xWindow* window, const char* title);
 bool xWindowSetWidth(xWindow* window, u32 width);
 bool xWindowSetHeight(xWindow* window, u32 height);
 bool xWindowSetDimensions(xWindow* window, u32 width, u32 height);
 
-bool xWindowSetKeyCallback(const xWindow* window, xWindowKeyCallback callback);
-bool xWindowSetMouseCallback(const xWindow* window, xWindowMouseCallback callback);
-bool xWindowSetMouseScrollCallback(const xWindow* window, xWindowMouseScrollCallback callback);
-bool xWindowSetResizeCallback(const xWindow* window, xWindowResizeCallback callback);
-bool xWindowSetCursorPositionCallback(const xWindow* window, xWindowCursorPositionCallback callback);
\ No newline at end of file
+/*
+ * Applied immediately on the thread that owns the window's GL context. From
+ * any other thread the mode is queued and applied by the next xWindowPresent.
+ * Adaptive vsync falls back to vsync when the driver lacks
+ * EXT_swap_control_tear; `present_mode` holds the mode actually in effect, and
+ * an immediate call returns false when it differs from `mode`.
+ */
+bool xWindowSetPresentMode(xWindow* window, xPresentMode mode);
+
+/*
+ * xWindowCreate leaves the GL context current on the creating thread. To hand
+ * it to a render thread, unbind it there first, then bind it on the new owner.
+ */
+void xWindowBindContext(xWindow* window);
+void xWindowUnbindContext(void);
+
+/* Swap buffers. Call from the context thread. */
+void xWindowPresent(xWindow* window);
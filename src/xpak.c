@@ -0,0 +1,208 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#define X_MEM_TAG X_MEM_TAG_ASSETS
+
+#include "xpak.h"
+
+#include <lz4.h>
+#include <lz4hc.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* ============================================================================
+ * READING
+ * ============================================================================ */
+
+bool xPakOpen(xPak* pak, const char* path) {
+    X_ZERO_STRUCT(pak);
+    if (!xPlatformMapFile(path, &pak->file)) { return false; }
+
+    const xPakHeader* header = (const xPakHeader*)pak->file.data;
+    const size_t size        = pak->file.size;
+    if (size < sizeof(xPakHeader) || header->magic != X_PAK_MAGIC || header->version != X_PAK_VERSION ||
+        header->file_size != size || header->toc_offset % X_PAK_ALIGN != 0 || header->toc_offset > size ||
+        header->entry_count > (size - header->toc_offset) / sizeof(xPakEntry)) {
+        X_PRINT_ERROR("'%s' is not a valid xpak archive", path);
+        xPlatformUnmapFile(&pak->file);
+        return false;
+    }
+
+    // Bounds-check every blob once here so lookups never have to. Subtraction form so hostile offsets can't wrap.
+    const xPakEntry* entries = (const xPakEntry*)(pak->file.data + header->toc_offset);
+    for (u32 i = 0; i < header->entry_count; ++i) {
+        const xPakEntry* entry = &entries[i];
+        if (entry->offset > size || entry->stored_size > size - entry->offset) {
+            X_PRINT_ERROR("xpak '%s' entry %u lies outside the file", path, i);
+            xPlatformUnmapFile(&pak->file);
+            return false;
+        }
+        // Uncompressed blobs are copied and handed out `size` bytes at a time
+        if (!(entry->flags & X_PAK_ENTRY_LZ4) && entry->size != entry->stored_size) {
+            X_PRINT_ERROR("xpak '%s' entry %u is uncompressed but its sizes differ", path, i);
+            xPlatformUnmapFile(&pak->file);
+            return false;
+        }
+    }
+
+    pak->header      = header;
+    pak->entries     = entries;
+    pak->entry_count = header->entry_count;
+    return true;
+}
+
+void xPakClose(xPak* pak) {
+    xPlatformUnmapFile(&pak->file);
+    pak->header      = NULL;
+    pak->entries     = NULL;
+    pak->entry_count = 0;
+}
+
+const xPakEntry* xPakFind(const xPak* pak, u64 id) {
+    u32 low  = 0;
+    u32 high = pak->entry_count;
+    while (low < high) {
+        const u32 mid = low + (high - low) / 2;
+        if (pak->entries[mid].id < id) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low < pak->entry_count && pak->entries[low].id == id ? &pak->entries[low] : NULL;
+}
+
+bool xPakRead(const xPak* pak, const xPakEntry* entry, void* dst) {
+    const void* stored = xPakStoredData(pak, entry);
+    if (!(entry->flags & X_PAK_ENTRY_LZ4)) {
+        memcpy(dst, stored, entry->size);
+        return true;
+    }
+
+    const int decoded = LZ4_decompress_safe((const char*)stored, (char*)dst, (int)entry->stored_size, (int)entry->size);
+    if (decoded != (int)entry->size) {
+        X_PRINT_ERROR("Corrupt LZ4 block in xpak entry %016llx", (unsigned long long)entry->id);
+        return false;
+    }
+    return true;
+}
+
+const void* xPakLoad(const xPak* pak, const xPakEntry* entry, xArena* arena) {
+    if (!(entry->flags & X_PAK_ENTRY_LZ4)) { return xPakStoredData(pak, entry); }
+
+    void* dst = xArenaAllocAligned(arena, entry->size, X_PAK_ALIGN);
+    if (dst == NULL) { return NULL; }
+    return xPakRead(pak, entry, dst) ? dst : NULL;
+}
+
+/* ============================================================================
+ * WRITING
+ * ============================================================================ */
+
+typedef struct {
+    xPakEntry entry;
+    const void* data;
+    void* compressed;
+} xPakStaging;
+
+static int compareStaging(const void* a, const void* b) {
+    const u64 lhs = ((const xPakStaging*)a)->entry.id;
+    const u64 rhs = ((const xPakStaging*)b)->entry.id;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static bool writePadding(FILE* file, u64* offset, u64 align) {
+    static const u8 kZeros[X_PAK_ALIGN] = {0};
+    const u64 padding                    = X_ALIGN_UP(*offset, align) - *offset;
+    *offset += padding;
+    return padding == 0 || fwrite(kZeros, 1, (size_t)padding, file) == padding;
+}
+
+bool xPakWrite(const char* path, const xPakInput* inputs, u32 count) {
+    xPakStaging* staging = X_CALLOC(xPakStaging, X_MAX(count, 1u));
+    if (staging == NULL) {
+        X_PRINT_ERROR("Failed to allocate xpak staging for %u entries", count);
+        return false;
+    }
+
+    bool ok = true;
+    for (u32 i = 0; i < count && ok; ++i) {
+        const xPakInput* input = &inputs[i];
+        xPakStaging* stage     = &staging[i];
+
+        stage->entry.id          = xHashPath(input->path);
+        stage->entry.size        = input->size;
+        stage->entry.stored_size = input->size;
+        stage->data              = input->data;
+
+        if (!input->compress || input->size == 0) { continue; }
+
+        // Offline packing, so spend the time on HC for a better ratio; decoding speed is the same
+        const int bound   = LZ4_compressBound((int)input->size);
+        stage->compressed = X_MALLOC(u8, (size_t)bound);
+        if (stage->compressed == NULL) {
+            X_PRINT_ERROR("Failed to allocate compression buffer for '%s'", input->path);
+            ok = false;
+            break;
+        }
+
+        const int stored = LZ4_compress_HC(
+          (const char*)input->data, (char*)stage->compressed, (int)input->size, bound, LZ4HC_CLEVEL_DEFAULT);
+        if (stored > 0 && (u32)stored <= input->size - input->size / 8) {
+            stage->entry.stored_size = (u32)stored;
+            stage->entry.flags       = X_PAK_ENTRY_LZ4;
+            stage->data              = stage->compressed;
+        }
+    }
+
+    if (ok) {
+        qsort(staging, count, sizeof(xPakStaging), compareStaging);
+        for (u32 i = 1; i < count; ++i) {
+            if (staging[i].entry.id == staging[i - 1].entry.id) {
+                X_PRINT_ERROR("Duplicate or colliding xpak path id %016llx", (unsigned long long)staging[i].entry.id);
+                ok = false;
+                break;
+            }
+        }
+    }
+
+    // Lay out blobs after the table
+    xPakHeader header = {X_PAK_MAGIC, X_PAK_VERSION, count, 0, X_ALIGN_UP(sizeof(xPakHeader), X_PAK_ALIGN), 0};
+    u64 offset        = X_ALIGN_UP(header.toc_offset + (u64)count * sizeof(xPakEntry), X_PAK_ALIGN);
+    for (u32 i = 0; i < count && ok; ++i) {
+        staging[i].entry.offset = offset;
+        offset                  = X_ALIGN_UP(offset + staging[i].entry.stored_size, X_PAK_ALIGN);
+    }
+    header.file_size = offset;
+
+    FILE* file = ok ? fopen(path, "wb") : NULL;
+    if (ok && file == NULL) {
+        X_PRINT_ERROR("Failed to open '%s' for writing", path);
+        ok = false;
+    }
+
+    if (ok) {
+        u64 written = sizeof(header);
+        ok          = fwrite(&header, sizeof(header), 1, file) == 1 && writePadding(file, &written, X_PAK_ALIGN);
+        for (u32 i = 0; i < count && ok; ++i) {
+            ok = fwrite(&staging[i].entry, sizeof(xPakEntry), 1, file) == 1;
+            written += sizeof(xPakEntry);
+        }
+        ok = ok && writePadding(file, &written, X_PAK_ALIGN);
+        for (u32 i = 0; i < count && ok; ++i) {
+            const u32 stored = staging[i].entry.stored_size;
+            ok               = stored == 0 || fwrite(staging[i].data, 1, stored, file) == stored;
+            written += stored;
+            ok = ok && writePadding(file, &written, X_PAK_ALIGN);
+        }
+        if (!ok) { X_PRINT_ERROR("Failed writing '%s'", path); }
+        if (fclose(file) != 0) { ok = false; }
+    }
+
+    for (u32 i = 0; i < count; ++i) {
+        X_FREE(staging[i].compressed);
+    }
+    X_FREE(staging);
+    return ok;
+}
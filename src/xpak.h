@@ -0,0 +1,91 @@
+// Author: Jake Rieger
+// Created: 10/16/2026.
+//
+
+#pragma once
+
+#include "common.h"
+#include "arena.h"
+#include "hash.h"
+#include "platform.h"
+
+#define X_PAK_MAGIC 0x4B415058u  // "XPAK"
+#define X_PAK_VERSION 1
+
+/* Every blob starts on this boundary so SIMD loads and GPU uploads can read in place */
+#define X_PAK_ALIGN 16
+
+typedef enum {
+    X_PAK_ENTRY_LZ4 = X_BIT(0),
+} xPakEntryFlags;
+
+/*
+ * On-disk layout (little endian):
+ *   xPakHeader
+ *   xPakEntry[entry_count], sorted by id
+ *   blobs, each aligned to X_PAK_ALIGN
+ */
+typedef struct {
+    u32 magic;
+    u32 version;
+    u32 entry_count;
+    u32 flags;
+    u64 toc_offset;
+    u64 file_size;
+} xPakHeader;
+
+typedef struct {
+    u64 id;
+    u64 offset;
+    u32 stored_size;
+    u32 size;
+    u32 flags;
+    u32 reserved;
+} xPakEntry;
+
+X_STATIC_ASSERT(sizeof(xPakHeader) == 32, "xPakHeader layout is part of the file format");
+X_STATIC_ASSERT(sizeof(xPakEntry) == 32, "xPakEntry layout is part of the file format");
+
+/* An open archive; the header, table and uncompressed blobs all point into the mapping */
+typedef struct {
+    xMappedFile file;
+    const xPakHeader* header;
+    const xPakEntry* entries;
+    u32 entry_count;
+} xPak;
+
+bool xPakOpen(xPak* pak, const char* path);
+void xPakClose(xPak* pak);
+
+/* Binary search of the table of contents. Returns NULL if absent. */
+const xPakEntry* xPakFind(const xPak* pak, u64 id);
+
+X_FORCE_INLINE static const xPakEntry* xPakFindPath(const xPak* pak, const char* path) {
+    return xPakFind(pak, xHashPath(path));
+}
+
+/* Bytes as stored in the archive: the asset itself, or its LZ4 block when compressed */
+X_FORCE_INLINE static const void* xPakStoredData(const xPak* pak, const xPakEntry* entry) {
+    return pak->file.data + entry->offset;
+}
+
+/*
+ * Pointer to the asset's bytes. Uncompressed entries are returned straight from
+ * the mapping (no copy, valid until xPakClose); compressed entries are decoded
+ * into `arena`. Returns NULL on corrupt data or when the arena is exhausted.
+ */
+const void* xPakLoad(const xPak* pak, const xPakEntry* entry, xArena* arena);
+
+/* Copy or decode an entry into `dst`, which must hold entry->size bytes */
+bool xPakRead(const xPak* pak, const xPakEntry* entry, void* dst);
+
+/* Input to xPakWrite. Paths are hashed with xHashPath. */
+typedef struct {
+    const char* path;
+    const void* data;
+    u32 size;
+    bool compress;
+} xPakInput;
+
+/* Write an archive. Compression is dropped per entry when it does not save at least 1/8th of the size. */
+bool xPakWrite(const char* path, const xPakInput* inputs, u32 count);